@@ -65,6 +65,10 @@ _geopmwrite()
                         # The user wants info about a control. Complete with the list of controls.
                         COMPREPLY=( $(compgen -W "$(_geopmwrite_controls $cur)" -- "$cur") )
                         ;;
+                -f|--file)
+                        # The user wants to write a request file. Complete with file names.
+                        COMPREPLY=( $(compgen -f -- "$cur") )
+                        ;;
                 *)
                         if [ "$COMP_CWORD" -eq 1 ]
                         then
@@ -385,6 +385,44 @@ def geopm_dbus_xml(TopoService=None, PlatformService=None):
         </doc:description>
       </doc:doc>
     </method>
+    <method name="PlatformReadSignals">
+      <arg direction="in" name="signal_config" type="a(iis)">
+        <doc:doc>
+          <doc:summary>{PlatformReadSignals_params0_description}
+          </doc:summary>
+        </doc:doc>
+      </arg>
+      <arg direction="out" name="samples" type="ad">
+        <doc:doc>
+          <doc:summary>{PlatformReadSignals_returns_description}
+          </doc:summary>
+        </doc:doc>
+      </arg>
+      <doc:doc>
+        <doc:description>
+          <doc:summary>{PlatformReadSignals_short_description}
+          </doc:summary>
+          <doc:para>{PlatformReadSignals_long_description}
+          </doc:para>
+        </doc:description>
+      </doc:doc>
+    </method>
+    <method name="PlatformWriteControls">
+      <arg direction="in" name="control_config" type="a(iisd)">
+        <doc:doc>
+          <doc:summary>{PlatformWriteControls_params0_description}
+          </doc:summary>
+        </doc:doc>
+      </arg>
+      <doc:doc>
+        <doc:description>
+          <doc:summary>{PlatformWriteControls_short_description}
+          </doc:summary>
+          <doc:para>{PlatformWriteControls_long_description}
+          </doc:para>
+        </doc:description>
+      </doc:doc>
+    </method>
     <method name="PlatformRestoreControl">
      <doc:doc>
         <doc:description>
@@ -493,6 +531,8 @@ def geopm_dbus_xml(TopoService=None, PlatformService=None):
         PlatformStopBatch = google.parse(PlatformService.stop_batch.__doc__)
         PlatformReadSignal = google.parse(PlatformService.read_signal.__doc__)
         PlatformWriteControl = google.parse(PlatformService.write_control.__doc__)
+        PlatformReadSignals = google.parse(PlatformService.read_signals.__doc__)
+        PlatformWriteControls = google.parse(PlatformService.write_controls.__doc__)
         PlatformRestoreControl = google.parse(PlatformService.restore_control.__doc__)
         PlatformStartProfile = google.parse(PlatformService.start_profile.__doc__)
         PlatformStopProfile = google.parse(PlatformService.stop_profile.__doc__)
@@ -567,6 +607,13 @@ def geopm_dbus_xml(TopoService=None, PlatformService=None):
             PlatformWriteControl_params3_description=PlatformWriteControl.params[3].description,
             PlatformWriteControl_short_description=PlatformWriteControl.short_description,
             PlatformWriteControl_long_description=PlatformWriteControl.long_description,
+            PlatformReadSignals_params0_description=PlatformReadSignals.params[1].description,
+            PlatformReadSignals_returns_description=PlatformReadSignals.returns.description,
+            PlatformReadSignals_short_description=PlatformReadSignals.short_description,
+            PlatformReadSignals_long_description=PlatformReadSignals.long_description,
+            PlatformWriteControls_params0_description=PlatformWriteControls.params[1].description,
+            PlatformWriteControls_short_description=PlatformWriteControls.short_description,
+            PlatformWriteControls_long_description=PlatformWriteControls.long_description,
             PlatformRestoreControl_short_description=PlatformRestoreControl.short_description,
             PlatformRestoreControl_long_description=PlatformRestoreControl.long_description,
             PlatformStartProfile_params2_description=PlatformStartProfile.params[2].description,
@@ -62,6 +62,22 @@ int geopm_pio_sample(int signal_idx,
 int geopm_pio_adjust(int control_idx,
                      double setting);
 
+int geopm_pio_push_signal_array(int num_request,
+                                const struct geopm_request_s *request,
+                                int *signal_idx);
+
+int geopm_pio_push_control_array(int num_request,
+                                 const struct geopm_request_s *request,
+                                 int *control_idx);
+
+int geopm_pio_sample_array(int num_signal,
+                           const int *signal_idx,
+                           double *result);
+
+int geopm_pio_adjust_array(int num_control,
+                           const int *control_idx,
+                           const double *setting);
+
 int geopm_pio_read_batch(void);
 
 int geopm_pio_write_batch(void);
@@ -385,6 +401,121 @@ def adjust(control_idx, setting):
     if err < 0:
         raise RuntimeError('geopm_pio_adjust() failed: {}'.format(error.message(err)))
 
+def _request_array(config):
+    num_request = len(config)
+    result = gffi.gffi.new(f'struct geopm_request_s[{num_request}]')
+    for idx, req in enumerate(config):
+        result[idx].name = req[0].encode()
+        result[idx].domain = topo.domain_type(req[1])
+        result[idx].domain_idx = req[2]
+    return result
+
+def push_signal_array(signal_config):
+    """Push a list of signals onto the stack of batch access signals.
+
+    Equivalent to calling push_signal() for each request in order, but
+    crosses into the C library only once.
+
+    Args:
+        signal_config (list((str, int or str, int))): List of requested
+            signals where each tuple represents (signal_name,
+            domain_type, domain_idx).
+
+    Returns:
+        list(int): Signal index for each request that can be passed to
+            the sample() or sample_array() functions.
+
+    """
+    global _dl
+    num_signal = len(signal_config)
+    if num_signal == 0:
+        return []
+    request_carr = _request_array(signal_config)
+    signal_idx_carr = gffi.gffi.new(f'int[{num_signal}]')
+    err = _dl.geopm_pio_push_signal_array(num_signal, request_carr, signal_idx_carr)
+    if err < 0:
+        raise RuntimeError('geopm_pio_push_signal_array() failed: {}'.format(error.message(err)))
+    return list(signal_idx_carr)
+
+def push_control_array(control_config):
+    """Push a list of controls onto the stack of batch access controls.
+
+    Equivalent to calling push_control() for each request in order,
+    but crosses into the C library only once.
+
+    Args:
+        control_config (list((str, int or str, int))): List of
+            requested controls where each tuple represents
+            (control_name, domain_type, domain_idx).
+
+    Returns:
+        list(int): Control index for each request that can be passed
+            to the adjust() or adjust_array() functions.
+
+    """
+    global _dl
+    num_control = len(control_config)
+    if num_control == 0:
+        return []
+    request_carr = _request_array(control_config)
+    control_idx_carr = gffi.gffi.new(f'int[{num_control}]')
+    err = _dl.geopm_pio_push_control_array(num_control, request_carr, control_idx_carr)
+    if err < 0:
+        raise RuntimeError('geopm_pio_push_control_array() failed: {}'.format(error.message(err)))
+    return list(control_idx_carr)
+
+def sample_array(signal_idx):
+    """Samples the cached values of several signals.
+
+    Equivalent to calling sample() for each index, but crosses into
+    the C library only once.
+
+    Args:
+        signal_idx (list(int)): Indices returned by previous calls to
+            push_signal() or push_signal_array().
+
+    Returns:
+        list(float): Value of each signal read when read_batch()
+            function was last called.
+
+    """
+    global _dl
+    num_signal = len(signal_idx)
+    if num_signal == 0:
+        return []
+    signal_idx_carr = gffi.gffi.new('int[]', signal_idx)
+    result_carr = gffi.gffi.new(f'double[{num_signal}]')
+    err = _dl.geopm_pio_sample_array(num_signal, signal_idx_carr, result_carr)
+    if err < 0:
+        raise RuntimeError('geopm_pio_sample_array() failed: {}'.format(error.message(err)))
+    return list(result_carr)
+
+def adjust_array(control_idx, setting):
+    """Updates the cached values of several controls.
+
+    Equivalent to calling adjust() for each index, but crosses into
+    the C library only once.
+
+    Args:
+        control_idx (list(int)): Indices returned by previous calls to
+            push_control() or push_control_array().
+
+        setting (list(float)): Value for each control to be set on
+            next call to write_batch().
+
+    """
+    global _dl
+    num_control = len(control_idx)
+    if num_control != len(setting):
+        raise ValueError('adjust_array(): control_idx and setting differ in length')
+    if num_control == 0:
+        return
+    control_idx_carr = gffi.gffi.new('int[]', control_idx)
+    setting_carr = gffi.gffi.new('double[]', setting)
+    err = _dl.geopm_pio_adjust_array(num_control, control_idx_carr, setting_carr)
+    if err < 0:
+        raise RuntimeError('geopm_pio_adjust_array() failed: {}'.format(error.message(err)))
+
 def read_batch():
     """Read all pushed signals from the platform.
 
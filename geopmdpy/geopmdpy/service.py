@@ -733,6 +733,92 @@ class PlatformService(object):
         self._pio.write_control(control_name, domain, domain_idx, setting)
         self._accessed_controls.add(control_name)
 
+    def read_signals(self, client_pid, signal_config):
+        """Read many signals with one request.
+
+        Equivalent to calling read_signal() for each requested signal,
+        but avoids a separate DBus round trip for each value.  The
+        values are returned in the order they were requested.  Each
+        signal that the client does not have permission to read is
+        reported as NaN with a warning, as with read_signal().
+
+        A RuntimeError is raised if any requested signal is not
+        supported, a domain is invalid or a domain index is out of
+        range.
+
+        Args:
+            client_pid (int): Linux PID of the client thread.
+
+            signal_config (list(tuple((int), (int), (str))):
+                domain_type (int): One of the geopmpy.topo.DOMAIN_*
+                                   integers corresponding to a domain
+                                   type to read from.
+
+                domain_idx (int): Specifies the particular domain
+                                  index to read from.
+
+                signal_name (str): The name of the signal to read.
+
+        Returns:
+            (list(float)): The value of each signal in SI units.
+
+        """
+        result = [math.nan] * len(signal_config)
+        if not self._check_client_active(client_pid, 'PlatformReadSignals'):
+            return result
+        signal_avail = self._active_sessions.get_signals(client_pid)
+        for req_idx, (domain, domain_idx, signal_name) in enumerate(signal_config):
+            if not signal_name in signal_avail:
+                sys.stderr.write(f"Warning: <geopm-service>: Requested signal that is not in allowed list: '{signal_name}'\n")
+            else:
+                result[req_idx] = self._pio.read_signal(signal_name, domain, domain_idx)
+                self._accessed_signals.add(signal_name)
+        return result
+
+    def write_controls(self, client_pid, control_config):
+        """Write many control values with one request.
+
+        Equivalent to calling write_control() for each requested
+        control in order, but avoids a separate DBus round trip for
+        each value.  Permission for every control is checked before
+        any value is written.
+
+        A RuntimeError is raised if the client_pid does not have an
+        open session, if the client does not have permission to write
+        any of the controls, or if a different client currently has an
+        open write-mode session.
+
+        A RuntimeError is raised if a requested control is not
+        supported, a domain is invalid or a domain index is out of
+        range.
+
+        Args:
+            client_pid (int): Linux PID of the client thread.
+
+            control_config (list(tuple((int), (int), (str), (float))):
+                domain_type (int): One of the geopmpy.topo.DOMAIN_*
+                                   integers corresponding to a domain
+                                   type to write to.
+
+                domain_idx (int): Specifies the particular domain
+                                  index to write to.
+
+                control_name (str): The name of the control to write.
+
+                setting (float): Value of the control to be written.
+
+        """
+        if not self._check_client_active(client_pid, 'PlatformWriteControls'):
+            return
+        control_avail = self._active_sessions.get_controls(client_pid)
+        for _, _, control_name, _ in control_config:
+            if not control_name in control_avail:
+                raise RuntimeError('Requested control that is not in allowed list: {}'.format(control_name))
+        self._write_mode(client_pid)
+        for domain, domain_idx, control_name, setting in control_config:
+            self._pio.write_control(control_name, domain, domain_idx, setting)
+            self._accessed_controls.add(control_name)
+
     def restore_control(self, client_pid):
         """Restore all controls recorded at the start of a session.
 
@@ -1029,6 +1115,14 @@ class GEOPMService(object):
     def PlatformWriteControl(self, control_name, domain, domain_idx, setting, **call_info):
         self._platform.write_control(self._get_pid(**call_info), control_name, domain, domain_idx, setting)
 
+    @accepts_additional_arguments
+    def PlatformReadSignals(self, signal_config, **call_info):
+        return self._platform.read_signals(self._get_pid(**call_info), signal_config)
+
+    @accepts_additional_arguments
+    def PlatformWriteControls(self, control_config, **call_info):
+        self._platform.write_controls(self._get_pid(**call_info), control_config)
+
     @accepts_additional_arguments
     def PlatformRestoreControl(self, **call_info):
         caller_pid = self._get_pid(**call_info)
@@ -6,6 +6,7 @@
 
 
 import unittest
+from unittest import mock
 import sys
 import time
 from importlib import reload
@@ -57,5 +58,70 @@ class TestPIO(unittest.TestCase):
         except RuntimeError:
             sys.stdout.write('<warning> failed to write CPU frequency\n')
 
+    def test_signal_array(self):
+        # Start from an empty batch so that signals may be pushed
+        pio.reset()
+        pio.save_control()
+        self.assertEqual([], pio.push_signal_array([]))
+        signal_config = [('TIME', topo.DOMAIN_CPU, 0),
+                         ('TIME', 'board', 0)]
+        signal_idx = pio.push_signal_array(signal_config)
+        self.assertEqual(len(signal_config), len(signal_idx))
+        self.assertEqual(signal_idx, [pio.push_signal(*req) for req in signal_config])
+        pio.read_batch()
+        self.assertEqual([], pio.sample_array([]))
+        result = pio.sample_array(signal_idx)
+        self.assertEqual([pio.sample(idx) for idx in signal_idx], result)
+        self.assertLess(0.0, result[0])
+
+        with self.assertRaisesRegex(RuntimeError, 'geopm_pio_sample_array\(\) failed'):
+            pio.sample_array([signal_idx[0], max(signal_idx) + 1])
+        pio.reset()
+        pio.save_control()
+        with self.assertRaisesRegex(RuntimeError, 'geopm_pio_push_signal_array\(\) failed'):
+            pio.push_signal_array([('TIME', 'cpu', 0), ('NOT_A_SIGNAL', 'cpu', 0)])
+
+    def test_control_array_error(self):
+        self.assertEqual([], pio.push_control_array([]))
+        with self.assertRaisesRegex(RuntimeError, 'geopm_pio_push_control_array\(\) failed'):
+            pio.push_control_array([('NOT_A_CONTROL', 'board', 0)])
+        pio.adjust_array([], [])
+        with self.assertRaisesRegex(ValueError, 'differ in length'):
+            pio.adjust_array([0], [1.0, 2.0])
+        with self.assertRaisesRegex(RuntimeError, 'geopm_pio_adjust_array\(\) failed'):
+            pio.adjust_array([1000], [1.0])
+
+    def test_control_array_marshal(self):
+        def push_control_array(num_control, request_carr, control_idx_carr):
+            self.assertEqual(2, num_control)
+            for idx in range(num_control):
+                self.assertEqual(b'CPU_FREQUENCY_MAX_CONTROL', gffi.gffi.string(request_carr[idx].name))
+                self.assertEqual(topo.DOMAIN_PACKAGE, request_carr[idx].domain)
+                self.assertEqual(idx, request_carr[idx].domain_idx)
+                control_idx_carr[idx] = 3 + idx
+            return 0
+
+        def adjust_array(num_control, control_idx_carr, setting_carr):
+            self.assertEqual(2, num_control)
+            self.assertEqual([3, 4], list(control_idx_carr[0:num_control]))
+            self.assertEqual([1.0e9, 2.0e9], list(setting_carr[0:num_control]))
+            return 0
+
+        control_config = [('CPU_FREQUENCY_MAX_CONTROL', 'package', 0),
+                          ('CPU_FREQUENCY_MAX_CONTROL', topo.DOMAIN_PACKAGE, 1)]
+        with mock.patch.object(pio, '_dl') as mock_dl:
+            mock_dl.geopm_pio_push_control_array.side_effect = push_control_array
+            mock_dl.geopm_pio_adjust_array.side_effect = adjust_array
+            control_idx = pio.push_control_array(control_config)
+            self.assertEqual([3, 4], control_idx)
+            pio.adjust_array(control_idx, [1.0e9, 2.0e9])
+            mock_dl.geopm_pio_adjust_array.assert_called_once()
+
+            # Negative return values are raised with the error message
+            mock_dl.geopm_pio_push_control_array.side_effect = None
+            mock_dl.geopm_pio_push_control_array.return_value = -1
+            with self.assertRaisesRegex(RuntimeError, 'geopm_pio_push_control_array\(\) failed'):
+                pio.push_control_array(control_config)
+
 if __name__ == '__main__':
     unittest.main()
@@ -398,6 +398,54 @@ class TestPlatformService(unittest.TestCase):
             self._platform_service.write_control(client_pid, control_name, domain, domain_idx, setting)
             mock_write_control.assert_called_once_with(control_name, domain, domain_idx, setting)
 
+    def test_read_signals(self):
+        session_data = self.open_mock_session('')
+        client_pid = session_data['client_pid']
+
+        signal_config = [(7, 42, 'energy'), (1, 0, 'geopm'), (2, 3, 'frequency')]
+        with mock.patch('geopmdpy.pio.read_signal', side_effect=[1.5, 2.5]) as rs, \
+             mock.patch('sys.stderr.write') as mock_stderr:
+            result = self._platform_service.read_signals(client_pid, signal_config)
+            mock_stderr.assert_called_once_with("Warning: <geopm-service>: Requested signal that is not in allowed list: 'geopm'\n")
+        calls = [mock.call('energy', 7, 42), mock.call('frequency', 2, 3)]
+        rs.assert_has_calls(calls)
+        self.assertEqual(1.5, result[0])
+        self.assertTrue(math.isnan(result[1]))
+        self.assertEqual(2.5, result[2])
+
+    def test_read_signals_invalid(self):
+        with mock.patch('sys.stderr.write') as mock_stderr, \
+             mock.patch('geopmdpy.service.PlatformService._close_session_completely') as mock_close_sess:
+            result = self._platform_service.read_signals('', [(7, 42, 'energy')])
+            mock_stderr.assert_called_with(f"Warning: <geopm-service>: Operation 'PlatformReadSignals' not allowed without an open session. Client PID: \n")
+            mock_close_sess.assert_called_with('')
+        self.assertEqual(1, len(result))
+        self.assertTrue(math.isnan(result[0]))
+
+    def test_write_controls(self):
+        session_data = self.open_mock_session('')
+        client_pid = session_data['client_pid']
+
+        self._mock_write_lock.try_lock.return_value = client_pid
+        control_config = [(7, 42, 'geopm', 777), (7, 43, 'geopm', 888)]
+        with mock.patch('geopmdpy.pio.write_control', return_value=[]) as mock_write_control, \
+             mock.patch('geopmdpy.pio.save_control_dir'), \
+             mock.patch('os.getsid', return_value=client_pid) as mock_getsid:
+            self._platform_service.write_controls(client_pid, control_config)
+            calls = [mock.call('geopm', 7, 42, 777), mock.call('geopm', 7, 43, 888)]
+            mock_write_control.assert_has_calls(calls)
+
+    def test_write_controls_invalid(self):
+        session_data = self.open_mock_session('')
+        client_pid = session_data['client_pid']
+
+        control_config = [(7, 42, 'geopm', 777), (7, 42, 'energy', 1)]
+        err_msg = 'Requested control that is not in allowed list: energy'
+        with mock.patch('geopmdpy.pio.write_control', return_value=[]) as mock_write_control, \
+             self.assertRaisesRegex(RuntimeError, err_msg):
+            self._platform_service.write_controls(client_pid, control_config)
+        mock_write_control.assert_not_called()
+
     def test_restore_already_closed(self):
         client_pid = -999
         self.open_mock_session('user_name', client_pid, True, 2)  # 2
@@ -12,6 +12,7 @@ from collections import OrderedDict
 import os
 import json
 import re
+import struct
 import pandas
 import numpy
 import glob
@@ -22,6 +23,7 @@ import copy
 import yaml
 import io
 import hashlib
+import zlib
 
 from distutils.spawn import find_executable
 from natsort import natsorted
@@ -317,6 +319,64 @@ class IndexTracker(object):
         self._run_outputs = {}
 
 
+class TraceStream(object):
+    """Incremental reader for a trace file that may still be written.
+
+    A trace written with ``GEOPM_TRACE_COMPRESSION`` or
+    ``GEOPM_TRACE_PROFILE_COMPRESSION`` set to ``gzip`` is a sequence
+    of gzip members, one for each time the GEOPM Runtime flushed its
+    buffer.  Each call to ``read()`` returns the text of the members
+    completed since the previous call, so a trace can be followed
+    while the job runs.  An uncompressed trace is returned a complete
+    line at a time in the same way.
+
+    Attributes:
+        path: The path to the trace file to read.
+    """
+    GZIP_MAGIC = b'\x1f\x8b'
+
+    @staticmethod
+    def is_compressed(path):
+        """Return True if the file at path is a gzip compressed trace."""
+        with open(path, 'rb') as fid:
+            return fid.read(len(TraceStream.GZIP_MAGIC)) == TraceStream.GZIP_MAGIC
+
+    def __init__(self, path):
+        self._path = path
+        self._offset = 0
+        self._is_compressed = None
+
+    def read(self):
+        """Return the text appended to the trace since the last call.
+
+        A gzip member or line that is only partly written is left for
+        the next call.
+        """
+        with open(self._path, 'rb') as fid:
+            fid.seek(self._offset)
+            data = fid.read()
+        if self._is_compressed is None:
+            if len(data) < len(self.GZIP_MAGIC):
+                return ''
+            self._is_compressed = data.startswith(self.GZIP_MAGIC)
+        if self._is_compressed:
+            result = []
+            pos = 0
+            while pos < len(data):
+                decomp = zlib.decompressobj(wbits=zlib.MAX_WBITS + 16)
+                text = decomp.decompress(data[pos:])
+                if not decomp.eof:
+                    break
+                result.append(text)
+                pos = len(data) - len(decomp.unused_data)
+            result = b''.join(result)
+        else:
+            pos = data.rfind(b'\n') + 1
+            result = data[:pos]
+        self._offset += pos
+        return result.decode()
+
+
 class Trace(object):
     """Creates a :py:class:`pandas.DataFrame` comprised of the trace file data.
 
@@ -335,6 +395,11 @@ class Trace(object):
     """
     def __init__(self, trace_path, use_agent=True):
         self._path = trace_path
+        # Compressed traces are decompressed once up to the last
+        # complete member
+        self._text = None
+        if TraceStream.is_compressed(trace_path):
+            self._text = TraceStream(trace_path).read()
 
         old_headers = {'time': 'TIME',
                        'epoch_count': 'EPOCH_COUNT',
@@ -368,13 +433,14 @@ class Trace(object):
         # explicitly.  We cannot use '#' as a comment character since
         # it occurs in raw MSR signal names.
         skiprows = 0
-        with open(trace_path) as fid:
+        with self._open_trace() as fid:
             for ll in fid:
                 if ll.startswith('#'):
                     skiprows += 1
                 else:
                     break
-        column_headers = pandas.read_csv(trace_path, sep='|', skiprows=skiprows, nrows=0, encoding='utf-8').columns.tolist()
+        with self._open_trace() as fid:
+            column_headers = pandas.read_csv(fid, sep='|', skiprows=skiprows, nrows=0, encoding='utf-8').columns.tolist()
         original_headers = copy.deepcopy(column_headers)
 
         column_headers = [old_headers.get(ii, ii) for ii in column_headers]
@@ -387,8 +453,9 @@ class Trace(object):
         # You can force them to int64 by setting up a converter function then passing the hex string through it
         # with the read_csv call, but the number will be displayed as an integer from then on.  You'd have to convert
         # it back to a hex string to compare it with the data in the reports.
-        self._df = pandas.read_csv(trace_path, sep='|', skiprows=skiprows, header=0, names=column_headers, encoding='utf-8',
-                                   dtype={'REGION_HASH': 'unicode', 'REGION_HINT': 'unicode'})
+        with self._open_trace() as fid:
+            self._df = pandas.read_csv(fid, sep='|', skiprows=skiprows, header=0, names=column_headers, encoding='utf-8',
+                                       dtype={'REGION_HASH': 'unicode', 'REGION_HINT': 'unicode'})
         self._df.columns = list(map(str.strip, self._df[:0]))  # Strip whitespace from column names
         try:
             self._df['REGION_HASH'] = self._df['REGION_HASH'].astype('unicode').map(str.strip)  # Strip whitespace from region hashes
@@ -439,6 +506,11 @@ class Trace(object):
         """
         return self._df.__getitem__(key)
 
+    def _open_trace(self):
+        if self._text is not None:
+            return io.StringIO(self._text)
+        return open(self._path)
+
     def _parse_header(self, trace_path):
         """Parses the configuration header out of the top of the trace file.
 
@@ -447,7 +519,7 @@ class Trace(object):
         """
         done = False
         out = []
-        with open(trace_path) as fid:
+        with self._open_trace() as fid:
             while not done:
                 ll = fid.readline()
                 if ll.startswith('#'):
@@ -690,6 +762,362 @@ imbalance : {imbalance}
         return [self._path]
 
 
+class BinaryReport(object):
+    """Reader for the binary report format that the GEOPM Runtime writes
+    when ``GEOPM_REPORT_FORMAT`` is ``binary`` or ``both``.
+
+    The measured values of each host are stored as fixed size columns
+    with one entry per region, so they are loaded without parsing
+    text.  See ``BinaryReport.hpp`` in libgeopm for the layout.
+    """
+    MAGIC = b'GEOPMRPT'
+    VERSION = 1
+    REGION_TYPES = ['region', 'unmarked', 'epoch', 'app']
+
+    @staticmethod
+    def is_binary(path):
+        """Return True if the file at path is a binary report."""
+        with open(path, 'rb') as fid:
+            return fid.read(len(BinaryReport.MAGIC)) == BinaryReport.MAGIC
+
+    def __init__(self, path):
+        with open(path, 'rb') as fid:
+            self._buffer = fid.read()
+        if not self._buffer.startswith(self.MAGIC):
+            raise RuntimeError('<geopm> geopmpy.io: Not a binary report: {}'.format(path))
+        offset = len(self.MAGIC)
+        version, num_host = struct.unpack_from('=II', self._buffer, offset)
+        offset += 8
+        if version != self.VERSION:
+            raise RuntimeError('<geopm> geopmpy.io: Unsupported binary report version {}: {}'.format(version, path))
+        host_offset = struct.unpack_from('={}Q'.format(num_host), self._buffer, offset)
+        offset += 8 * num_host
+        self._header, offset = self._read_pairs(offset)
+        self._hosts = [self._read_host(ho) for ho in host_offset]
+
+    def _read_string(self, offset):
+        size, = struct.unpack_from('=I', self._buffer, offset)
+        offset += 4
+        return self._buffer[offset:offset + size].decode(), offset + size
+
+    def _read_pairs(self, offset):
+        num_pair, = struct.unpack_from('=I', self._buffer, offset)
+        offset += 4
+        result = []
+        for _ in range(num_pair):
+            key, offset = self._read_string(offset)
+            value, offset = self._read_string(offset)
+            result.append((key, value))
+        return result, offset
+
+    def _read_host(self, offset):
+        host = {}
+        host['name'], offset = self._read_string(offset)
+        host['agent'], offset = self._read_pairs(offset)
+        num_region, num_column = struct.unpack_from('=II', self._buffer, offset)
+        offset += 8
+        columns = []
+        for _ in range(num_column):
+            name, offset = self._read_string(offset)
+            columns.append(name)
+        host['columns'] = columns
+        host['type'] = numpy.frombuffer(self._buffer, dtype=numpy.uint32,
+                                        count=num_region, offset=offset)
+        offset += 4 * num_region
+        host['hash'] = numpy.frombuffer(self._buffer, dtype=numpy.uint64,
+                                        count=num_region, offset=offset)
+        offset += 8 * num_region
+        names = []
+        for _ in range(num_region):
+            name, offset = self._read_string(offset)
+            names.append(name)
+        host['region'] = names
+        host['values'] = numpy.frombuffer(self._buffer, dtype=numpy.float64,
+                                          count=num_column * num_region,
+                                          offset=offset).reshape(num_column, num_region)
+        offset += 8 * num_column * num_region
+        num_agent_region, = struct.unpack_from('=I', self._buffer, offset)
+        offset += 4
+        agent_region = []
+        for _ in range(num_agent_region):
+            region_idx, = struct.unpack_from('=I', self._buffer, offset)
+            key, offset = self._read_string(offset + 4)
+            value, offset = self._read_string(offset)
+            agent_region.append((region_idx, key, value))
+        host['agent_region'] = agent_region
+        num_overhead, = struct.unpack_from('=I', self._buffer, offset)
+        offset += 4
+        overhead = []
+        for _ in range(num_overhead):
+            key, offset = self._read_string(offset)
+            value, = struct.unpack_from('=d', self._buffer, offset)
+            offset += 8
+            overhead.append((key, value))
+        host['overhead'] = overhead
+        return host
+
+    @staticmethod
+    def _parse_value(value):
+        # Values given as text are typed the way the YAML report
+        # would type them
+        try:
+            return yaml.safe_load(value)
+        except yaml.YAMLError:
+            return value
+
+    def header(self):
+        """Key-value pairs of the report header in order."""
+        return OrderedDict((key, self._parse_value(value))
+                           for key, value in self._header)
+
+    def host_names(self):
+        return [host['name'] for host in self._hosts]
+
+    def get_df(self, region_type=None):
+        """Return a DataFrame with one row for each region of each host.
+
+        Args:
+            region_type (str): If given, one of 'region', 'unmarked',
+                'epoch' or 'app' to select only those rows.
+        """
+        frames = []
+        for host in self._hosts:
+            data = OrderedDict()
+            data['host'] = [host['name']] * len(host['region'])
+            data['type'] = [self.REGION_TYPES[tt] for tt in host['type']]
+            data['region'] = host['region']
+            data['hash'] = host['hash']
+            for name, column in zip(host['columns'], host['values']):
+                data[name] = column
+            frames.append(pandas.DataFrame(data))
+        result = pandas.concat(frames, ignore_index=True) if frames else pandas.DataFrame()
+        if region_type is not None:
+            result = result[result['type'] == region_type].reset_index(drop=True)
+        return result
+
+    def raw_report(self):
+        """Return the report as the dictionary that loading the
+        equivalent YAML report would give.
+        """
+        section_name = {1: 'Unmarked Totals',
+                        2: 'Epoch Totals',
+                        3: 'Application Totals'}
+        result = self.header()
+        hosts = OrderedDict()
+        for host in self._hosts:
+            host_data = OrderedDict((key, self._parse_value(value))
+                                    for key, value in host['agent'])
+            agent_region = {}
+            for region_idx, key, value in host['agent_region']:
+                agent_region.setdefault(region_idx, []).append((key, self._parse_value(value)))
+            regions = []
+            sections = OrderedDict()
+            for region_idx, region_type in enumerate(host['type']):
+                region_data = OrderedDict()
+                if region_type == 0:
+                    region_data['region'] = host['region'][region_idx]
+                    region_data['hash'] = int(host['hash'][region_idx])
+                for name, column in zip(host['columns'], host['values']):
+                    value = float(column[region_idx])
+                    if not numpy.isnan(value):
+                        region_data[name] = value
+                region_data.update(agent_region.get(region_idx, []))
+                if region_type == 0:
+                    regions.append(region_data)
+                else:
+                    if region_type == 3:
+                        region_data.update(host['overhead'])
+                    sections[section_name[int(region_type)]] = region_data
+            if regions:
+                host_data['Regions'] = regions
+            host_data.update(sections)
+            hosts[host['name']] = host_data
+        result['Hosts'] = hosts
+        return result
+
+
+class BinaryProfileTrace(object):
+    """Reader for the binary profile trace that the GEOPM Runtime writes
+    when ``GEOPM_TRACE_PROFILE_FORMAT`` is ``binary``.
+
+    Records are stored in blocks with the time range of each block
+    kept in an index at the end of the file, so a time range is loaded
+    without reading the rest of the file.  A file that is still being
+    written has no index and its complete blocks are read in order.
+    See ``BinaryProfileTrace.hpp`` in libgeopm for the layout.
+    """
+    MAGIC = b'GEOPMPTR'
+    INDEX_MAGIC = b'GEOPMPTI'
+    END_MAGIC = b'GEOPMPTE'
+    VERSION = 1
+    BLOCK_HEADER = struct.Struct('=IIqqdd')
+    RECORD_DTYPE = numpy.dtype([('sec', 'i8'), ('nsec', 'i8'), ('process', 'i4'),
+                                ('event', 'i4'), ('signal', 'u8')])
+    SHORT_DTYPE = numpy.dtype([('hash', 'u8'), ('num_complete', 'i4'),
+                               ('zero', 'u4'), ('total_time', 'f8')])
+    EVENT_NAMES = {0: 'REGION_ENTRY',
+                   1: 'REGION_EXIT',
+                   2: 'EPOCH_COUNT',
+                   3: 'EVENT_SHORT_REGION',
+                   9: 'EVENT_AFFINITY',
+                   10: 'EVENT_START_PROFILE',
+                   11: 'EVENT_STOP_PROFILE',
+                   12: 'EVENT_OVERHEAD'}
+    EVENT_SHORT_REGION = 3
+    EVENT_OVERHEAD = 12
+
+    @staticmethod
+    def is_binary(path):
+        """Return True if the file at path is a binary profile trace."""
+        with open(path, 'rb') as fid:
+            return fid.read(len(BinaryProfileTrace.MAGIC)) == BinaryProfileTrace.MAGIC
+
+    def __init__(self, path):
+        self._path = path
+        with open(path, 'rb') as fid:
+            self._buffer = fid.read()
+        if not self._buffer.startswith(self.MAGIC):
+            raise RuntimeError('<geopm> geopmpy.io: Not a binary profile trace: {}'.format(path))
+        offset = len(self.MAGIC)
+        version, self._block_size, num_pair = struct.unpack_from('=III', self._buffer, offset)
+        offset += 12
+        if version != self.VERSION:
+            raise RuntimeError('<geopm> geopmpy.io: Unsupported binary profile trace version {}: {}'.format(version, path))
+        self._header = []
+        for _ in range(num_pair):
+            key, offset = self._read_string(offset)
+            value, offset = self._read_string(offset)
+            self._header.append((key, value))
+        self._data_offset = offset
+        self._index = self._read_index()
+
+    def _read_string(self, offset):
+        size, = struct.unpack_from('=I', self._buffer, offset)
+        offset += 4
+        return self._buffer[offset:offset + size].decode(), offset + size
+
+    def _read_index(self):
+        # Returns a list of (offset, begin_time, end_time) or None if
+        # the file was not closed.
+        end_size = 8 + len(self.END_MAGIC)
+        if len(self._buffer) < self._data_offset + end_size or \
+           not self._buffer.endswith(self.END_MAGIC):
+            return None
+        index_offset, = struct.unpack_from('=Q', self._buffer, len(self._buffer) - end_size)
+        if self._buffer[index_offset:index_offset + len(self.INDEX_MAGIC)] != self.INDEX_MAGIC:
+            return None
+        num_block, = struct.unpack_from('=Q', self._buffer, index_offset + 8)
+        return [struct.unpack_from('=Qdd', self._buffer, index_offset + 16 + 24 * idx)
+                for idx in range(num_block)]
+
+    def _walk_blocks(self):
+        result = []
+        offset = self._data_offset
+        while offset + self.BLOCK_HEADER.size <= len(self._buffer) and \
+              self._buffer[offset:offset + len(self.INDEX_MAGIC)] != self.INDEX_MAGIC:
+            num_record, num_short, _, _, begin, end = self.BLOCK_HEADER.unpack_from(self._buffer, offset)
+            size = (self.BLOCK_HEADER.size + num_record * self.RECORD_DTYPE.itemsize +
+                    num_short * self.SHORT_DTYPE.itemsize)
+            if offset + size > len(self._buffer):
+                # Block is still being written
+                break
+            result.append((offset, begin, end))
+            offset += size
+        return result
+
+    def header(self):
+        """Key-value pairs of the trace header in order."""
+        return OrderedDict(self._header)
+
+    def get_df(self, begin_time=None, end_time=None):
+        """Return a DataFrame with one row for each record.
+
+        The columns match the CSV profile trace: TIME in seconds since
+        the start of the application, PROCESS, EVENT as a name, and
+        SIGNAL as an integer.  The SIGNAL of an EVENT_SHORT_REGION row
+        is the region hash, and the NUM_COMPLETE and TOTAL_TIME columns
+        describe the short region; they are NaN for other rows.
+
+        Args:
+            begin_time (float): If given, only records at or after this
+                time are returned.
+            end_time (float): If given, only records at or before this
+                time are returned.
+        """
+        blocks = self._index if self._index is not None else self._walk_blocks()
+        frames = []
+        for offset, block_begin, block_end in blocks:
+            if begin_time is not None and block_end < begin_time:
+                continue
+            if end_time is not None and block_begin > end_time:
+                continue
+            frames.append(self._read_block(offset))
+        if frames:
+            result = pandas.concat(frames, ignore_index=True)
+        else:
+            result = self._make_df(numpy.zeros(0, dtype=self.RECORD_DTYPE),
+                                   numpy.zeros(0, dtype=self.SHORT_DTYPE), (0, 0))
+        if begin_time is not None:
+            result = result[result['TIME'] >= begin_time]
+        if end_time is not None:
+            result = result[result['TIME'] <= end_time]
+        return result.reset_index(drop=True)
+
+    def _read_block(self, offset):
+        num_record, num_short, tz_sec, tz_nsec, _, _ = self.BLOCK_HEADER.unpack_from(self._buffer, offset)
+        offset += self.BLOCK_HEADER.size
+        records = numpy.frombuffer(self._buffer, dtype=self.RECORD_DTYPE,
+                                   count=num_record, offset=offset)
+        offset += num_record * self.RECORD_DTYPE.itemsize
+        short = numpy.frombuffer(self._buffer, dtype=self.SHORT_DTYPE,
+                                 count=num_short, offset=offset)
+        return self._make_df(records, short, (tz_sec, tz_nsec))
+
+    def _make_df(self, records, short, time_zero):
+        time = ((records['sec'] - time_zero[0]) +
+                (records['nsec'] - time_zero[1]) * 1e-9)
+        signal = records['signal'].copy()
+        num_complete = numpy.full(len(records), numpy.nan)
+        total_time = numpy.full(len(records), numpy.nan)
+        is_short = records['event'] == self.EVENT_SHORT_REGION
+        signal[is_short] = short['hash']
+        num_complete[is_short] = short['num_complete']
+        total_time[is_short] = short['total_time']
+        return pandas.DataFrame(OrderedDict([
+            ('TIME', time),
+            ('PROCESS', records['process']),
+            ('EVENT', [self.EVENT_NAMES.get(int(ee), 'INVALID') for ee in records['event']]),
+            ('SIGNAL', signal),
+            ('NUM_COMPLETE', num_complete),
+            ('TOTAL_TIME', total_time)]))
+
+    @classmethod
+    def _format_signal(cls, event, signal):
+        # Same formatting as ProfileTracerImp::event_format()
+        if event in ('EPOCH_COUNT', 'EVENT_AFFINITY'):
+            return str(int(signal))
+        if event == 'EVENT_OVERHEAD':
+            value, = struct.unpack('=d', struct.pack('=Q', int(signal)))
+            return '{:.16g}'.format(value)
+        return '0x{:08x}'.format(int(signal))
+
+    def to_csv(self, path):
+        """Convert the trace to the CSV profile trace format.
+
+        Args:
+            path (str): Path of the CSV file to write.
+        """
+        df = self.get_df()
+        with open(path, 'w') as fid:
+            for key, value in self._header:
+                fid.write('# {}: {}\n'.format(key, value))
+            fid.write('TIME|PROCESS|EVENT|SIGNAL\n')
+            for time, process, event, signal in zip(df['TIME'], df['PROCESS'],
+                                                    df['EVENT'], df['SIGNAL']):
+                fid.write('{:.16g}|{}|{}|{}\n'.format(time, process, event,
+                                                     self._format_signal(event, signal)))
+
+
 class RawReport(object):
     def __init__(self, path):
         # Fix issue with python yaml module where it is confused
@@ -706,8 +1134,11 @@ class RawReport(object):
                            |[-+]?\.(?:inf|Inf|INF)
                            |\.(?:nan|NaN|NAN))$''', re.X),
             list(u'-+0123456789.'))
-        with open(path) as fid:
-            self._raw_dict = yaml.safe_load(fid)
+        if BinaryReport.is_binary(path):
+            self._raw_dict = BinaryReport(path).raw_report()
+        else:
+            with open(path) as fid:
+                self._raw_dict = yaml.safe_load(fid)
 
     def raw_report(self):
         return copy.deepcopy(self._raw_dict)
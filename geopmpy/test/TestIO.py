@@ -9,8 +9,11 @@ import unittest
 import os
 import tempfile
 import shutil
+import struct
+import gzip
+import numpy
 from unittest import mock
-from collections import Counter
+from collections import Counter, OrderedDict
 from contextlib import contextmanager
 
 import geopmpy.io
@@ -1153,6 +1156,114 @@ TIME|EPOCH_COUNT|REGION_HASH|REGION_HINT|REGION_PROGRESS|REGION_COUNT|REGION_RUN
 """
 
 
+def write_binary_report(path, header, hosts):
+    """Write a report in the binary format produced by the GEOPM
+    Runtime when GEOPM_REPORT_FORMAT is binary.  Each host is a dict
+    with keys 'name', 'agent', 'columns', 'regions' and 'overhead'.
+    Each region is a tuple of (type, hash, name, values, agent).
+    """
+    def pack_string(value):
+        value = value.encode()
+        return struct.pack('=I', len(value)) + value
+
+    def pack_pairs(pairs):
+        return struct.pack('=I', len(pairs)) + b''.join(
+            pack_string(kk) + pack_string(vv) for kk, vv in pairs)
+
+    blocks = []
+    for host in hosts:
+        regions = host['regions']
+        block = pack_string(host['name']) + pack_pairs(host['agent'])
+        block += struct.pack('=II', len(regions), len(host['columns']))
+        block += b''.join(pack_string(cc) for cc in host['columns'])
+        block += b''.join(struct.pack('=I', rr[0]) for rr in regions)
+        block += b''.join(struct.pack('=Q', rr[1]) for rr in regions)
+        block += b''.join(pack_string(rr[2]) for rr in regions)
+        for col_idx in range(len(host['columns'])):
+            block += b''.join(struct.pack('=d', rr[3][col_idx]) for rr in regions)
+        agent_region = [(idx, kk, vv) for idx, rr in enumerate(regions) for kk, vv in rr[4]]
+        block += struct.pack('=I', len(agent_region))
+        block += b''.join(struct.pack('=I', idx) + pack_string(kk) + pack_string(vv)
+                          for idx, kk, vv in agent_region)
+        block += struct.pack('=I', len(host['overhead']))
+        block += b''.join(pack_string(kk) + struct.pack('=d', vv)
+                          for kk, vv in host['overhead'])
+        blocks.append(block)
+    fields = pack_pairs(header)
+    result = b'GEOPMRPT' + struct.pack('=II', 1, len(blocks))
+    offset = len(result) + 8 * len(blocks) + len(fields)
+    for block in blocks:
+        result += struct.pack('=Q', offset)
+        offset += len(block)
+    result += fields + b''.join(blocks)
+    with open(path, 'wb') as fid:
+        fid.write(result)
+
+
+test_report_data_small = """\
+GEOPM Version: 3.1.0
+Start Time: Tue Nov  6 08:00:00 2018
+Profile: small
+Agent: monitor
+Policy: {}
+
+Hosts:
+  node1:
+    agent stat: 5
+    Regions:
+    -
+      region: "dgemm"
+      hash: 0x00000000a74bbf35
+      runtime (s): 2.5
+      count: 10
+      package-energy (J): 300
+      agent region stat: 7
+    Unmarked Totals:
+      runtime (s): 0.5
+      count: 0
+      package-energy (J): 50
+    Application Totals:
+      runtime (s): 3
+      count: 0
+      package-energy (J): 350
+      GEOPM overhead (s): 0.01
+"""
+
+
+def write_binary_profile_trace(path, header, blocks, do_index=True):
+    """Write a profile trace in the binary format produced by the GEOPM
+    Runtime when GEOPM_TRACE_PROFILE_FORMAT is binary.  Each block is
+    a tuple of (time_zero, records, short_regions) where each record
+    is a tuple of (time, process, event, signal) and each short region
+    is a tuple of (hash, num_complete, total_time).
+    """
+    def pack_string(value):
+        value = value.encode()
+        return struct.pack('=I', len(value)) + value
+
+    result = b'GEOPMPTR' + struct.pack('=III', 1, 2, len(header))
+    result += b''.join(pack_string(kk) + pack_string(vv) for kk, vv in header)
+    index = []
+    for time_zero, records, short_regions in blocks:
+        begin = records[0][0] - time_zero
+        end = records[-1][0] - time_zero
+        index.append((len(result), begin, end))
+        result += struct.pack('=IIqqdd', len(records), len(short_regions),
+                              time_zero, 0, begin, end)
+        result += b''.join(struct.pack('=qqiiQ', time, 0, process, event, signal)
+                           for time, process, event, signal in records)
+        result += b''.join(struct.pack('=QiId', hash, num_complete, 0, total_time)
+                           for hash, num_complete, total_time in short_regions)
+    if do_index:
+        index_offset = len(result)
+        result += b'GEOPMPTI' + struct.pack('=Q', len(index))
+        result += b''.join(struct.pack('=Qdd', *ii) for ii in index)
+        result += struct.pack('=Q', index_offset) + b'GEOPMPTE'
+    with open(path, 'wb') as fid:
+        fid.write(result)
+    return result
+
+
 class TestIO(unittest.TestCase):
     def setUp(self):
         if 'assertCountEqual' not in dir(self):
@@ -1389,6 +1500,135 @@ class TestIO(unittest.TestCase):
         actual = df.loc[(df['host'] == 'mcfly11')].to_dict('records')[0]
         self.assertEqual(unmarked_mcfly11, actual)
 
+    def test_binary_report(self):
+        binary_path = os.path.join(self._test_directory, 'geopmpy-io-test-binary-report')
+        yaml_path = os.path.join(self._test_directory, 'geopmpy-io-test-small-report')
+        with open(yaml_path, 'w') as fid:
+            fid.write(test_report_data_small)
+        header = [('GEOPM Version', '3.1.0'),
+                  ('Start Time', 'Tue Nov  6 08:00:00 2018'),
+                  ('Profile', 'small'),
+                  ('Agent', 'monitor'),
+                  ('Policy', '{}')]
+        columns = ['runtime (s)', 'count', 'package-energy (J)']
+        host = {'name': 'node1',
+                'agent': [('agent stat', '5')],
+                'columns': columns,
+                'regions': [(0, 0xa74bbf35, 'dgemm', [2.5, 10, 300], [('agent region stat', '7')]),
+                            (1, 0x725e8066, '', [0.5, 0, 50], []),
+                            (3, 0x4c4e4ef4, '', [3, 0, 350], [])],
+                'overhead': [('GEOPM overhead (s)', 0.01)]}
+        write_binary_report(binary_path, header, [host])
+
+        self.assertTrue(geopmpy.io.BinaryReport.is_binary(binary_path))
+        self.assertFalse(geopmpy.io.BinaryReport.is_binary(yaml_path))
+        self.assertEqual(geopmpy.io.RawReport(yaml_path).raw_report(),
+                         geopmpy.io.RawReport(binary_path).raw_report())
+
+        report = geopmpy.io.BinaryReport(binary_path)
+        self.assertEqual(['node1'], report.host_names())
+        df = report.get_df()
+        self.assertEqual(['host', 'type', 'region', 'hash'] + columns, list(df.columns))
+        self.assertEqual(['region', 'unmarked', 'app'], list(df['type']))
+        self.assertEqual([2.5, 0.5, 3.0], list(df['runtime (s)']))
+        region_df = report.get_df('region')
+        self.assertEqual(['dgemm'], list(region_df['region']))
+        self.assertEqual(0xa74bbf35, region_df['hash'][0])
+
+        rrc = geopmpy.io.RawReportCollection(binary_path, do_cache=False)
+        self.assertEqual([300.0], list(rrc.get_df()['package-energy (J)']))
+
+
+    def test_binary_profile_trace(self):
+        binary_path = os.path.join(self._test_directory, 'geopmpy-io-test-binary-profile-trace')
+        csv_path = binary_path + '.csv'
+        header = [('geopm_version', '3.1.0'),
+                  ('start_time', 'Mon Sep 14 19:00:25 2020'),
+                  ('profile_name', 'test'),
+                  ('node_name', 'node1'),
+                  ('agent', 'monitor')]
+        blocks = [(5, [(10, 0, 0, 0xfa5920d6), (11, 1, 0, 0xfa5920d6)], []),
+                  (5, [(20, 1, 3, 0), (21, 0, 2, 1)], [(0xdeadbeef, 2, 3.14)]),
+                  (5, [(30, 0, 1, 0xfa5920d6)], [])]
+        buffer = write_binary_profile_trace(binary_path, header, blocks)
+        self.assertTrue(geopmpy.io.BinaryProfileTrace.is_binary(binary_path))
+
+        trace = geopmpy.io.BinaryProfileTrace(binary_path)
+        self.assertEqual(OrderedDict(header), trace.header())
+        df = trace.get_df()
+        self.assertEqual([5.0, 6.0, 15.0, 16.0, 25.0], list(df['TIME']))
+        self.assertEqual(['REGION_ENTRY', 'REGION_ENTRY', 'EVENT_SHORT_REGION',
+                          'EPOCH_COUNT', 'REGION_EXIT'], list(df['EVENT']))
+        self.assertEqual([0xfa5920d6, 0xfa5920d6, 0xdeadbeef, 1, 0xfa5920d6], list(df['SIGNAL']))
+        self.assertEqual(2, df['NUM_COMPLETE'][2])
+        self.assertEqual(3.14, df['TOTAL_TIME'][2])
+        self.assertTrue(numpy.isnan(df['TOTAL_TIME'][0]))
+
+        df = trace.get_df(begin_time=15.5, end_time=30)
+        self.assertEqual([16.0, 25.0], list(df['TIME']))
+        self.assertEqual(['EPOCH_COUNT', 'REGION_EXIT'], list(df['EVENT']))
+
+        trace.to_csv(csv_path)
+        with open(csv_path) as fid:
+            csv_lines = fid.read().splitlines()
+        self.assertEqual(['# geopm_version: 3.1.0',
+                          '# start_time: Mon Sep 14 19:00:25 2020',
+                          '# profile_name: test',
+                          '# node_name: node1',
+                          '# agent: monitor',
+                          'TIME|PROCESS|EVENT|SIGNAL',
+                          '5|0|REGION_ENTRY|0xfa5920d6',
+                          '6|1|REGION_ENTRY|0xfa5920d6',
+                          '15|1|EVENT_SHORT_REGION|0xdeadbeef',
+                          '16|0|EPOCH_COUNT|1',
+                          '25|0|REGION_EXIT|0xfa5920d6'], csv_lines)
+
+        # A trace that is still being written has no index and may end
+        # with a partial block
+        with open(binary_path, 'wb') as fid:
+            fid.write(buffer[:-120])
+        trace = geopmpy.io.BinaryProfileTrace(binary_path)
+        self.assertEqual([5.0, 6.0, 15.0, 16.0], list(trace.get_df()['TIME']))
+
+    def test_trace_stream(self):
+        trace_path = os.path.join(self._test_directory, 'geopmpy-io-test-trace.gz')
+        header = ('# geopm_version: 3.1.0\n'
+                  '# start_time: Mon Sep 14 19:00:25 2020\n'
+                  '# profile_name: test\n'
+                  '# node_name: node1\n'
+                  '# agent: monitor\n'
+                  'TIME|EPOCH_COUNT|REGION_HASH|REGION_HINT|CPU_POWER\n')
+        rows = ['{}|0|0x00000000fa5920d6|0x0000000100000000|{}\n'.format(tt * 0.005, 100 + tt)
+                for tt in range(6)]
+        members = [gzip.compress((header + ''.join(rows[:3])).encode()),
+                   gzip.compress(''.join(rows[3:5]).encode()),
+                   gzip.compress(rows[5].encode())]
+        # The last member is still being written
+        with open(trace_path, 'wb') as fid:
+            fid.write(members[0] + members[1] + members[2][:10])
+        self.assertTrue(geopmpy.io.TraceStream.is_compressed(trace_path))
+        stream = geopmpy.io.TraceStream(trace_path)
+        self.assertEqual(header + ''.join(rows[:5]), stream.read())
+        self.assertEqual('', stream.read())
+
+        trace = geopmpy.io.Trace(trace_path)
+        self.assertEqual('node1', trace.get_node_name())
+        self.assertEqual([100, 101, 102, 103, 104], list(trace.get_df()['CPU_POWER']))
+
+        with open(trace_path, 'ab') as fid:
+            fid.write(members[2][10:])
+        self.assertEqual(rows[5], stream.read())
+
+        # Uncompressed traces are returned a complete line at a time
+        plain_path = os.path.join(self._test_directory, 'geopmpy-io-test-trace')
+        with open(plain_path, 'w') as fid:
+            fid.write(header + rows[0] + rows[1][:5])
+        self.assertFalse(geopmpy.io.TraceStream.is_compressed(plain_path))
+        stream = geopmpy.io.TraceStream(plain_path)
+        self.assertEqual(header + rows[0], stream.read())
+        with open(plain_path, 'a') as fid:
+            fid.write(rows[1][5:])
+        self.assertEqual(rows[1], stream.read())
 
 if __name__ == '__main__':
     unittest.main()
@@ -11,6 +11,7 @@ import subprocess
 import io
 import time
 import signal
+import struct
 from contextlib import contextmanager
 
 from integration.test import geopm_test_launcher
@@ -88,6 +89,66 @@ class TestIntegrationGeopmio(unittest.TestCase):
         self.check_output(['INVALID', 'board', '0'], ['cannot read signal'])
         self.check_output(['--domain', '--info'], ['info about domain not implemented'])
 
+    def test_geopmread_stream_command_line(self):
+        '''
+        Check that geopmread rejects bad streaming mode arguments.
+        '''
+        self.exec_name = "geopmread"
+        request = ['TIME', 'board', '0']
+
+        period_err = '--period must be a positive number of seconds'
+        self.check_output(['--period', '0'] + request, [period_err])
+        self.check_output(['--period', '-1'] + request, [period_err])
+        self.check_output(['--period', 'fast'] + request, [period_err])
+        count_err = '--count must be a positive integer'
+        self.check_output(['--period', '0.01', '--count', '0'] + request, [count_err])
+        self.check_output(['--period', '0.01', '--count', 'many'] + request, [count_err])
+        require_err = '--count and --binary require --period'
+        self.check_output(['--count', '2'] + request, [require_err])
+        self.check_output(['--binary'] + request, [require_err])
+        self.check_output(['--period', '0.01', 'TIME', 'board'],
+                          ['streaming requires one or more'])
+        self.check_output(['--period', '0.01', 'TIME', 'invalid', '0'],
+                          ['invalid domain type'])
+        self.check_output(['--period', '0.01', 'TIME', 'board', 'bad'],
+                          ['invalid domain index'])
+        self.check_output(['--period', '0.01', 'INVALID', 'board', '0'],
+                          ['cannot push signal'])
+
+    def test_geopmread_stream_output(self):
+        '''
+        Check the shape of a short geopmread streaming mode run.
+        '''
+        period = 0.05
+        num_sample = 5
+        request = ['TIME', 'board', '0', 'TIME', 'package', '0']
+        proc = subprocess.run(['geopmread', '--period', str(period),
+                               '--count', str(num_sample)] + request,
+                              stdout=subprocess.PIPE, stderr=subprocess.PIPE,
+                              check=True)
+        lines = proc.stdout.decode().splitlines()
+        self.assertEqual('TIME,TIME-package-0', lines[0])
+        rows = [[float(value) for value in line.split(',')] for line in lines[1:]]
+        self.assertEqual(num_sample, len(rows))
+        for row in rows:
+            self.assertEqual(2, len(row))
+        times = [row[0] for row in rows]
+        for prev_time, curr_time in zip(times, times[1:]):
+            self.assertLess(prev_time, curr_time)
+        self.assertGreaterEqual(times[-1] - times[0], period * (num_sample - 1))
+
+        # Same requests from standard input, streamed as raw doubles
+        proc = subprocess.run(['geopmread', '--period', str(period),
+                               '--count', str(num_sample), '--binary'],
+                              input=' '.join(request).encode(),
+                              stdout=subprocess.PIPE, stderr=subprocess.PIPE,
+                              check=True)
+        self.assertEqual(num_sample * 2 * 8, len(proc.stdout))
+        values = struct.unpack('{}d'.format(num_sample * 2), proc.stdout)
+        times = values[::2]
+        for prev_time, curr_time in zip(times, times[1:]):
+            self.assertLess(prev_time, curr_time)
+
     @util.skip_unless_batch()
     def test_geopmread_all_signal_agg(self):
         '''
@@ -0,0 +1,24 @@
+#  Copyright (c) 2015 - 2024 Intel Corporation
+#  SPDX-License-Identifier: BSD-3-Clause
+#
+
+# Benchmarks are built with "make checkprogs" but are not run by
+# "make check": timing results are only meaningful on an idle system.
+check_PROGRAMS += benchmark/region_report_benchmark \
+                  benchmark/runtime_hot_path_benchmark \
+                  # end
+
+benchmark_region_report_benchmark_SOURCES = benchmark/region_report_benchmark.cpp
+benchmark_region_report_benchmark_LDADD = libgeopm.la
+benchmark_runtime_hot_path_benchmark_SOURCES = benchmark/benchmark_case.hpp \
+                                              benchmark/runtime_hot_path_benchmark.cpp \
+                                              # end
+benchmark_runtime_hot_path_benchmark_LDADD = libgeopm.la
+
+if ENABLE_MPI
+check_PROGRAMS += benchmark/tree_comm_benchmark \
+                  # end
+
+benchmark_tree_comm_benchmark_SOURCES = benchmark/tree_comm_benchmark.cpp
+benchmark_tree_comm_benchmark_LDADD = libgeopm.la $(MPI_CLIBS)
+endif # ENABLE_MPI
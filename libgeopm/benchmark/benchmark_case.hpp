@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/// Timing harness of the libgeopm benchmarks.  This is a copy of
+/// libgeopmd/benchmark/benchmark_case.hpp so that the two source
+/// trees build independently; keep the two in step so that results
+/// may be compared.  Results are printed as CSV with one row per
+/// case, and the times in each row are for a single operation, so
+/// rows may be compared across commits to track regressions.
+
+#ifndef BENCHMARK_CASE_HPP_INCLUDE
+#define BENCHMARK_CASE_HPP_INCLUDE
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <string>
+
+#include "geopm_time.h"
+
+/// Prints the CSV header of the rows printed by run_case().
+static inline void print_case_header(void)
+{
+    std::cout << "case,iterations,operations,mean_seconds,min_seconds,max_seconds" << std::endl;
+}
+
+/// Times num_iteration calls to func, each of which performs num_op
+/// operations, and prints the time per operation.  The optional reset
+/// function is called before each iteration and is not timed.
+static inline void run_case(const std::string &case_name, int num_iteration, int num_op,
+                            std::function<void(void)> func,
+                            std::function<void(void)> reset = nullptr)
+{
+    double total = 0.0;
+    double min = std::numeric_limits<double>::max();
+    double max = 0.0;
+    for (int iter = 0; iter < num_iteration; ++iter) {
+        if (reset) {
+            reset();
+        }
+        geopm_time_s start;
+        geopm_time(&start);
+        func();
+        double elapsed = geopm_time_since(&start) / num_op;
+        total += elapsed;
+        min = std::min(min, elapsed);
+        max = std::max(max, elapsed);
+    }
+    std::cout << case_name << "," << num_iteration << "," << num_op << ","
+              << total / num_iteration << "," << min << "," << max << std::endl;
+}
+
+#endif
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/// Measures the cost of the per-region work done by the Reporter for
+/// applications with many regions, e.g. "region_report_benchmark
+/// 10000 8".  Every control interval one process enters and exits the
+/// next region, so NUM_REGION intervals visit each region once.
+/// Afterwards each region is queried the way the Reporter queries it:
+/// the ProcessRegionAggregator runtime and count followed by one
+/// SampleAggregator sample per signal.  The PlatformIO and
+/// ApplicationSampler are stand-ins that only return the injected
+/// values, so the times measure the aggregators alone.  Results are
+/// printed as CSV.
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "geopm/PlatformIO.hpp"
+#include "geopm/IOGroup.hpp"
+#include "geopm_topo.h"
+#include "geopm_time.h"
+#include "geopm_hash.h"
+#include "ApplicationSampler.hpp"
+#include "ProcessRegionAggregator.hpp"
+#include "RegionIndex.hpp"
+#include "SampleAggregatorImp.hpp"
+#include "record.hpp"
+
+using geopm::ApplicationSampler;
+using geopm::IOGroup;
+using geopm::PlatformIO;
+using geopm::ProcessRegionAggregatorImp;
+using geopm::RegionIndex;
+using geopm::SampleAggregatorImp;
+using geopm::record_s;
+using geopm::short_region_s;
+
+// Signals are identified by name only; sample() returns the value
+// most recently set by the benchmark.
+class BenchmarkPlatformIO : public PlatformIO
+{
+    public:
+        int signal_idx(const std::string &signal_name)
+        {
+            for (size_t idx = 0; idx != m_name.size(); ++idx) {
+                if (m_name[idx] == signal_name) {
+                    return idx;
+                }
+            }
+            m_name.push_back(signal_name);
+            m_value.push_back(0.0);
+            return m_name.size() - 1;
+        }
+        void set_value(const std::string &signal_name, double value)
+        {
+            m_value[signal_idx(signal_name)] = value;
+        }
+        void register_iogroup(std::shared_ptr<IOGroup> iogroup) override {}
+        std::set<std::string> signal_names(void) const override { return {}; }
+        std::set<std::string> control_names(void) const override { return {}; }
+        int signal_domain_type(const std::string &signal_name) const override { return GEOPM_DOMAIN_BOARD; }
+        int control_domain_type(const std::string &control_name) const override { return GEOPM_DOMAIN_BOARD; }
+        int push_signal(const std::string &signal_name, int domain_type, int domain_idx) override
+        {
+            return signal_idx(signal_name);
+        }
+        int push_control(const std::string &control_name, int domain_type, int domain_idx) override { return -1; }
+        double sample(int signal_idx) override { return m_value[signal_idx]; }
+        void adjust(int control_idx, double setting) override {}
+        void read_batch(void) override {}
+        void write_batch(void) override {}
+        double read_signal(const std::string &signal_name, int domain_type, int domain_idx) override { return NAN; }
+        void write_control(const std::string &control_name, int domain_type, int domain_idx, double setting) override {}
+        void save_control(void) override {}
+        void restore_control(void) override {}
+        std::function<double(const std::vector<double> &)> agg_function(const std::string &signal_name) const override { return nullptr; }
+        std::function<std::string(double)> format_function(const std::string &signal_name) const override { return nullptr; }
+        std::string signal_description(const std::string &signal_name) const override { return ""; }
+        std::string control_description(const std::string &control_name) const override { return ""; }
+        int signal_behavior(const std::string &signal_name) const override
+        {
+            return signal_name.find("AVERAGE") == std::string::npos ?
+                   IOGroup::M_SIGNAL_BEHAVIOR_MONOTONE : IOGroup::M_SIGNAL_BEHAVIOR_VARIABLE;
+        }
+        void save_control(const std::string &save_dir) override {}
+        void restore_control(const std::string &save_dir) override {}
+        void start_batch_server(int client_pid,
+                                const std::vector<geopm_request_s> &signal_config,
+                                const std::vector<geopm_request_s> &control_config,
+                                int &server_pid,
+                                std::string &server_key) override {}
+        void stop_batch_server(int server_pid) override {}
+    private:
+        std::vector<std::string> m_name;
+        std::vector<double> m_value;
+};
+
+class BenchmarkApplicationSampler : public ApplicationSampler
+{
+    public:
+        std::vector<record_s> records;
+
+        void update(const geopm_time_s &curr_time) override {}
+        const std::vector<record_s> &get_records(void) const override { return records; }
+        short_region_s get_short_region(uint64_t event_signal) const override { return {}; }
+        uint64_t cpu_region_hash(int cpu_idx) const override { return 0; }
+        uint64_t cpu_hint(int cpu_idx) const override { return 0; }
+        double cpu_hint_time(int cpu_idx, uint64_t hint) const override { return 0.0; }
+        double cpu_progress(int cpu_idx) const override { return 0.0; }
+        void connect(const std::vector<int> &client_pids) override {}
+        std::vector<int> client_pids(void) const override { return {1}; }
+        std::set<int> client_cpu_set(int client_pid) const override { return {}; }
+        bool do_shutdown(void) const override { return false; }
+        double total_time(void) const override { return 0.0; }
+        double overhead_time(void) const override { return 0.0; }
+};
+
+int main(int argc, char **argv)
+{
+    int num_region = 10000;
+    int num_signal = 8;
+    if (argc > 1) {
+        num_region = std::atoi(argv[1]);
+    }
+    if (argc > 2) {
+        num_signal = std::atoi(argv[2]);
+    }
+    if (num_region <= 0 || num_signal <= 0) {
+        std::cerr << "Usage: " << argv[0] << " [NUM_REGION] [NUM_SIGNAL]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    BenchmarkPlatformIO platform_io;
+    BenchmarkApplicationSampler app_sampler;
+    RegionIndex region_index;
+    SampleAggregatorImp sample_agg(platform_io, region_index);
+    ProcessRegionAggregatorImp proc_agg(app_sampler, region_index);
+    std::vector<std::string> signal_name;
+    std::vector<int> signal_idx;
+    for (int sig = 0; sig < num_signal; ++sig) {
+        // Alternate between total and average signals
+        signal_name.push_back((sig % 2 ? "AVERAGE_" : "TOTAL_") + std::to_string(sig));
+        signal_idx.push_back(sample_agg.push_signal(signal_name.back(), GEOPM_DOMAIN_BOARD, 0));
+    }
+    std::vector<uint64_t> region_hash;
+    for (int region = 0; region < num_region; ++region) {
+        region_hash.push_back(geopm_crc32_str(("region_" + std::to_string(region)).c_str()));
+    }
+
+    geopm_time_s start;
+    geopm_time(&start);
+    geopm_time_s record_time = geopm::time_zero();
+    for (int step = 0; step <= num_region; ++step) {
+        uint64_t hash = step < num_region ? region_hash[step] : GEOPM_REGION_HASH_UNMARKED;
+        platform_io.set_value("TIME", step);
+        platform_io.set_value("REGION_HASH", hash);
+        for (const auto &name : signal_name) {
+            platform_io.set_value(name, step);
+        }
+        sample_agg.update();
+        app_sampler.records.clear();
+        if (step < num_region) {
+            app_sampler.records.push_back({record_time, 1, geopm::EVENT_REGION_ENTRY, hash});
+            geopm_time_add(&record_time, 0.001, &record_time);
+            app_sampler.records.push_back({record_time, 1, geopm::EVENT_REGION_EXIT, hash});
+        }
+        proc_agg.update();
+    }
+    double update_time = geopm_time_since(&start);
+
+    geopm_time(&start);
+    double check_sum = 0.0;
+    for (auto hash : region_hash) {
+        check_sum += proc_agg.get_runtime_average(hash);
+        check_sum += proc_agg.get_count_average(hash);
+        for (auto idx : signal_idx) {
+            check_sum += sample_agg.sample_region(idx, hash);
+        }
+    }
+    double query_time = geopm_time_since(&start);
+
+    std::cout << "num_region,num_signal,update_time_per_interval,query_time,query_time_per_region,check_sum" << std::endl
+              << num_region << "," << num_signal << ","
+              << update_time / (num_region + 1) << ","
+              << query_time << "," << query_time / num_region << ","
+              << check_sum << std::endl;
+    return 0;
+}
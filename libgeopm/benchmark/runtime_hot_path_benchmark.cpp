@@ -0,0 +1,513 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/// Measures the cost per operation of the runtime code that runs in
+/// the application and in the controller on every control interval,
+/// e.g. "runtime_hot_path_benchmark 1000 8 16".  The arguments are
+/// the number of timed iterations of each case, the number of
+/// application processes and signals (N and M), and the number of
+/// regions (R).  The cases are:
+///
+///   - Profile enter/exit and epoch, which back geopm_prof_enter(),
+///     geopm_prof_exit() and geopm_prof_epoch(), with and without a
+///     thread that concurrently drains the record log the way the
+///     controller does;
+///   - ApplicationRecordLog::dump();
+///   - ApplicationSampler::update() with N processes;
+///   - the proxy_epoch and edit_distance record filters, the latter
+///     with several history buffer sizes;
+///   - SampleAggregator::update() with M signals and R regions;
+///   - CSV row formatting as done by the trace files;
+///   - TensorMath and DenseLayer forward passes;
+///   - aggregate_sample() of the power_governor and power_balancer
+///     agents at a non-leaf level of the tree; the other built-in
+///     agents do not aggregate samples.
+///
+/// The Profile and ApplicationSampler use shared memory record logs
+/// created in this process, and the PlatformIO used by the
+/// SampleAggregator is a stand-in that only returns the injected
+/// values.  Results are printed in the CSV format of
+/// benchmark/benchmark_case.hpp.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "geopm/Agent.hpp"
+#include "geopm/Helper.hpp"
+#include "geopm/IOGroup.hpp"
+#include "geopm/PlatformIO.hpp"
+#include "geopm/PlatformTopo.hpp"
+#include "geopm/PowerBalancer.hpp"
+#include "geopm/PowerGovernor.hpp"
+#include "geopm/Profile.hpp"
+#include "geopm/ServiceProxy.hpp"
+#include "geopm/SharedMemory.hpp"
+#include "geopm_hash.h"
+#include "geopm_hint.h"
+#include "geopm_time.h"
+#include "geopm_topo.h"
+#include "ApplicationRecordLog.hpp"
+#include "ApplicationSamplerImp.hpp"
+#include "ApplicationStatus.hpp"
+#include "CSV.hpp"
+#include "DenseLayer.hpp"
+#include "PowerBalancerAgent.hpp"
+#include "PowerGovernorAgent.hpp"
+#include "RecordFilter.hpp"
+#include "RegionIndex.hpp"
+#include "SampleAggregatorImp.hpp"
+#include "Scheduler.hpp"
+#include "TensorMath.hpp"
+#include "TensorOneD.hpp"
+#include "TensorTwoD.hpp"
+#include "record.hpp"
+#include "benchmark_case.hpp"
+
+using geopm::Agent;
+using geopm::ApplicationRecordLog;
+using geopm::ApplicationSamplerImp;
+using geopm::ApplicationStatus;
+using geopm::IOGroup;
+using geopm::PlatformIO;
+using geopm::ProfileImp;
+using geopm::RecordFilter;
+using geopm::RegionIndex;
+using geopm::SampleAggregatorImp;
+using geopm::ServiceProxy;
+using geopm::SharedMemory;
+using geopm::TensorOneD;
+using geopm::TensorTwoD;
+using geopm::record_s;
+using geopm::short_region_s;
+
+// Signals are identified by name only; sample() returns the value
+// most recently set by the benchmark.
+class BenchmarkPlatformIO : public PlatformIO
+{
+    public:
+        int signal_idx(const std::string &signal_name)
+        {
+            for (size_t idx = 0; idx != m_name.size(); ++idx) {
+                if (m_name[idx] == signal_name) {
+                    return idx;
+                }
+            }
+            m_name.push_back(signal_name);
+            m_value.push_back(0.0);
+            return m_name.size() - 1;
+        }
+        void set_value(int signal_idx, double value)
+        {
+            m_value[signal_idx] = value;
+        }
+        void register_iogroup(std::shared_ptr<IOGroup> iogroup) override {}
+        std::set<std::string> signal_names(void) const override { return {}; }
+        std::set<std::string> control_names(void) const override { return {}; }
+        int signal_domain_type(const std::string &signal_name) const override { return GEOPM_DOMAIN_BOARD; }
+        int control_domain_type(const std::string &control_name) const override { return GEOPM_DOMAIN_BOARD; }
+        int push_signal(const std::string &signal_name, int domain_type, int domain_idx) override
+        {
+            return signal_idx(signal_name);
+        }
+        int push_control(const std::string &control_name, int domain_type, int domain_idx) override { return -1; }
+        double sample(int signal_idx) override { return m_value[signal_idx]; }
+        void adjust(int control_idx, double setting) override {}
+        void read_batch(void) override {}
+        void write_batch(void) override {}
+        double read_signal(const std::string &signal_name, int domain_type, int domain_idx) override { return NAN; }
+        void write_control(const std::string &control_name, int domain_type, int domain_idx, double setting) override {}
+        void save_control(void) override {}
+        void restore_control(void) override {}
+        std::function<double(const std::vector<double> &)> agg_function(const std::string &signal_name) const override { return nullptr; }
+        std::function<std::string(double)> format_function(const std::string &signal_name) const override { return nullptr; }
+        std::string signal_description(const std::string &signal_name) const override { return ""; }
+        std::string control_description(const std::string &control_name) const override { return ""; }
+        int signal_behavior(const std::string &signal_name) const override
+        {
+            return signal_name.find("AVERAGE") == std::string::npos ?
+                   IOGroup::M_SIGNAL_BEHAVIOR_MONOTONE : IOGroup::M_SIGNAL_BEHAVIOR_VARIABLE;
+        }
+        void save_control(const std::string &save_dir) override {}
+        void restore_control(const std::string &save_dir) override {}
+        void start_batch_server(int client_pid,
+                                const std::vector<geopm_request_s> &signal_config,
+                                const std::vector<geopm_request_s> &control_config,
+                                int &server_pid,
+                                std::string &server_key) override {}
+        void stop_batch_server(int server_pid) override {}
+    private:
+        std::vector<std::string> m_name;
+        std::vector<double> m_value;
+};
+
+// The Profile only uses the service to start and stop the profile.
+class BenchmarkServiceProxy : public ServiceProxy
+{
+    public:
+        void platform_get_user_access(std::vector<std::string> &signal_names,
+                                      std::vector<std::string> &control_names) override {}
+        std::vector<geopm::signal_info_s> platform_get_signal_info(const std::vector<std::string> &signal_names) override { return {}; }
+        std::vector<geopm::control_info_s> platform_get_control_info(const std::vector<std::string> &control_names) override { return {}; }
+        void platform_open_session(void) override {}
+        void platform_close_session(void) override {}
+        void platform_start_batch(const std::vector<struct geopm_request_s> &signal_config,
+                                  const std::vector<struct geopm_request_s> &control_config,
+                                  int &server_pid,
+                                  std::string &server_key) override {}
+        void platform_stop_batch(int server_pid) override {}
+        double platform_read_signal(const std::string &signal_name, int domain, int domain_idx) override { return NAN; }
+        void platform_write_control(const std::string &control_name, int domain, int domain_idx, double setting) override {}
+        std::vector<double> platform_read_signals(const std::vector<struct geopm_request_s> &signal_config) override { return {}; }
+        void platform_write_controls(const std::vector<struct geopm_request_s> &control_config,
+                                     const std::vector<double> &settings) override {}
+        void platform_restore_control() override {}
+        std::string topo_get_cache(void) override { return ""; }
+        void platform_start_profile(const std::string &profile_name) override {}
+        void platform_stop_profile(const std::vector<std::string> &region_names) override {}
+        std::vector<int> platform_get_profile_pids(const std::string &profile_name) override { return {}; }
+        std::vector<std::string> platform_pop_profile_region_names(const std::string &profile_name) override { return {}; }
+};
+
+static std::string shmem_key(const std::string &name)
+{
+    return "/geopm-runtime-hot-path-benchmark-" + name + "-" + std::to_string(getpid());
+}
+
+static void run_profile_cases(int num_iteration)
+{
+    // Stay below ApplicationRecordLog::max_record() between drains
+    const int num_op = 256;
+    int num_cpu = geopm::platform_topo().num_domain(GEOPM_DOMAIN_CPU);
+    std::shared_ptr<SharedMemory> status_shmem = SharedMemory::make_unique_owner(shmem_key("status"),
+                                                                                 ApplicationStatus::buffer_size(num_cpu));
+    std::shared_ptr<SharedMemory> log_shmem = SharedMemory::make_unique_owner(shmem_key("record-log"),
+                                                                              ApplicationRecordLog::buffer_size());
+    std::shared_ptr<ApplicationStatus> status = ApplicationStatus::make_unique(num_cpu, status_shmem);
+    std::shared_ptr<ApplicationRecordLog> record_log = ApplicationRecordLog::make_unique(log_shmem);
+    // The controller side of the record log
+    auto drain_shmem = SharedMemory::make_unique_user(shmem_key("record-log"), 1);
+    std::shared_ptr<ApplicationRecordLog> drain_log = ApplicationRecordLog::make_unique(std::move(drain_shmem));
+    std::vector<record_s> records;
+    std::vector<short_region_s> short_regions;
+    auto drain = [&]() {
+        drain_log->dump(records, short_regions);
+    };
+    {
+        // A pid_registered of -2 keeps the injected status and record log
+        ProfileImp profile("benchmark", "", num_cpu, {}, status, record_log, true,
+                           std::make_shared<BenchmarkServiceProxy>(),
+                           geopm::Scheduler::make_unique(), -2);
+        uint64_t region_id = profile.region("runtime_hot_path_benchmark", GEOPM_REGION_HINT_COMPUTE);
+        auto enter_exit = [&]() {
+            for (int op_idx = 0; op_idx != num_op; ++op_idx) {
+                profile.enter(region_id);
+                profile.exit(region_id);
+            }
+        };
+        auto epoch = [&]() {
+            for (int op_idx = 0; op_idx != num_op; ++op_idx) {
+                profile.epoch();
+            }
+        };
+        run_case("profile_enter_exit", num_iteration, num_op, enter_exit, drain);
+        run_case("profile_epoch", num_iteration, num_op, epoch, drain);
+
+        std::atomic<bool> is_done(false);
+        std::thread drainer([&]() {
+            std::vector<record_s> drain_records;
+            std::vector<short_region_s> drain_short_regions;
+            while (!is_done) {
+                drain_log->dump(drain_records, drain_short_regions);
+                usleep(1000);
+            }
+        });
+        // The main thread must not dump while the drainer is running
+        auto yield = []() {
+            usleep(2000);
+        };
+        run_case("profile_enter_exit_drained", num_iteration, num_op, enter_exit, yield);
+        run_case("profile_epoch_drained", num_iteration, num_op, epoch, yield);
+        is_done = true;
+        drainer.join();
+
+        drain();
+        run_case("record_log_dump", num_iteration, 1, drain, [&]() {
+            drain();
+            epoch();
+        });
+    }
+    log_shmem->unlink();
+    status_shmem->unlink();
+}
+
+static void run_app_sampler_cases(int num_iteration, int num_process)
+{
+    const int num_region = 4;
+    int num_cpu = geopm::platform_topo().num_domain(GEOPM_DOMAIN_CPU);
+    std::shared_ptr<SharedMemory> status_shmem = SharedMemory::make_unique_owner(shmem_key("sampler-status"),
+                                                                                 ApplicationStatus::buffer_size(num_cpu));
+    std::shared_ptr<ApplicationStatus> status = ApplicationStatus::make_unique(num_cpu, status_shmem);
+    std::map<int, ApplicationSamplerImp::m_process_s> process_map;
+    std::vector<std::shared_ptr<SharedMemory> > log_shmem;
+    std::vector<std::shared_ptr<ApplicationRecordLog> > app_log;
+    for (int proc_idx = 0; proc_idx != num_process; ++proc_idx) {
+        log_shmem.push_back(SharedMemory::make_unique_owner(shmem_key("sampler-log-" + std::to_string(proc_idx)),
+                                                            ApplicationRecordLog::buffer_size()));
+        auto &process = process_map[proc_idx + 1];
+        process.record_log = ApplicationRecordLog::make_unique(log_shmem.back());
+        app_log.push_back(process.record_log);
+    }
+    ApplicationSamplerImp app_sampler(status, geopm::platform_topo(), process_map,
+                                      false, "", std::vector<bool>(num_cpu, true),
+                                      "benchmark", {}, geopm::Scheduler::make_unique());
+    std::vector<uint64_t> region_hash;
+    for (int region_idx = 0; region_idx != num_region; ++region_idx) {
+        region_hash.push_back(geopm_crc32_str(("region_" + std::to_string(region_idx)).c_str()));
+    }
+    // Each process reports an epoch and a long running region that
+    // is exited in the next interval, and enters and exits the
+    // others as short regions.
+    auto app_progress = [&]() {
+        geopm_time_s now;
+        geopm_time(&now);
+        for (auto &log : app_log) {
+            log->exit(region_hash[0], now);
+            log->epoch(now);
+            for (int region_idx = 1; region_idx != num_region; ++region_idx) {
+                log->enter(region_hash[region_idx], now);
+                log->exit(region_hash[region_idx], now);
+            }
+            log->enter(region_hash[0], now);
+        }
+    };
+    geopm_time_s now;
+    geopm_time(&now);
+    for (auto &log : app_log) {
+        log->enter(region_hash[0], now);
+    }
+    run_case("app_sampler_update", num_iteration, 1, [&]() {
+        geopm_time_s curr_time;
+        geopm_time(&curr_time);
+        app_sampler.update(curr_time);
+    }, app_progress);
+    for (auto &shmem : log_shmem) {
+        shmem->unlink();
+    }
+    status_shmem->unlink();
+}
+
+static void run_record_filter_cases(int num_iteration)
+{
+    // Application with an outer loop over a fixed sequence of regions
+    // and no epoch markup.
+    std::vector<uint64_t> region_hash;
+    for (int region_idx = 0; region_idx != 5; ++region_idx) {
+        region_hash.push_back(geopm_crc32_str(("region_" + std::to_string(region_idx)).c_str()));
+    }
+    // The cost of the edit distance filter grows with the square of
+    // its history size, so fewer records are filtered per iteration.
+    struct filter_case_s {
+        std::string case_name;
+        std::string filter_name;
+        int num_op;
+    };
+    std::vector<filter_case_s> filter_cases = {
+        {"record_filter_proxy_epoch", "proxy_epoch," + geopm::string_format_hex(region_hash[0]), 1000},
+        {"record_filter_edit_distance_50", "edit_distance,50", 100},
+        {"record_filter_edit_distance_100", "edit_distance,100", 100},
+        {"record_filter_edit_distance_200", "edit_distance,200", 100},
+    };
+    for (const auto &fc : filter_cases) {
+        auto filter = RecordFilter::make_unique(fc.filter_name);
+        geopm_time_s time = geopm::time_zero();
+        size_t record_idx = 0;
+        std::vector<record_s> result;
+        run_case(fc.case_name, num_iteration, fc.num_op, [&]() {
+            for (int op_idx = 0; op_idx != fc.num_op; ++op_idx) {
+                geopm_time_add(&time, 0.001, &time);
+                uint64_t hash = region_hash[(record_idx / 2) % region_hash.size()];
+                int event = record_idx % 2 ? geopm::EVENT_REGION_EXIT : geopm::EVENT_REGION_ENTRY;
+                result.clear();
+                filter->filter({time, 1, event, hash}, result);
+                ++record_idx;
+            }
+        });
+    }
+}
+
+static void run_sample_agg_cases(int num_iteration, int num_signal, int num_region)
+{
+    BenchmarkPlatformIO platform_io;
+    RegionIndex region_index;
+    SampleAggregatorImp sample_agg(platform_io, region_index);
+    std::vector<int> signal_idx;
+    for (int sig = 0; sig < num_signal; ++sig) {
+        // Alternate between total and average signals
+        std::string signal_name = (sig % 2 ? "AVERAGE_" : "TOTAL_") + std::to_string(sig);
+        sample_agg.push_signal(signal_name, GEOPM_DOMAIN_BOARD, 0);
+        signal_idx.push_back(platform_io.signal_idx(signal_name));
+    }
+    int time_idx = platform_io.signal_idx("TIME");
+    int hash_idx = platform_io.signal_idx("REGION_HASH");
+    int epoch_idx = platform_io.signal_idx("EPOCH_COUNT");
+    std::vector<uint64_t> region_hash;
+    for (int region = 0; region < num_region; ++region) {
+        region_hash.push_back(geopm_crc32_str(("region_" + std::to_string(region)).c_str()));
+    }
+    int step = 0;
+    run_case("sample_agg_update", num_iteration, 1, [&]() {
+        sample_agg.update();
+    }, [&]() {
+        ++step;
+        platform_io.set_value(time_idx, step * 0.005);
+        platform_io.set_value(hash_idx, region_hash[step % num_region]);
+        platform_io.set_value(epoch_idx, step / num_region);
+        for (int idx : signal_idx) {
+            platform_io.set_value(idx, step);
+        }
+    });
+}
+
+static void run_csv_cases(int num_iteration, int num_signal)
+{
+    const int num_op = 100;
+    std::string path = "/tmp/geopm-runtime-hot-path-benchmark-" + std::to_string(getpid()) + ".csv";
+    {
+        geopm::CSVImp csv(path, "", "", 1 << 20);
+        std::vector<std::string> formats = {"double", "float", "integer", "hex"};
+        for (int sig = 0; sig < num_signal; ++sig) {
+            csv.add_column("SIGNAL_" + std::to_string(sig), formats[sig % formats.size()]);
+        }
+        csv.activate();
+        std::vector<double> row(num_signal);
+        run_case("csv_update", num_iteration, num_op, [&]() {
+            for (int op_idx = 0; op_idx != num_op; ++op_idx) {
+                for (int sig = 0; sig < num_signal; ++sig) {
+                    row[sig] = 1.0e9 / (op_idx + sig + 1);
+                }
+                csv.update(row);
+            }
+        }, [&]() {
+            csv.flush();
+        });
+    }
+    (void)remove(path.c_str());
+}
+
+static void run_tensor_cases(int num_iteration)
+{
+    const int num_op = 100;
+    std::vector<size_t> sizes = {16, 64, 256};
+    auto math = geopm::TensorMath::make_shared();
+    double check_sum = 0.0;
+    for (size_t size : sizes) {
+        TensorOneD input(size);
+        TensorTwoD weights(size, size);
+        TensorOneD biases(size);
+        for (size_t row = 0; row != size; ++row) {
+            input[row] = 1.0 / (row + 1);
+            biases[row] = 0.5;
+            for (size_t col = 0; col != size; ++col) {
+                weights[row][col] = (row == col) ? 1.0 : 0.01;
+            }
+        }
+        run_case("tensor_multiply_" + std::to_string(size), num_iteration, num_op, [&]() {
+            for (int op_idx = 0; op_idx != num_op; ++op_idx) {
+                check_sum += math->multiply(weights, input)[0];
+            }
+        });
+        auto layer = geopm::DenseLayer::make_unique(weights, biases);
+        run_case("dense_layer_forward_" + std::to_string(size), num_iteration, num_op, [&]() {
+            for (int op_idx = 0; op_idx != num_op; ++op_idx) {
+                check_sum += layer->forward(input)[0];
+            }
+        });
+    }
+    if (std::isnan(check_sum)) {
+        std::cerr << "Warning: check sum is NAN" << std::endl;
+    }
+}
+
+static void run_agent_cases(int num_iteration, int num_process)
+{
+    const int num_op = 1000;
+    // Agents of a non-leaf level of the tree, above one leaf per
+    // process; only the leaf level uses the PlatformIO.
+    const std::vector<int> fan_in = {num_process, 2};
+    BenchmarkPlatformIO platform_io;
+    std::vector<std::pair<std::string, std::shared_ptr<Agent> > > agents = {
+        {geopm::PowerGovernorAgent::plugin_name(),
+         std::make_shared<geopm::PowerGovernorAgent>(platform_io, nullptr, nullptr)},
+        {geopm::PowerBalancerAgent::plugin_name(),
+         std::make_shared<geopm::PowerBalancerAgent>(platform_io, geopm::platform_topo(), nullptr,
+                                                     std::vector<std::shared_ptr<geopm::PowerBalancer> >{},
+                                                     NAN, NAN, nullptr)},
+    };
+    for (const auto &name_agent : agents) {
+        auto &agent = name_agent.second;
+        agent->init(1, fan_in, false);
+        int num_sample = Agent::num_sample(name_agent.first);
+        std::vector<std::vector<double> > in_sample(num_process, std::vector<double>(num_sample, 1.0));
+        std::vector<double> out_sample(num_sample);
+        run_case("agent_aggregate_" + name_agent.first, num_iteration, num_op, [&]() {
+            for (int op_idx = 0; op_idx != num_op; ++op_idx) {
+                agent->aggregate_sample(in_sample, out_sample);
+            }
+        });
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int num_iteration = 1000;
+    int num_process = 8;
+    int num_region = 16;
+    if (argc > 1) {
+        num_iteration = std::atoi(argv[1]);
+    }
+    if (argc > 2) {
+        num_process = std::atoi(argv[2]);
+    }
+    if (argc > 3) {
+        num_region = std::atoi(argv[3]);
+    }
+    if (num_iteration <= 0 || num_process <= 0 || num_region <= 0 || argc > 4) {
+        std::cerr << "Usage: " << argv[0] << " [NUM_ITERATION] [NUM_PROCESS] [NUM_REGION]" << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::cerr << "Info: num_process=" << num_process
+              << " num_signal=" << num_process
+              << " num_region=" << num_region << std::endl;
+    print_case_header();
+    int err = 0;
+    try {
+        run_profile_cases(num_iteration);
+        run_app_sampler_cases(num_iteration, num_process);
+        run_record_filter_cases(num_iteration);
+        run_sample_agg_cases(num_iteration, num_process, num_region);
+        run_csv_cases(num_iteration, num_process);
+        run_tensor_cases(num_iteration);
+        run_agent_cases(num_iteration, num_process);
+    }
+    catch (const std::exception &ex) {
+        std::cerr << "Error: " << ex.what() << std::endl;
+        err = EXIT_FAILURE;
+    }
+    return err;
+}
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/// Measures the latency and traffic of one level of the controller
+/// tree for each TreeCommLevel implementation.  Launch with many
+/// ranks on one node, e.g. "mpiexec -n 17 tree_comm_benchmark 1000 16"
+/// to form one level of fan-out 16.  The ranks are divided into
+/// levels of FAN_OUT + 1 ranks; the root of each level sends a new policy
+/// down and waits until every child has sent a matching sample up.
+/// Afterwards every rank resends an unchanged sample for
+/// NUM_ITERATION periods to measure the bytes sent in steady state.
+/// Results are printed by rank zero as CSV with one row per
+/// implementation.
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "geopm_time.h"
+#include "MPIComm.hpp"
+#include "TreeCommLevel.hpp"
+
+using geopm::Comm;
+using geopm::MPIComm;
+using geopm::TreeCommLevel;
+using geopm::TreeCommLevelImp;
+using geopm::P2PTreeCommLevel;
+
+static const int M_NUM_SEND = 4;
+
+static void run_case(const std::string &case_name, int num_iteration,
+                     std::shared_ptr<Comm> comm_world, int level_size,
+                     std::shared_ptr<TreeCommLevel> level)
+{
+    bool is_root = level->level_rank() == 0;
+    std::vector<double> policy(M_NUM_SEND, 0.0);
+    std::vector<double> sample(M_NUM_SEND, 0.0);
+    std::vector<std::vector<double> > level_policy(level_size, policy);
+    std::vector<std::vector<double> > level_sample(level_size, sample);
+    double latency_total = 0.0;
+    double latency_min = std::numeric_limits<double>::max();
+    double latency_max = 0.0;
+    comm_world->barrier();
+    for (int iter = 1; iter <= num_iteration; ++iter) {
+        double value = iter;
+        geopm_time_s start;
+        geopm_time(&start);
+        if (is_root) {
+            std::fill(policy.begin(), policy.end(), value);
+            std::fill(level_policy.begin(), level_policy.end(), policy);
+            level->send_down(level_policy);
+            level->send_up(policy);
+            bool is_done = false;
+            while (!is_done) {
+                is_done = level->receive_up(level_sample) &&
+                          std::all_of(level_sample.begin(), level_sample.end(),
+                                      [value](const std::vector<double> &ss)
+                                      {return ss[0] == value;});
+            }
+            double elapsed = geopm_time_since(&start);
+            latency_total += elapsed;
+            latency_min = std::min(latency_min, elapsed);
+            latency_max = std::max(latency_max, elapsed);
+        }
+        else {
+            bool is_done = false;
+            while (!is_done) {
+                is_done = level->receive_down(policy) && policy[0] == value;
+            }
+            level->send_up(policy);
+        }
+    }
+    comm_world->barrier();
+    size_t overhead_before = level->overhead_send();
+    for (int iter = 0; iter < num_iteration; ++iter) {
+        level->send_up(sample);
+        if (is_root) {
+            level->send_down(level_policy);
+            level->receive_up(level_sample);
+        }
+        else {
+            level->receive_down(policy);
+        }
+    }
+    double overhead = level->overhead_send() - overhead_before;
+    double overhead_total = 0.0;
+    comm_world->reduce_max(&overhead, &overhead_total, 1, 0);
+    if (comm_world->rank() == 0) {
+        std::cout << case_name << "," << num_iteration << ","
+                  << latency_total / num_iteration << "," << latency_min << ","
+                  << latency_max << "," << overhead_total << std::endl;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    MPI_Init(&argc, &argv);
+    int err = 0;
+    {
+        auto comm_world = std::make_shared<MPIComm>(MPI_COMM_WORLD);
+        int num_iteration = 1000;
+        int level_size = comm_world->num_rank();
+        if (argc > 1) {
+            num_iteration = std::atoi(argv[1]);
+        }
+        if (argc > 2) {
+            level_size = std::atoi(argv[2]) + 1;
+        }
+        if (num_iteration <= 0 || level_size <= 1 ||
+            comm_world->num_rank() % level_size != 0) {
+            if (comm_world->rank() == 0) {
+                std::cerr << "Usage: " << argv[0] << " [NUM_ITERATION] [FAN_OUT]" << std::endl
+                          << "       The number of ranks must be a multiple of FAN_OUT + 1" << std::endl;
+            }
+            err = EXIT_FAILURE;
+        }
+        else {
+            std::shared_ptr<Comm> comm_level = comm_world->split(comm_world->rank() / level_size,
+                                                                 comm_world->rank());
+            if (comm_world->rank() == 0) {
+                std::cout << "case,iterations,latency_mean,latency_min,latency_max,max_bytes_sent" << std::endl;
+            }
+            std::vector<std::pair<std::string, std::function<std::shared_ptr<TreeCommLevel>(void)> > > cases {
+                {"rma", [comm_level]() {
+                    return std::make_shared<TreeCommLevelImp>(comm_level, M_NUM_SEND, M_NUM_SEND);
+                }},
+                {"p2p_max_stale_0", [comm_level]() {
+                    return std::make_shared<P2PTreeCommLevel>(comm_level, M_NUM_SEND, M_NUM_SEND, 0);
+                }},
+                {"p2p_max_stale_10", [comm_level]() {
+                    return std::make_shared<P2PTreeCommLevel>(comm_level, M_NUM_SEND, M_NUM_SEND, 10);
+                }},
+            };
+            for (const auto &cc : cases) {
+                run_case(cc.first, num_iteration, comm_world, comm_level->num_rank(), cc.second());
+            }
+        }
+    }
+    MPI_Finalize();
+    return err;
+}
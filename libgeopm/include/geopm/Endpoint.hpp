@@ -35,6 +35,21 @@ namespace geopm
             ///        specified by the Agent.
             /// @return The age of the sample in seconds.
             virtual double read_sample(std::vector<double> &sample) = 0;
+            /// @brief Read all samples written by the Agent since
+            ///        the last call to read_sample() or
+            ///        read_sample_history().  Requires that the
+            ///        Endpoint was created with a non-zero history
+            ///        size.
+            /// @param [out] sample One vector of sample values per
+            ///        sample written, oldest first.  The order of
+            ///        values within each sample is specified by the
+            ///        Agent.
+            /// @param [out] sample_age The age in seconds of each
+            ///        sample, aligned with the sample vector.
+            /// @return The number of samples that were overwritten
+            ///         in the history before they could be read.
+            virtual size_t read_sample_history(std::vector<std::vector<double> > &sample,
+                                               std::vector<double> &sample_age) = 0;
             /// @brief Returns the Agent name, or empty string if no
             ///        Agent is attached.
             virtual std::string get_agent(void) = 0;
@@ -51,6 +66,14 @@ namespace geopm
             ///        stop_wait_loop().  The name of the attached
             ///        agent can be read with get_agent().
             virtual void wait_for_agent_detach(double timeout) = 0;
+            /// @brief Blocks until the attached Agent writes a sample
+            ///        that has not been read with read_sample() or
+            ///        read_sample_history(), a timeout is reached, or
+            ///        the operation is canceled with
+            ///        stop_wait_loop().  Throws an exception if the
+            ///        given timeout is reached before a new sample is
+            ///        available.
+            virtual void wait_for_sample(double timeout) = 0;
             /// @brief Cancels any current wait loops in this
             ///        Endpoint.
             virtual void stop_wait_loop(void) = 0;
@@ -66,6 +89,14 @@ namespace geopm
             virtual std::set<std::string> get_hostnames(void) = 0;
             /// @brief Factory method for the Endpoint used to set the policy.
             static std::unique_ptr<Endpoint> make_unique(const std::string &data_path);
+            /// @brief Factory method for an Endpoint that also keeps
+            ///        a ring of the most recent samples written by
+            ///        the Agent.
+            /// @param [in] data_path Shared memory key prefix.
+            /// @param [in] history_size Number of samples retained
+            ///        for read_sample_history(), at most 65536.
+            static std::unique_ptr<Endpoint> make_unique(const std::string &data_path,
+                                                         size_t history_size);
     };
 }
 
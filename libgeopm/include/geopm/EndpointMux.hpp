@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef ENDPOINTMUX_HPP_INCLUDE
+#define ENDPOINTMUX_HPP_INCLUDE
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "geopm_public.h"
+
+namespace geopm
+{
+    class Endpoint;
+
+    /// @brief Manages many Endpoints from a single resource manager
+    ///        thread.
+    ///
+    /// Every Endpoint added to the EndpointMux shares one doorbell
+    /// shared memory region.  Agents attached to any of the
+    /// Endpoints ring the doorbell whenever they attach, detach, or
+    /// write a sample, so a single call to wait() replaces one
+    /// polling loop per Endpoint.
+    class GEOPM_PUBLIC EndpointMux
+    {
+        public:
+            virtual ~EndpointMux() = default;
+            /// @brief Create and open a new Endpoint managed by the
+            ///        EndpointMux.
+            /// @param [in] data_path Shared memory key prefix of the
+            ///        Endpoint.
+            /// @return Index of the Endpoint used by the other
+            ///         methods.  Indices of removed Endpoints are
+            ///         reused.
+            virtual int add_endpoint(const std::string &data_path) = 0;
+            /// @brief Close and release an Endpoint created with
+            ///        add_endpoint().
+            /// @param [in] endpoint_idx Index returned by
+            ///        add_endpoint().
+            virtual void remove_endpoint(int endpoint_idx) = 0;
+            /// @brief Access an Endpoint created with add_endpoint()
+            ///        to write policies or query the attached Agent.
+            /// @param [in] endpoint_idx Index returned by
+            ///        add_endpoint().
+            /// @return Reference valid until the Endpoint is removed.
+            virtual Endpoint &endpoint(int endpoint_idx) = 0;
+            /// @brief Maximum number of Endpoints that may be managed
+            ///        at the same time.
+            virtual int max_endpoint(void) const = 0;
+            /// @brief Blocks until the Agent of at least one managed
+            ///        Endpoint attaches, detaches or writes a sample,
+            ///        or until the timeout is reached.
+            /// @param [in] timeout Maximum time to wait in seconds; a
+            ///        negative value waits without a time limit.
+            /// @return Indices of the Endpoints updated since the
+            ///         last call, in increasing order.  Empty if the
+            ///         timeout was reached.
+            virtual std::vector<int> wait(double timeout) = 0;
+            /// @brief Read the latest sample of every Endpoint slot
+            ///        into one contiguous array.
+            /// @param [in] stride Number of values reserved per
+            ///        Endpoint.  Samples with fewer values are padded
+            ///        with NAN, longer samples are truncated.
+            /// @param [out] sample Resized to max_endpoint() * stride;
+            ///        the values for index N begin at N * stride.
+            /// @param [out] sample_age Resized to max_endpoint(); the
+            ///        age in seconds of each sample, or NAN if the
+            ///        slot is unused or no Agent is attached.
+            virtual void read_sample(size_t stride,
+                                     std::vector<double> &sample,
+                                     std::vector<double> &sample_age) = 0;
+            /// @brief Factory method for the EndpointMux.  Closes all
+            ///        managed Endpoints when destroyed.
+            /// @param [in] data_path Shared memory key prefix of the
+            ///        doorbell.
+            /// @param [in] max_endpoint Maximum number of Endpoints
+            ///        managed at the same time.
+            static std::unique_ptr<EndpointMux> make_unique(const std::string &data_path,
+                                                            int max_endpoint);
+    };
+}
+
+#endif
@@ -35,11 +35,16 @@ namespace geopm
             Environment() = default;
             virtual ~Environment() = default;
             virtual std::string report(void) const = 0;
+            virtual std::string report_format(void) const = 0;
             virtual std::string comm(void) const = 0;
             virtual std::string policy(void) const = 0;
             virtual std::string endpoint(void) const = 0;
             virtual std::string trace(void) const = 0;
+            virtual std::string trace_compression(void) const = 0;
+            virtual std::string trace_summary(void) const = 0;
             virtual std::string trace_profile(void) const = 0;
+            virtual std::string trace_profile_format(void) const = 0;
+            virtual std::string trace_profile_compression(void) const = 0;
             virtual std::string trace_endpoint_policy(void) const = 0;
             virtual std::string profile(void) const = 0;
             virtual std::string frequency_map(void) const = 0;
@@ -47,6 +52,9 @@ namespace geopm
             virtual std::string trace_signals(void) const = 0;
             virtual std::string report_signals(void) const = 0;
             virtual int max_fan_out(void) const = 0;
+            virtual std::string tree_comm(void) const = 0;
+            virtual int tree_comm_max_stale(void) const = 0;
+            virtual std::string waiter_strategy(void) const = 0;
             virtual int pmpi_ctl(void) const = 0;
             virtual bool do_policy(void) const = 0;
             virtual bool do_endpoint(void) const = 0;
@@ -79,11 +87,16 @@ namespace geopm
                            const std::string &override_settings_path);
             virtual ~EnvironmentImp() = default;
             std::string report(void) const override;
+            std::string report_format(void) const override;
             std::string comm(void) const override;
             std::string policy(void) const override;
             std::string endpoint(void) const override;
             std::string trace(void) const override;
+            std::string trace_compression(void) const override;
+            std::string trace_summary(void) const override;
             std::string trace_profile(void) const override;
+            std::string trace_profile_format(void) const override;
+            std::string trace_profile_compression(void) const override;
             std::string trace_endpoint_policy(void) const override;
             std::string profile(void) const override;
             std::string frequency_map(void) const override;
@@ -91,6 +104,9 @@ namespace geopm
             std::string trace_signals(void) const override;
             std::string report_signals(void) const override;
             int max_fan_out(void) const override;
+            std::string tree_comm(void) const override;
+            int tree_comm_max_stale(void) const override;
+            std::string waiter_strategy(void) const override;
             int pmpi_ctl(void) const override;
             bool do_policy(void) const override;
             bool do_endpoint(void) const override;
@@ -16,12 +16,14 @@ namespace geopm
     class GEOPM_PUBLIC Waiter
     {
         public:
-            /// @brief Create a Waiter with "sleep" strategy
+            /// @brief Create a Waiter with the strategy selected by
+            ///        the GEOPM_WAITER_STRATEGY environment variable
             /// @param [in] period Duration in seconds to wait
             static std::unique_ptr<Waiter> make_unique(double period);
             /// @brief Create a Waiter
             /// @param [in] period Duration in seconds to wait
-            /// @param [in] strategy Wait algorithm ("sleep")
+            /// @param [in] strategy Wait algorithm ("sleep",
+            ///        "timerfd" or "hybrid")
             static std::unique_ptr<Waiter> make_unique(double period,
                                                        std::string strategy);
             Waiter() = default;
@@ -34,6 +34,26 @@ struct geopm_endpoint_c;
 int GEOPM_PUBLIC
     geopm_endpoint_create(const char *endpoint_name, struct geopm_endpoint_c **endpoint);
 
+/*!
+ *  @brief Create an endpoint object that also retains a history of
+ *         the most recent samples written by the agent.
+ *
+ *  @param [in] endpoint_name Shared memory key substring used to create
+ *         an endpoint that an agent can attach to.
+ *
+ *  @param [in] history_size Number of samples retained in the
+ *         history ring that can be read with
+ *         geopm_endpoint_read_sample_history(), at most 65536.
+ *
+ *  @param [out] endpoint Opaque pointer to geopm_endpoint_c object,
+ *          or NULL upon failure.
+ *
+ *  @return Zero on success, error code on failure.
+ */
+int GEOPM_PUBLIC
+    geopm_endpoint_create_history(const char *endpoint_name, size_t history_size,
+                                  struct geopm_endpoint_c **endpoint);
+
 /*!
  *  @brief Release resources associated with endpoint.
  *
@@ -105,6 +125,30 @@ int GEOPM_PUBLIC
 int GEOPM_PUBLIC
     geopm_endpoint_wait_for_agent_attach(struct geopm_endpoint_c *endpoint, double timeout);
 
+/*!
+ *  @brief Blocks until the attached agent has detached or the
+ *         timeout is reached.
+ *
+ *  @param [in] endpoint Object created by call to
+ *         geopm_endpoint_create().
+ *
+ *  @param [in] timeout Timeout in seconds.
+ */
+int GEOPM_PUBLIC
+    geopm_endpoint_wait_for_agent_detach(struct geopm_endpoint_c *endpoint, double timeout);
+
+/*!
+ *  @brief Blocks until the attached agent has written a sample that
+ *         has not yet been read or the timeout is reached.
+ *
+ *  @param [in] endpoint Object created by call to
+ *         geopm_endpoint_create().
+ *
+ *  @param [in] timeout Timeout in seconds.
+ */
+int GEOPM_PUBLIC
+    geopm_endpoint_wait_for_sample(struct geopm_endpoint_c *endpoint, double timeout);
+
 /*!
  * @brief Stops any current wait loops the endpoint is running.
  *
@@ -221,6 +265,196 @@ int GEOPM_PUBLIC
     geopm_endpoint_read_sample(struct geopm_endpoint_c *endpoint, size_t num_sample,
                                double *sample_array, double *sample_age_sec);
 
+/*!
+ *  @brief Get all samples written by the agent since the last read
+ *         from an endpoint created with
+ *         geopm_endpoint_create_history().
+ *
+ *  @param [in] endpoint Object created by call to
+ *         geopm_endpoint_create_history() that has reported an
+ *         attached agent that provides samples.
+ *
+ *  @param [in] num_sample Number of values in each sample.
+ *
+ *  @param [in] max_record Number of samples that fit in the output
+ *         arrays.  If more samples are available, only the most
+ *         recent max_record are provided and the others are
+ *         counted as lost.
+ *
+ *  @param [out] sample_array Array of max_record * num_sample
+ *         values, filled with num_record samples, oldest first.
+ *
+ *  @param [out] sample_age_sec Array of max_record values, filled
+ *         with the age in seconds of each sample provided.
+ *
+ *  @param [out] num_record Number of samples provided.
+ *
+ *  @param [out] num_lost Number of samples that were written by the
+ *         agent but could not be provided.
+ *
+ *  @return Zero on success, error code on failure
+ */
+int GEOPM_PUBLIC
+    geopm_endpoint_read_sample_history(struct geopm_endpoint_c *endpoint, size_t num_sample,
+                                       size_t max_record, double *sample_array,
+                                       double *sample_age_sec, size_t *num_record,
+                                       size_t *num_lost);
+
+struct geopm_endpoint_mux_c;
+
+/*!
+ *  @brief Create an endpoint multiplexer that manages many endpoints
+ *         from a single thread.
+ *
+ *  Agents attached to any endpoint added to the multiplexer notify
+ *  a shared doorbell when they attach, detach, or write a sample,
+ *  so that one call to geopm_endpoint_mux_wait() services all of
+ *  the endpoints.
+ *
+ *  @param [in] mux_name Shared memory key substring used to create
+ *         the doorbell shared by all managed endpoints.
+ *
+ *  @param [in] max_endpoint Maximum number of endpoints managed at
+ *         the same time.
+ *
+ *  @param [out] mux Opaque pointer to geopm_endpoint_mux_c object,
+ *         or NULL upon failure.
+ *
+ *  @return Zero on success, error code on failure.
+ */
+int GEOPM_PUBLIC
+    geopm_endpoint_mux_create(const char *mux_name, int max_endpoint,
+                              struct geopm_endpoint_mux_c **mux);
+
+/*!
+ *  @brief Close all managed endpoints and release resources
+ *         associated with the multiplexer.
+ *
+ *  @param [in] mux Object created by call to
+ *         geopm_endpoint_mux_create().
+ *
+ *  @return Zero on success, error code on failure.
+ */
+int GEOPM_PUBLIC
+    geopm_endpoint_mux_destroy(struct geopm_endpoint_mux_c *mux);
+
+/*!
+ *  @brief Create and open an endpoint managed by the multiplexer.
+ *
+ *  @param [in] mux Object created by call to
+ *         geopm_endpoint_mux_create().
+ *
+ *  @param [in] endpoint_name Shared memory key substring used to
+ *         create an endpoint that an agent can attach to.
+ *
+ *  @param [out] endpoint_idx Index of the new endpoint.  Indices of
+ *         removed endpoints are reused.
+ *
+ *  @return Zero on success, error code on failure.
+ */
+int GEOPM_PUBLIC
+    geopm_endpoint_mux_add(struct geopm_endpoint_mux_c *mux,
+                           const char *endpoint_name, int *endpoint_idx);
+
+/*!
+ *  @brief Close and release an endpoint managed by the multiplexer.
+ *
+ *  @param [in] mux Object created by call to
+ *         geopm_endpoint_mux_create().
+ *
+ *  @param [in] endpoint_idx Index returned by
+ *         geopm_endpoint_mux_add().
+ *
+ *  @return Zero on success, error code on failure.
+ */
+int GEOPM_PUBLIC
+    geopm_endpoint_mux_remove(struct geopm_endpoint_mux_c *mux,
+                              int endpoint_idx);
+
+/*!
+ *  @brief Get a handle to a managed endpoint for use with the other
+ *         geopm_endpoint_*() functions.
+ *
+ *  The handle is owned by the multiplexer: it must not be passed to
+ *  geopm_endpoint_destroy(), geopm_endpoint_open() or
+ *  geopm_endpoint_close(), and it is invalid once the endpoint is
+ *  removed.
+ *
+ *  @param [in] mux Object created by call to
+ *         geopm_endpoint_mux_create().
+ *
+ *  @param [in] endpoint_idx Index returned by
+ *         geopm_endpoint_mux_add().
+ *
+ *  @param [out] endpoint Borrowed pointer to the endpoint.
+ *
+ *  @return Zero on success, error code on failure.
+ */
+int GEOPM_PUBLIC
+    geopm_endpoint_mux_endpoint(struct geopm_endpoint_mux_c *mux,
+                                int endpoint_idx,
+                                struct geopm_endpoint_c **endpoint);
+
+/*!
+ *  @brief Block until the agent of at least one managed endpoint
+ *         attaches, detaches or writes a sample, or the timeout is
+ *         reached.
+ *
+ *  @param [in] mux Object created by call to
+ *         geopm_endpoint_mux_create().
+ *
+ *  @param [in] timeout Maximum time to wait in seconds; a negative
+ *         value waits without a time limit.
+ *
+ *  @param [in] ready_idx_max Number of elements allocated for the
+ *         ready_idx array; must be at least max_endpoint.
+ *
+ *  @param [out] ready_idx Array filled with the indices of the
+ *         updated endpoints in increasing order.
+ *
+ *  @param [out] num_ready Number of indices written to ready_idx;
+ *         zero if the timeout was reached.
+ *
+ *  @return Zero on success, error code on failure.  If ready_idx_max
+ *          is less than max_endpoint GEOPM_ERROR_INVALID is returned
+ *          without waiting.
+ */
+int GEOPM_PUBLIC
+    geopm_endpoint_mux_wait(struct geopm_endpoint_mux_c *mux, double timeout,
+                            size_t ready_idx_max, int *ready_idx, int *num_ready);
+
+/*!
+ *  @brief Read the latest sample of every endpoint slot into one
+ *         contiguous array.
+ *
+ *  @param [in] mux Object created by call to
+ *         geopm_endpoint_mux_create().
+ *
+ *  @param [in] stride Number of values reserved per endpoint.
+ *         Samples with fewer values are padded with NAN, longer
+ *         samples are truncated.
+ *
+ *  @param [in] sample_array_max Number of elements allocated for the
+ *         sample_array; must be at least max_endpoint * stride.
+ *
+ *  @param [out] sample_array Values for endpoint index N begin at
+ *         N * stride.
+ *
+ *  @param [in] sample_age_max Number of elements allocated for the
+ *         sample_age_sec array; must be at least max_endpoint.
+ *
+ *  @param [out] sample_age_sec Age of each sample in seconds, or NAN
+ *         if the slot is unused or no agent is attached.
+ *
+ *  @return Zero on success, error code on failure.  If either array
+ *          is too small GEOPM_ERROR_INVALID is returned and neither
+ *          array is modified.
+ */
+int GEOPM_PUBLIC
+    geopm_endpoint_mux_read_sample(struct geopm_endpoint_mux_c *mux, size_t stride,
+                                   size_t sample_array_max, double *sample_array,
+                                   size_t sample_age_max, double *sample_age_sec);
+
 #ifdef __cplusplus
 }
 #endif
@@ -165,13 +165,15 @@ namespace geopm
             auto &proc_it = proc_map_it.second;
             proc_it.record_log->dump(proc_it.records, proc_it.short_regions);
             if (m_is_filtered) {
-                // Filter and check the records and push them onto
-                // m_record_buffer
+                // Filter the records directly onto m_record_buffer
+                // and check them
                 for (const auto &record_it : proc_it.records) {
-                    for (auto &filtered_it : proc_it.filter->filter(record_it)) {
-                        proc_it.valid.check(filtered_it);
-                        m_record_buffer.push_back(filtered_it);
-                    }
+                    proc_it.filter->filter(record_it, m_record_buffer);
+                }
+                for (auto record_it = m_record_buffer.begin() + record_offset;
+                     record_it != m_record_buffer.end();
+                     ++record_it) {
+                    proc_it.valid.check(*record_it);
                 }
             }
             else {
@@ -278,7 +280,7 @@ namespace geopm
         }
     }
 
-    std::vector<record_s> ApplicationSamplerImp::get_records(void) const
+    const std::vector<record_s> &ApplicationSamplerImp::get_records(void) const
     {
         return m_record_buffer;
     }
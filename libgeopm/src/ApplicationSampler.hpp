@@ -42,8 +42,11 @@ namespace geopm
             /// @brief Get all of the application events that have
             ///        been recorded since the last call to
             ///        update_records().
-            /// @return Vector of application event records.
-            virtual std::vector<record_s> get_records(void) const = 0;
+            /// @return Read-only view of the application event
+            ///         records.  The view refers to the internal
+            ///         record buffer and is valid until the next call
+            ///         to update().
+            virtual const std::vector<record_s> &get_records(void) const = 0;
             virtual short_region_s get_short_region(uint64_t event_signal) const = 0;
             /// @brief Get the region hash associated with a CPU.
             ///
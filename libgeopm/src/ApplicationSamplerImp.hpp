@@ -42,7 +42,7 @@ namespace geopm
                                   std::shared_ptr<Scheduler> scheduler);
             virtual ~ApplicationSamplerImp() = default;
             void update(const geopm_time_s &curr_time) override;
-            std::vector<record_s> get_records(void) const override;
+            const std::vector<record_s> &get_records(void) const override;
             short_region_s get_short_region(uint64_t event_signal) const override;
             uint64_t cpu_region_hash(int cpu_idx) const override;
             uint64_t cpu_hint(int cpu_idx) const override;
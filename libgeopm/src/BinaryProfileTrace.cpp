@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "BinaryProfileTrace.hpp"
+
+#include <errno.h>
+
+#include <algorithm>
+#include <cstddef>
+
+#include "geopm/Exception.hpp"
+#include "binary_write.hpp"
+
+namespace geopm
+{
+    static_assert(sizeof(record_s) == 32 &&
+                  offsetof(record_s, process) == 16 &&
+                  offsetof(record_s, event) == 20 &&
+                  offsetof(record_s, signal) == 24,
+                  "BinaryProfileTrace: record_s layout does not match the file format");
+
+    const std::string &BinaryProfileTrace::magic(void)
+    {
+        static const std::string result = "GEOPMPTR";
+        return result;
+    }
+
+    BinaryProfileTrace::BinaryProfileTrace(const std::string &file_path,
+                                           const std::string &host_name,
+                                           const std::vector<std::pair<std::string, std::string> > &header,
+                                           size_t block_size)
+        : m_file_path(file_path)
+        , M_BLOCK_SIZE(std::max(block_size, (size_t)1))
+        , m_offset(0)
+        , m_time_zero{{0, 0}}
+    {
+        if (host_name.size()) {
+            m_file_path += "-" + host_name;
+        }
+        m_stream.open(m_file_path, std::ios::binary);
+        if (!m_stream.good()) {
+            throw Exception("Unable to open profile trace file '" + m_file_path + "'",
+                            errno ? errno : GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        m_record.reserve(M_BLOCK_SIZE);
+        std::string buffer = magic();
+        binary_write(buffer, M_VERSION);
+        binary_write(buffer, (uint32_t)M_BLOCK_SIZE);
+        binary_write(buffer, header);
+        write(buffer);
+    }
+
+    BinaryProfileTrace::~BinaryProfileTrace()
+    {
+        flush();
+        std::string buffer = "GEOPMPTI";
+        binary_write(buffer, (uint64_t)m_index.size());
+        for (const auto &index : m_index) {
+            binary_write(buffer, index.offset);
+            binary_write(buffer, index.begin_time);
+            binary_write(buffer, index.end_time);
+        }
+        binary_write(buffer, m_offset);
+        buffer += "GEOPMPTE";
+        write(buffer);
+    }
+
+    void BinaryProfileTrace::time_zero(const geopm_time_s &time_zero)
+    {
+        if (time_zero.t.tv_sec != m_time_zero.t.tv_sec ||
+            time_zero.t.tv_nsec != m_time_zero.t.tv_nsec) {
+            flush();
+            m_time_zero = time_zero;
+        }
+    }
+
+    void BinaryProfileTrace::append(const record_s &record)
+    {
+        m_record.push_back(record);
+        if (m_record.size() == M_BLOCK_SIZE) {
+            flush();
+        }
+    }
+
+    void BinaryProfileTrace::append(const record_s &record, const short_region_s &short_region)
+    {
+        m_short_region.push_back(short_region);
+        append(record);
+    }
+
+    void BinaryProfileTrace::flush(void)
+    {
+        if (m_record.empty()) {
+            return;
+        }
+        double begin_time = geopm_time_diff(&m_time_zero, &m_record.front().time);
+        double end_time = geopm_time_diff(&m_time_zero, &m_record.back().time);
+        m_index.push_back({m_offset, begin_time, end_time});
+
+        std::string buffer;
+        buffer.reserve(48 + m_record.size() * sizeof(record_s) +
+                       m_short_region.size() * 24);
+        binary_write(buffer, (uint32_t)m_record.size());
+        binary_write(buffer, (uint32_t)m_short_region.size());
+        binary_write(buffer, (int64_t)m_time_zero.t.tv_sec);
+        binary_write(buffer, (int64_t)m_time_zero.t.tv_nsec);
+        binary_write(buffer, begin_time);
+        binary_write(buffer, end_time);
+        buffer.append((const char *)m_record.data(), m_record.size() * sizeof(record_s));
+        for (const auto &short_region : m_short_region) {
+            binary_write(buffer, short_region.hash);
+            binary_write(buffer, short_region.num_complete);
+            binary_write(buffer, (uint32_t)0);
+            binary_write(buffer, short_region.total_time);
+        }
+        write(buffer);
+        m_record.clear();
+        m_short_region.clear();
+    }
+
+    void BinaryProfileTrace::write(const std::string &buffer)
+    {
+        m_stream.write(buffer.data(), buffer.size());
+        m_stream.flush();
+        m_offset += buffer.size();
+    }
+}
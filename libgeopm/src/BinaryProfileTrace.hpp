@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef BINARYPROFILETRACE_HPP_INCLUDE
+#define BINARYPROFILETRACE_HPP_INCLUDE
+
+#include <cstdint>
+
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "geopm_time.h"
+#include "record.hpp"
+
+namespace geopm
+{
+    /// @brief Writes the application records of the profile trace as
+    ///        an event log in a compact binary format.
+    ///
+    /// All integers and doubles are stored in the byte order of the
+    /// host that wrote the file, and strings are stored as a uint32
+    /// byte count followed by the bytes without a terminator.  Times
+    /// are seconds since the time zero of the block that holds them.
+    /// A file is the header followed by blocks of up to block_size
+    /// records each, and the index once the file is closed:
+    ///
+    /// @code
+    /// header:
+    ///     char     magic[8]                 "GEOPMPTR"
+    ///     uint32   version
+    ///     uint32   block_size
+    ///     uint32   num_header_field
+    ///     string   key, value               for each header field
+    /// block:
+    ///     uint32   num_record
+    ///     uint32   num_short_region
+    ///     int64    time_zero_sec
+    ///     int64    time_zero_nsec
+    ///     double   begin_time               time of the first record
+    ///     double   end_time                 time of the last record
+    ///     record   record[num_record]
+    ///     short    short_region[num_short_region]
+    /// record (record_s):
+    ///     int64    time_sec
+    ///     int64    time_nsec
+    ///     int32    process
+    ///     int32    event                    event_e
+    ///     uint64   signal
+    /// short (short_region_s):
+    ///     uint64   hash
+    ///     int32    num_complete
+    ///     uint32   zero
+    ///     double   total_time
+    /// index:
+    ///     char     magic[8]                 "GEOPMPTI"
+    ///     uint64   num_block
+    ///     uint64   offset; double begin_time, end_time   for each block
+    ///     uint64   index_offset
+    ///     char     magic[8]                 "GEOPMPTE"
+    /// @endcode
+    ///
+    /// The signal of an EVENT_SHORT_REGION record is only meaningful
+    /// while the controller runs; the n-th such record in a block is
+    /// described by the n-th short_region of the block instead.  The
+    /// index lets a reader seek to the blocks of a time range.  A
+    /// file that is still being written, or that was not closed, has
+    /// no index and is read by walking the blocks from the header.
+    class BinaryProfileTrace
+    {
+        public:
+            static constexpr uint32_t M_VERSION = 1;
+            /// @brief File signature, without a terminator.
+            static const std::string &magic(void);
+            /// @param [in] file_path Path of the file to create; the
+            ///        host name is appended with a "-" if not empty.
+            /// @param [in] header Key-value pairs stored in the file
+            ///        header in order.
+            /// @param [in] block_size Maximum number of records in
+            ///        a block.  A block is written to the file once
+            ///        it is full.
+            BinaryProfileTrace(const std::string &file_path,
+                               const std::string &host_name,
+                               const std::vector<std::pair<std::string, std::string> > &header,
+                               size_t block_size);
+            BinaryProfileTrace(const BinaryProfileTrace &other) = delete;
+            BinaryProfileTrace &operator=(const BinaryProfileTrace &other) = delete;
+            /// @brief Writes the last block and the index.
+            virtual ~BinaryProfileTrace();
+            /// @brief Set the time zero for the records that follow.
+            ///        Ends the current block if the time zero
+            ///        changes.
+            void time_zero(const geopm_time_s &time_zero);
+            /// @brief Append a record that is not an
+            ///        EVENT_SHORT_REGION.
+            void append(const record_s &record);
+            /// @brief Append an EVENT_SHORT_REGION record with the
+            ///        short region that its signal refers to.
+            void append(const record_s &record, const short_region_s &short_region);
+            /// @brief Write the records appended so far as a block.
+            void flush(void);
+        private:
+            struct m_index_s {
+                uint64_t offset;
+                double begin_time;
+                double end_time;
+            };
+            void write(const std::string &buffer);
+
+            std::string m_file_path;
+            std::ofstream m_stream;
+            const size_t M_BLOCK_SIZE;
+            uint64_t m_offset;
+            geopm_time_s m_time_zero;
+            std::vector<record_s> m_record;
+            std::vector<short_region_s> m_short_region;
+            std::vector<m_index_s> m_index;
+    };
+}
+
+#endif
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "BinaryReport.hpp"
+
+#include <cmath>
+
+#include <algorithm>
+#include <map>
+
+#include "geopm/Exception.hpp"
+#include "binary_write.hpp"
+
+namespace geopm
+{
+    const std::string &BinaryReport::magic(void)
+    {
+        static const std::string result = "GEOPMRPT";
+        return result;
+    }
+
+    std::string BinaryReport::header(const std::vector<std::pair<std::string, std::string> > &header,
+                                     const std::vector<size_t> &host_block_size)
+    {
+        std::string result = magic();
+        binary_write(result, M_VERSION);
+        binary_write(result, (uint32_t)host_block_size.size());
+        std::string fields;
+        binary_write(fields, header);
+        uint64_t offset = result.size() +
+                          host_block_size.size() * sizeof(uint64_t) +
+                          fields.size();
+        for (auto size : host_block_size) {
+            binary_write(result, offset);
+            offset += size;
+        }
+        result += fields;
+        return result;
+    }
+
+    std::string BinaryReport::host_block(const report_host_s &host)
+    {
+        std::string result;
+        binary_write(result, host.host_name);
+        binary_write(result, host.agent_field);
+
+        // Columns in the order they first appear
+        std::vector<std::string> column_name;
+        std::map<std::string, size_t> column_idx;
+        for (const auto &region : host.region) {
+            for (const auto &field : region.field) {
+                if (column_idx.emplace(field.first, column_name.size()).second) {
+                    column_name.push_back(field.first);
+                }
+            }
+        }
+        size_t num_region = host.region.size();
+        std::vector<double> value(column_name.size() * num_region, NAN);
+        for (size_t region_idx = 0; region_idx != num_region; ++region_idx) {
+            for (const auto &field : host.region[region_idx].field) {
+                value[column_idx.at(field.first) * num_region + region_idx] = field.second;
+            }
+        }
+
+        binary_write(result, (uint32_t)num_region);
+        binary_write(result, (uint32_t)column_name.size());
+        for (const auto &name : column_name) {
+            binary_write(result, name);
+        }
+        for (const auto &region : host.region) {
+            binary_write(result, (uint32_t)region.type);
+        }
+        for (const auto &region : host.region) {
+            binary_write(result, region.hash);
+        }
+        for (const auto &region : host.region) {
+            binary_write(result, region.name);
+        }
+        result.append((const char *)value.data(), value.size() * sizeof(double));
+
+        uint32_t num_agent_region_field = 0;
+        for (const auto &region : host.region) {
+            num_agent_region_field += region.agent_field.size();
+        }
+        binary_write(result, num_agent_region_field);
+        for (size_t region_idx = 0; region_idx != num_region; ++region_idx) {
+            for (const auto &kv : host.region[region_idx].agent_field) {
+                binary_write(result, (uint32_t)region_idx);
+                binary_write(result, kv.first);
+                binary_write(result, kv.second);
+            }
+        }
+
+        binary_write(result, (uint32_t)host.overhead.size());
+        for (const auto &kv : host.overhead) {
+            binary_write(result, kv.first);
+            binary_write(result, kv.second);
+        }
+        return result;
+    }
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef BINARYREPORT_HPP_INCLUDE
+#define BINARYREPORT_HPP_INCLUDE
+
+#include <cstdint>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace geopm
+{
+    /// @brief Values reported for one host, independent of the
+    ///        format used to write them.
+    struct report_host_s {
+        enum m_region_type_e {
+            M_REGION_TYPE_REGION,
+            M_REGION_TYPE_UNMARKED,
+            M_REGION_TYPE_EPOCH,
+            M_REGION_TYPE_APP,
+        };
+        struct m_region_s {
+            int type;
+            /// Region name; empty unless type is M_REGION_TYPE_REGION
+            std::string name;
+            uint64_t hash;
+            std::vector<std::pair<std::string, double> > field;
+            std::vector<std::pair<std::string, std::string> > agent_field;
+        };
+        std::string host_name;
+        std::vector<std::pair<std::string, std::string> > agent_field;
+        /// Marked regions in report order, followed by the unmarked,
+        /// epoch and application totals
+        std::vector<m_region_s> region;
+        /// Controller overhead listed with the application totals
+        std::vector<std::pair<std::string, double> > overhead;
+    };
+
+    /// @brief Encodes reports in a compact binary format that can be
+    ///        loaded without parsing text.
+    ///
+    /// All integers and doubles are stored in the byte order of the
+    /// host that wrote the file, and strings are stored as a uint32
+    /// byte count followed by the bytes without a terminator.  A file
+    /// is the header followed by one block per host:
+    ///
+    /// @code
+    /// header:
+    ///     char     magic[8]                 "GEOPMRPT"
+    ///     uint32   version
+    ///     uint32   num_host
+    ///     uint64   host_offset[num_host]    from the start of the file
+    ///     uint32   num_header_field
+    ///     string   key, value               for each header field
+    /// host block:
+    ///     string   host_name
+    ///     uint32   num_agent_field
+    ///     string   key, value               for each agent host field
+    ///     uint32   num_region
+    ///     uint32   num_column
+    ///     string   column_name[num_column]
+    ///     uint32   region_type[num_region]  report_host_s::m_region_type_e
+    ///     uint64   region_hash[num_region]
+    ///     string   region_name[num_region]
+    ///     double   value[num_column][num_region]
+    ///     uint32   num_agent_region_field
+    ///     uint32   region_idx; string key, value  for each field
+    ///     uint32   num_overhead
+    ///     string   key; double value        for each overhead field
+    /// @endcode
+    ///
+    /// Each column holds one field for every region; fields that a
+    /// region does not report are NAN.
+    class BinaryReport
+    {
+        public:
+            static constexpr uint32_t M_VERSION = 1;
+            /// @brief File signature, without a terminator.
+            static const std::string &magic(void);
+            /// @brief Encode the file header.
+            /// @param [in] header Key-value pairs of the report
+            ///        header in order.
+            /// @param [in] host_block_size Size in bytes of each host
+            ///        block that will follow the header.
+            static std::string header(const std::vector<std::pair<std::string, std::string> > &header,
+                                      const std::vector<size_t> &host_block_size);
+            /// @brief Encode the block for one host.
+            static std::string host_block(const report_host_s &host);
+    };
+}
+
+#endif
@@ -6,6 +6,8 @@
 #include <climits>
 #include <cinttypes>
 
+#include <zlib.h>
+
 #include "geopm_version.h"
 #include "geopm_hash.h"
 #include "geopm/Helper.hpp"
@@ -19,6 +21,16 @@ namespace geopm
                    const std::string &host_name,
                    const std::string &start_time,
                    size_t buffer_size)
+        : CSVImp(file_path, host_name, start_time, buffer_size, "none")
+    {
+
+    }
+
+    CSVImp::CSVImp(const std::string &file_path,
+                   const std::string &host_name,
+                   const std::string &start_time,
+                   size_t buffer_size,
+                   const std::string &compression)
         : M_NAME_FORMAT_MAP {{"double", string_format_double},
                              {"float", string_format_float},
                              {"integer", string_format_integer},
@@ -28,11 +40,22 @@ namespace geopm
         , m_file_path(file_path)
         , m_buffer_limit(buffer_size)
         , m_is_active(false)
+        , m_is_compressed(compression == "gzip")
     {
+        if (compression != "none" && compression != "gzip") {
+            throw Exception("CSVImp: compression must be \"none\" or \"gzip\": \"" + compression + "\"",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
         if (host_name.size()) {
             m_file_path += "-" + host_name;
         }
-        m_stream.open(m_file_path);
+        if (m_is_compressed) {
+            m_file_path += ".gz";
+            m_stream.open(m_file_path, std::ios::binary);
+        }
+        else {
+            m_stream.open(m_file_path);
+        }
         if (!m_stream.good()) {
             throw Exception("Unable to open CSV file '" + m_file_path + "'",
                             errno ? errno : GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
@@ -101,11 +124,46 @@ namespace geopm
 
     void CSVImp::flush(void)
     {
-        m_stream << m_buffer.str();
+        if (m_is_compressed) {
+            std::string text = m_buffer.str();
+            if (!text.empty()) {
+                std::string member = gzip_member(text);
+                m_stream.write(member.data(), member.size());
+            }
+        }
+        else {
+            m_stream << m_buffer.str();
+        }
         m_stream.flush();
         m_buffer.str("");
     }
 
+    std::string CSVImp::gzip_member(const std::string &text)
+    {
+        // Favor speed over ratio: the flush blocks the caller, and
+        // the repeated rows of a trace compress well at any level.
+        z_stream stream = {};
+        int err = deflateInit2(&stream, Z_BEST_SPEED, Z_DEFLATED,
+                               MAX_WBITS + 16, 8, Z_DEFAULT_STRATEGY);
+        if (err != Z_OK) {
+            throw Exception("CSVImp::gzip_member(): deflateInit2() failed",
+                            GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        std::string result(deflateBound(&stream, text.size()), '\0');
+        stream.next_in = (Bytef *)text.data();
+        stream.avail_in = text.size();
+        stream.next_out = (Bytef *)&result[0];
+        stream.avail_out = result.size();
+        err = deflate(&stream, Z_FINISH);
+        result.resize(stream.total_out);
+        deflateEnd(&stream);
+        if (err != Z_STREAM_END) {
+            throw Exception("CSVImp::gzip_member(): deflate() failed",
+                            GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        return result;
+    }
+
     void CSVImp::write_header(const std::string &host_name, const std::string &start_time)
     {
         m_buffer << "# geopm_version: " << geopm_version() << "\n"
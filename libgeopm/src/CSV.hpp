@@ -80,6 +80,16 @@ namespace geopm
                    const std::string &host_name,
                    const std::string &start_time,
                    size_t buffer_size);
+            /// @param [in] compression Either "none" or "gzip".  When
+            ///        "gzip", ".gz" is appended to the file path and
+            ///        each flush() writes the buffered text as one
+            ///        complete gzip member, so the file can be read
+            ///        up to the last flush while it is still open.
+            CSVImp(const std::string &file_path,
+                   const std::string &host_name,
+                   const std::string &start_time,
+                   size_t buffer_size,
+                   const std::string &compression);
             CSVImp(const CSVImp &other) = delete;
             CSVImp & operator=(const CSVImp &other) = delete;
             virtual ~CSVImp();
@@ -94,6 +104,7 @@ namespace geopm
         private:
             void write_header(const std::string &host_name, const std::string &start_time);
             void write_names(void);
+            static std::string gzip_member(const std::string &text);
 
             const std::map<std::string, std::function<std::string(double)> > M_NAME_FORMAT_MAP;
             const char M_SEPARATOR;
@@ -104,6 +115,7 @@ namespace geopm
             std::ostringstream m_buffer;
             off_t m_buffer_limit;
             bool m_is_active;
+            bool m_is_compressed;
     };
 }
 
@@ -15,6 +15,7 @@
 #include <algorithm>
 #include <geopm/Environment.hpp>
 #include <geopm_plugin.hpp>
+#include "ShmComm.hpp"
 #ifdef GEOPM_ENABLE_MPI
 #include "MPIComm.hpp"
 #endif
@@ -31,6 +32,8 @@ namespace geopm
 #endif
         register_plugin(geopm::NullComm::plugin_name(),
                         geopm::NullComm::make_plugin);
+        register_plugin(geopm::ShmComm::plugin_name(),
+                        geopm::ShmComm::make_plugin);
     }
 
 
@@ -302,6 +305,30 @@ namespace geopm
         std::copy((char *)send_buf, (char*)send_buf + send_size, data_ptr);
     }
 
+    size_t NullComm::isend(const void *send_buf, size_t send_size, int rank, int tag)
+    {
+        throw Exception("NullComm::" + std::string(__func__) + "(): NullComm is only valid with one rank",
+                        GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+    }
+
+    size_t NullComm::irecv(void *recv_buf, size_t recv_size, int rank, int tag)
+    {
+        throw Exception("NullComm::" + std::string(__func__) + "(): NullComm is only valid with one rank",
+                        GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+    }
+
+    bool NullComm::request_test(size_t request_id)
+    {
+        throw Exception("NullComm::" + std::string(__func__) + "(): request_id is out of bounds",
+                        GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+    }
+
+    void NullComm::request_cancel(size_t request_id)
+    {
+        throw Exception("NullComm::" + std::string(__func__) + "(): request_id is out of bounds",
+                        GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+    }
+
     void NullComm::tear_down(void)
     {
 
@@ -179,6 +179,59 @@ namespace geopm
             ///
             /// @param [in] window_id The window handle for the target window.
             virtual void window_put(const void *send_buf, size_t send_size, int rank, off_t disp, size_t window_id) const = 0;
+            /// @brief Start a non-blocking send of a message to
+            ///        another rank.  The send buffer must not be
+            ///        modified until request_test() reports that the
+            ///        request is complete.
+            ///
+            /// @param [in] send_buf Start address of memory buffer to be transmitted.
+            ///
+            /// @param [in] send_size Size in bytes of buffer to be sent.
+            ///
+            /// @param [in] rank Target rank of the transmission.
+            ///
+            /// @param [in] tag Message tag that must match the tag
+            ///        given to irecv() by the target.
+            ///
+            /// @return Request handle for subsequent calls to
+            ///         request_test() or request_cancel().
+            virtual size_t isend(const void *send_buf, size_t send_size, int rank, int tag) = 0;
+            /// @brief Post a non-blocking receive of a message from
+            ///        another rank.  The receive buffer is valid once
+            ///        request_test() reports that the request is
+            ///        complete.
+            ///
+            /// @param [out] recv_buf Start address of memory buffer to receive data.
+            ///
+            /// @param [in] recv_size Size in bytes of the receive buffer.
+            ///
+            /// @param [in] rank Source rank of the transmission.
+            ///
+            /// @param [in] tag Message tag that must match the tag
+            ///        given to isend() by the source.
+            ///
+            /// @return Request handle for subsequent calls to
+            ///         request_test() or request_cancel().
+            virtual size_t irecv(void *recv_buf, size_t recv_size, int rank, int tag) = 0;
+            /// @brief Check whether a non-blocking request has
+            ///        completed.  The request handle is released and
+            ///        is no longer valid once true is returned.
+            ///
+            /// @param [in] request_id Handle returned by isend() or
+            ///        irecv().
+            ///
+            /// @return True if the request has completed.
+            virtual bool request_test(size_t request_id) = 0;
+            /// @brief Cancel a pending non-blocking request and
+            ///        release the request handle.  A pending send
+            ///        can not be cancelled: its handle is released
+            ///        and the message is still delivered, so the
+            ///        send buffer must remain valid until the
+            ///        receiver has completed the matching irecv().
+            ///
+            /// @param [in] request_id Handle returned by isend() or
+            ///        irecv().
+            virtual void request_cancel(size_t request_id) = 0;
             /// @brief Clean up resources held by the comm.  This
             ///        allows static global objects to be cleaned up
             ///        before the destructor is called.
@@ -229,6 +282,10 @@ namespace geopm
             void gatherv(const void *send_buf, size_t send_size, void *recv_buf,
                                  const std::vector<size_t> &recv_sizes, const std::vector<off_t> &rank_offset, int root) const override;
             void window_put(const void *send_buf, size_t send_size, int rank, off_t disp, size_t window_id) const override;
+            size_t isend(const void *send_buf, size_t send_size, int rank, int tag) override;
+            size_t irecv(void *recv_buf, size_t recv_size, int rank, int tag) override;
+            bool request_test(size_t request_id) override;
+            void request_cancel(size_t request_id) override;
             void tear_down(void) override;
             static std::string plugin_name(void);
             static std::unique_ptr<Comm> make_plugin();
@@ -34,6 +34,7 @@
 #include "record.hpp"
 #include "geopm/PlatformIOProf.hpp"
 #include "InitControl.hpp"
+#include "ControllerPhase.hpp"
 
 #include "EpochIOGroup.hpp"
 #include "ProfileIOGroup.hpp"
@@ -242,6 +243,7 @@ namespace geopm
         , m_max_level(m_num_level_ctl + 1)
         , m_root_level(m_tree_comm->root_level())
         , m_application_sampler(application_sampler)
+        , m_phase(ControllerPhase::controller_phase())
         , m_application_io(std::move(application_io))
         , m_reporter(std::move(reporter))
         , m_tracer(std::move(tracer))
@@ -417,8 +419,12 @@ namespace geopm
     void Controller::step(void)
     {
         walk_down();
-        m_agent[0]->wait();
+        {
+            ControllerPhase::ScopedTimer timer(m_phase, ControllerPhase::M_PHASE_WAIT);
+            m_agent[0]->wait();
+        }
         walk_up();
+        m_phase.end_step();
     }
 
     void Controller::walk_down(void)
@@ -426,6 +432,7 @@ namespace geopm
         bool do_send = false;
         if (m_is_root) {
             if (m_do_endpoint) {
+                ControllerPhase::ScopedTimer timer(m_phase, ControllerPhase::M_PHASE_ENDPOINT);
                 (void) m_endpoint->read_policy(m_in_policy);
                 bool equal = std::equal(m_in_policy.begin(), m_in_policy.end(),
                                         m_last_policy.begin(),
@@ -445,60 +452,90 @@ namespace geopm
                 }
             }
             else if (m_do_policy) {
+                ControllerPhase::ScopedTimer timer(m_phase, ControllerPhase::M_PHASE_ENDPOINT);
                 m_in_policy = m_file_policy->get_policy();
                 do_send = true;
             }
         }
         else {
+            ControllerPhase::ScopedTimer timer(m_phase, ControllerPhase::M_PHASE_TREE_COMM_DOWN);
             do_send = m_tree_comm->receive_down(m_num_level_ctl, m_in_policy);
         }
         for (int level = m_num_level_ctl - 1; level > -1; --level) {
             if (do_send) {
+                ControllerPhase::ScopedTimer timer(m_phase, ControllerPhase::M_PHASE_AGENT_POLICY);
                 m_agent[level + 1]->validate_policy(m_in_policy);
                 m_agent[level + 1]->split_policy(m_in_policy, m_out_policy[level]);
                 do_send = m_agent[level + 1]->do_send_policy();
             }
+            ControllerPhase::ScopedTimer timer(m_phase, ControllerPhase::M_PHASE_TREE_COMM_DOWN);
             if (do_send) {
                 m_tree_comm->send_down(level, m_out_policy[level]);
             }
             do_send = m_tree_comm->receive_down(level, m_in_policy);
         }
-        m_agent[0]->validate_policy(m_in_policy);
-        m_agent[0]->adjust_platform(m_in_policy);
+        {
+            ControllerPhase::ScopedTimer timer(m_phase, ControllerPhase::M_PHASE_AGENT_ADJUST);
+            m_agent[0]->validate_policy(m_in_policy);
+            m_agent[0]->adjust_platform(m_in_policy);
+        }
         if (m_agent[0]->do_write_batch()) {
+            ControllerPhase::ScopedTimer timer(m_phase, ControllerPhase::M_PHASE_WRITE_BATCH);
             m_platform_io.write_batch();
         }
     }
 
     void Controller::walk_up(void)
     {
-        geopm_time_s curr_time;
-        geopm_time(&curr_time);
-        m_application_sampler.update(curr_time);
-        m_platform_io.read_batch();
-        m_agent[0]->sample_platform(m_out_sample);
-        bool do_send = m_agent[0]->do_send_sample();
-        m_reporter->update();
-        m_agent[0]->trace_values(m_trace_sample);
-        m_tracer->update(m_trace_sample);
-        m_profile_tracer->update(m_application_sampler.get_records());
+        {
+            ControllerPhase::ScopedTimer timer(m_phase, ControllerPhase::M_PHASE_APPLICATION_SAMPLER);
+            geopm_time_s curr_time;
+            geopm_time(&curr_time);
+            m_application_sampler.update(curr_time);
+        }
+        {
+            ControllerPhase::ScopedTimer timer(m_phase, ControllerPhase::M_PHASE_READ_BATCH);
+            m_platform_io.read_batch();
+        }
+        bool do_send = false;
+        {
+            ControllerPhase::ScopedTimer timer(m_phase, ControllerPhase::M_PHASE_AGENT_SAMPLE);
+            m_agent[0]->sample_platform(m_out_sample);
+            do_send = m_agent[0]->do_send_sample();
+        }
+        {
+            ControllerPhase::ScopedTimer timer(m_phase, ControllerPhase::M_PHASE_REPORTER);
+            m_reporter->update();
+        }
+        {
+            ControllerPhase::ScopedTimer timer(m_phase, ControllerPhase::M_PHASE_TRACER);
+            m_agent[0]->trace_values(m_trace_sample);
+            m_tracer->update(m_trace_sample);
+            m_profile_tracer->update(m_application_sampler.get_records());
+        }
 
         for (int level = 0; level < m_num_level_ctl; ++level) {
-            if (do_send) {
-                m_tree_comm->send_up(level, m_out_sample);
+            {
+                ControllerPhase::ScopedTimer timer(m_phase, ControllerPhase::M_PHASE_TREE_COMM_UP);
+                if (do_send) {
+                    m_tree_comm->send_up(level, m_out_sample);
+                }
+                do_send = m_tree_comm->receive_up(level, m_in_sample[level]);
             }
-            do_send = m_tree_comm->receive_up(level, m_in_sample[level]);
             if (do_send) {
+                ControllerPhase::ScopedTimer timer(m_phase, ControllerPhase::M_PHASE_AGENT_AGGREGATE);
                 m_agent[level + 1]->aggregate_sample(m_in_sample[level], m_out_sample);
                 do_send = m_agent[level + 1]->do_send_sample();
             }
         }
         if (do_send) {
             if (!m_is_root) {
+                ControllerPhase::ScopedTimer timer(m_phase, ControllerPhase::M_PHASE_TREE_COMM_UP);
                 m_tree_comm->send_up(m_num_level_ctl, m_out_sample);
             }
             else {
                 if (m_do_endpoint) {
+                    ControllerPhase::ScopedTimer timer(m_phase, ControllerPhase::M_PHASE_ENDPOINT);
                     m_endpoint->write_sample(m_out_sample);
                 }
             }
@@ -29,6 +29,7 @@ namespace geopm
     class ProfileTracer;
     class ApplicationSampler;
     class InitControl;
+    class ControllerPhase;
 
     class Controller
     {
@@ -146,6 +147,7 @@ namespace geopm
             const int m_max_level;
             const int m_root_level;
             ApplicationSampler &m_application_sampler;
+            ControllerPhase &m_phase;
             std::shared_ptr<ApplicationIO> m_application_io;
             std::unique_ptr<Reporter> m_reporter;
             std::unique_ptr<Tracer> m_tracer;
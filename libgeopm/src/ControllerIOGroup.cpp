@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "ControllerIOGroup.hpp"
+
+#include <algorithm>
+#include <cctype>
+
+#include "geopm/Helper.hpp"
+
+namespace geopm
+{
+    ControllerIOGroup::ControllerIOGroup()
+        : ControllerIOGroup(ControllerPhase::controller_phase())
+    {
+
+    }
+
+    ControllerIOGroup::ControllerIOGroup(const ControllerPhase &phase)
+        : SummaryIOGroup("ControllerIOGroup", plugin_name(), make_signal_info(),
+                         [&phase]() {
+                             std::array<ControllerPhase::m_summary_s, ControllerPhase::M_NUM_PHASE> result;
+                             for (int phase_idx = 0; phase_idx != ControllerPhase::M_NUM_PHASE; ++phase_idx) {
+                                 result[phase_idx] = phase.summary(phase_idx);
+                             }
+                             return result;
+                         })
+    {
+
+    }
+
+    std::map<std::string, ControllerIOGroup::m_signal_info_s> ControllerIOGroup::make_signal_info(void)
+    {
+        std::map<std::string, m_signal_info_s> result;
+        for (int phase_idx = 0; phase_idx != ControllerPhase::M_NUM_PHASE; ++phase_idx) {
+            std::string phase = ControllerPhase::phase_name()[phase_idx];
+            std::string prefix = plugin_name() + "::" + phase;
+            std::string phase_lower = phase;
+            std::transform(phase_lower.begin(), phase_lower.end(), phase_lower.begin(),
+                           [](char cc) { return cc == '_' ? ' ' : std::tolower(cc); });
+            std::string subject = "the " + phase_lower + " phase of the control loop";
+            // Each signal is a function of the summary of one phase
+            auto add_signal = [&result, phase_idx](const std::string &signal_name,
+                                                   const std::string &description,
+                                                   int behavior,
+                                                   std::function<double(const ControllerPhase::m_summary_s &)> value) {
+                result[signal_name] = {
+                    description, behavior,
+                    [phase_idx, value](const std::array<ControllerPhase::m_summary_s, ControllerPhase::M_NUM_PHASE> &summary) {
+                        return value(summary[phase_idx]);
+                    }};
+            };
+            add_signal(prefix + "_COUNT",
+                       "Number of control loop steps that entered " + subject,
+                       IOGroup::M_SIGNAL_BEHAVIOR_MONOTONE,
+                       [](const ControllerPhase::m_summary_s &summary) {
+                           return (double)summary.count;
+                       });
+            add_signal(prefix + "_TIME",
+                       "Total time in seconds spent in " + subject,
+                       IOGroup::M_SIGNAL_BEHAVIOR_MONOTONE,
+                       [](const ControllerPhase::m_summary_s &summary) {
+                           return summary.total;
+                       });
+            add_signal(prefix + "_TIME_LAST",
+                       "Time in seconds spent in " + subject + " during the most recent step that entered it",
+                       IOGroup::M_SIGNAL_BEHAVIOR_VARIABLE,
+                       [](const ControllerPhase::m_summary_s &summary) {
+                           return summary.last;
+                       });
+            add_signal(prefix + "_TIME_MAX",
+                       "Largest time in seconds spent in " + subject + " during one step",
+                       IOGroup::M_SIGNAL_BEHAVIOR_VARIABLE,
+                       [](const ControllerPhase::m_summary_s &summary) {
+                           return summary.max;
+                       });
+            for (int bin = 0; bin != LatencyHistogram::M_NUM_BIN; ++bin) {
+                add_signal(prefix + "_COUNT_" + LatencyHistogram::bin_name()[bin],
+                           "Number of control loop steps that spent " + LatencyHistogram::bin_range()[bin] + " in " + subject,
+                           IOGroup::M_SIGNAL_BEHAVIOR_MONOTONE,
+                           [bin](const ControllerPhase::m_summary_s &summary) {
+                               return (double)summary.histogram[bin];
+                           });
+            }
+        }
+        return result;
+    }
+
+    std::string ControllerIOGroup::plugin_name(void)
+    {
+        return "CONTROLLER";
+    }
+
+    std::unique_ptr<IOGroup> ControllerIOGroup::make_plugin(void)
+    {
+        return geopm::make_unique<ControllerIOGroup>();
+    }
+}
@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef CONTROLLERIOGROUP_HPP_INCLUDE
+#define CONTROLLERIOGROUP_HPP_INCLUDE
+
+#include <array>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "ControllerPhase.hpp"
+#include "SummaryIOGroup.hpp"
+
+namespace geopm
+{
+    /// @brief IOGroup that provides the time spent in each phase of
+    ///        the Controller control loop.
+    class ControllerIOGroup
+        : public SummaryIOGroup<std::array<ControllerPhase::m_summary_s, ControllerPhase::M_NUM_PHASE> >
+    {
+        public:
+            ControllerIOGroup();
+            ControllerIOGroup(const ControllerPhase &phase);
+            virtual ~ControllerIOGroup() = default;
+            static std::string plugin_name(void);
+            static std::unique_ptr<IOGroup> make_plugin(void);
+        private:
+            static std::map<std::string, m_signal_info_s> make_signal_info(void);
+    };
+}
+
+#endif
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "ControllerPhase.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "geopm/Exception.hpp"
+
+namespace geopm
+{
+    ControllerPhase &ControllerPhase::controller_phase(void)
+    {
+        static ControllerPhase instance;
+        return instance;
+    }
+
+    ControllerPhase::ControllerPhase()
+        : m_step_ticks{}
+        , m_is_step_active{}
+        , m_tick_zero(tick())
+    {
+        geopm_time(&m_time_zero);
+        reset();
+    }
+
+    const std::array<std::string, ControllerPhase::M_NUM_PHASE> &ControllerPhase::phase_name(void)
+    {
+        static const std::array<std::string, M_NUM_PHASE> result {
+            "APPLICATION_SAMPLER",
+            "READ_BATCH",
+            "AGENT_SAMPLE",
+            "REPORTER",
+            "TRACER",
+            "TREE_COMM_UP",
+            "AGENT_AGGREGATE",
+            "ENDPOINT",
+            "TREE_COMM_DOWN",
+            "AGENT_POLICY",
+            "AGENT_ADJUST",
+            "WRITE_BATCH",
+            "WAIT",
+        };
+        return result;
+    }
+
+    void ControllerPhase::check_phase(int phase_idx, const std::string &func_name) const
+    {
+        if (phase_idx < 0 || phase_idx >= M_NUM_PHASE) {
+            throw Exception("ControllerPhase::" + func_name + "(): phase_idx out of range: " +
+                            std::to_string(phase_idx),
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+    }
+
+    void ControllerPhase::add_ticks(int phase_idx, uint64_t ticks)
+    {
+#ifdef GEOPM_DEBUG
+        check_phase(phase_idx, __func__);
+#endif
+        m_step_ticks[phase_idx] += ticks;
+        m_is_step_active[phase_idx] = true;
+    }
+
+    void ControllerPhase::end_step(void)
+    {
+        uint64_t elapsed_ticks = tick() - m_tick_zero;
+        double elapsed_time = geopm_time_since(&m_time_zero);
+        double tick_period = elapsed_ticks != 0 ? elapsed_time / elapsed_ticks : 0.0;
+        for (int phase_idx = 0; phase_idx != M_NUM_PHASE; ++phase_idx) {
+            if (m_is_step_active[phase_idx]) {
+                update(phase_idx, m_step_ticks[phase_idx] * tick_period);
+                m_step_ticks[phase_idx] = 0;
+                m_is_step_active[phase_idx] = false;
+            }
+        }
+    }
+
+    void ControllerPhase::update(int phase_idx, double duration)
+    {
+        check_phase(phase_idx, __func__);
+        duration = std::max(duration, 0.0);
+        int bin = LatencyHistogram::bin(duration);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto &summary = m_summary[phase_idx];
+        ++summary.count;
+        summary.total += duration;
+        summary.last = duration;
+        summary.max = std::max(summary.max, duration);
+        ++summary.histogram[bin];
+    }
+
+    ControllerPhase::m_summary_s ControllerPhase::summary(int phase_idx) const
+    {
+        check_phase(phase_idx, __func__);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_summary[phase_idx];
+    }
+
+    void ControllerPhase::reset(void)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_summary.fill({0, 0.0, NAN, 0.0, {}});
+    }
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef CONTROLLERPHASE_HPP_INCLUDE
+#define CONTROLLERPHASE_HPP_INCLUDE
+
+#include <cstdint>
+
+#include <array>
+#include <mutex>
+#include <string>
+
+#include "geopm_time.h"
+#include "LatencyHistogram.hpp"
+
+namespace geopm
+{
+    /// @brief Record of the time spent in each phase of the
+    ///        Controller control loop.  Phase times are accumulated
+    ///        in ticks of the time stamp counter over one step and
+    ///        converted to seconds when the step ends.  One instance
+    ///        is shared by the process.
+    class ControllerPhase
+    {
+        public:
+            enum m_phase_e {
+                M_PHASE_APPLICATION_SAMPLER,
+                M_PHASE_READ_BATCH,
+                M_PHASE_AGENT_SAMPLE,
+                M_PHASE_REPORTER,
+                M_PHASE_TRACER,
+                M_PHASE_TREE_COMM_UP,
+                M_PHASE_AGENT_AGGREGATE,
+                M_PHASE_ENDPOINT,
+                M_PHASE_TREE_COMM_DOWN,
+                M_PHASE_AGENT_POLICY,
+                M_PHASE_AGENT_ADJUST,
+                M_PHASE_WRITE_BATCH,
+                M_PHASE_WAIT,
+                M_NUM_PHASE,
+            };
+            struct m_summary_s {
+                /// Number of steps that entered the phase
+                uint64_t count;
+                /// Total time in seconds spent in the phase
+                double total;
+                /// Time spent in the phase during the most recent
+                /// step that entered it
+                double last;
+                double max;
+                /// Number of steps with phase time below each bin
+                /// limit and at or above the previous one
+                std::array<uint64_t, LatencyHistogram::M_NUM_BIN> histogram;
+            };
+            /// @brief Adds the ticks elapsed over its lifetime to
+            ///        one phase of the current step.
+            class ScopedTimer
+            {
+                public:
+                    ScopedTimer(ControllerPhase &phase, int phase_idx)
+                        : m_phase(phase)
+                        , m_phase_idx(phase_idx)
+                        , m_begin(tick())
+                    {
+
+                    }
+                    ~ScopedTimer()
+                    {
+                        m_phase.add_ticks(m_phase_idx, tick() - m_begin);
+                    }
+                    ScopedTimer(const ScopedTimer &other) = delete;
+                    ScopedTimer &operator=(const ScopedTimer &other) = delete;
+                private:
+                    ControllerPhase &m_phase;
+                    const int m_phase_idx;
+                    const uint64_t m_begin;
+            };
+            static ControllerPhase &controller_phase(void);
+            ControllerPhase();
+            virtual ~ControllerPhase() = default;
+            /// @brief Add ticks to a phase of the current step.  Only
+            ///        the thread running the control loop may call
+            ///        this.
+            void add_ticks(int phase_idx, uint64_t ticks);
+            /// @brief Record the phase times of the current step and
+            ///        begin the next one.  Phases that were not
+            ///        entered during the step are not updated.
+            void end_step(void);
+            /// @brief Record one step's time for a phase.
+            /// @param [in] duration Seconds spent in the phase;
+            ///        negative values are recorded as zero.
+            void update(int phase_idx, double duration);
+            m_summary_s summary(int phase_idx) const;
+            /// @brief Forget all recorded steps.
+            void reset(void);
+            /// @brief Current value of the time stamp counter, or of
+            ///        the monotonic clock in nanoseconds where there
+            ///        is no time stamp counter.
+            static inline uint64_t tick(void);
+            /// @brief Upper-case name of each phase, e.g.
+            ///        "READ_BATCH".
+            static const std::array<std::string, M_NUM_PHASE> &phase_name(void);
+        private:
+            void check_phase(int phase_idx, const std::string &func_name) const;
+
+            mutable std::mutex m_mutex;
+            std::array<m_summary_s, M_NUM_PHASE> m_summary;
+            std::array<uint64_t, M_NUM_PHASE> m_step_ticks;
+            std::array<bool, M_NUM_PHASE> m_is_step_active;
+            // Reference points used to convert ticks to seconds
+            uint64_t m_tick_zero;
+            geopm_time_s m_time_zero;
+    };
+
+    uint64_t ControllerPhase::tick(void)
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        return __builtin_ia32_rdtsc();
+#else
+        geopm_time_s curr_time;
+        geopm_time(&curr_time);
+        return (uint64_t)curr_time.t.tv_sec * 1000000000ULL + curr_time.t.tv_nsec;
+#endif
+    }
+}
+
+#endif
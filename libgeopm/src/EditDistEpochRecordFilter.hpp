@@ -53,7 +53,9 @@ namespace geopm
                                       double unstable_period_hysteresis);
             EditDistEpochRecordFilter(const std::string &name);
             virtual ~EditDistEpochRecordFilter() = default;
-            std::vector<record_s> filter(const record_s &record) override;
+            using RecordFilter::filter;
+            void filter(const record_s &record,
+                        std::vector<record_s> &result) override;
             /// @brief Static function that will parse the filter
             ///        string for the edit_distance into the constructor
             ///        arguments for a EditDistanceEpochRecordFilter.
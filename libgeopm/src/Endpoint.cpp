@@ -22,6 +22,7 @@
 #include "geopm/Exception.hpp"
 #include "geopm/Helper.hpp"
 #include "geopm/Agent.hpp"
+#include "Futex.hpp"
 
 namespace geopm
 {
@@ -30,6 +31,12 @@ namespace geopm
         return geopm::make_unique<EndpointImp>(data_path);
     }
 
+    std::unique_ptr<Endpoint> Endpoint::make_unique(const std::string &data_path,
+                                                    size_t history_size)
+    {
+        return geopm::make_unique<EndpointImp>(data_path, history_size);
+    }
+
     std::string EndpointImp::shm_policy_postfix(void)
     {
         return "-policy";
@@ -40,8 +47,42 @@ namespace geopm
         return "-sample";
     }
 
+    size_t EndpointImp::sample_shmem_size(size_t history_size)
+    {
+        return sizeof(struct geopm_endpoint_sample_shmem_s) +
+               history_size * sizeof(struct geopm_endpoint_sample_record_s);
+    }
+
+    size_t EndpointImp::doorbell_shmem_size(size_t num_endpoint)
+    {
+        size_t num_word = (num_endpoint + 63) / 64;
+        return sizeof(struct geopm_endpoint_doorbell_shmem_s) +
+               num_word * sizeof(uint64_t);
+    }
+
+    void EndpointImp::ring_doorbell(SharedMemory &doorbell, size_t doorbell_index)
+    {
+        auto data = (struct geopm_endpoint_doorbell_shmem_s *)doorbell.pointer();
+        if (doorbell_index >= data->num_endpoint ||
+            doorbell.size() < doorbell_shmem_size(data->num_endpoint)) {
+            throw Exception("EndpointImp::" + std::string(__func__) + "(): doorbell index is out of range",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        uint64_t *ready_mask = (uint64_t *)(data + 1);
+        __atomic_or_fetch(ready_mask + doorbell_index / 64,
+                          1ULL << (doorbell_index % 64), __ATOMIC_SEQ_CST);
+        futex_notify(&data->update_count);
+    }
+
     EndpointImp::EndpointImp(const std::string &data_path)
-        : EndpointImp(data_path, nullptr, nullptr, 0, 0)
+        : EndpointImp(data_path, 0)
+    {
+
+    }
+
+    EndpointImp::EndpointImp(const std::string &data_path,
+                             size_t history_size)
+        : EndpointImp(data_path, nullptr, nullptr, 0, 0, history_size)
     {
 
     }
@@ -51,15 +92,33 @@ namespace geopm
                              std::shared_ptr<SharedMemory> sample_shmem,
                              size_t num_policy,
                              size_t num_sample)
+        : EndpointImp(path, policy_shmem, sample_shmem, num_policy, num_sample, 0)
+    {
+
+    }
+
+    EndpointImp::EndpointImp(const std::string &path,
+                             std::shared_ptr<SharedMemory> policy_shmem,
+                             std::shared_ptr<SharedMemory> sample_shmem,
+                             size_t num_policy,
+                             size_t num_sample,
+                             size_t history_size)
         : m_path(path)
         , m_policy_shmem(std::move(policy_shmem))
         , m_sample_shmem(std::move(sample_shmem))
         , m_num_policy(num_policy)
         , m_num_sample(num_sample)
+        , m_history_size(history_size)
+        , m_sample_count_read(0)
+        , m_doorbell_index(0)
         , m_is_open(false)
         , m_continue_loop(true)
     {
-
+        if (history_size > GEOPM_ENDPOINT_HISTORY_SIZE_MAX) {
+            throw Exception("EndpointImp::" + std::string(__func__) + "(): history_size must not exceed " +
+                            std::to_string(GEOPM_ENDPOINT_HISTORY_SIZE_MAX) + ": " + std::to_string(history_size),
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
     }
 
     EndpointImp::~EndpointImp()
@@ -74,9 +133,13 @@ namespace geopm
             m_policy_shmem = SharedMemory::make_unique_owner(m_path + shm_policy_postfix(), shmem_size);
         }
         if (m_sample_shmem == nullptr) {
-            size_t shmem_size = sizeof(struct geopm_endpoint_sample_shmem_s);
+            size_t shmem_size = sample_shmem_size(m_history_size);
             m_sample_shmem = SharedMemory::make_unique_owner(m_path + shm_sample_postfix(), shmem_size);
         }
+        if (m_sample_shmem->size() < sample_shmem_size(m_history_size)) {
+            throw Exception("EndpointImp::" + std::string(__func__) + "(): sample shared memory is too small for the requested history size",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
         auto lock_p = m_policy_shmem->get_scoped_lock();
         struct geopm_endpoint_policy_shmem_s *data_p = (struct geopm_endpoint_policy_shmem_s*)m_policy_shmem->pointer();
         *data_p = {};
@@ -84,9 +147,27 @@ namespace geopm
         auto lock_s = m_sample_shmem->get_scoped_lock();
         struct geopm_endpoint_sample_shmem_s *data_s = (struct geopm_endpoint_sample_shmem_s*)m_sample_shmem->pointer();
         *data_s = {};
+        data_s->history_size = m_history_size;
+        std::copy(m_doorbell_key.begin(), m_doorbell_key.end(), data_s->doorbell_key);
+        data_s->doorbell_index = m_doorbell_index;
+        m_sample_count_read = 0;
         m_is_open = true;
     }
 
+    void EndpointImp::set_doorbell(const std::string &doorbell_key, size_t doorbell_index)
+    {
+        if (m_is_open) {
+            throw Exception("EndpointImp::" + std::string(__func__) + "(): doorbell must be set before calling open()",
+                            GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        if (doorbell_key.size() >= GEOPM_ENDPOINT_DOORBELL_KEY_MAX) {
+            throw Exception("EndpointImp::" + std::string(__func__) + "(): doorbell key is too long: " + doorbell_key,
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        m_doorbell_key = doorbell_key;
+        m_doorbell_index = doorbell_index;
+    }
+
     void EndpointImp::close(void)
     {
         if (m_policy_shmem) {
@@ -115,6 +196,7 @@ namespace geopm
         data->count = policy.size();
         std::copy(policy.begin(), policy.end(), data->values);
         geopm_time(&data->timestamp);
+        futex_notify(&data->update_count);
     }
 
     double EndpointImp::read_sample(std::vector<double> &sample)
@@ -137,9 +219,66 @@ namespace geopm
             throw Exception("EndpointImpUser::" + std::string(__func__) + "(): Data read from shmem does not match number of samples.",
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
+        m_sample_count_read = data->sample_count;
         return geopm_time_since(&ts);
     }
 
+    double EndpointImp::read_sample(size_t max_sample, double *sample)
+    {
+        if (!m_is_open) {
+            throw Exception("EndpointImp::" + std::string(__func__) + "(): cannot use shmem before calling open()",
+                            GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        auto lock = m_sample_shmem->get_scoped_lock();
+        struct geopm_endpoint_sample_shmem_s *data = (struct geopm_endpoint_sample_shmem_s *) m_sample_shmem->pointer(); // Managed by shmem subsystem.
+
+        double result = NAN;
+        size_t num_copy = 0;
+        if (data->agent[0] != '\0') {
+            num_copy = std::min(max_sample, data->count);
+            std::copy(data->values, data->values + num_copy, sample);
+            result = geopm_time_since(&data->timestamp);
+            m_sample_count_read = data->sample_count;
+        }
+        std::fill(sample + num_copy, sample + max_sample, NAN);
+        return result;
+    }
+
+    size_t EndpointImp::read_sample_history(std::vector<std::vector<double> > &sample,
+                                            std::vector<double> &sample_age)
+    {
+        if (!m_is_open) {
+            throw Exception("EndpointImp::" + std::string(__func__) + "(): cannot use shmem before calling open()",
+                            GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        if (m_history_size == 0) {
+            throw Exception("EndpointImp::" + std::string(__func__) + "(): endpoint was created without a sample history",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        sample.clear();
+        sample_age.clear();
+        auto lock = m_sample_shmem->get_scoped_lock();
+        struct geopm_endpoint_sample_shmem_s *data = (struct geopm_endpoint_sample_shmem_s *) m_sample_shmem->pointer(); // Managed by shmem subsystem.
+        const struct geopm_endpoint_sample_record_s *history = (const struct geopm_endpoint_sample_record_s *)(data + 1);
+
+        uint64_t sample_count = data->sample_count;
+        uint64_t first = m_sample_count_read;
+        size_t num_lost = 0;
+        if (sample_count - first > m_history_size) {
+            // Writer has lapped the reader cursor: oldest unread
+            // records have been overwritten.
+            num_lost = sample_count - first - m_history_size;
+            first = sample_count - m_history_size;
+        }
+        for (uint64_t sample_idx = first; sample_idx != sample_count; ++sample_idx) {
+            const auto &record = history[sample_idx % m_history_size];
+            sample.emplace_back(record.values, record.values + data->count);
+            sample_age.push_back(geopm_time_since(&record.timestamp));
+        }
+        m_sample_count_read = sample_count;
+        return num_lost;
+    }
+
     std::string EndpointImp::get_agent(void)
     {
         if (!m_is_open) {
@@ -159,41 +298,69 @@ namespace geopm
         return agent;
     }
 
-    void EndpointImp::wait_for_agent_attach(double timeout)
+    void EndpointImp::wait_for_sample_update(const std::string &func_name,
+                                             double timeout,
+                                             std::function<bool(void)> is_done)
     {
-        std::string agent = get_agent();
+        if (!m_is_open) {
+            throw Exception("EndpointImp::" + func_name + "(): cannot use shmem before calling open()",
+                            GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        struct geopm_endpoint_sample_shmem_s *data = (struct geopm_endpoint_sample_shmem_s *) m_sample_shmem->pointer(); // Managed by shmem subsystem.
         geopm_time_s start;
         geopm_time(&start);
-        while (m_continue_loop && agent == "") {
-            agent = get_agent();
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
-            if (timeout >= 0 && geopm_time_since(&start) >= timeout) {
-                throw Exception("EndpointImp::" + std::string(__func__) +
-                                "(): timed out waiting for controller.",
-                                GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        while (m_continue_loop) {
+            // Load the futex word before checking the condition so
+            // that an update made after the check makes the wait
+            // below return immediately.
+            uint32_t update_count = futex_load(&data->update_count);
+            if (is_done()) {
+                break;
             }
+            double wait_time = M_WAIT_POLL_INTERVAL;
+            if (timeout >= 0) {
+                double elapsed = geopm_time_since(&start);
+                if (elapsed >= timeout) {
+                    throw Exception("EndpointImp::" + func_name +
+                                    "(): timed out waiting for controller.",
+                                    GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+                }
+                wait_time = std::min(timeout - elapsed, wait_time);
+            }
+            (void)futex_wait(&data->update_count, update_count, wait_time);
         }
     }
 
+    void EndpointImp::wait_for_agent_attach(double timeout)
+    {
+        wait_for_sample_update(__func__, timeout, [this]() {
+            return get_agent() != "";
+        });
+    }
+
     void EndpointImp::wait_for_agent_detach(double timeout)
     {
-        std::string agent = get_agent();
-        geopm_time_s start;
-        geopm_time(&start);
-        while (m_continue_loop && agent != "") {
-            agent = get_agent();
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
-            if (timeout >= 0 && geopm_time_since(&start) >= timeout) {
-                throw Exception("EndpointImp::" + std::string(__func__) +
-                                "(): timed out waiting for controller.",
-                                GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
-            }
-        }
+        wait_for_sample_update(__func__, timeout, [this]() {
+            return get_agent() == "";
+        });
+    }
+
+    void EndpointImp::wait_for_sample(double timeout)
+    {
+        wait_for_sample_update(__func__, timeout, [this]() {
+            auto lock = m_sample_shmem->get_scoped_lock();
+            struct geopm_endpoint_sample_shmem_s *data = (struct geopm_endpoint_sample_shmem_s *) m_sample_shmem->pointer(); // Managed by shmem subsystem.
+            return data->sample_count != m_sample_count_read;
+        });
     }
 
     void EndpointImp::stop_wait_loop(void)
     {
         m_continue_loop = false;
+        if (m_is_open) {
+            struct geopm_endpoint_sample_shmem_s *data = (struct geopm_endpoint_sample_shmem_s *) m_sample_shmem->pointer(); // Managed by shmem subsystem.
+            futex_wake(&data->update_count);
+        }
     }
 
     void EndpointImp::reset_wait_loop(void)
@@ -256,6 +423,20 @@ int geopm_endpoint_create(const char *endpoint_name,
     return err;
 }
 
+int geopm_endpoint_create_history(const char *endpoint_name,
+                                  size_t history_size,
+                                  geopm_endpoint_c **endpoint)
+{
+    int err = 0;
+    try {
+        *endpoint = (struct geopm_endpoint_c*)(new geopm::EndpointImp(endpoint_name, history_size));
+    }
+    catch (...) {
+        err = geopm::exception_handler(std::current_exception(), true);
+    }
+    return err;
+}
+
 int geopm_endpoint_destroy(struct geopm_endpoint_c *endpoint)
 {
     int err = 0;
@@ -324,6 +505,34 @@ int geopm_endpoint_wait_for_agent_attach(struct geopm_endpoint_c *endpoint,
     return err;
 }
 
+int geopm_endpoint_wait_for_agent_detach(struct geopm_endpoint_c *endpoint,
+                                         double timeout)
+{
+    int err = 0;
+    geopm::EndpointImp *end = (geopm::EndpointImp*)endpoint;
+    try {
+        end->wait_for_agent_detach(timeout);
+    }
+    catch (...) {
+        err = geopm::exception_handler(std::current_exception(), true);
+    }
+    return err;
+}
+
+int geopm_endpoint_wait_for_sample(struct geopm_endpoint_c *endpoint,
+                                   double timeout)
+{
+    int err = 0;
+    geopm::EndpointImp *end = (geopm::EndpointImp*)endpoint;
+    try {
+        end->wait_for_sample(timeout);
+    }
+    catch (...) {
+        err = geopm::exception_handler(std::current_exception(), true);
+    }
+    return err;
+}
+
 int geopm_endpoint_stop_wait_loop(struct geopm_endpoint_c *endpoint)
 {
     int err = 0;
@@ -441,3 +650,36 @@ int geopm_endpoint_read_sample(struct geopm_endpoint_c *endpoint,
     }
     return err;
 }
+
+int geopm_endpoint_read_sample_history(struct geopm_endpoint_c *endpoint,
+                                       size_t agent_num_sample,
+                                       size_t max_record,
+                                       double *sample_array,
+                                       double *sample_age_sec,
+                                       size_t *num_record,
+                                       size_t *num_lost)
+{
+    int err = 0;
+    geopm::EndpointImp *end = (geopm::EndpointImp*)endpoint;
+    try {
+        std::vector<std::vector<double> > sample;
+        std::vector<double> sample_age;
+        size_t lost = end->read_sample_history(sample, sample_age);
+        size_t first = sample.size() > max_record ? sample.size() - max_record : 0;
+        for (size_t record_idx = first; record_idx != sample.size(); ++record_idx) {
+            if (sample[record_idx].size() != agent_num_sample) {
+                throw geopm::Exception("geopm_endpoint_read_sample_history(): Data read from shmem does not match number of samples.",
+                                       GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            std::copy(sample[record_idx].begin(), sample[record_idx].end(),
+                      sample_array + (record_idx - first) * agent_num_sample);
+            sample_age_sec[record_idx - first] = sample_age[record_idx];
+        }
+        *num_record = sample.size() - first;
+        *num_lost = lost + first;
+    }
+    catch (...) {
+        err = geopm::exception_handler(std::current_exception(), true);
+    }
+    return err;
+}
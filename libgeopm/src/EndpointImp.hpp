@@ -8,6 +8,9 @@
 
 #include <pthread.h>
 #include <limits.h>
+#include <stdint.h>
+
+#include <functional>
 
 #include "geopm_endpoint.h"
 #include "geopm_time.h"
@@ -15,8 +18,17 @@
 
 namespace geopm
 {
+    /// @brief Maximum length of the shared memory key of an
+    ///        EndpointMux doorbell, including the null terminator.
+    static constexpr size_t GEOPM_ENDPOINT_DOORBELL_KEY_MAX = 256;
+    /// @brief Largest number of records in an Endpoint sample
+    ///        history ring, about 256 MiB of shared memory.
+    static constexpr uint32_t GEOPM_ENDPOINT_HISTORY_SIZE_MAX = 65536;
+
     struct geopm_endpoint_policy_shmem_header {
         geopm_time_s timestamp;   // 16 bytes
+        uint32_t update_count;    // 4 bytes
+        uint32_t padding;         // 4 bytes
         size_t count;         // 8 bytes
         double values;        // 8 bytes
     };
@@ -26,6 +38,11 @@ namespace geopm
         char agent[GEOPM_ENDPOINT_AGENT_NAME_MAX]; // 256 bytes
         char profile_name[GEOPM_ENDPOINT_PROFILE_NAME_MAX];   // 256 bytes
         char hostlist_path[GEOPM_ENDPOINT_HOSTLIST_PATH_MAX];  // 512 bytes
+        uint32_t update_count;    // 4 bytes
+        uint32_t history_size;    // 4 bytes
+        uint64_t sample_count;    // 8 bytes
+        char doorbell_key[GEOPM_ENDPOINT_DOORBELL_KEY_MAX]; // 256 bytes
+        uint64_t doorbell_index;  // 8 bytes
         size_t count;             // 8 bytes
         double values;            // 8 bytes
     };
@@ -33,6 +50,11 @@ namespace geopm
     struct geopm_endpoint_policy_shmem_s {
         /// @brief Time that the memory was last updated.
         geopm_time_s timestamp;
+        /// @brief Futex word incremented each time a policy is
+        ///        written.
+        uint32_t update_count;
+        /// @brief Unused; keeps count aligned.
+        uint32_t padding;
         /// @brief Specifies the size of the following array.
         size_t count;
         /// @brief Holds resource manager data.
@@ -50,12 +72,54 @@ namespace geopm
         /// @brief Path to a file containing the list of hostnames
         ///        in the attached job.
         char hostlist_path[GEOPM_ENDPOINT_HOSTLIST_PATH_MAX];
+        /// @brief Futex word incremented each time an agent
+        ///        attaches, detaches, or writes a sample.
+        uint32_t update_count;
+        /// @brief Number of records in the sample history ring
+        ///        that follows this structure, zero if the
+        ///        endpoint was opened without a history.
+        uint32_t history_size;
+        /// @brief Number of samples written since the endpoint
+        ///        was opened.
+        uint64_t sample_count;
+        /// @brief Shared memory key of the EndpointMux doorbell to
+        ///        ring on every update, empty if the endpoint is not
+        ///        managed by an EndpointMux.
+        char doorbell_key[GEOPM_ENDPOINT_DOORBELL_KEY_MAX];
+        /// @brief Index of this endpoint within the doorbell.
+        uint64_t doorbell_index;
         /// @brief Specifies the size of the following array.
         size_t count;
         /// @brief Holds resource manager data.
         double values[(4096 - offsetof(struct geopm_endpoint_sample_shmem_header, values)) / sizeof(double)];
     };
 
+    /// @brief One timestamped entry of the sample history ring.
+    ///        The ring is an array of history_size of these
+    ///        records placed directly after the
+    ///        geopm_endpoint_sample_shmem_s in the sample shared
+    ///        memory.  The sample with sample_count N is stored at
+    ///        index (N - 1) % history_size.
+    struct geopm_endpoint_sample_record_s {
+        /// @brief Time that the sample was written.
+        geopm_time_s timestamp;
+        /// @brief Sample values, count is given by the count
+        ///        field of the geopm_endpoint_sample_shmem_s.
+        double values[sizeof(geopm_endpoint_sample_shmem_s::values) / sizeof(double)];
+    };
+
+    struct geopm_endpoint_doorbell_shmem_s {
+        /// @brief Futex word incremented each time any endpoint
+        ///        sharing the doorbell is updated.
+        uint32_t update_count;
+        /// @brief Unused; keeps num_endpoint aligned.
+        uint32_t padding;
+        /// @brief Number of bits in the ready mask that follows
+        ///        this structure.  Bit N of the mask is set when
+        ///        the endpoint with doorbell_index N is updated.
+        uint64_t num_endpoint;
+    };
+
     static_assert(sizeof(struct geopm_endpoint_policy_shmem_s) == 4096, "Alignment issue with geopm_endpoint_policy_shmem_s.");
     static_assert(sizeof(struct geopm_endpoint_sample_shmem_s) == 4096, "Alignment issue with geopm_endpoint_sample_shmem_s.");
 
@@ -69,32 +133,81 @@ namespace geopm
             EndpointImp &operator=(const EndpointImp &other) = delete;
 
             EndpointImp(const std::string &data_path);
+            EndpointImp(const std::string &data_path,
+                        size_t history_size);
             EndpointImp(const std::string &data_path,
                         std::shared_ptr<SharedMemory> policy_shmem,
                         std::shared_ptr<SharedMemory> sample_shmem,
                         size_t num_policy,
                         size_t num_sample);
+            EndpointImp(const std::string &data_path,
+                        std::shared_ptr<SharedMemory> policy_shmem,
+                        std::shared_ptr<SharedMemory> sample_shmem,
+                        size_t num_policy,
+                        size_t num_sample,
+                        size_t history_size);
             virtual ~EndpointImp();
 
             void open(void) override;
             void close(void) override;
             void write_policy(const std::vector<double> &policy) override;
             double read_sample(std::vector<double> &sample) override;
+            size_t read_sample_history(std::vector<std::vector<double> > &sample,
+                                       std::vector<double> &sample_age) override;
             std::string get_agent(void) override;
             void wait_for_agent_attach(double timeout) override;
             void wait_for_agent_detach(double timeout) override;
+            void wait_for_sample(double timeout) override;
             void stop_wait_loop(void) override;
             void reset_wait_loop(void) override;
             std::string get_profile_name(void) override;
             std::set<std::string> get_hostnames(void) override;
             static std::string shm_policy_postfix(void);
             static std::string shm_sample_postfix(void);
+            /// @brief Size in bytes of the sample shared memory
+            ///        holding a history ring of the given size.
+            static size_t sample_shmem_size(size_t history_size);
+            /// @brief Size in bytes of an EndpointMux doorbell shared
+            ///        memory for the given number of endpoints.
+            static size_t doorbell_shmem_size(size_t num_endpoint);
+            /// @brief Mark an endpoint as updated in the doorbell and
+            ///        wake any thread waiting on it.
+            static void ring_doorbell(SharedMemory &doorbell, size_t doorbell_index);
+            /// @brief Request that the Agent ring the given doorbell
+            ///        on every update.  Must be called before open().
+            /// @param [in] doorbell_key Shared memory key of the
+            ///        doorbell created by an EndpointMux.
+            /// @param [in] doorbell_index Bit to set in the ready mask.
+            void set_doorbell(const std::string &doorbell_key, size_t doorbell_index);
+            /// @brief Copy the latest sample into a caller provided
+            ///        buffer without requiring the Agent plugin to be
+            ///        loaded in the calling process.
+            /// @param [in] max_sample Number of values that fit in
+            ///        sample.
+            /// @param [out] sample Filled with the sample values
+            ///        followed by NAN up to max_sample.
+            /// @return The age of the sample in seconds, or NAN if
+            ///         no Agent is attached.
+            double read_sample(size_t max_sample, double *sample);
         private:
+            /// @brief Poll interval used as a fallback in case the
+            ///        writer does not notify the futex word.
+            static constexpr double M_WAIT_POLL_INTERVAL = 0.1;
+            /// @brief Block until is_done() returns true, the timeout
+            ///        is reached, or stop_wait_loop() is called.
+            ///        Throws on timeout.
+            void wait_for_sample_update(const std::string &func_name,
+                                        double timeout,
+                                        std::function<bool(void)> is_done);
             std::string m_path;
             std::shared_ptr<SharedMemory> m_policy_shmem;
             std::shared_ptr<SharedMemory> m_sample_shmem;
             size_t m_num_policy;
             size_t m_num_sample;
+            uint32_t m_history_size;
+            uint64_t m_sample_count_read;
+            std::string m_doorbell_key;
+            size_t m_doorbell_index;
             bool m_is_open;
             volatile bool m_continue_loop;
     };
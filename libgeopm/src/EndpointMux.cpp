@@ -0,0 +1,319 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "geopm_endpoint.h"
+#include "EndpointMuxImp.hpp"
+
+#include <cmath>
+#include <cstdint>
+
+#include <algorithm>
+
+#include "geopm/Exception.hpp"
+#include "geopm/Helper.hpp"
+#include "geopm/SharedMemory.hpp"
+#include "geopm_time.h"
+#include "EndpointImp.hpp"
+#include "Futex.hpp"
+
+namespace geopm
+{
+    std::unique_ptr<EndpointMux> EndpointMux::make_unique(const std::string &data_path,
+                                                          int max_endpoint)
+    {
+        return geopm::make_unique<EndpointMuxImp>(data_path, max_endpoint);
+    }
+
+    std::string EndpointMuxImp::shm_doorbell_postfix(void)
+    {
+        return "-doorbell";
+    }
+
+    EndpointMuxImp::EndpointMuxImp(const std::string &data_path, int max_endpoint)
+        : EndpointMuxImp(data_path, max_endpoint, nullptr,
+                         [](const std::string &path) {
+                             return geopm::make_unique<EndpointImp>(path);
+                         })
+    {
+
+    }
+
+    EndpointMuxImp::EndpointMuxImp(const std::string &data_path,
+                                   int max_endpoint,
+                                   std::shared_ptr<SharedMemory> doorbell_shmem,
+                                   std::function<std::unique_ptr<EndpointImp>(const std::string &)> endpoint_factory)
+        : m_doorbell_key(data_path + shm_doorbell_postfix())
+        , m_max_endpoint(max_endpoint)
+        , m_doorbell_shmem(std::move(doorbell_shmem))
+        , m_endpoint_factory(endpoint_factory)
+        , m_endpoint(max_endpoint < 0 ? 0 : max_endpoint)
+    {
+        if (m_max_endpoint <= 0) {
+            throw Exception("EndpointMuxImp::" + std::string(__func__) + "(): max_endpoint must be positive",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (m_doorbell_key.size() >= GEOPM_ENDPOINT_DOORBELL_KEY_MAX) {
+            throw Exception("EndpointMuxImp::" + std::string(__func__) + "(): data_path is too long: " + data_path,
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        size_t shmem_size = EndpointImp::doorbell_shmem_size(m_max_endpoint);
+        if (m_doorbell_shmem == nullptr) {
+            m_doorbell_shmem = SharedMemory::make_unique_owner(m_doorbell_key, shmem_size);
+        }
+        if (m_doorbell_shmem->size() < shmem_size) {
+            throw Exception("EndpointMuxImp::" + std::string(__func__) + "(): doorbell shared memory is too small",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        auto data = (struct geopm_endpoint_doorbell_shmem_s *)m_doorbell_shmem->pointer();
+        *data = {};
+        data->num_endpoint = m_max_endpoint;
+        uint64_t *ready_mask = (uint64_t *)(data + 1);
+        std::fill(ready_mask, ready_mask + (m_max_endpoint + 63) / 64, 0);
+    }
+
+    EndpointMuxImp::~EndpointMuxImp()
+    {
+        for (auto &endpoint : m_endpoint) {
+            if (endpoint) {
+                endpoint->close();
+            }
+        }
+        m_doorbell_shmem->unlink();
+    }
+
+    void EndpointMuxImp::check_index(const std::string &func_name, int endpoint_idx) const
+    {
+        if (endpoint_idx < 0 || endpoint_idx >= m_max_endpoint ||
+            m_endpoint[endpoint_idx] == nullptr) {
+            throw Exception("EndpointMuxImp::" + func_name + "(): invalid endpoint index: " +
+                            std::to_string(endpoint_idx),
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+    }
+
+    int EndpointMuxImp::add_endpoint(const std::string &data_path)
+    {
+        auto slot = std::find(m_endpoint.begin(), m_endpoint.end(), nullptr);
+        if (slot == m_endpoint.end()) {
+            throw Exception("EndpointMuxImp::" + std::string(__func__) + "(): all " +
+                            std::to_string(m_max_endpoint) + " endpoints are in use",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        int result = slot - m_endpoint.begin();
+        auto endpoint = m_endpoint_factory(data_path);
+        endpoint->set_doorbell(m_doorbell_key, result);
+        endpoint->open();
+        *slot = std::move(endpoint);
+        return result;
+    }
+
+    void EndpointMuxImp::remove_endpoint(int endpoint_idx)
+    {
+        check_index(__func__, endpoint_idx);
+        m_endpoint[endpoint_idx]->close();
+        m_endpoint[endpoint_idx].reset();
+        // Drop any pending notification so that a new Endpoint in
+        // the same slot does not appear updated.
+        auto data = (struct geopm_endpoint_doorbell_shmem_s *)m_doorbell_shmem->pointer();
+        uint64_t *ready_mask = (uint64_t *)(data + 1);
+        __atomic_and_fetch(ready_mask + endpoint_idx / 64,
+                           ~(1ULL << (endpoint_idx % 64)), __ATOMIC_SEQ_CST);
+    }
+
+    Endpoint &EndpointMuxImp::endpoint(int endpoint_idx)
+    {
+        check_index(__func__, endpoint_idx);
+        return *m_endpoint[endpoint_idx];
+    }
+
+    int EndpointMuxImp::max_endpoint(void) const
+    {
+        return m_max_endpoint;
+    }
+
+    std::vector<int> EndpointMuxImp::take_ready(void)
+    {
+        std::vector<int> result;
+        auto data = (struct geopm_endpoint_doorbell_shmem_s *)m_doorbell_shmem->pointer();
+        uint64_t *ready_mask = (uint64_t *)(data + 1);
+        int num_word = (m_max_endpoint + 63) / 64;
+        for (int word_idx = 0; word_idx != num_word; ++word_idx) {
+            uint64_t word = __atomic_exchange_n(ready_mask + word_idx, 0, __ATOMIC_SEQ_CST);
+            while (word != 0) {
+                int endpoint_idx = word_idx * 64 + __builtin_ctzll(word);
+                word &= word - 1;
+                if (endpoint_idx < m_max_endpoint && m_endpoint[endpoint_idx]) {
+                    result.push_back(endpoint_idx);
+                }
+            }
+        }
+        return result;
+    }
+
+    std::vector<int> EndpointMuxImp::wait(double timeout)
+    {
+        auto data = (struct geopm_endpoint_doorbell_shmem_s *)m_doorbell_shmem->pointer();
+        geopm_time_s start;
+        geopm_time(&start);
+        std::vector<int> result;
+        while (true) {
+            // Load the futex word before draining the mask so that a
+            // doorbell rung after the drain makes the wait return.
+            uint32_t update_count = futex_load(&data->update_count);
+            result = take_ready();
+            if (!result.empty()) {
+                break;
+            }
+            double wait_time = -1.0;
+            if (timeout >= 0) {
+                double elapsed = geopm_time_since(&start);
+                if (elapsed >= timeout) {
+                    break;
+                }
+                wait_time = timeout - elapsed;
+            }
+            (void)futex_wait(&data->update_count, update_count, wait_time);
+        }
+        return result;
+    }
+
+    void EndpointMuxImp::read_sample(size_t stride,
+                                     std::vector<double> &sample,
+                                     std::vector<double> &sample_age)
+    {
+        sample.assign(m_max_endpoint * stride, NAN);
+        sample_age.assign(m_max_endpoint, NAN);
+        for (int endpoint_idx = 0; endpoint_idx != m_max_endpoint; ++endpoint_idx) {
+            if (m_endpoint[endpoint_idx]) {
+                sample_age[endpoint_idx] =
+                    m_endpoint[endpoint_idx]->read_sample(stride, sample.data() + endpoint_idx * stride);
+            }
+        }
+    }
+}
+
+int geopm_endpoint_mux_create(const char *mux_name,
+                              int max_endpoint,
+                              struct geopm_endpoint_mux_c **mux)
+{
+    int err = 0;
+    try {
+        *mux = (struct geopm_endpoint_mux_c*)(new geopm::EndpointMuxImp(mux_name, max_endpoint));
+    }
+    catch (...) {
+        err = geopm::exception_handler(std::current_exception(), true);
+    }
+    return err;
+}
+
+int geopm_endpoint_mux_destroy(struct geopm_endpoint_mux_c *mux)
+{
+    int err = 0;
+    try {
+        delete (geopm::EndpointMuxImp*)mux;
+    }
+    catch (...) {
+        err = geopm::exception_handler(std::current_exception(), true);
+    }
+    return err;
+}
+
+int geopm_endpoint_mux_add(struct geopm_endpoint_mux_c *mux,
+                           const char *endpoint_name,
+                           int *endpoint_idx)
+{
+    int err = 0;
+    geopm::EndpointMuxImp *emux = (geopm::EndpointMuxImp*)mux;
+    try {
+        *endpoint_idx = emux->add_endpoint(endpoint_name);
+    }
+    catch (...) {
+        err = geopm::exception_handler(std::current_exception(), true);
+    }
+    return err;
+}
+
+int geopm_endpoint_mux_remove(struct geopm_endpoint_mux_c *mux,
+                              int endpoint_idx)
+{
+    int err = 0;
+    geopm::EndpointMuxImp *emux = (geopm::EndpointMuxImp*)mux;
+    try {
+        emux->remove_endpoint(endpoint_idx);
+    }
+    catch (...) {
+        err = geopm::exception_handler(std::current_exception(), true);
+    }
+    return err;
+}
+
+int geopm_endpoint_mux_endpoint(struct geopm_endpoint_mux_c *mux,
+                                int endpoint_idx,
+                                struct geopm_endpoint_c **endpoint)
+{
+    int err = 0;
+    geopm::EndpointMuxImp *emux = (geopm::EndpointMuxImp*)mux;
+    try {
+        // All managed endpoints are EndpointImp objects, which is
+        // the type behind struct geopm_endpoint_c.
+        geopm::EndpointImp *end = static_cast<geopm::EndpointImp*>(&emux->endpoint(endpoint_idx));
+        *endpoint = (struct geopm_endpoint_c*)end;
+    }
+    catch (...) {
+        err = geopm::exception_handler(std::current_exception(), true);
+    }
+    return err;
+}
+
+int geopm_endpoint_mux_wait(struct geopm_endpoint_mux_c *mux,
+                            double timeout,
+                            size_t ready_idx_max,
+                            int *ready_idx,
+                            int *num_ready)
+{
+    int err = 0;
+    geopm::EndpointMuxImp *emux = (geopm::EndpointMuxImp*)mux;
+    try {
+        if (ready_idx_max < (size_t)emux->max_endpoint()) {
+            throw geopm::Exception("geopm_endpoint_mux_wait(): ready_idx_max is less than max_endpoint",
+                                   GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        std::vector<int> ready = emux->wait(timeout);
+        std::copy(ready.begin(), ready.end(), ready_idx);
+        *num_ready = ready.size();
+    }
+    catch (...) {
+        err = geopm::exception_handler(std::current_exception(), true);
+    }
+    return err;
+}
+
+int geopm_endpoint_mux_read_sample(struct geopm_endpoint_mux_c *mux,
+                                   size_t stride,
+                                   size_t sample_array_max,
+                                   double *sample_array,
+                                   size_t sample_age_max,
+                                   double *sample_age_sec)
+{
+    int err = 0;
+    geopm::EndpointMuxImp *emux = (geopm::EndpointMuxImp*)mux;
+    try {
+        size_t max_endpoint = emux->max_endpoint();
+        if (sample_array_max < max_endpoint * stride ||
+            sample_age_max < max_endpoint) {
+            throw geopm::Exception("geopm_endpoint_mux_read_sample(): array is smaller than max_endpoint samples",
+                                   GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        std::vector<double> sample;
+        std::vector<double> sample_age;
+        emux->read_sample(stride, sample, sample_age);
+        std::copy(sample.begin(), sample.end(), sample_array);
+        std::copy(sample_age.begin(), sample_age.end(), sample_age_sec);
+    }
+    catch (...) {
+        err = geopm::exception_handler(std::current_exception(), true);
+    }
+    return err;
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef ENDPOINTMUXIMP_HPP_INCLUDE
+#define ENDPOINTMUXIMP_HPP_INCLUDE
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "geopm/EndpointMux.hpp"
+
+namespace geopm
+{
+    class EndpointImp;
+    class SharedMemory;
+
+    class EndpointMuxImp : public EndpointMux
+    {
+        public:
+            EndpointMuxImp() = delete;
+            EndpointMuxImp(const EndpointMuxImp &other) = delete;
+            EndpointMuxImp &operator=(const EndpointMuxImp &other) = delete;
+            EndpointMuxImp(const std::string &data_path, int max_endpoint);
+            EndpointMuxImp(const std::string &data_path,
+                           int max_endpoint,
+                           std::shared_ptr<SharedMemory> doorbell_shmem,
+                           std::function<std::unique_ptr<EndpointImp>(const std::string &)> endpoint_factory);
+            virtual ~EndpointMuxImp();
+            int add_endpoint(const std::string &data_path) override;
+            void remove_endpoint(int endpoint_idx) override;
+            Endpoint &endpoint(int endpoint_idx) override;
+            int max_endpoint(void) const override;
+            std::vector<int> wait(double timeout) override;
+            void read_sample(size_t stride,
+                             std::vector<double> &sample,
+                             std::vector<double> &sample_age) override;
+            static std::string shm_doorbell_postfix(void);
+        private:
+            void check_index(const std::string &func_name, int endpoint_idx) const;
+            /// @brief Atomically clear the ready mask and return the
+            ///        indices of the active Endpoints that were set.
+            std::vector<int> take_ready(void);
+            std::string m_doorbell_key;
+            int m_max_endpoint;
+            std::shared_ptr<SharedMemory> m_doorbell_shmem;
+            std::function<std::unique_ptr<EndpointImp>(const std::string &)> m_endpoint_factory;
+            std::vector<std::unique_ptr<EndpointImp> > m_endpoint;
+    };
+}
+
+#endif
@@ -10,12 +10,14 @@
 #include <sys/stat.h>
 
 #include <fstream>
+#include <iostream>
 
 #include "EndpointImp.hpp"  // for shmem region structs and constants
 #include "geopm/Helper.hpp"
 #include "geopm/Agent.hpp"
 #include "geopm/Environment.hpp"
 #include "geopm/SharedMemory.hpp"
+#include "Futex.hpp"
 
 
 namespace geopm
@@ -47,6 +49,8 @@ namespace geopm
         , m_policy_shmem(std::move(policy_shmem))
         , m_sample_shmem(std::move(sample_shmem))
         , m_num_sample(num_sample)
+        , m_policy_update_count(0)
+        , m_doorbell_index(0)
     {
         // Attach to shared memory here and send across agent,
         // profile, hostname list.  Once user attaches to sample
@@ -96,6 +100,17 @@ namespace geopm
         }
         data->hostlist_path[GEOPM_ENDPOINT_HOSTLIST_PATH_MAX -1] = '\0';
         strncpy(data->hostlist_path, m_hostlist_path.c_str(), GEOPM_ENDPOINT_HOSTLIST_PATH_MAX - 1);
+        // attach to the doorbell of the EndpointMux managing this
+        // endpoint, if any
+        data->doorbell_key[GEOPM_ENDPOINT_DOORBELL_KEY_MAX - 1] = '\0';
+        std::string doorbell_key = data->doorbell_key;
+        if (doorbell_key != "") {
+            m_doorbell_shmem = SharedMemory::make_unique_user(doorbell_key,
+                                                              environment().timeout());
+            m_doorbell_index = data->doorbell_index;
+        }
+        futex_notify(&data->update_count);
+        ring_doorbell();
     }
 
     EndpointUserImp::~EndpointUserImp()
@@ -106,6 +121,18 @@ namespace geopm
         data->agent[0] = '\0';
         data->profile_name[0] = '\0';
         data->hostlist_path[0] = '\0';
+        try {
+            futex_notify(&data->update_count);
+        }
+        catch (const Exception &ex) {
+            std::cerr << "Warning: <geopm> EndpointUserImp::~EndpointUserImp(): Failed to notify waiters: " << ex.what() << "\n";
+        }
+        try {
+            ring_doorbell();
+        }
+        catch (const Exception &ex) {
+            std::cerr << "Warning: <geopm> EndpointUserImp::~EndpointUserImp(): Failed to ring doorbell: " << ex.what() << "\n";
+        }
         unlink(m_hostlist_path.c_str());
     }
 
@@ -114,6 +141,7 @@ namespace geopm
         auto lock = m_policy_shmem->get_scoped_lock();
         auto data = (struct geopm_endpoint_policy_shmem_s *) m_policy_shmem->pointer(); // Managed by shmem subsystem.
 
+        m_policy_update_count = data->update_count;
         int num_policy = data->count;
         if (policy.size() < (size_t)num_policy) {
             throw Exception("EndpointUserImp::" + std::string(__func__) + "(): Data read from shmem does not fit in policy vector.",
@@ -138,5 +166,45 @@ namespace geopm
         std::copy(sample.begin(), sample.end(), data->values);
         // also update timestamp
         geopm_time(&data->timestamp);
+        // append to the history ring if the endpoint owner created one
+        if (data->history_size != 0 &&
+            m_sample_shmem->size() >= EndpointImp::sample_shmem_size(data->history_size)) {
+            auto history = (struct geopm_endpoint_sample_record_s *)(data + 1);
+            auto &record = history[data->sample_count % data->history_size];
+            record.timestamp = data->timestamp;
+            std::copy(sample.begin(), sample.end(), record.values);
+        }
+        ++data->sample_count;
+        futex_notify(&data->update_count);
+        ring_doorbell();
+    }
+
+    void EndpointUserImp::ring_doorbell(void)
+    {
+        if (m_doorbell_shmem) {
+            EndpointImp::ring_doorbell(*m_doorbell_shmem, m_doorbell_index);
+        }
+    }
+
+    void EndpointUserImp::wait_for_policy(double timeout)
+    {
+        auto data = (struct geopm_endpoint_policy_shmem_s *) m_policy_shmem->pointer(); // Managed by shmem subsystem.
+        geopm_time_s start;
+        geopm_time(&start);
+        uint32_t update_count = futex_load(&data->update_count);
+        while (update_count == m_policy_update_count) {
+            double wait_time = -1.0;
+            if (timeout >= 0) {
+                double elapsed = geopm_time_since(&start);
+                if (elapsed >= timeout) {
+                    throw Exception("EndpointUserImp::" + std::string(__func__) +
+                                    "(): timed out waiting for policy.",
+                                    GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+                }
+                wait_time = timeout - elapsed;
+            }
+            (void)futex_wait(&data->update_count, update_count, wait_time);
+            update_count = futex_load(&data->update_count);
+        }
     }
 }
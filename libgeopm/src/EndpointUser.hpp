@@ -7,6 +7,7 @@
 #define ENDPOINTUSER_HPP_INCLUDE
 
 #include <cstddef>
+#include <cstdint>
 
 #include <vector>
 #include <string>
@@ -30,6 +31,13 @@ namespace geopm
             /// @param [in] sample The values to write.  The order is
             ///        specified by the Agent.
             virtual void write_sample(const std::vector<double> &sample) = 0;
+            /// @brief Blocks until the resource manager writes a
+            ///        policy that has not been read with
+            ///        read_policy(), or the timeout is reached.
+            ///        Throws an exception on timeout.
+            /// @param [in] timeout Maximum time to wait in seconds; a
+            ///        negative value waits without a time limit.
+            virtual void wait_for_policy(double timeout) = 0;
             /// @brief Factory method for the EndpointUser receiving
             ///        the policy.
             static std::unique_ptr<EndpointUser> make_unique(const std::string &policy_path,
@@ -57,12 +65,17 @@ namespace geopm
             virtual ~EndpointUserImp();
             double read_policy(std::vector<double> &policy) override;
             void write_sample(const std::vector<double> &sample) override;
+            void wait_for_policy(double timeout) override;
         private:
+            void ring_doorbell(void);
             std::string m_path;
             std::unique_ptr<SharedMemory> m_policy_shmem;
             std::unique_ptr<SharedMemory> m_sample_shmem;
             std::string m_hostlist_path;
             size_t m_num_sample;
+            uint32_t m_policy_update_count;
+            std::unique_ptr<SharedMemory> m_doorbell_shmem;
+            size_t m_doorbell_index;
     };
 }
 
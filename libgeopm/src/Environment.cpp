@@ -75,7 +75,14 @@ namespace geopm
 #else
                              {"GEOPM_COMM" ,"NullComm"},
 #endif
+                             {"GEOPM_REPORT_FORMAT", "yaml"},
+                             {"GEOPM_TRACE_COMPRESSION", "none"},
+                             {"GEOPM_TRACE_PROFILE_FORMAT", "csv"},
+                             {"GEOPM_TRACE_PROFILE_COMPRESSION", "none"},
                              {"GEOPM_MAX_FAN_OUT", "16"},
+                             {"GEOPM_TREE_COMM", "rma"},
+                             {"GEOPM_TREE_COMM_MAX_STALE", "10"},
+                             {"GEOPM_WAITER_STRATEGY", "sleep"},
                              {"GEOPM_TIMEOUT", "30"},
                              {"GEOPM_DEBUG_ATTACH", "-1"},
                              {"GEOPM_NUM_PROC", "1"}})
@@ -106,20 +113,28 @@ namespace geopm
     {
         return {"GEOPM_CTL",
                 "GEOPM_REPORT",
+                "GEOPM_REPORT_FORMAT",
                 "GEOPM_REPORT_SIGNALS",
                 "GEOPM_COMM",
                 "GEOPM_POLICY",
                 "GEOPM_ENDPOINT",
                 "GEOPM_AGENT",
                 "GEOPM_TRACE",
+                "GEOPM_TRACE_COMPRESSION",
+                "GEOPM_TRACE_SUMMARY",
                 "GEOPM_TRACE_SIGNALS",
                 "GEOPM_TRACE_PROFILE",
+                "GEOPM_TRACE_PROFILE_FORMAT",
+                "GEOPM_TRACE_PROFILE_COMPRESSION",
                 "GEOPM_TRACE_ENDPOINT_POLICY",
                 "GEOPM_TIMEOUT",
                 "GEOPM_DEBUG_ATTACH",
                 "GEOPM_PROFILE",
                 "GEOPM_FREQUENCY_MAP",
                 "GEOPM_MAX_FAN_OUT",
+                "GEOPM_TREE_COMM",
+                "GEOPM_TREE_COMM_MAX_STALE",
+                "GEOPM_WAITER_STRATEGY",
                 "GEOPM_OMPT_DISABLE",
                 "GEOPM_RECORD_FILTER",
                 "GEOPM_INIT_CONTROL",
@@ -207,6 +222,16 @@ namespace geopm
         return lookup("GEOPM_REPORT");
     }
 
+    std::string EnvironmentImp::report_format(void) const
+    {
+        std::string result = lookup("GEOPM_REPORT_FORMAT");
+        if (result != "yaml" && result != "binary" && result != "both") {
+            throw geopm::Exception("EnvironmentImp::report_format(): GEOPM_REPORT_FORMAT environment variable must be \"yaml\", \"binary\" or \"both\": \"" + result + "\"",
+                                   GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        return result;
+    }
+
     std::string EnvironmentImp::comm(void) const
     {
         std::string ret = "NullComm";
@@ -256,11 +281,46 @@ namespace geopm
         return lookup("GEOPM_TRACE");
     }
 
+    std::string EnvironmentImp::trace_compression(void) const
+    {
+        std::string result = lookup("GEOPM_TRACE_COMPRESSION");
+        if (result != "none" && result != "gzip") {
+            throw geopm::Exception("EnvironmentImp::trace_compression(): GEOPM_TRACE_COMPRESSION environment variable must be \"none\" or \"gzip\": \"" + result + "\"",
+                                   GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        return result;
+    }
+
+    std::string EnvironmentImp::trace_summary(void) const
+    {
+        return lookup("GEOPM_TRACE_SUMMARY");
+    }
+
     std::string EnvironmentImp::trace_profile(void) const
     {
         return lookup("GEOPM_TRACE_PROFILE");
     }
 
+    std::string EnvironmentImp::trace_profile_format(void) const
+    {
+        std::string result = lookup("GEOPM_TRACE_PROFILE_FORMAT");
+        if (result != "csv" && result != "binary") {
+            throw geopm::Exception("EnvironmentImp::trace_profile_format(): GEOPM_TRACE_PROFILE_FORMAT environment variable must be \"csv\" or \"binary\": \"" + result + "\"",
+                                   GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        return result;
+    }
+
+    std::string EnvironmentImp::trace_profile_compression(void) const
+    {
+        std::string result = lookup("GEOPM_TRACE_PROFILE_COMPRESSION");
+        if (result != "none" && result != "gzip") {
+            throw geopm::Exception("EnvironmentImp::trace_profile_compression(): GEOPM_TRACE_PROFILE_COMPRESSION environment variable must be \"none\" or \"gzip\": \"" + result + "\"",
+                                   GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        return result;
+    }
+
     std::string EnvironmentImp::trace_endpoint_policy(void) const
     {
         return lookup("GEOPM_TRACE_ENDPOINT_POLICY");
@@ -322,6 +382,48 @@ namespace geopm
         return result;
     }
 
+    std::string EnvironmentImp::tree_comm(void) const
+    {
+        std::string result = lookup("GEOPM_TREE_COMM");
+        if (result != "rma" && result != "p2p") {
+            throw geopm::Exception("EnvironmentImp::tree_comm(): GEOPM_TREE_COMM environment variable must be \"rma\" or \"p2p\": \"" + result + "\"",
+                                   GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        return result;
+    }
+
+    int EnvironmentImp::tree_comm_max_stale(void) const
+    {
+        int result = 0;
+        std::string max_stale_str = lookup("GEOPM_TREE_COMM_MAX_STALE");
+        try {
+            result = std::stoi(max_stale_str);
+        }
+        catch (const std::invalid_argument &conv_ex) {
+            throw geopm::Exception("EnvironmentImp::tree_comm_max_stale(): GEOPM_TREE_COMM_MAX_STALE environment variable could not be converted into an integer: \"" + max_stale_str + "\"",
+                                   GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        catch (const std::out_of_range &range_ex) {
+            throw geopm::Exception("EnvironmentImp::tree_comm_max_stale(): GEOPM_TREE_COMM_MAX_STALE environment variable could not be converted into an integer, out of range: \"" + max_stale_str + "\"",
+                                    GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (result < 0) {
+            throw geopm::Exception("EnvironmentImp::tree_comm_max_stale(): GEOPM_TREE_COMM_MAX_STALE environment variable must not be negative: \"" + max_stale_str + "\"",
+                                   GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        return result;
+    }
+
+    std::string EnvironmentImp::waiter_strategy(void) const
+    {
+        std::string result = lookup("GEOPM_WAITER_STRATEGY");
+        if (result != "sleep" && result != "timerfd" && result != "hybrid") {
+            throw geopm::Exception("EnvironmentImp::waiter_strategy(): GEOPM_WAITER_STRATEGY environment variable must be \"sleep\", \"timerfd\" or \"hybrid\": \"" + result + "\"",
+                                   GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        return result;
+    }
+
     int EnvironmentImp::pmpi_ctl(void) const
     {
         int ret = Environment::M_CTL_NONE;
@@ -111,7 +111,7 @@ namespace geopm
     void EpochIOGroup::read_batch(void)
     {
         /// update_records() will get called by controller
-        auto records = m_app.get_records();
+        const auto &records = m_app.get_records();
         for (const auto &record : records) {
             if (record.event == EVENT_EPOCH_COUNT) {
                 for (int cpu_idx : m_app.client_cpu_set(record.process)) {
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "Futex.hpp"
+
+#include <cerrno>
+#include <climits>
+#include <ctime>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+#include "geopm/Exception.hpp"
+
+namespace geopm
+{
+    static long futex_syscall(const uint32_t *addr, int op, uint32_t val,
+                              const struct timespec *timeout)
+    {
+        return syscall(SYS_futex, addr, op, val, timeout, nullptr, 0);
+    }
+
+    bool futex_wait(const uint32_t *addr, uint32_t expected, double timeout)
+    {
+        struct timespec ts = {};
+        struct timespec *ts_ptr = nullptr;
+        if (timeout >= 0.0) {
+            ts.tv_sec = (time_t)timeout;
+            ts.tv_nsec = (long)((timeout - ts.tv_sec) * 1E9);
+            ts_ptr = &ts;
+        }
+        bool result = true;
+        if (futex_syscall(addr, FUTEX_WAIT, expected, ts_ptr) == -1) {
+            switch (errno) {
+                case ETIMEDOUT:
+                    result = false;
+                    break;
+                case EAGAIN:
+                case EINTR:
+                    // Value had already changed or a signal arrived
+                    break;
+                default:
+                    throw Exception("futex_wait(): FUTEX_WAIT failed",
+                                    errno, __FILE__, __LINE__);
+            }
+        }
+        return result;
+    }
+
+    void futex_wake(uint32_t *addr)
+    {
+        if (futex_syscall(addr, FUTEX_WAKE, INT_MAX, nullptr) == -1) {
+            throw Exception("futex_wake(): FUTEX_WAKE failed",
+                            errno, __FILE__, __LINE__);
+        }
+    }
+
+    uint32_t futex_notify(uint32_t *addr)
+    {
+        uint32_t result = __atomic_add_fetch(addr, 1, __ATOMIC_SEQ_CST);
+        futex_wake(addr);
+        return result;
+    }
+
+    uint32_t futex_load(const uint32_t *addr)
+    {
+        return __atomic_load_n(addr, __ATOMIC_SEQ_CST);
+    }
+}
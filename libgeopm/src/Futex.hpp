@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef FUTEX_HPP_INCLUDE
+#define FUTEX_HPP_INCLUDE
+
+#include <cstdint>
+
+namespace geopm
+{
+    /// @brief Block the calling thread while the 32-bit word at addr
+    ///        holds the expected value.
+    ///
+    /// The word may live in memory shared between processes: the
+    /// wait is not restricted to the calling process.  Returns when
+    /// another thread calls futex_wake() on the same word, when the
+    /// word no longer holds the expected value, when the timeout
+    /// elapses, or on a spurious wakeup.  Callers must re-check
+    /// their condition after this returns.
+    ///
+    /// @param [in] addr Address of the futex word.
+    /// @param [in] expected Value the word is expected to hold.
+    /// @param [in] timeout Maximum time to block in seconds; a
+    ///        negative value blocks without a time limit.
+    ///
+    /// @return True if the call returned before the timeout
+    ///         elapsed, false if the timeout was reached.
+    bool futex_wait(const uint32_t *addr, uint32_t expected, double timeout);
+    /// @brief Wake all threads blocked in futex_wait() on the word
+    ///        at addr.
+    ///
+    /// @param [in] addr Address of the futex word.
+    void futex_wake(uint32_t *addr);
+    /// @brief Atomically increment the futex word at addr and wake
+    ///        all threads waiting on it.
+    ///
+    /// @param [in] addr Address of the futex word.
+    ///
+    /// @return The value of the word after the increment.
+    uint32_t futex_notify(uint32_t *addr);
+    /// @brief Atomically load the futex word at addr.
+    ///
+    /// @param [in] addr Address of the futex word.
+    ///
+    /// @return The current value of the word.
+    uint32_t futex_load(const uint32_t *addr);
+}
+
+#endif
@@ -6,6 +6,8 @@
 
 #include "InitControl.hpp"
 
+#include <climits>
+#include <cstring>
 #include <iostream>
 #include <stdexcept>
 #include <regex>
@@ -143,12 +145,34 @@ namespace geopm
 
     void InitControlImp::write_controls(void) const
     {
+        // Write the requests together so that IOGroups can combine
+        // them, e.g. one MSR batch instead of a read-modify-write per
+        // domain.  Requests are written in file order.
+        std::vector<geopm_request_s> control_config;
+        std::vector<double> settings;
         for (const auto &[name, domain, index, setting] : m_requests) {
 #ifdef GEOPM_DEBUG
             std::cout << "Info: <geopm> InitControl: Setting " << name << " "
                       << domain << " " << index << " " << setting << std::endl;
 #endif
-            m_platform_io.write_control(name, domain, index, setting);
+            if (name.size() >= NAME_MAX) {
+                // Does not fit in a geopm_request_s: write the
+                // requests before it first
+                if (!control_config.empty()) {
+                    m_platform_io.write_controls(control_config, settings);
+                    control_config.clear();
+                    settings.clear();
+                }
+                m_platform_io.write_control(name, domain, index, setting);
+                continue;
+            }
+            geopm_request_s request = {domain, index, {}};
+            strncpy(request.name, name.c_str(), NAME_MAX - 1);
+            control_config.push_back(request);
+            settings.push_back(setting);
+        }
+        if (!control_config.empty()) {
+            m_platform_io.write_controls(control_config, settings);
         }
     }
 }
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "LatencyHistogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace geopm
+{
+    int LatencyHistogram::bin(double latency)
+    {
+        const auto &limit = bin_limit();
+        int result = std::upper_bound(limit.begin(), limit.end(), latency) - limit.begin();
+        return std::min(result, M_NUM_BIN - 1);
+    }
+
+    const std::array<double, LatencyHistogram::M_NUM_BIN> &LatencyHistogram::bin_limit(void)
+    {
+        static const std::array<double, M_NUM_BIN> result {
+            10e-6, 100e-6, 1e-3, 10e-3, INFINITY
+        };
+        return result;
+    }
+
+    const std::array<std::string, LatencyHistogram::M_NUM_BIN> &LatencyHistogram::bin_name(void)
+    {
+        static const std::array<std::string, M_NUM_BIN> result {
+            "LT_10US", "LT_100US", "LT_1MS", "LT_10MS", "GE_10MS"
+        };
+        return result;
+    }
+
+    const std::array<std::string, LatencyHistogram::M_NUM_BIN> &LatencyHistogram::bin_range(void)
+    {
+        static const std::array<std::string, M_NUM_BIN> result {
+            "less than 10 microseconds",
+            "at least 10 and less than 100 microseconds",
+            "at least 100 microseconds and less than 1 millisecond",
+            "at least 1 and less than 10 milliseconds",
+            "at least 10 milliseconds",
+        };
+        return result;
+    }
+}
@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef LATENCYHISTOGRAM_HPP_INCLUDE
+#define LATENCYHISTOGRAM_HPP_INCLUDE
+
+#include <array>
+#include <string>
+
+namespace geopm
+{
+    /// @brief Bins of the histograms of control loop latencies, e.g.
+    ///        the lateness of wake ups recorded by WaiterLateness and
+    ///        the phase times recorded by ControllerPhase.
+    class LatencyHistogram
+    {
+        public:
+            /// @brief Number of histogram bins.
+            static constexpr int M_NUM_BIN = 5;
+            /// @brief Index of the bin that a latency falls in.
+            /// @param [in] latency Time in seconds; negative values
+            ///        fall in the first bin.
+            static int bin(double latency);
+            /// @brief Upper limit in seconds of each histogram bin.
+            static const std::array<double, M_NUM_BIN> &bin_limit(void);
+            /// @brief Short name for each histogram bin, e.g.
+            ///        "LT_10US".
+            static const std::array<std::string, M_NUM_BIN> &bin_name(void);
+            /// @brief Range of latencies counted by each histogram
+            ///        bin for use in signal descriptions, e.g. "less
+            ///        than 10 microseconds".
+            static const std::array<std::string, M_NUM_BIN> &bin_range(void);
+    };
+}
+
+#endif
@@ -11,6 +11,7 @@
 
 #include "Comm.hpp"
 #include "geopm/Exception.hpp"
+#include "geopm/Helper.hpp"
 #include "geopm/SharedMemory.hpp"
 #include "geopm_mpi_comm_split.h"
 
@@ -169,6 +170,18 @@ namespace geopm
             for (auto it = m_windows.begin(); it != m_windows.end(); ++it) {
                 delete (CommWindow *) *it;
             }
+            for (auto it = m_requests.begin(); it != m_requests.end(); ++it) {
+                MPI_Request *request = (MPI_Request *) it->first;
+                if (is_valid() && *request != MPI_REQUEST_NULL) {
+                    // Sends can not be cancelled, they are released
+                    // and left to complete.
+                    if (!it->second) {
+                        PMPI_Cancel(request);
+                    }
+                    PMPI_Request_free(request);
+                }
+                delete request;
+            }
             if (is_valid() && m_comm != MPI_COMM_WORLD) {
                 PMPI_Comm_free(&m_comm);
             }
@@ -247,6 +260,15 @@ namespace geopm
         }
     }
 
+    void MPIComm::check_request(size_t request_id) const
+    {
+        if (m_requests.find(request_id) == m_requests.end()) {
+            std::ostringstream ex_str;
+            ex_str << "requested request handle " << request_id << " invalid";
+            throw Exception(ex_str.str(), GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+    }
+
     bool MPIComm::is_valid() const
     {
         int is_finalized;
@@ -382,6 +404,70 @@ namespace geopm
         ((CommWindow *) window_id)->put(send_buf, send_size, rank, disp);
     }
 
+    size_t MPIComm::isend(const void *send_buf, size_t send_size, int rank, int tag)
+    {
+        std::unique_ptr<MPI_Request> request = geopm::make_unique<MPI_Request>(MPI_REQUEST_NULL);
+        if (is_valid()) {
+            check_mpi(PMPI_Isend(GEOPM_MPI_CONST_CAST(void *)(send_buf), send_size, MPI_BYTE,
+                                 rank, tag, m_comm, request.get()));
+        }
+        size_t result = (size_t) request.release();
+        m_requests[result] = true;
+        return result;
+    }
+
+    size_t MPIComm::irecv(void *recv_buf, size_t recv_size, int rank, int tag)
+    {
+        std::unique_ptr<MPI_Request> request = geopm::make_unique<MPI_Request>(MPI_REQUEST_NULL);
+        if (is_valid()) {
+            check_mpi(PMPI_Irecv(recv_buf, recv_size, MPI_BYTE,
+                                 rank, tag, m_comm, request.get()));
+        }
+        size_t result = (size_t) request.release();
+        m_requests[result] = false;
+        return result;
+    }
+
+    bool MPIComm::request_test(size_t request_id)
+    {
+        check_request(request_id);
+        MPI_Request *request = (MPI_Request *) request_id;
+        int is_complete = 1;
+        if (*request != MPI_REQUEST_NULL) {
+            check_mpi(PMPI_Test(request, &is_complete, MPI_STATUS_IGNORE));
+        }
+        if (is_complete) {
+            m_requests.erase(request_id);
+            delete request;
+        }
+        return is_complete;
+    }
+
+    void MPIComm::request_cancel(size_t request_id)
+    {
+        check_request(request_id);
+        MPI_Request *request = (MPI_Request *) request_id;
+        bool is_send = m_requests.at(request_id);
+        m_requests.erase(request_id);
+        if (*request != MPI_REQUEST_NULL) {
+            int err = 0;
+            if (is_send) {
+                err = PMPI_Request_free(request);
+            }
+            else {
+                err = PMPI_Cancel(request);
+                if (!err) {
+                    err = PMPI_Wait(request, MPI_STATUS_IGNORE);
+                }
+            }
+            delete request;
+            check_mpi(err);
+        }
+        else {
+            delete request;
+        }
+    }
+
     CommWindow::CommWindow(MPI_Comm comm, void *base, size_t size)
     {
         check_mpi(PMPI_Win_create(base, (MPI_Aint) size, 1, MPI_INFO_NULL, comm, &m_window));
@@ -6,6 +6,7 @@
 #ifndef MPICOMM_HPP_INCLUDE
 #define MPICOMM_HPP_INCLUDE
 
+#include <map>
 #include <memory>
 #include <set>
 #include <vector>
@@ -67,14 +68,21 @@ namespace geopm
             virtual void gatherv(const void *send_buf, size_t send_size, void *recv_buf,
                                  const std::vector<size_t> &recv_sizes, const std::vector<off_t> &rank_offset, int root) const override;
             virtual void window_put(const void *send_buf, size_t send_size, int rank, off_t disp, size_t window_id) const override;
+            virtual size_t isend(const void *send_buf, size_t send_size, int rank, int tag) override;
+            virtual size_t irecv(void *recv_buf, size_t recv_size, int rank, int tag) override;
+            virtual bool request_test(size_t request_id) override;
+            virtual void request_cancel(size_t request_id) override;
 
             void tear_down(void) override;
         protected:
             void check_window(size_t window_id) const;
+            void check_request(size_t request_id) const;
             bool is_valid() const;
             MPI_Comm m_comm;
             size_t m_maxdims;
             std::set<size_t> m_windows;
+            // Pending request handles, mapped to true for sends
+            std::map<size_t, bool> m_requests;
             const std::string m_name;
             bool m_is_torn_down = false;
     };
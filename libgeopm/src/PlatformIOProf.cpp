@@ -14,6 +14,8 @@
 #include "geopm/PlatformIO.hpp"
 #include "ProfileIOGroup.hpp"
 #include "EpochIOGroup.hpp"
+#include "WaiterIOGroup.hpp"
+#include "ControllerIOGroup.hpp"
 
 
 namespace geopm
@@ -36,6 +38,20 @@ namespace geopm
         catch (const geopm::Exception &ex) {
             print_load_warning("ProfileIOGroup", ex.what());
         }
+        try {
+            m_platform_io.register_iogroup(
+                WaiterIOGroup::make_plugin());
+        }
+        catch (const geopm::Exception &ex) {
+            print_load_warning("WaiterIOGroup", ex.what());
+        }
+        try {
+            m_platform_io.register_iogroup(
+                ControllerIOGroup::make_plugin());
+        }
+        catch (const geopm::Exception &ex) {
+            print_load_warning("ControllerIOGroup", ex.what());
+        }
     }
     void PlatformIOProf::print_load_warning(const std::string &io_group_name,
                                             const std::string &what) const
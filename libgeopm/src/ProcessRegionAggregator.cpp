@@ -5,10 +5,13 @@
 
 #include "ProcessRegionAggregator.hpp"
 
+#include <cmath>
+
 #include "ApplicationSampler.hpp"
 #include "geopm/Helper.hpp"
 #include "geopm/Exception.hpp"
 #include "record.hpp"
+#include "RegionIndex.hpp"
 #include "geopm_time.h"
 
 namespace geopm
@@ -25,71 +28,80 @@ namespace geopm
     }
 
     ProcessRegionAggregatorImp::ProcessRegionAggregatorImp(ApplicationSampler &sampler)
+        : ProcessRegionAggregatorImp(sampler, RegionIndex::region_index())
+    {
+
+    }
+
+    ProcessRegionAggregatorImp::ProcessRegionAggregatorImp(ApplicationSampler &sampler,
+                                                           RegionIndex &region_index)
         : m_app_sampler(sampler)
+        , m_region_index(region_index)
+        , m_process_last(-1)
+        , m_entry_time_last(nullptr)
     {
         m_num_process = m_app_sampler.client_pids().size();
     }
 
+    std::vector<double> &ProcessRegionAggregatorImp::process_entry_time(int process)
+    {
+        if (m_entry_time_last == nullptr || process != m_process_last) {
+            m_entry_time_last = &(m_entry_time[process]);
+            m_process_last = process;
+        }
+        return *m_entry_time_last;
+    }
+
+    void ProcessRegionAggregatorImp::region_update(int region_idx, double runtime, int count)
+    {
+        if (region_idx >= (int)m_region_info.size()) {
+            m_region_info.resize(region_idx + 1, {0.0, 0});
+        }
+        m_region_info[region_idx].total_runtime += runtime;
+        m_region_info[region_idx].total_count += count;
+    }
+
     void ProcessRegionAggregatorImp::update(void)
     {
         geopm_time_s time_zero = geopm::time_zero();
-        auto records = m_app_sampler.get_records();
+        const auto &records = m_app_sampler.get_records();
         for (const auto &rec: records) {
             if (rec.event == EVENT_REGION_ENTRY) {
-                int process = rec.process;
-                uint64_t region_hash = rec.signal;
-                double entry_time = geopm_time_diff(&time_zero, &(rec.time));
-                auto proc = m_region_info.emplace(std::piecewise_construct,
-                                                  std::forward_as_tuple(process),
-                                                  std::forward_as_tuple());
-                auto region = proc.first->second.emplace(std::piecewise_construct,
-                                                         std::forward_as_tuple(region_hash),
-                                                         std::forward_as_tuple());
-                region.first->second.last_entry_time = entry_time;
+                int region_idx = m_region_index.insert(rec.signal);
+                auto &entry_time = process_entry_time(rec.process);
+                if (region_idx >= (int)entry_time.size()) {
+                    entry_time.resize(region_idx + 1, NAN);
+                }
+                entry_time[region_idx] = geopm_time_diff(&time_zero, &(rec.time));
             }
             else if (rec.event == EVENT_REGION_EXIT) {
-                int process = rec.process;
-                uint64_t region_hash = rec.signal;
-                double exit_time = geopm_time_diff(&time_zero, &(rec.time));
-                auto proc = m_region_info.find(process);
-                if (proc == m_region_info.end()) {
+                int region_idx = m_region_index.index(rec.signal);
+                auto &entry_time = process_entry_time(rec.process);
+                if (region_idx == -1 ||
+                    region_idx >= (int)entry_time.size() ||
+                    std::isnan(entry_time[region_idx])) {
                     throw Exception("ProcessRegionAggregator: region exit without entry",
                                     GEOPM_ERROR_INVALID, __FILE__, __LINE__);
                 }
-                auto region = proc->second.find(region_hash);
-                if (region == proc->second.end()) {
-                    throw Exception("ProcessRegionAggregator: region exit without entry",
-                                    GEOPM_ERROR_INVALID, __FILE__, __LINE__);
-                }
-                region->second.total_runtime += exit_time - region->second.last_entry_time;
-                region->second.total_count += 1;
+                double exit_time = geopm_time_diff(&time_zero, &(rec.time));
+                region_update(region_idx, exit_time - entry_time[region_idx], 1);
             }
             else if (rec.event == EVENT_SHORT_REGION) {
-                int process = rec.process;
-                int short_idx = rec.signal;
-                auto short_region = m_app_sampler.get_short_region(short_idx);
-                uint64_t region_hash = short_region.hash;
-
-                auto proc = m_region_info.emplace(std::piecewise_construct,
-                                                  std::forward_as_tuple(process),
-                                                  std::forward_as_tuple());
-                auto region = proc.first->second.emplace(std::piecewise_construct,
-                                                         std::forward_as_tuple(region_hash),
-                                                         std::forward_as_tuple());
-                region.first->second.total_runtime += short_region.total_time;
-                region.first->second.total_count += short_region.num_complete;
+                auto short_region = m_app_sampler.get_short_region(rec.signal);
+                region_update(m_region_index.insert(short_region.hash),
+                              short_region.total_time,
+                              short_region.num_complete);
             }
         }
     }
 
-    double ProcessRegionAggregatorImp::get_runtime_average(uint64_t region_hash) const
+    double ProcessRegionAggregatorImp::region_average(uint64_t region_hash, bool is_count) const
     {
         double total = 0;
-        for (const auto &kv : m_region_info) {
-            auto it = kv.second.find(region_hash);
-            if (it != kv.second.end()) {
-                total += it->second.total_runtime;
-            }
+        int region_idx = m_region_index.index(region_hash);
+        if (region_idx != -1 && region_idx < (int)m_region_info.size()) {
+            const auto &info = m_region_info[region_idx];
+            total = is_count ? info.total_count : info.total_runtime;
         }
         if (m_num_process != 0) {
             total = total / m_num_process;
@@ -97,18 +109,13 @@ namespace geopm
         return total;
     }
 
+    double ProcessRegionAggregatorImp::get_runtime_average(uint64_t region_hash) const
+    {
+        return region_average(region_hash, false);
+    }
+
     double ProcessRegionAggregatorImp::get_count_average(uint64_t region_hash) const
     {
-        double total = 0;
-        for (const auto &kv : m_region_info) {
-            auto it = kv.second.find(region_hash);
-            if (it != kv.second.end()) {
-                total += it->second.total_count;
-            }
-        }
-        if (m_num_process != 0) {
-            total = total / m_num_process;
-        }
-        return total;
+        return region_average(region_hash, true);
     }
 }
@@ -8,8 +8,9 @@
 
 #include <cstdint>
 
-#include <map>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 namespace geopm
 {
@@ -37,32 +38,44 @@ namespace geopm
     };
 
     class ApplicationSampler;
+    class RegionIndex;
 
     class ProcessRegionAggregatorImp : public ProcessRegionAggregator
     {
         public:
             ProcessRegionAggregatorImp();
             ProcessRegionAggregatorImp(ApplicationSampler &sampler);
+            ProcessRegionAggregatorImp(ApplicationSampler &sampler,
+                                       RegionIndex &region_index);
             virtual ~ProcessRegionAggregatorImp() = default;
             void update(void) override;
             double get_runtime_average(uint64_t region_hash) const override;
             double get_count_average(uint64_t region_hash) const override;
         private:
+            std::vector<double> &process_entry_time(int process);
+            void region_update(int region_idx, double runtime, int count);
+            double region_average(uint64_t region_hash, bool is_count) const;
+
             ApplicationSampler &m_app_sampler;
+            RegionIndex &m_region_index;
             int m_num_process;
 
-            // Records will be coming in sorted by process.  An
-            // optimization might be to keep an iterator around
-            // pointing to the most recent process's map.  The lookup
-            // by region hash will happen less frequently but requires
-            // iteration over all the process maps.  Build a cache and
-            // invalidate it if update() is called.
+            // Totals over all processes, indexed by the RegionIndex
+            // index of the region.  Regions that have not been seen
+            // by this aggregator may be beyond the end.
             struct region_info_s {
                 double total_runtime;
                 int total_count;
-                double last_entry_time;
             };
-            std::map<int, std::map<uint64_t, region_info_s> > m_region_info;
+            std::vector<region_info_s> m_region_info;
+            // Time of the last entry into each region by each
+            // process, indexed like m_region_info and NAN for regions
+            // the process has never entered.
+            std::unordered_map<int, std::vector<double> > m_entry_time;
+            // Records are sorted by process, so remember the most
+            // recent process to avoid a lookup per record.
+            int m_process_last;
+            std::vector<double> *m_entry_time_last;
     };
 }
 
@@ -10,6 +10,7 @@
 #include <iostream>
 #include <iomanip>
 #include "ProfileTracerImp.hpp"
+#include "geopm_version.h"
 #include "geopm/PlatformIO.hpp"
 #include "geopm/PlatformTopo.hpp"
 #include "geopm/Helper.hpp"
@@ -18,6 +19,7 @@
 #include "geopm_field.h"
 #include "geopm/Environment.hpp"
 #include "geopm/Exception.hpp"
+#include "BinaryProfileTrace.hpp"
 #include "CSV.hpp"
 #include "geopm_debug.hpp"
 #include "ApplicationSampler.hpp"
@@ -35,6 +37,10 @@ namespace geopm
                            environment().do_trace_profile(),
                            environment().trace_profile(),
                            hostname(),
+                           environment().profile(),
+                           environment().agent(),
+                           environment().trace_profile_format(),
+                           environment().trace_profile_compression(),
                            ApplicationSampler::application_sampler())
     {
 
@@ -47,12 +53,47 @@ namespace geopm
                                        const std::string &file_name,
                                        const std::string &host_name,
                                        ApplicationSampler& application_sampler)
+        : ProfileTracerImp(start_time, time_zero, buffer_size, is_trace_enabled,
+                           file_name, host_name, "", "", "csv", "none",
+                           application_sampler)
+    {
+
+    }
+
+    ProfileTracerImp::ProfileTracerImp(const std::string &start_time,
+                                       const geopm_time_s &time_zero,
+                                       size_t buffer_size,
+                                       bool is_trace_enabled,
+                                       const std::string &file_name,
+                                       const std::string &host_name,
+                                       const std::string &profile_name,
+                                       const std::string &agent_name,
+                                       const std::string &format,
+                                       const std::string &compression,
+                                       ApplicationSampler& application_sampler)
         : m_is_trace_enabled(is_trace_enabled)
         , m_time_zero(time_zero)
     {
         m_application_sampler = &application_sampler;
-        if (m_is_trace_enabled) {
-            m_csv = geopm::make_unique<CSVImp>(file_name, host_name, start_time, buffer_size);
+        if (m_is_trace_enabled && format == "binary" && compression != "none") {
+            throw Exception("ProfileTracerImp::ProfileTracerImp(): compression \"" + compression +
+                            "\" is not supported for the binary profile trace format",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (m_is_trace_enabled && format == "binary") {
+            // Same header fields as the CSV trace
+            std::vector<std::pair<std::string, std::string> > header = {
+                {"geopm_version", geopm_version()},
+                {"start_time", start_time},
+                {"profile_name", profile_name},
+                {"node_name", host_name},
+                {"agent", agent_name},
+            };
+            m_binary = geopm::make_unique<BinaryProfileTrace>(file_name, host_name, header,
+                                                              buffer_size / sizeof(record_s));
+        }
+        else if (m_is_trace_enabled) {
+            m_csv = geopm::make_unique<CSVImp>(file_name, host_name, start_time, buffer_size, compression);
 
             m_csv->add_column("TIME", "double");
             m_csv->add_column("PROCESS", "integer");
@@ -118,7 +159,18 @@ namespace geopm
 
     void ProfileTracerImp::update(const std::vector<record_s> &records)
     {
-        if (m_is_trace_enabled) {
+        if (m_binary) {
+            m_binary->time_zero(geopm::time_zero());
+            for (const auto &it : records) {
+                if (it.event == EVENT_SHORT_REGION) {
+                    m_binary->append(it, m_application_sampler->get_short_region(it.signal));
+                }
+                else {
+                    m_binary->append(it);
+                }
+            }
+        }
+        else if (m_is_trace_enabled) {
             std::vector<double> sample(M_NUM_COLUMN);
             m_time_zero = geopm::time_zero();
             for (const auto &it : records) {
@@ -15,6 +15,7 @@
 namespace geopm
 {
     struct record_s;
+    class BinaryProfileTrace;
 
     class ProfileTracerImp : public ProfileTracer
     {
@@ -27,6 +28,26 @@ namespace geopm
                              const std::string &file_name,
                              const std::string &host_name,
                              ApplicationSampler& application_sampler = ApplicationSampler::application_sampler());
+            /// @param [in] profile_name Profile name recorded in the
+            ///        header of the binary format.
+            /// @param [in] agent_name Agent name recorded in the
+            ///        header of the binary format.
+            /// @param [in] format Either "csv" or "binary"; see
+            ///        BinaryProfileTrace for the binary format.
+            /// @param [in] compression Either "none" or "gzip"; see
+            ///        CSVImp.  Only "none" is supported with the
+            ///        "binary" format.
+            ProfileTracerImp(const std::string &start_time,
+                             const geopm_time_s &time_zero,
+                             size_t buffer_size,
+                             bool is_trace_enabled,
+                             const std::string &file_name,
+                             const std::string &host_name,
+                             const std::string &profile_name,
+                             const std::string &agent_name,
+                             const std::string &format,
+                             const std::string &compression,
+                             ApplicationSampler& application_sampler);
             virtual ~ProfileTracerImp();
             void update(const std::vector<record_s> &records);
          private:
@@ -39,6 +60,7 @@ namespace geopm
             };
             bool m_is_trace_enabled;
             std::unique_ptr<CSV> m_csv;
+            std::unique_ptr<BinaryProfileTrace> m_binary;
             geopm_time_s m_time_zero;
             static ApplicationSampler* m_application_sampler;
             static std::string event_format(double value);
@@ -126,9 +126,9 @@ namespace geopm
         }
     }
 
-    std::vector<record_s> ProxyEpochRecordFilter::filter(const record_s &record)
+    void ProxyEpochRecordFilter::filter(const record_s &record,
+                                        std::vector<record_s> &result)
     {
-        std::vector<record_s> result;
         if (record.event != EVENT_EPOCH_COUNT) {
             result.push_back(record);
             if (record.event == EVENT_REGION_ENTRY &&
@@ -143,6 +143,5 @@ namespace geopm
                 ++m_count;
             }
         }
-        return result;
     }
 }
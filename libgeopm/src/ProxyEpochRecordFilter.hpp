@@ -60,16 +60,20 @@ namespace geopm
             ProxyEpochRecordFilter(const std::string &filter_name);
             /// @brief Default destructor.
             virtual ~ProxyEpochRecordFilter() = default;
-            /// @brief If input record matches the periodic entry into
-            ///        the proxy-region matching the construction
-            ///        arguments, then the output will be a vector of
-            ///        length one containing the inferred
-            ///        M_EVENT_EPOCH_COUNT event.  In all other cases
-            ///        the method returns an empty vector.
+            using RecordFilter::filter;
+            /// @brief Input records other than M_EVENT_EPOCH_COUNT
+            ///        events are appended to the result.  If the input
+            ///        record matches the periodic entry into the
+            ///        proxy-region matching the construction
+            ///        arguments, then the inferred
+            ///        M_EVENT_EPOCH_COUNT event is also appended.
             ///
-            /// @return An empty vector or a vector of length one
-            ///         containing a record of an epoch event.
-            std::vector<record_s> filter(const record_s &record);
+            /// @param [in] record The update value to be filtered.
+            ///
+            /// @param [in,out] result Vector that the filtered
+            ///        records are appended to.
+            void filter(const record_s &record,
+                        std::vector<record_s> &result) override;
             /// @brief Static function that will parse the filter
             ///        string for the proxy_epoch into the constructor
             ///        arguments for a ProxyEpochRecordFilter.
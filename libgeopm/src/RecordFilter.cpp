@@ -5,6 +5,7 @@
 
 
 #include "RecordFilter.hpp"
+#include "record.hpp"
 #include "ProxyEpochRecordFilter.hpp"
 #include "EditDistEpochRecordFilter.hpp"
 #include "geopm/Helper.hpp"
@@ -27,4 +28,11 @@ namespace geopm
         }
         return result;
     }
+
+    std::vector<record_s> RecordFilter::filter(const record_s &record)
+    {
+        std::vector<record_s> result;
+        filter(record, result);
+        return result;
+    }
 }
@@ -8,6 +8,7 @@
 
 #include <vector>
 #include <memory>
+#include <string>
 
 namespace geopm
 {
@@ -28,14 +29,26 @@ namespace geopm
             /// This method is called repeatedly by a user to update a
             /// filtered time stream with a new record.  The input
             /// record is used to update the state of the filter and
-            /// the method returns a vector containing any filtered
-            /// values resulting from the update.
+            /// any filtered values resulting from the update are
+            /// appended to the end of the result vector.  This lets
+            /// the caller filter many records into one buffer
+            /// without creating a temporary vector per record.
+            ///
+            /// @param [in] record The update value to be filtered.
+            ///
+            /// @param [in,out] result Vector that zero or more
+            ///        records to update the filtered stream are
+            ///        appended to.
+            virtual void filter(const record_s &record,
+                                std::vector<record_s> &result) = 0;
+            /// @brief Apply a filter to a stream of records and
+            ///        return the filtered values in a new vector.
             ///
             /// @param [in] record The update value to be filtered.
             ///
             /// @return Vector of zero or more records to update the
             ///         filtered stream.
-            virtual std::vector<record_s> filter(const record_s &record) = 0;
+            std::vector<record_s> filter(const record_s &record);
     };
 }
 
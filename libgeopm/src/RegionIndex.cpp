@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "RegionIndex.hpp"
+
+#include <string>
+
+#include "geopm/Exception.hpp"
+
+namespace geopm
+{
+    RegionIndex &RegionIndex::region_index(void)
+    {
+        static RegionIndex instance;
+        return instance;
+    }
+
+    int RegionIndex::insert(uint64_t region_hash)
+    {
+        auto result = m_index.emplace(region_hash, m_hash.size());
+        if (result.second) {
+            m_hash.push_back(region_hash);
+        }
+        return result.first->second;
+    }
+
+    int RegionIndex::index(uint64_t region_hash) const
+    {
+        auto it = m_index.find(region_hash);
+        return it == m_index.end() ? -1 : it->second;
+    }
+
+    uint64_t RegionIndex::hash(int region_idx) const
+    {
+        if (region_idx < 0 || region_idx >= (int)m_hash.size()) {
+            throw Exception("RegionIndex::hash(): region_idx out of range: " +
+                            std::to_string(region_idx),
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        return m_hash[region_idx];
+    }
+
+    int RegionIndex::num_region(void) const
+    {
+        return m_hash.size();
+    }
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef REGIONINDEX_HPP_INCLUDE
+#define REGIONINDEX_HPP_INCLUDE
+
+#include <cstdint>
+
+#include <unordered_map>
+#include <vector>
+
+namespace geopm
+{
+    /// @brief Registry that assigns each region hash a dense index
+    ///        the first time the hash is seen.  Indices start at zero
+    ///        and are never reused, so per-region data can be stored
+    ///        in vectors and found with one hash table lookup.  One
+    ///        instance is shared by the aggregators in the process so
+    ///        that a region has the same index in each of them.  Not
+    ///        thread safe; only the controller thread may use the
+    ///        shared instance.
+    class RegionIndex
+    {
+        public:
+            static RegionIndex &region_index(void);
+            RegionIndex() = default;
+            virtual ~RegionIndex() = default;
+            /// @brief Get the index of a region, assigning the next
+            ///        unused index if the hash has not been seen.
+            int insert(uint64_t region_hash);
+            /// @brief Get the index of a region.
+            /// @return The region index, or -1 if the hash has never
+            ///         been inserted.
+            int index(uint64_t region_hash) const;
+            /// @brief Get the hash of the region with the given
+            ///        index.
+            uint64_t hash(int region_idx) const;
+            /// @brief Number of regions that have been inserted.
+            int num_region(void) const;
+        private:
+            std::unordered_map<uint64_t, int> m_index;
+            std::vector<uint64_t> m_hash;
+    };
+}
+
+#endif
@@ -35,6 +35,8 @@
 #include "EnvironmentParser.hpp"
 #include "geopm/PlatformIOProf.hpp"
 #include "geopm_time.h"
+#include "ControllerPhase.hpp"
+#include "BinaryReport.hpp"
 
 namespace geopm
 {
@@ -53,7 +55,8 @@ namespace geopm
                       environment().policy(),
                       environment().do_endpoint(),
                       environment().profile(),
-                      environment().do_ctl_local())
+                      environment().do_ctl_local(),
+                      environment().report_format())
     {
 
     }
@@ -69,7 +72,8 @@ namespace geopm
                              const std::string &policy_path,
                              bool do_endpoint,
                              const std::string &profile_name,
-                             bool do_ctl_local)
+                             bool do_ctl_local,
+                             const std::string &report_format)
         : m_start_time(start_time)
         , m_report_name(report_name)
         , m_platform_io(platform_io)
@@ -82,13 +86,23 @@ namespace geopm
         , m_rank(rank)
         , m_sticker_freq(m_platform_io.read_signal("CPUINFO::FREQ_STICKER", GEOPM_DOMAIN_BOARD, 0))
         , m_epoch_count_idx(-1)
+        , m_do_write_skipped(false)
+        , m_write_skipped_idx(-1)
+        , m_do_wait_lateness(false)
+        , m_do_controller_phase(false)
         , m_do_init(true)
         , m_total_time(0.0)
         , m_overhead_time(0.0)
         , m_sample_delay(0.0)
         , m_profile_name(profile_name)
         , m_do_ctl_local(do_ctl_local)
+        , m_do_yaml(report_format == "yaml" || report_format == "both")
+        , m_do_binary(report_format == "binary" || report_format == "both")
     {
+        if (!m_do_yaml && !m_do_binary) {
+            throw Exception("ReporterImp::ReporterImp(): invalid report format: \"" + report_format + "\"",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
         GEOPM_DEBUG_ASSERT(m_sample_agg != nullptr, "m_sample_agg cannot be null");
         if (!m_rank) {
             // check if report file can be created
@@ -123,6 +137,10 @@ namespace geopm
             init_sync_fields();
             init_environment_signals();
             m_epoch_count_idx = m_platform_io.push_signal("EPOCH_COUNT", GEOPM_DOMAIN_BOARD, 0);
+            if (m_do_write_skipped) {
+                m_write_skipped_idx = m_platform_io.push_signal("MSR::BATCH_WRITE_SKIPPED",
+                                                                GEOPM_DOMAIN_BOARD, 0);
+            }
             if (m_proc_region_agg == nullptr) {
                 m_proc_region_agg = ProcessRegionAggregator::make_unique();
             }
@@ -162,26 +180,45 @@ namespace geopm
         }
 
         int rank = comm->rank();
-        std::ofstream common_report;
-        if (!rank) {
-            common_report.open(m_report_name);
-            if (!common_report.good()) {
-                throw Exception("Failed to open report file", GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        auto header = create_header_fields(agent_name, m_profile_name, agent_report_header);
+        report_host_s host_report = create_host_report(application_io.region_name_set(),
+                                                       get_max_memory(),
+                                                       tree_comm.overhead_send(),
+                                                       agent_host_report,
+                                                       agent_region_report);
+        if (m_do_yaml) {
+            std::ofstream common_report;
+            if (!rank) {
+                common_report.open(m_report_name);
+                if (!common_report.good()) {
+                    throw Exception("Failed to open report file", GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+                }
+                common_report << create_header(header);
+            }
+            std::vector<size_t> host_size;
+            std::string full_report = gather_report(create_report(host_report), comm, host_size);
+            if (!rank) {
+                common_report << full_report;
+                common_report << std::endl;
+                common_report.close();
             }
-            common_report << create_header(agent_name, m_profile_name, agent_report_header);
         }
-
-        std::string host_report = create_report(application_io.region_name_set(),
-                                                get_max_memory(),
-                                                tree_comm.overhead_send(),
-                                                agent_host_report,
-                                                agent_region_report);
-        std::string full_report = gather_report(host_report, std::move(comm));
-
-        if (!rank) {
-            common_report << full_report;
-            common_report << std::endl;
-            common_report.close();
+        if (m_do_binary) {
+            std::string binary_name = m_do_yaml ? m_report_name + ".bin" : m_report_name;
+            std::ofstream binary_report;
+            if (!rank) {
+                binary_report.open(binary_name, std::ios::binary);
+                if (!binary_report.good()) {
+                    throw Exception("Failed to open binary report file", GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+                }
+            }
+            std::vector<size_t> host_size;
+            std::string full_report = gather_report(BinaryReport::host_block(host_report), comm, host_size);
+            if (!rank) {
+                binary_report << BinaryReport::header(header, host_size);
+                binary_report << full_report;
+                binary_report.close();
+            }
         }
     }
 
@@ -192,23 +229,22 @@ namespace geopm
                                       const std::map<uint64_t, std::vector<std::pair<std::string, std::string> > > &agent_region_report)
     {
         std::ostringstream common_report;
-        common_report << create_header(agent_name, profile_name, agent_report_header);
+        common_report << create_header(create_header_fields(agent_name, profile_name, agent_report_header));
 
-        common_report << create_report({},
-                                       get_max_memory(),
-                                       0.0,
-                                       agent_host_report,
-                                       agent_region_report);
+        common_report << create_report(create_host_report({},
+                                                          get_max_memory(),
+                                                          0.0,
+                                                          agent_host_report,
+                                                          agent_region_report));
         common_report << std::endl;
         return common_report.str();
     }
 
-    std::string ReporterImp::create_header(const std::string &agent_name,
-                                           const std::string &profile_name,
-                                           const std::vector<std::pair<std::string, std::string> > &agent_report_header)
+    std::vector<std::pair<std::string, std::string> >
+    ReporterImp::create_header_fields(const std::string &agent_name,
+                                      const std::string &profile_name,
+                                      const std::vector<std::pair<std::string, std::string> > &agent_report_header)
     {
-        std::ostringstream common_report;
-        // make header
         std::string policy_str = "{}";
         if (m_do_endpoint) {
             policy_str = "DYNAMIC";
@@ -221,32 +257,41 @@ namespace geopm
                 policy_str = m_policy_path;
             }
         }
-        std::vector<std::pair<std::string, std::string> > header {
+        std::vector<std::pair<std::string, std::string> > result {
             {"GEOPM Version", geopm_version()},
             {"Start Time", m_start_time},
             {"Profile", profile_name},
             {"Agent", agent_name},
             {"Policy", policy_str}
         };
+        result.insert(result.end(), agent_report_header.begin(), agent_report_header.end());
+        return result;
+    }
+
+    std::string ReporterImp::create_header(const std::vector<std::pair<std::string, std::string> > &header)
+    {
+        std::ostringstream common_report;
         yaml_write(common_report, M_INDENT_HEADER, header);
-        yaml_write(common_report, M_INDENT_HEADER, agent_report_header);
         common_report << "\n";
         yaml_write(common_report, M_INDENT_HOST, "Hosts:");
         return common_report.str();
     }
 
-
-    std::string ReporterImp::create_report(const std::set<std::string> &region_name_set, double max_memory, double comm_overhead,
-                                           const std::vector<std::pair<std::string, std::string> > &agent_host_report,
-                                           const std::map<uint64_t, std::vector<std::pair<std::string, std::string> > > &agent_region_report)
+    report_host_s ReporterImp::create_host_report(const std::set<std::string> &region_name_set, double max_memory, double comm_overhead,
+                                                  const std::vector<std::pair<std::string, std::string> > &agent_host_report,
+                                                  const std::map<uint64_t, std::vector<std::pair<std::string, std::string> > > &agent_region_report)
     {
-        // per-host report
-        std::ostringstream report;
-        yaml_write(report, M_INDENT_HOST_NAME, hostname() + ":");
-        yaml_write(report, M_INDENT_HOST_AGENT, agent_host_report);
-        if (region_name_set.size() != 0) {
-            yaml_write(report, M_INDENT_REGION, "Regions:");
-        }
+        report_host_s result;
+        result.host_name = hostname();
+        result.agent_field = agent_host_report;
+        auto agent_fields = [&agent_region_report](uint64_t hash) {
+            std::vector<std::pair<std::string, std::string> > fields;
+            const auto &it = agent_region_report.find(hash);
+            if (it != agent_region_report.end()) {
+                fields = it->second;
+            }
+            return fields;
+        };
 
         // vector of region data, in descending order by runtime
         struct region_info {
@@ -259,7 +304,7 @@ namespace geopm
         std::vector<region_info> region_ordered;
         GEOPM_DEBUG_ASSERT(region_name_set.size() == 0 ||
                            m_proc_region_agg != nullptr,
-                           "ReporterImp::create_report(): region set is not empty, but region aggregator pointer is null");
+                           "ReporterImp::create_host_report(): region set is not empty, but region aggregator pointer is null");
         for (const auto &region : region_name_set) {
             uint64_t region_hash = geopm_crc32_str(region.c_str());
             double count = m_proc_region_agg->get_count_average(region_hash);
@@ -285,19 +330,15 @@ namespace geopm
                                 GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
             }
 #endif
-            yaml_write(report, M_INDENT_REGION, "-");
-            yaml_write(report, M_INDENT_REGION_FIELD,
-                       {{"region", '"' + region.name + '"'},
-                        {"hash", geopm::string_format_hex(region.hash)}});
-            yaml_write(report, M_INDENT_REGION_FIELD,
-                       {{"runtime (s)", region.per_rank_avg_runtime},
-                        {"count", region.count}});
+            std::vector<std::pair<std::string, double> > fields {
+                {"runtime (s)", region.per_rank_avg_runtime},
+                {"count", region.count}
+            };
             auto region_data = get_region_data(region.hash);
-            yaml_write(report, M_INDENT_REGION_FIELD, region_data);
-            const auto &it = agent_region_report.find(region.hash);
-            if (it != agent_region_report.end()) {
-                yaml_write(report, M_INDENT_REGION_FIELD, agent_region_report.at(region.hash));
-            }
+            fields.insert(fields.end(), region_data.begin(), region_data.end());
+            result.region.push_back({report_host_s::M_REGION_TYPE_REGION,
+                                     region.name, region.hash, fields,
+                                     agent_fields(region.hash)});
             total_marked_runtime += region.per_rank_avg_runtime;
         }
 
@@ -307,41 +348,45 @@ namespace geopm
             epoch_count = m_platform_io.sample(m_epoch_count_idx);
         }
         if (total_marked_runtime != 0.0) {
-            yaml_write(report, M_INDENT_UNMARKED, "Unmarked Totals:");
             double unmarked_time = m_total_time -
                                    total_marked_runtime;
-            yaml_write(report, M_INDENT_UNMARKED_FIELD,
-                       {{"runtime (s)", unmarked_time},
-                        {"count", 0}});
+            std::vector<std::pair<std::string, double> > fields {
+                {"runtime (s)", unmarked_time},
+                {"count", 0}
+            };
             auto unmarked_data = get_region_data(GEOPM_REGION_HASH_UNMARKED);
-            yaml_write(report, M_INDENT_UNMARKED_FIELD, unmarked_data);
+            fields.insert(fields.end(), unmarked_data.begin(), unmarked_data.end());
             // agent extensions for unmarked
-            const auto &it = agent_region_report.find(GEOPM_REGION_HASH_UNMARKED);
-            if (it != agent_region_report.end()) {
-                yaml_write(report, M_INDENT_UNMARKED_FIELD, agent_region_report.at(GEOPM_REGION_HASH_UNMARKED));
-            }
+            result.region.push_back({report_host_s::M_REGION_TYPE_UNMARKED,
+                                     "", GEOPM_REGION_HASH_UNMARKED, fields,
+                                     agent_fields(GEOPM_REGION_HASH_UNMARKED)});
         }
         if (m_platform_io.is_valid_value(epoch_count) &&
             epoch_count != 0) {
-            yaml_write(report, M_INDENT_EPOCH, "Epoch Totals:");
             double epoch_runtime = m_sample_agg->sample_epoch(m_sync_signal_idx["TIME"]);
-            yaml_write(report, M_INDENT_EPOCH_FIELD,
-                       {{"runtime (s)", epoch_runtime},
-                        {"count", (int)epoch_count}});
+            std::vector<std::pair<std::string, double> > fields {
+                {"runtime (s)", epoch_runtime},
+                {"count", (int)epoch_count}
+            };
             auto epoch_data = get_region_data(GEOPM_REGION_HASH_EPOCH);
-            yaml_write(report, M_INDENT_EPOCH_FIELD, epoch_data);
+            fields.insert(fields.end(), epoch_data.begin(), epoch_data.end());
+            result.region.push_back({report_host_s::M_REGION_TYPE_EPOCH,
+                                     "", GEOPM_REGION_HASH_EPOCH, fields, {}});
         }
-        yaml_write(report, M_INDENT_TOTALS, "Application Totals:");
-        yaml_write(report, M_INDENT_TOTALS_FIELD,
-                   {{"runtime (s)", m_total_time},
-                    {"count", 0}});
+        std::vector<std::pair<std::string, double> > fields {
+            {"runtime (s)", m_total_time},
+            {"count", 0}
+        };
         auto region_data = get_region_data(GEOPM_REGION_HASH_APP);
-        yaml_write(report, M_INDENT_TOTALS_FIELD, region_data);
+        fields.insert(fields.end(), region_data.begin(), region_data.end());
+        result.region.push_back({report_host_s::M_REGION_TYPE_APP,
+                                 "", GEOPM_REGION_HASH_APP, fields, {}});
         // Controller overhead
         uint64_t mpi_init_thread_hash = geopm_crc32_str("MPI_Init_thread");
         double mpi_startup = m_proc_region_agg->get_runtime_average(mpi_init_thread_hash);
 
-        std::vector<std::pair<std::string, double> > overhead {
+        auto &overhead = result.overhead;
+        overhead = {
             {"GEOPM startup (s)", m_sample_delay},
             {"GEOPM overhead (s)", m_overhead_time},
             {"geopmctl memory HWM (B)", max_memory},
@@ -351,42 +396,120 @@ namespace geopm
             overhead.insert(overhead.begin(),
                             {"MPI startup (s)", mpi_startup});
         }
+        if (m_write_skipped_idx != -1) {
+            overhead.emplace_back("MSR writes skipped",
+                                  m_platform_io.sample(m_write_skipped_idx));
+        }
+        if (m_do_wait_lateness &&
+            m_platform_io.read_signal("WAITER::WAIT_COUNT", GEOPM_DOMAIN_BOARD, 0) != 0.0) {
+            static const std::vector<std::pair<std::string, std::string> > wait_fields {
+                {"Wait count", "WAITER::WAIT_COUNT"},
+                {"Wait lateness mean (s)", "WAITER::LATENESS_MEAN"},
+                {"Wait lateness max (s)", "WAITER::LATENESS_MAX"},
+                {"Waits with lateness < 10 us", "WAITER::LATENESS_COUNT_LT_10US"},
+                {"Waits with lateness < 100 us", "WAITER::LATENESS_COUNT_LT_100US"},
+                {"Waits with lateness < 1 ms", "WAITER::LATENESS_COUNT_LT_1MS"},
+                {"Waits with lateness < 10 ms", "WAITER::LATENESS_COUNT_LT_10MS"},
+                {"Waits with lateness >= 10 ms", "WAITER::LATENESS_COUNT_GE_10MS"},
+            };
+            for (const auto &field : wait_fields) {
+                overhead.emplace_back(field.first,
+                                      m_platform_io.read_signal(field.second,
+                                                                GEOPM_DOMAIN_BOARD, 0));
+            }
+        }
+        if (m_do_controller_phase) {
+            // Time spent in each phase of the control loop that was
+            // entered at least once
+            for (const auto &phase : ControllerPhase::phase_name()) {
+                std::string signal_prefix = "CONTROLLER::" + phase;
+                if (m_platform_io.read_signal(signal_prefix + "_COUNT", GEOPM_DOMAIN_BOARD, 0) == 0.0) {
+                    continue;
+                }
+                std::string phase_lower = phase;
+                std::transform(phase_lower.begin(), phase_lower.end(), phase_lower.begin(),
+                               [](char cc) { return cc == '_' ? ' ' : std::tolower(cc); });
+                std::string field_prefix = "Controller " + phase_lower;
+                overhead.emplace_back(field_prefix + " time (s)",
+                                      m_platform_io.read_signal(signal_prefix + "_TIME",
+                                                                GEOPM_DOMAIN_BOARD, 0));
+                overhead.emplace_back(field_prefix + " max (s)",
+                                      m_platform_io.read_signal(signal_prefix + "_TIME_MAX",
+                                                                GEOPM_DOMAIN_BOARD, 0));
+            }
+        }
+        return result;
+    }
 
-        yaml_write(report, M_INDENT_TOTALS_FIELD, overhead);
+    std::string ReporterImp::create_report(const report_host_s &host_report)
+    {
+        std::ostringstream report;
+        yaml_write(report, M_INDENT_HOST_NAME, host_report.host_name + ":");
+        yaml_write(report, M_INDENT_HOST_AGENT, host_report.agent_field);
+        bool is_first_region = true;
+        for (const auto &region : host_report.region) {
+            switch (region.type) {
+                case report_host_s::M_REGION_TYPE_REGION:
+                    if (is_first_region) {
+                        yaml_write(report, M_INDENT_REGION, "Regions:");
+                        is_first_region = false;
+                    }
+                    yaml_write(report, M_INDENT_REGION, "-");
+                    yaml_write(report, M_INDENT_REGION_FIELD,
+                               {{"region", '"' + region.name + '"'},
+                                {"hash", geopm::string_format_hex(region.hash)}});
+                    yaml_write(report, M_INDENT_REGION_FIELD, region.field);
+                    yaml_write(report, M_INDENT_REGION_FIELD, region.agent_field);
+                    break;
+                case report_host_s::M_REGION_TYPE_UNMARKED:
+                    yaml_write(report, M_INDENT_UNMARKED, "Unmarked Totals:");
+                    yaml_write(report, M_INDENT_UNMARKED_FIELD, region.field);
+                    yaml_write(report, M_INDENT_UNMARKED_FIELD, region.agent_field);
+                    break;
+                case report_host_s::M_REGION_TYPE_EPOCH:
+                    yaml_write(report, M_INDENT_EPOCH, "Epoch Totals:");
+                    yaml_write(report, M_INDENT_EPOCH_FIELD, region.field);
+                    break;
+                case report_host_s::M_REGION_TYPE_APP:
+                    yaml_write(report, M_INDENT_TOTALS, "Application Totals:");
+                    yaml_write(report, M_INDENT_TOTALS_FIELD, region.field);
+                    yaml_write(report, M_INDENT_TOTALS_FIELD, host_report.overhead);
+                    break;
+                default:
+                    GEOPM_DEBUG_ASSERT(false, "ReporterImp::create_report(): unknown region type");
+                    break;
+            }
+        }
         return report.str();
     }
 
-    std::string ReporterImp::gather_report(const std::string &host_report, std::shared_ptr<Comm> comm)
+    std::string ReporterImp::gather_report(const std::string &host_report, std::shared_ptr<Comm> comm,
+                                           std::vector<size_t> &host_size)
     {
         // aggregate reports from every node
         size_t buffer_size = host_report.size();
         std::vector<char> report_buffer;
-        std::vector<size_t> buffer_size_array;
         std::vector<off_t> buffer_displacement;
         int num_ranks = comm->num_rank();
-        buffer_size_array.resize(num_ranks);
+        host_size.resize(num_ranks);
         buffer_displacement.resize(num_ranks);
-        comm->gather(&buffer_size, sizeof(size_t), buffer_size_array.data(),
+        comm->gather(&buffer_size, sizeof(size_t), host_size.data(),
                      sizeof(size_t), 0);
 
         if (comm->rank() == 0) {
-            int full_report_size = std::accumulate(buffer_size_array.begin(), buffer_size_array.end(), 0) + 1;
+            size_t full_report_size = std::accumulate(host_size.begin(), host_size.end(), (size_t)0);
             report_buffer.resize(full_report_size);
             buffer_displacement[0] = 0;
             for (int i = 1; i < num_ranks; ++i) {
-                buffer_displacement[i] = buffer_displacement[i-1] + buffer_size_array[i-1];
+                buffer_displacement[i] = buffer_displacement[i-1] + host_size[i-1];
             }
         }
 
-        comm->gatherv((void *) (host_report.c_str()), sizeof(char) * buffer_size,
-                      (void *) report_buffer.data(), buffer_size_array, buffer_displacement, 0);
-        if (report_buffer.size() != 0) {
-            report_buffer.back() = '\0';
-        }
-        else {
-            report_buffer.push_back('\0');
-        }
-        return report_buffer.data();
+        comm->gatherv((void *) (host_report.data()), sizeof(char) * buffer_size,
+                      (void *) report_buffer.data(), host_size, buffer_displacement, 0);
+        // The gathered reports may hold binary data, so the size is
+        // explicit rather than given by a terminator
+        return std::string(report_buffer.begin(), report_buffer.end());
     }
 
     void ReporterImp::init_sync_fields(void)
@@ -447,6 +570,10 @@ namespace geopm
             {"uncore-frequency (Hz)", {"CPU_UNCORE_FREQUENCY_STATUS"}, sample_only}
         };
 
+        m_do_write_skipped = all_names.count("MSR::BATCH_WRITE_SKIPPED") != 0;
+        m_do_wait_lateness = all_names.count("WAITER::WAIT_COUNT") != 0;
+        m_do_controller_phase = all_names.count("CONTROLLER::WAIT_COUNT") != 0;
+
         for (const auto &field : conditional_sync_fields) {
             for (const auto &signal : field.supporting_signals) {
                 if (all_names.count(signal) != 0) {
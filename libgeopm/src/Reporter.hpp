@@ -18,6 +18,7 @@
 
 namespace geopm
 {
+    struct report_host_s;
     class Comm;
     class ApplicationIO;
     class TreeComm;
@@ -101,7 +102,8 @@ namespace geopm
                         const std::string &policy_path,
                         bool do_endpoint,
                         const std::string &profile_name,
-                        bool do_ctl_local);
+                        bool do_ctl_local,
+                        const std::string &report_format);
             virtual ~ReporterImp() = default;
             void init(void) override;
             void update(void) override;
@@ -156,13 +158,22 @@ namespace geopm
             static void yaml_write(std::ostream &os, int indent_level,
                                    const std::vector<std::pair<std::string, double> > &data);
 
-            std::string create_header(const std::string &agent_name,
-                                      const std::string &profile_name,
-                                      const std::vector<std::pair<std::string, std::string> > &agent_report_header);
-            std::string create_report(const std::set<std::string> &region_name_set, double max_memory, double comm_overhead,
-                                      const std::vector<std::pair<std::string, std::string> > &agent_host_report,
-                                      const std::map<uint64_t, std::vector<std::pair<std::string, std::string> > > &agent_region_report);
-            std::string gather_report(const std::string &host_report, std::shared_ptr<Comm> comm);
+            std::vector<std::pair<std::string, std::string> > create_header_fields(const std::string &agent_name,
+                                                                                   const std::string &profile_name,
+                                                                                   const std::vector<std::pair<std::string, std::string> > &agent_report_header);
+            std::string create_header(const std::vector<std::pair<std::string, std::string> > &header);
+            /// @brief Collect the values reported for this host.
+            report_host_s create_host_report(const std::set<std::string> &region_name_set, double max_memory, double comm_overhead,
+                                             const std::vector<std::pair<std::string, std::string> > &agent_host_report,
+                                             const std::map<uint64_t, std::vector<std::pair<std::string, std::string> > > &agent_region_report);
+            /// @brief Format the values reported for this host as YAML.
+            std::string create_report(const report_host_s &host_report);
+            /// @brief Concatenate the reports of every host on the
+            ///        root rank.
+            /// @param [out] host_size Size in bytes of the report
+            ///        from each host; only valid on the root rank.
+            std::string gather_report(const std::string &host_report, std::shared_ptr<Comm> comm,
+                                      std::vector<size_t> &host_size);
 
             std::string m_start_time;
             std::string m_report_name;
@@ -176,6 +187,14 @@ namespace geopm
             int m_rank;
             double m_sticker_freq;
             int m_epoch_count_idx;
+            // Report count of MSR writes skipped by write_batch().
+            // The signal is pushed so that it is read from the MSRIO
+            // that writes the pushed controls, which is the batch
+            // server when the service is used.
+            bool m_do_write_skipped;
+            int m_write_skipped_idx;
+            bool m_do_wait_lateness;
+            bool m_do_controller_phase;
 
             // Mapping from pushed signal name to index
             std::map<std::string, int> m_sync_signal_idx;
@@ -199,6 +218,8 @@ namespace geopm
             double m_sample_delay;
             const std::string m_profile_name;
             bool m_do_ctl_local;
+            bool m_do_yaml;
+            bool m_do_binary;
     };
 }
 
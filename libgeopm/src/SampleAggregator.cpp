@@ -15,6 +15,7 @@
 #include "Accumulator.hpp"
 #include "geopm/PlatformIOProf.hpp"
 #include "geopm/IOGroup.hpp"
+#include "RegionIndex.hpp"
 
 namespace geopm
 {
@@ -30,7 +31,14 @@ namespace geopm
     }
 
     SampleAggregatorImp::SampleAggregatorImp(PlatformIO &platio)
+        : SampleAggregatorImp(platio, RegionIndex::region_index())
+    {
+
+    }
+
+    SampleAggregatorImp::SampleAggregatorImp(PlatformIO &platio, RegionIndex &region_index)
         : m_platform_io(platio)
+        , m_region_index(region_index)
         , m_time_idx(m_platform_io.push_signal("TIME", GEOPM_DOMAIN_BOARD, 0))
         , m_is_updated(false)
         , m_period_duration(0.0)
@@ -96,7 +104,7 @@ namespace geopm
                 SumAccumulator::make_unique(),
                 SumAccumulator::make_unique(),
                 {},
-                {},
+                nullptr,
            };
         }
         return result;
@@ -128,23 +136,37 @@ namespace geopm
                 AvgAccumulator::make_unique(),
                 AvgAccumulator::make_unique(),
                 {},
-                {},
+                nullptr,
            };
         }
         return result;
     }
 
     template<typename type>
-    typename std::map<uint64_t, std::shared_ptr<type> >::iterator
-    sample_aggregator_emplace_hash(
-        std::map<uint64_t, std::shared_ptr<type> > &hash_accum_map,
-        uint64_t hash)
+    type *sample_aggregator_emplace_hash(std::vector<std::shared_ptr<type> > &region_accum,
+                                         RegionIndex &region_index,
+                                         uint64_t hash)
+    {
+        size_t region_idx = region_index.insert(hash);
+        if (region_idx >= region_accum.size()) {
+            region_accum.resize(region_idx + 1);
+        }
+        auto &result = region_accum[region_idx];
+        if (result == nullptr) {
+            result = type::make_unique();
+        }
+        return result.get();
+    }
+
+    template<typename type>
+    type *sample_aggregator_find_hash(const std::vector<std::shared_ptr<type> > &region_accum,
+                                      const RegionIndex &region_index,
+                                      uint64_t hash)
     {
-        typename std::map<uint64_t, std::shared_ptr<type> >::iterator result;
-        result = hash_accum_map.find(hash);
-        if (result == hash_accum_map.end()) {
-            auto empl_ret = hash_accum_map.emplace(hash, type::make_unique());
-            result = empl_ret.first;
+        int region_idx = region_index.index(hash);
+        type *result = nullptr;
+        if (region_idx != -1 && (size_t)region_idx < region_accum.size()) {
+            result = region_accum[region_idx].get();
         }
         return result;
     }
@@ -168,7 +190,7 @@ namespace geopm
         if (signal.region_hash_last != hash) {
             // If we have exited a valid region, call exit()
             if (signal.region_hash_last != GEOPM_REGION_HASH_UNMARKED) {
-                signal.region_accum_it->second->exit();
+                signal.region_accum_last->exit();
             }
         }
     }
@@ -179,7 +201,7 @@ namespace geopm
         if (signal.region_hash_last != hash) {
             // If we have entered a valid region, call enter()
             if (hash != GEOPM_REGION_HASH_UNMARKED) {
-                signal.region_accum_it->second->enter();
+                signal.region_accum_last->enter();
             }
         }
     }
@@ -236,7 +258,8 @@ namespace geopm
                 signal.sample_last = sample;
                 signal.region_hash_last = hash;
                 signal.epoch_count_last = epoch_count;
-                signal.region_accum_it = sample_aggregator_emplace_hash(signal.region_accum, hash);
+                signal.region_accum_last = sample_aggregator_emplace_hash(signal.region_accum,
+                                                                          m_region_index, hash);
             }
             else {
                 if (std::isnan(sample)) {
@@ -256,11 +279,12 @@ namespace geopm
                 // Update the periodic totals
                 signal.period_accum->update(delta);
                 // Update region totals
-                signal.region_accum_it->second->update(delta);
+                signal.region_accum_last->update(delta);
                 sample_aggregator_update_epoch(signal, epoch_count);
                 sample_aggregator_update_hash_exit(signal, hash);
                 if (signal.region_hash_last != hash) {
-                    signal.region_accum_it = sample_aggregator_emplace_hash(signal.region_accum, hash);
+                    signal.region_accum_last = sample_aggregator_emplace_hash(signal.region_accum,
+                                                                              m_region_index, hash);
                 }
                 sample_aggregator_update_hash_enter(signal, hash);
                 if (period != m_period_last) {
@@ -288,7 +312,8 @@ namespace geopm
                 signal.time_last = 0.0;
                 signal.region_hash_last = hash;
                 signal.epoch_count_last = epoch_count;
-                signal.region_accum_it = sample_aggregator_emplace_hash(signal.region_accum, hash);
+                signal.region_accum_last = sample_aggregator_emplace_hash(signal.region_accum,
+                                                                          m_region_index, hash);
             }
             else {
                 // Measure the time change since the last update
@@ -302,12 +327,13 @@ namespace geopm
                 // Update the periodic totals
                 signal.period_accum->update(delta, sample);
                 // Update region totals
-                signal.region_accum_it->second->update(delta, sample);
+                signal.region_accum_last->update(delta, sample);
 
                 sample_aggregator_update_epoch(signal, epoch_count);
                 sample_aggregator_update_hash_exit(signal, hash);
                 if (signal.region_hash_last != hash) {
-                    signal.region_accum_it = sample_aggregator_emplace_hash(signal.region_accum, hash);
+                    signal.region_accum_last = sample_aggregator_emplace_hash(signal.region_accum,
+                                                                              m_region_index, hash);
                 }
                 sample_aggregator_update_hash_enter(signal, hash);
                 if (period != m_period_last) {
@@ -382,13 +408,12 @@ namespace geopm
         double result = NAN;
         auto sum_it = m_sum_signal.find(signal_idx);
         if (sum_it != m_sum_signal.end()) {
-            const auto &region_accum = sum_it->second.region_accum;
-            auto region_accum_it = region_accum.find(region_hash);
-            if (region_accum_it == region_accum.end()) {
+            auto accum_ptr = sample_aggregator_find_hash(sum_it->second.region_accum,
+                                                         m_region_index, region_hash);
+            if (accum_ptr == nullptr) {
                 result = 0.0;
             }
             else {
-                auto accum_ptr = region_accum_it->second;
                 if (is_last) {
                     result = accum_ptr->interval_total();
                 }
@@ -403,10 +428,9 @@ namespace geopm
                 throw Exception("SampleAggregator::sample_region(): Invalid signal index: signal index not pushed with push_signal_total() or push_signal_average()",
                                 GEOPM_ERROR_INVALID, __FILE__, __LINE__);
             }
-            const auto &region_accum = avg_it->second.region_accum;
-            auto region_accum_it = region_accum.find(region_hash);
-            if (region_accum_it != region_accum.end()) {
-                auto accum_ptr = region_accum_it->second;
+            auto accum_ptr = sample_aggregator_find_hash(avg_it->second.region_accum,
+                                                         m_region_index, region_hash);
+            if (accum_ptr != nullptr) {
                 if (is_last) {
                     result = accum_ptr->interval_average();
                 }
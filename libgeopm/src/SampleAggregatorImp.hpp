@@ -9,6 +9,7 @@
 #include <cmath>
 
 #include <map>
+#include <vector>
 
 #include "geopm/SampleAggregator.hpp"
 
@@ -17,12 +18,14 @@ namespace geopm
     class PlatformIO;
     class SumAccumulator;
     class AvgAccumulator;
+    class RegionIndex;
 
     class SampleAggregatorImp : public SampleAggregator
     {
         public:
             SampleAggregatorImp();
             SampleAggregatorImp(PlatformIO &platio);
+            SampleAggregatorImp(PlatformIO &platio, RegionIndex &region_index);
             int push_signal(const std::string &signal_name,
                             int domain_type,
                             int domain_idx) override;
@@ -61,10 +64,11 @@ namespace geopm
                 std::shared_ptr<SumAccumulator> epoch_accum;
                 // Accumulator for periodic totals (always updated)
                 std::shared_ptr<SumAccumulator> period_accum;
-                // Map from region hash to an accumulator for that region
-                std::map<uint64_t, std::shared_ptr<SumAccumulator> > region_accum;
-                // Iterator pointing to the region_hash_last map location
-                std::map<uint64_t, std::shared_ptr<SumAccumulator> >::iterator region_accum_it;
+                // Accumulator for each region indexed by RegionIndex;
+                // null for regions not yet observed by this signal
+                std::vector<std::shared_ptr<SumAccumulator> > region_accum;
+                // Accumulator for the region_hash_last region
+                SumAccumulator *region_accum_last;
             };
 
             // All of the data relating to each pushed "average" signal
@@ -85,10 +89,11 @@ namespace geopm
                 std::shared_ptr<AvgAccumulator> epoch_accum;
                 // Accumulator for periodic totals (always updated)
                 std::shared_ptr<AvgAccumulator> period_accum;
-                // Map from region hash to an accumulator for that region
-                std::map<uint64_t, std::shared_ptr<AvgAccumulator> > region_accum;
-                // Iterator pointing to the region_hash_last map location
-                std::map<uint64_t, std::shared_ptr<AvgAccumulator> >::iterator region_accum_it;
+                // Accumulator for each region indexed by RegionIndex;
+                // null for regions not yet observed by this signal
+                std::vector<std::shared_ptr<AvgAccumulator> > region_accum;
+                // Accumulator for the region_hash_last region
+                AvgAccumulator *region_accum_last;
             };
 
             void update_total(void);
@@ -98,6 +103,7 @@ namespace geopm
             uint64_t sample_to_hash(double sample);
 
             PlatformIO &m_platform_io;
+            RegionIndex &m_region_index;
             // PlatformIO signal index for time of last sample
             int m_time_idx;
             bool m_is_updated;
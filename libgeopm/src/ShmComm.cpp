@@ -0,0 +1,941 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "ShmComm.hpp"
+
+#include <limits.h>
+#include <linux/futex.h>
+#include <sched.h>
+#include <string.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+
+#include "geopm/Environment.hpp"
+#include "geopm/Exception.hpp"
+#include "geopm/Helper.hpp"
+#include "geopm/SharedMemory.hpp"
+#include "geopm_time.h"
+
+#define GEOPM_SHM_COMM_PLUGIN_NAME "ShmComm"
+
+namespace geopm
+{
+    static_assert(std::atomic<uint32_t>::is_always_lock_free &&
+                  sizeof(std::atomic<uint32_t>) == sizeof(uint32_t),
+                  "ShmComm requires a lock free 32 bit atomic for the futex word");
+    static_assert(std::atomic<uint64_t>::is_always_lock_free,
+                  "ShmComm requires a lock free 64 bit atomic");
+
+    /// Header of the region shared by all ranks of a communicator.
+    /// The region is zero filled on creation, which is the initial
+    /// state.
+    struct ShmComm::m_header_s {
+        std::atomic<uint32_t> barrier_count;
+        std::atomic<uint32_t> barrier_generation;
+        /// Written by rank zero once the region is created, so that
+        /// shared memory left behind by an earlier run with the same
+        /// key can be told apart.
+        std::atomic<uint64_t> session;
+        /// Sequence number, starting from one, of the last collective
+        /// operation that failed on any rank.
+        std::atomic<uint64_t> collective_error;
+    };
+
+    /// Single message mailbox shared by the sender and receiver of
+    /// a point-to-point channel.  The message follows the header.
+    struct ShmComm::m_slot_s {
+        std::atomic<uint64_t> num_write;
+        std::atomic<uint64_t> num_read;
+        uint64_t size;
+        /// Session of the communicator, written by the receiver once
+        /// the channel is ready for the sender to attach.
+        std::atomic<uint64_t> session;
+    };
+
+    /// Lock for the memory returned by alloc_mem(): -1 when held
+    /// exclusively, otherwise the number of shared holders.  The
+    /// memory handed to the caller follows the lock.
+    static constexpr size_t M_ALLOC_HEADER_SIZE = hardware_destructive_interference_size;
+    static_assert(sizeof(std::atomic<int32_t>) <= M_ALLOC_HEADER_SIZE,
+                  "M_ALLOC_HEADER_SIZE not large enough for lock");
+    static constexpr size_t M_SLOT_HEADER_SIZE = hardware_destructive_interference_size;
+
+    static void futex_wait(std::atomic<uint32_t> *addr, uint32_t value)
+    {
+        (void)syscall(SYS_futex, (uint32_t *)addr, FUTEX_WAIT, value, nullptr, nullptr, 0);
+    }
+
+    static void futex_wake(std::atomic<uint32_t> *addr)
+    {
+        (void)syscall(SYS_futex, (uint32_t *)addr, FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+    }
+
+    /// Create a region, replacing one left behind by an earlier run
+    /// that used the same key.
+    static std::unique_ptr<SharedMemory> create_region(const std::string &key, size_t size)
+    {
+        std::unique_ptr<SharedMemory> result;
+        try {
+            result = SharedMemory::make_unique_owner(key, size);
+        }
+        catch (const Exception &) {
+            try {
+                SharedMemory::make_unique_user(key, 0)->unlink();
+            }
+            catch (const Exception &) {
+
+            }
+            result = SharedMemory::make_unique_owner(key, size);
+        }
+        return result;
+    }
+
+    static int env_int(const std::string &name)
+    {
+        std::string value = get_env(name);
+        int result = 0;
+        try {
+            result = std::stoi(value);
+        }
+        catch (const std::exception &) {
+            throw Exception("ShmComm::comm_world(): " + name +
+                            " environment variable could not be converted into an integer: \"" + value + "\"",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        return result;
+    }
+
+    ShmComm &ShmComm::comm_world(void)
+    {
+        static ShmComm comm_world_singleton(get_env("GEOPM_SHM_COMM_KEY"),
+                                            env_int("GEOPM_SHM_COMM_RANK"),
+                                            env_int("GEOPM_SHM_COMM_SIZE"),
+                                            environment().timeout());
+        return comm_world_singleton;
+    }
+
+    std::string ShmComm::plugin_name(void)
+    {
+        return GEOPM_SHM_COMM_PLUGIN_NAME;
+    }
+
+    std::unique_ptr<Comm> ShmComm::make_plugin(void)
+    {
+        return comm_world().split_group(0, comm_world().rank(), {});
+    }
+
+    ShmComm::ShmComm(const std::string &key, int rank, int num_rank, int timeout)
+        : ShmComm("/geopm-shm-" + std::to_string(getuid()) + "-comm-" + (key.empty() ? "world" : key),
+                  rank, num_rank, timeout, {})
+    {
+        if (key.find('/') != std::string::npos) {
+            throw Exception("ShmComm::ShmComm(): key must not contain '/': \"" + key + "\"",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        attach();
+    }
+
+    ShmComm::ShmComm(const std::string &key, int rank, int num_rank, int timeout,
+                     const std::vector<int> &dimension)
+        : m_key(key)
+        , m_rank(rank)
+        , m_num_rank(num_rank)
+        , m_timeout(timeout)
+        , m_dimension(dimension)
+        , m_header(nullptr)
+        , m_session(0)
+        , m_num_split(0)
+        , m_num_collective(0)
+        , m_num_alloc(0)
+        , m_num_window(0)
+        , m_num_request(0)
+        , m_is_torn_down(false)
+    {
+        if (m_num_rank < 0 || (m_num_rank != 0 && (m_rank < 0 || m_rank >= m_num_rank))) {
+            throw Exception("ShmComm::ShmComm(): rank " + std::to_string(m_rank) +
+                            " is not valid for a communicator of size " + std::to_string(m_num_rank),
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (m_rank == 0 && m_num_rank != 0) {
+            m_shmem = create_region(m_key, sizeof(m_header_s));
+            m_header = (m_header_s *)m_shmem->pointer();
+            m_session = ((uint64_t)getpid() << 32) | ((uint32_t)time(nullptr) | 1);
+            m_header->session.store(m_session, std::memory_order_release);
+        }
+    }
+
+    ShmComm::~ShmComm()
+    {
+        tear_down();
+    }
+
+    void ShmComm::attach(void)
+    {
+        if (m_rank > 0) {
+            m_shmem = SharedMemory::make_unique_user(m_key, m_timeout);
+            auto header = (m_header_s *)m_shmem->pointer();
+            // Rank zero writes the session right after it creates the
+            // region
+            geopm_time_s begin;
+            geopm_time(&begin);
+            m_session = header->session.load(std::memory_order_acquire);
+            while (m_session == 0 && geopm_time_since(&begin) < m_timeout) {
+                sched_yield();
+                m_session = header->session.load(std::memory_order_acquire);
+            }
+            if (m_session == 0) {
+                throw Exception("ShmComm::attach(): timed out waiting for rank 0 to initialize " + m_key,
+                                GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+            }
+            m_header = header;
+        }
+    }
+
+    void ShmComm::tear_down(void)
+    {
+        if (!m_is_torn_down) {
+            m_request.clear();
+            m_window.clear();
+            for (auto &it : m_channel) {
+                if (it.second->is_owner) {
+                    it.second->shmem->unlink();
+                }
+            }
+            m_channel.clear();
+            for (auto &it : m_alloc) {
+                it.second->unlink();
+            }
+            m_alloc.clear();
+            if (m_rank == 0 && m_shmem) {
+                m_shmem->unlink();
+            }
+            m_shmem.reset();
+            m_header = nullptr;
+            m_is_torn_down = true;
+        }
+    }
+
+    bool ShmComm::is_valid(void) const
+    {
+        return m_header != nullptr;
+    }
+
+    std::unique_ptr<ShmComm> ShmComm::split_group(int color, int key,
+                                                  const std::vector<int> &dimension) const
+    {
+        if (!is_valid()) {
+            throw Exception("ShmComm::split(): communicator is not valid",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        std::vector<int> color_key(2 * m_num_rank);
+        int send_buf[2] = {color, key};
+        allgather(send_buf, sizeof(send_buf), color_key.data());
+        std::string split_key = m_key + "-" + std::to_string(m_num_split);
+        ++m_num_split;
+        std::unique_ptr<ShmComm> result;
+        if (color == M_SPLIT_COLOR_UNDEFINED) {
+            result = std::unique_ptr<ShmComm>(new ShmComm(split_key, -1, 0, m_timeout, {}));
+        }
+        else {
+            // Order members by key, breaking ties with the parent rank
+            std::vector<std::pair<int, int> > member;
+            for (int rank = 0; rank < m_num_rank; ++rank) {
+                if (color_key[2 * rank] == color) {
+                    member.emplace_back(color_key[2 * rank + 1], rank);
+                }
+            }
+            std::sort(member.begin(), member.end());
+            int split_rank = std::find(member.begin(), member.end(),
+                                       std::make_pair(key, m_rank)) - member.begin();
+            result = std::unique_ptr<ShmComm>(
+                new ShmComm(split_key + "-" + std::to_string(color), split_rank,
+                            member.size(), m_timeout, dimension));
+        }
+        // Rank zero of each group has created its region
+        barrier();
+        result->attach();
+        return result;
+    }
+
+    std::shared_ptr<Comm> ShmComm::split(void) const
+    {
+        return split_group(0, m_rank, m_dimension);
+    }
+
+    std::shared_ptr<Comm> ShmComm::split(int color, int key) const
+    {
+        return split_group(color, key, {});
+    }
+
+    std::shared_ptr<Comm> ShmComm::split(const std::string &tag, int split_type) const
+    {
+        // Every process is treated as a separate compute node
+        std::shared_ptr<Comm> result;
+        switch (split_type) {
+            case M_COMM_SPLIT_TYPE_PPN1:
+                result = split_group(0, m_rank, {});
+                break;
+            case M_COMM_SPLIT_TYPE_SHARED:
+                result = split_group(m_rank, 0, {});
+                break;
+            default:
+                throw Exception("ShmComm::split(): invalid split_type: " + std::to_string(split_type),
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        return result;
+    }
+
+    std::shared_ptr<Comm> ShmComm::split(std::vector<int> dimensions, std::vector<int> periods, bool is_reorder) const
+    {
+        if (dimensions.empty() ||
+            std::any_of(dimensions.begin(), dimensions.end(),
+                        [](int dim) {return dim <= 0;})) {
+            throw Exception("ShmComm::split(): dimensions must be positive",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        int num_cart = std::accumulate(dimensions.begin(), dimensions.end(),
+                                       1, std::multiplies<int>());
+        if (num_cart > m_num_rank) {
+            throw Exception("ShmComm::split(): Cartesian grid is larger than the communicator",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        int color = m_rank < num_cart ? 0 : M_SPLIT_COLOR_UNDEFINED;
+        return split_group(color, m_rank, dimensions);
+    }
+
+    std::shared_ptr<Comm> ShmComm::split_cart(std::vector<int> dimensions) const
+    {
+        return split(dimensions, std::vector<int>(dimensions.size(), 0), true);
+    }
+
+    bool ShmComm::comm_supported(const std::string &description) const
+    {
+        return description == plugin_name();
+    }
+
+    int ShmComm::cart_rank(const std::vector<int> &coords) const
+    {
+        if (m_dimension.empty() || coords.size() != m_dimension.size()) {
+            throw Exception("ShmComm::cart_rank(): coordinates do not match the Cartesian grid",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        int result = 0;
+        for (size_t dim_idx = 0; dim_idx != m_dimension.size(); ++dim_idx) {
+            if (coords[dim_idx] < 0 || coords[dim_idx] >= m_dimension[dim_idx]) {
+                throw Exception("ShmComm::cart_rank(): coordinate is out of range",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            result = result * m_dimension[dim_idx] + coords[dim_idx];
+        }
+        return result;
+    }
+
+    int ShmComm::rank(void) const
+    {
+        return m_rank;
+    }
+
+    int ShmComm::num_rank(void) const
+    {
+        return m_num_rank;
+    }
+
+    void ShmComm::dimension_create(int num_ranks, std::vector<int> &dimension) const
+    {
+        int num_fixed = 1;
+        std::vector<size_t> free_idx;
+        for (size_t dim_idx = 0; dim_idx != dimension.size(); ++dim_idx) {
+            if (dimension[dim_idx] < 0) {
+                throw Exception("ShmComm::dimension_create(): dimensions must not be negative",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            if (dimension[dim_idx] == 0) {
+                free_idx.push_back(dim_idx);
+            }
+            else {
+                num_fixed *= dimension[dim_idx];
+            }
+        }
+        if (num_ranks <= 0 || num_ranks % num_fixed != 0 ||
+            (free_idx.empty() && num_ranks != num_fixed)) {
+            throw Exception("ShmComm::dimension_create(): " + std::to_string(num_ranks) +
+                            " ranks cannot be arranged in the requested grid",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        // Give the largest prime factors to the smallest dimensions
+        // so that the dimensions are as close to each other as
+        // possible, then order them from largest to smallest.
+        int remain = num_ranks / num_fixed;
+        std::vector<int> factor;
+        for (int ff = 2; ff * ff <= remain; ++ff) {
+            while (remain % ff == 0) {
+                factor.push_back(ff);
+                remain /= ff;
+            }
+        }
+        if (remain > 1) {
+            factor.push_back(remain);
+        }
+        std::vector<int> free_dim(free_idx.size(), 1);
+        for (auto it = factor.rbegin(); it != factor.rend(); ++it) {
+            *std::min_element(free_dim.begin(), free_dim.end()) *= *it;
+        }
+        std::sort(free_dim.begin(), free_dim.end(), std::greater<int>());
+        for (size_t idx = 0; idx != free_idx.size(); ++idx) {
+            dimension[free_idx[idx]] = free_dim[idx];
+        }
+    }
+
+    void ShmComm::alloc_mem(size_t size, void **base)
+    {
+        std::string key = m_key + "-mem-" + std::to_string(m_rank) + "-" + std::to_string(m_num_alloc);
+        ++m_num_alloc;
+        std::unique_ptr<SharedMemory> shmem = create_region(key, M_ALLOC_HEADER_SIZE + size);
+        char *result = (char *)shmem->pointer() + M_ALLOC_HEADER_SIZE;
+        m_alloc[result] = std::move(shmem);
+        *base = result;
+    }
+
+    void ShmComm::free_mem(void *base)
+    {
+        auto it = m_alloc.find((char *)base);
+        if (it == m_alloc.end()) {
+            throw Exception("ShmComm::free_mem(): base was not returned by alloc_mem()",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        it->second->unlink();
+        m_alloc.erase(it);
+    }
+
+    size_t ShmComm::window_create(size_t size, void *base)
+    {
+        struct m_region_s {
+            char key[NAME_MAX];
+            uint64_t size;
+        } region = {};
+        if (size != 0) {
+            auto it = m_alloc.find((char *)base);
+            if (it == m_alloc.end()) {
+                throw Exception("ShmComm::window_create(): base was not returned by alloc_mem()",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            if (size > it->second->size() - M_ALLOC_HEADER_SIZE) {
+                throw Exception("ShmComm::window_create(): size is larger than the allocation",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            strncpy(region.key, it->second->key().c_str(), NAME_MAX - 1);
+            region.size = size;
+        }
+        std::vector<m_region_s> all_region(m_num_rank);
+        allgather(&region, sizeof(region), all_region.data());
+        m_window_s window;
+        for (int rank = 0; rank < m_num_rank; ++rank) {
+            char *rank_base = nullptr;
+            if (rank == m_rank) {
+                rank_base = (char *)base;
+            }
+            else if (all_region[rank].size != 0) {
+                window.shmem.push_back(SharedMemory::make_unique_user(all_region[rank].key, m_timeout));
+                rank_base = (char *)window.shmem.back()->pointer() + M_ALLOC_HEADER_SIZE;
+            }
+            window.base.push_back(all_region[rank].size ? rank_base : nullptr);
+            window.size.push_back(all_region[rank].size);
+        }
+        size_t result = m_num_window;
+        ++m_num_window;
+        m_window[result] = std::move(window);
+        return result;
+    }
+
+    void ShmComm::window_destroy(size_t window_id)
+    {
+        if (m_window.erase(window_id) == 0) {
+            throw Exception("ShmComm::window_destroy(): window_id is not valid",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+    }
+
+    const ShmComm::m_window_s &ShmComm::window(size_t window_id, int rank,
+                                               const std::string &func_name) const
+    {
+        auto it = m_window.find(window_id);
+        if (it == m_window.end()) {
+            throw Exception("ShmComm::" + func_name + "(): window_id is not valid",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        check_rank(rank, func_name);
+        if (it->second.base[rank] == nullptr) {
+            throw Exception("ShmComm::" + func_name + "(): rank " + std::to_string(rank) +
+                            " does not expose memory in the window",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        return it->second;
+    }
+
+    void ShmComm::window_lock(size_t window_id, bool is_exclusive, int rank, int assert) const
+    {
+        const m_window_s &win = window(window_id, rank, __func__);
+        auto lock = (std::atomic<int32_t> *)(win.base[rank] - M_ALLOC_HEADER_SIZE);
+        bool is_locked = false;
+        while (!is_locked) {
+            int32_t expect = lock->load(std::memory_order_relaxed);
+            if (is_exclusive) {
+                is_locked = expect == 0 &&
+                            lock->compare_exchange_weak(expect, -1, std::memory_order_acquire);
+            }
+            else {
+                is_locked = expect >= 0 &&
+                            lock->compare_exchange_weak(expect, expect + 1, std::memory_order_acquire);
+            }
+            if (!is_locked) {
+                sched_yield();
+            }
+        }
+    }
+
+    void ShmComm::window_unlock(size_t window_id, int rank) const
+    {
+        const m_window_s &win = window(window_id, rank, __func__);
+        auto lock = (std::atomic<int32_t> *)(win.base[rank] - M_ALLOC_HEADER_SIZE);
+        int32_t expect = -1;
+        if (!lock->compare_exchange_strong(expect, 0, std::memory_order_release)) {
+            if (expect <= 0) {
+                throw Exception("ShmComm::window_unlock(): window is not locked",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            lock->fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    void ShmComm::window_put(const void *send_buf, size_t send_size, int rank, off_t disp, size_t window_id) const
+    {
+        const m_window_s &win = window(window_id, rank, __func__);
+        if (disp < 0 || disp + send_size > win.size[rank]) {
+            throw Exception("ShmComm::window_put(): copy range is out of bounds",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        memcpy(win.base[rank] + disp, send_buf, send_size);
+    }
+
+    void ShmComm::coordinate(int rank, std::vector<int> &coord) const
+    {
+        coord = coordinate(rank);
+    }
+
+    std::vector<int> ShmComm::coordinate(int rank) const
+    {
+        if (m_dimension.empty()) {
+            throw Exception("ShmComm::coordinate(): communicator is not a Cartesian grid",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        check_rank(rank, __func__);
+        std::vector<int> result(m_dimension.size());
+        for (size_t dim_idx = m_dimension.size(); dim_idx != 0; --dim_idx) {
+            result[dim_idx - 1] = rank % m_dimension[dim_idx - 1];
+            rank /= m_dimension[dim_idx - 1];
+        }
+        return result;
+    }
+
+    void ShmComm::barrier(void) const
+    {
+        if (is_valid()) {
+            uint32_t generation = m_header->barrier_generation.load(std::memory_order_acquire);
+            if (m_header->barrier_count.fetch_add(1, std::memory_order_acq_rel) + 1 == (uint32_t)m_num_rank) {
+                m_header->barrier_count.store(0, std::memory_order_relaxed);
+                m_header->barrier_generation.fetch_add(1, std::memory_order_release);
+                futex_wake(&m_header->barrier_generation);
+            }
+            else {
+                while (m_header->barrier_generation.load(std::memory_order_acquire) == generation) {
+                    futex_wait(&m_header->barrier_generation, generation);
+                }
+            }
+        }
+    }
+
+    void ShmComm::collective(size_t size, int root,
+                             std::function<void(char *data, size_t size)> init_func,
+                             std::function<void(char *data, size_t size)> write_func,
+                             std::function<void(char *data, size_t size)> read_func) const
+    {
+        if (!is_valid()) {
+            return;
+        }
+        check_rank(root, "collective");
+        std::string key = m_key + "-op-" + std::to_string(m_num_collective);
+        ++m_num_collective;
+        // Every rank enters both barriers even if a step fails, and
+        // a failure is recorded in the header so that all ranks throw
+        // after the second barrier instead of waiting on the failed
+        // rank.
+        uint64_t op_id = m_num_collective;
+        std::exception_ptr error;
+        std::unique_ptr<SharedMemory> shmem;
+        if (m_rank == root) {
+            try {
+                shmem = create_region(key, std::max(size, (size_t)1));
+                if (init_func) {
+                    init_func((char *)shmem->pointer(), shmem->size());
+                }
+            }
+            catch (...) {
+                error = std::current_exception();
+                m_header->collective_error.store(op_id, std::memory_order_relaxed);
+            }
+        }
+        barrier();
+        bool is_failed = error != nullptr ||
+                         m_header->collective_error.load(std::memory_order_relaxed) == op_id;
+        if (!is_failed) {
+            try {
+                if (m_rank != root) {
+                    shmem = SharedMemory::make_unique_user(key, m_timeout);
+                }
+                if (write_func) {
+                    write_func((char *)shmem->pointer(), shmem->size());
+                }
+            }
+            catch (...) {
+                error = std::current_exception();
+                m_header->collective_error.store(op_id, std::memory_order_relaxed);
+            }
+        }
+        barrier();
+        if (m_rank == root && shmem) {
+            shmem->unlink();
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        if (m_header->collective_error.load(std::memory_order_relaxed) == op_id) {
+            throw Exception("ShmComm::collective(): operation failed on another rank",
+                            GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        if (read_func) {
+            read_func((char *)shmem->pointer(), shmem->size());
+        }
+    }
+
+    void ShmComm::allgather(const void *send_buf, size_t send_size, void *recv_buf) const
+    {
+        size_t offset = send_size * m_rank;
+        size_t total = send_size * m_num_rank;
+        collective(total, 0, nullptr,
+                   [send_buf, send_size, offset](char *data, size_t size)
+                   {
+                       memcpy(data + offset, send_buf, send_size);
+                   },
+                   [recv_buf, total](char *data, size_t size)
+                   {
+                       memcpy(recv_buf, data, total);
+                   });
+    }
+
+    void ShmComm::broadcast(void *buffer, size_t size, int root) const
+    {
+        int rank = m_rank;
+        collective(size, root,
+                   [buffer, size](char *data, size_t data_size)
+                   {
+                       memcpy(data, buffer, size);
+                   },
+                   nullptr,
+                   [buffer, size, rank, root](char *data, size_t data_size)
+                   {
+                       if (rank != root) {
+                           memcpy(buffer, data, size);
+                       }
+                   });
+    }
+
+    bool ShmComm::test(bool is_true) const
+    {
+        bool result = is_true;
+        if (is_valid()) {
+            char send_buf = is_true;
+            std::vector<char> recv_buf(m_num_rank);
+            allgather(&send_buf, sizeof(send_buf), recv_buf.data());
+            result = std::all_of(recv_buf.begin(), recv_buf.end(),
+                                 [](char val) {return val != 0;});
+        }
+        return result;
+    }
+
+    void ShmComm::reduce_max(double *send_buf, double *recv_buf, size_t count, int root) const
+    {
+        size_t send_size = count * sizeof(double);
+        size_t offset = send_size * m_rank;
+        int rank = m_rank;
+        int num_rank = m_num_rank;
+        collective(send_size * m_num_rank, root, nullptr,
+                   [send_buf, send_size, offset](char *data, size_t size)
+                   {
+                       memcpy(data + offset, send_buf, send_size);
+                   },
+                   [recv_buf, count, rank, num_rank, root](char *data, size_t size)
+                   {
+                       if (rank == root) {
+                           const double *value = (const double *)data;
+                           std::copy(value, value + count, recv_buf);
+                           for (int rr = 1; rr < num_rank; ++rr) {
+                               for (size_t idx = 0; idx != count; ++idx) {
+                                   recv_buf[idx] = std::max(recv_buf[idx], value[rr * count + idx]);
+                               }
+                           }
+                       }
+                   });
+    }
+
+    void ShmComm::gather(const void *send_buf, size_t send_size, void *recv_buf,
+                         size_t recv_size, int root) const
+    {
+        size_t offset = send_size * m_rank;
+        int rank = m_rank;
+        size_t total = recv_size * m_num_rank;
+        collective(total, root, nullptr,
+                   [send_buf, send_size, offset](char *data, size_t size)
+                   {
+                       if (offset + send_size > size) {
+                           throw Exception("ShmComm::gather(): send_size is larger than recv_size on root",
+                                           GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+                       }
+                       memcpy(data + offset, send_buf, send_size);
+                   },
+                   [recv_buf, total, rank, root](char *data, size_t size)
+                   {
+                       if (rank == root) {
+                           memcpy(recv_buf, data, total);
+                       }
+                   });
+    }
+
+    void ShmComm::gatherv(const void *send_buf, size_t send_size, void *recv_buf,
+                          const std::vector<size_t> &recv_sizes, const std::vector<off_t> &rank_offset, int root) const
+    {
+        // The root publishes the offset of each rank in front of the
+        // data.
+        size_t table_size = sizeof(off_t) * m_num_rank;
+        size_t total = 0;
+        int rank = m_rank;
+        bool is_valid_table = recv_sizes.size() == (size_t)m_num_rank &&
+                              rank_offset.size() == (size_t)m_num_rank;
+        if (m_rank == root && is_valid_table) {
+            for (int rr = 0; rr < m_num_rank; ++rr) {
+                total = std::max(total, rank_offset[rr] + recv_sizes[rr]);
+            }
+        }
+        collective(table_size + total, root,
+                   [&rank_offset, table_size, is_valid_table](char *data, size_t size)
+                   {
+                       // Checked inside the collective so that the
+                       // other ranks are released by the error
+                       if (!is_valid_table) {
+                           throw Exception("ShmComm::gatherv(): recv_sizes and rank_offset must have one element per rank",
+                                           GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+                       }
+                       memcpy(data, rank_offset.data(), table_size);
+                   },
+                   [send_buf, send_size, rank, table_size](char *data, size_t size)
+                   {
+                       off_t offset = ((const off_t *)data)[rank];
+                       if (table_size + offset + send_size > size) {
+                           throw Exception("ShmComm::gatherv(): send_size is larger than recv_sizes on root",
+                                           GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+                       }
+                       memcpy(data + table_size + offset, send_buf, send_size);
+                   },
+                   [recv_buf, total, rank, root, table_size](char *data, size_t size)
+                   {
+                       if (rank == root) {
+                           memcpy(recv_buf, data + table_size, total);
+                       }
+                   });
+    }
+
+    ShmComm::m_channel_s &ShmComm::channel(int send_rank, int recv_rank, int tag, size_t size)
+    {
+        static_assert(sizeof(m_slot_s) <= M_SLOT_HEADER_SIZE,
+                      "M_SLOT_HEADER_SIZE not large enough for slot header");
+        auto key = std::make_tuple(send_rank, recv_rank, tag);
+        auto it = m_channel.find(key);
+        if (it == m_channel.end()) {
+            auto result = geopm::make_unique<m_channel_s>();
+            result->shm_key = m_key + "-p2p-" + std::to_string(send_rank) + "-" +
+                              std::to_string(recv_rank) + "-" + std::to_string(tag);
+            result->is_owner = recv_rank == m_rank;
+            result->slot = nullptr;
+            result->capacity = 0;
+            result->num_ticket = 0;
+            result->head_ticket = 0;
+            geopm_time(&result->attach_begin);
+            if (result->is_owner) {
+                // The receiver is the only end that creates the
+                // channel, and it replaces any region left behind by
+                // an earlier run.  The sender attaches in attach()
+                // once the session is written.
+                result->shmem = create_region(result->shm_key, M_SLOT_HEADER_SIZE + size);
+                result->slot = (m_slot_s *)result->shmem->pointer();
+                result->capacity = result->shmem->size() - M_SLOT_HEADER_SIZE;
+                result->slot->session.store(m_session, std::memory_order_release);
+            }
+            it = m_channel.emplace(key, std::move(result)).first;
+        }
+        return *(it->second);
+    }
+
+    bool ShmComm::attach(m_channel_s &chan)
+    {
+        if (chan.slot == nullptr) {
+            std::unique_ptr<SharedMemory> shmem;
+            try {
+                shmem = SharedMemory::make_unique_user(chan.shm_key, 0);
+            }
+            catch (const Exception &) {
+                // The receiver has not created the channel yet
+            }
+            if (shmem != nullptr &&
+                shmem->size() >= M_SLOT_HEADER_SIZE &&
+                ((m_slot_s *)shmem->pointer())->session.load(std::memory_order_acquire) == m_session) {
+                chan.slot = (m_slot_s *)shmem->pointer();
+                chan.capacity = shmem->size() - M_SLOT_HEADER_SIZE;
+                chan.shmem = std::move(shmem);
+            }
+            else if (geopm_time_since(&chan.attach_begin) > m_timeout) {
+                throw Exception("ShmComm::attach(): timed out waiting for the receiver to create channel " +
+                                chan.shm_key, GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+            }
+        }
+        return chan.slot != nullptr;
+    }
+
+    bool ShmComm::progress(m_request_s &request)
+    {
+        m_channel_s &chan = *(request.channel);
+        if (request.is_complete || request.ticket != chan.head_ticket ||
+            !attach(chan)) {
+            return request.is_complete;
+        }
+        if (request.is_send && request.size > chan.capacity) {
+            throw Exception("ShmComm::request_test(): send_size is larger than the channel capacity",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        char *data = (char *)chan.slot + M_SLOT_HEADER_SIZE;
+        uint64_t num_write = chan.slot->num_write.load(request.is_send ?
+                                                       std::memory_order_relaxed :
+                                                       std::memory_order_acquire);
+        uint64_t num_read = chan.slot->num_read.load(request.is_send ?
+                                                     std::memory_order_acquire :
+                                                     std::memory_order_relaxed);
+        if (request.is_send && num_write == num_read) {
+            memcpy(data, request.send_buf, request.size);
+            chan.slot->size = request.size;
+            chan.slot->num_write.store(num_write + 1, std::memory_order_release);
+            request.is_complete = true;
+        }
+        else if (!request.is_send && num_write != num_read) {
+            if (chan.slot->size > request.size) {
+                throw Exception("ShmComm::request_test(): received message is larger than the receive buffer",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            memcpy(request.recv_buf, data, chan.slot->size);
+            chan.slot->num_read.store(num_read + 1, std::memory_order_release);
+            request.is_complete = true;
+        }
+        if (request.is_complete) {
+            ++chan.head_ticket;
+            while (chan.cancel_ticket.erase(chan.head_ticket) != 0) {
+                ++chan.head_ticket;
+            }
+        }
+        return request.is_complete;
+    }
+
+    size_t ShmComm::isend(const void *send_buf, size_t send_size, int rank, int tag)
+    {
+        check_rank(rank, __func__);
+        m_channel_s &chan = channel(m_rank, rank, tag, send_size);
+        if (attach(chan) && send_size > chan.capacity) {
+            throw Exception("ShmComm::isend(): send_size is larger than the channel capacity",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        size_t result = m_num_request;
+        ++m_num_request;
+        m_request_s &request = m_request[result];
+        request = {&chan, true, send_buf, nullptr, send_size, chan.num_ticket, false};
+        ++chan.num_ticket;
+        progress(request);
+        return result;
+    }
+
+    size_t ShmComm::irecv(void *recv_buf, size_t recv_size, int rank, int tag)
+    {
+        check_rank(rank, __func__);
+        m_channel_s &chan = channel(rank, m_rank, tag, recv_size);
+        size_t result = m_num_request;
+        ++m_num_request;
+        m_request_s &request = m_request[result];
+        request = {&chan, false, nullptr, recv_buf, recv_size, chan.num_ticket, false};
+        ++chan.num_ticket;
+        progress(request);
+        return result;
+    }
+
+    bool ShmComm::request_test(size_t request_id)
+    {
+        auto it = m_request.find(request_id);
+        if (it == m_request.end()) {
+            throw Exception("ShmComm::request_test(): request_id is not valid",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        // Requests on a channel complete in order, so progress the
+        // earlier requests on the same channel first.
+        for (auto &prev : m_request) {
+            if (prev.first == request_id) {
+                break;
+            }
+            if (prev.second.channel == it->second.channel) {
+                progress(prev.second);
+            }
+        }
+        bool result = progress(it->second);
+        if (result) {
+            m_request.erase(it);
+        }
+        return result;
+    }
+
+    void ShmComm::request_cancel(size_t request_id)
+    {
+        auto it = m_request.find(request_id);
+        if (it == m_request.end()) {
+            throw Exception("ShmComm::request_cancel(): request_id is not valid",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        m_request_s &request = it->second;
+        if (!request.is_complete) {
+            m_channel_s &chan = *(request.channel);
+            chan.cancel_ticket.insert(request.ticket);
+            while (chan.cancel_ticket.erase(chan.head_ticket) != 0) {
+                ++chan.head_ticket;
+            }
+        }
+        m_request.erase(it);
+    }
+
+    void ShmComm::check_rank(int rank, const std::string &func_name) const
+    {
+        if (rank < 0 || rank >= m_num_rank) {
+            throw Exception("ShmComm::" + func_name + "(): rank " + std::to_string(rank) +
+                            " is out of range",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+    }
+}
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef SHMCOMM_HPP_INCLUDE
+#define SHMCOMM_HPP_INCLUDE
+
+#include <stdint.h>
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "geopm_time.h"
+#include "Comm.hpp"
+
+namespace geopm
+{
+    class SharedMemory;
+
+    /// @brief Implementation of the Comm interface for processes
+    ///        running on one host that communicate through POSIX
+    ///        shared memory.
+    ///
+    /// Each process in the world communicator plays the role of a
+    /// compute node, so the multi-level behavior of the controller
+    /// tree can be exercised by oversubscribing a single host.  The
+    /// world communicator used by the plugin is described by the
+    /// GEOPM_SHM_COMM_RANK, GEOPM_SHM_COMM_SIZE and
+    /// GEOPM_SHM_COMM_KEY environment variables.  Barriers block on
+    /// a futex, collectives are staged through a shared memory
+    /// region created by the root, and the memory returned by
+    /// alloc_mem() is mapped by every process that creates a window
+    /// with it.  Each point-to-point channel is created by the
+    /// receiver and sized by the first receive buffer posted on it;
+    /// the sender waits up to the timeout for it to be created.
+    class ShmComm : public Comm
+    {
+        public:
+            /// @brief Construct a world communicator.
+            ///
+            /// @param [in] key Name that is unique to the set of
+            ///        processes in the communicator.
+            ///
+            /// @param [in] rank Rank of the calling process in the
+            ///        range [0, num_rank).
+            ///
+            /// @param [in] num_rank Number of processes in the
+            ///        communicator.
+            ///
+            /// @param [in] timeout Seconds to wait for another
+            ///        process to create shared memory.
+            ShmComm(const std::string &key, int rank, int num_rank, int timeout);
+            ShmComm(const ShmComm &other) = delete;
+            ShmComm &operator=(const ShmComm &other) = delete;
+            virtual ~ShmComm();
+
+            static std::string plugin_name(void);
+            static std::unique_ptr<Comm> make_plugin(void);
+            static ShmComm &comm_world(void);
+
+            std::shared_ptr<Comm> split() const override;
+            std::shared_ptr<Comm> split(int color, int key) const override;
+            std::shared_ptr<Comm> split(const std::string &tag, int split_type) const override;
+            std::shared_ptr<Comm> split(std::vector<int> dimensions, std::vector<int> periods, bool is_reorder) const override;
+            std::shared_ptr<Comm> split_cart(std::vector<int> dimensions) const override;
+
+            bool comm_supported(const std::string &description) const override;
+
+            int cart_rank(const std::vector<int> &coords) const override;
+            int rank(void) const override;
+            int num_rank(void) const override;
+            void dimension_create(int num_ranks, std::vector<int> &dimension) const override;
+            void alloc_mem(size_t size, void **base) override;
+            void free_mem(void *base) override;
+            size_t window_create(size_t size, void *base) override;
+            void window_destroy(size_t window_id) override;
+            void coordinate(int rank, std::vector<int> &coord) const override;
+            std::vector<int> coordinate(int rank) const override;
+            void window_lock(size_t window_id, bool is_exclusive, int rank, int assert) const override;
+            void window_unlock(size_t window_id, int rank) const override;
+            void barrier(void) const override;
+            void broadcast(void *buffer, size_t size, int root) const override;
+            bool test(bool is_true) const override;
+            void reduce_max(double *send_buf, double *recv_buf, size_t count, int root) const override;
+            void gather(const void *send_buf, size_t send_size, void *recv_buf,
+                        size_t recv_size, int root) const override;
+            void gatherv(const void *send_buf, size_t send_size, void *recv_buf,
+                         const std::vector<size_t> &recv_sizes, const std::vector<off_t> &rank_offset, int root) const override;
+            void window_put(const void *send_buf, size_t send_size, int rank, off_t disp, size_t window_id) const override;
+            size_t isend(const void *send_buf, size_t send_size, int rank, int tag) override;
+            size_t irecv(void *recv_buf, size_t recv_size, int rank, int tag) override;
+            bool request_test(size_t request_id) override;
+            void request_cancel(size_t request_id) override;
+            void tear_down(void) override;
+        private:
+            struct m_header_s;
+            struct m_slot_s;
+            struct m_window_s {
+                /// Regions mapped from other ranks
+                std::vector<std::unique_ptr<SharedMemory> > shmem;
+                /// Start of the memory exposed by each rank, nullptr
+                /// if the rank exposes no memory
+                std::vector<char *> base;
+                std::vector<size_t> size;
+            };
+            struct m_channel_s {
+                std::string shm_key;
+                /// True for the receiver, which creates the region
+                bool is_owner;
+                /// Region of the channel, nullptr until the sender
+                /// has attached
+                std::unique_ptr<SharedMemory> shmem;
+                m_slot_s *slot;
+                /// Largest message, set by the size of the first
+                /// receive buffer posted on the channel
+                size_t capacity;
+                /// When the channel was first used, to time out the
+                /// sender waiting for the receiver
+                geopm_time_s attach_begin;
+                /// Requests on a channel complete in the order they
+                /// were posted, identified by a ticket number.
+                uint64_t num_ticket;
+                uint64_t head_ticket;
+                std::set<uint64_t> cancel_ticket;
+            };
+            struct m_request_s {
+                m_channel_s *channel;
+                bool is_send;
+                const void *send_buf;
+                void *recv_buf;
+                size_t size;
+                uint64_t ticket;
+                bool is_complete;
+            };
+            /// @brief Construct a communicator that is not yet
+            ///        attached to its shared memory.  Rank zero
+            ///        creates the memory.
+            ShmComm(const std::string &key, int rank, int num_rank, int timeout,
+                    const std::vector<int> &dimension);
+            /// @brief Attach a rank other than zero to the shared
+            ///        memory.
+            void attach(void);
+            bool is_valid(void) const;
+            std::unique_ptr<ShmComm> split_group(int color, int key,
+                                                 const std::vector<int> &dimension) const;
+            /// @brief Stage a collective operation through a region
+            ///        created by the root.
+            ///
+            /// @param [in] size Size of the region, only used by
+            ///        the root.
+            ///
+            /// @param [in] init_func Called by the root after the
+            ///        region is created and before any other rank
+            ///        attaches.
+            ///
+            /// @param [in] write_func Called by every rank once all
+            ///        ranks have attached.
+            ///
+            /// @param [in] read_func Called by every rank once all
+            ///        ranks have completed write_func.
+            ///
+            /// @throws If init_func or write_func throws on any rank,
+            ///         every rank throws once all ranks have reached
+            ///         the end of the write step, and read_func is not
+            ///         called.
+            void collective(size_t size, int root,
+                            std::function<void(char *data, size_t size)> init_func,
+                            std::function<void(char *data, size_t size)> write_func,
+                            std::function<void(char *data, size_t size)> read_func) const;
+            void allgather(const void *send_buf, size_t send_size, void *recv_buf) const;
+            void check_rank(int rank, const std::string &func_name) const;
+            const m_window_s &window(size_t window_id, int rank, const std::string &func_name) const;
+            m_channel_s &channel(int send_rank, int recv_rank, int tag, size_t size);
+            /// @brief Attach the sender to a channel created by the
+            ///        receiver.
+            ///
+            /// @return True if the channel is ready for use.
+            ///
+            /// @throws If the receiver has not created the channel
+            ///         within the timeout.
+            bool attach(m_channel_s &chan);
+            bool progress(m_request_s &request);
+            const std::string m_key;
+            const int m_rank;
+            const int m_num_rank;
+            const int m_timeout;
+            const std::vector<int> m_dimension;
+            std::unique_ptr<SharedMemory> m_shmem;
+            m_header_s *m_header;
+            /// Identifies the communicator so that regions left
+            /// behind by an earlier run are not attached
+            uint64_t m_session;
+            mutable int m_num_split;
+            mutable int m_num_collective;
+            int m_num_alloc;
+            std::map<char *, std::unique_ptr<SharedMemory> > m_alloc;
+            size_t m_num_window;
+            std::map<size_t, m_window_s> m_window;
+            std::map<std::tuple<int, int, int>, std::unique_ptr<m_channel_s> > m_channel;
+            size_t m_num_request;
+            std::map<size_t, m_request_s> m_request;
+            bool m_is_torn_down;
+    };
+}
+
+#endif
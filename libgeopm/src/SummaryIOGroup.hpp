@@ -0,0 +1,329 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef SUMMARYIOGROUP_HPP_INCLUDE
+#define SUMMARYIOGROUP_HPP_INCLUDE
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "geopm/Agg.hpp"
+#include "geopm/Exception.hpp"
+#include "geopm/Helper.hpp"
+#include "geopm/IOGroup.hpp"
+#include "geopm_topo.h"
+
+namespace geopm
+{
+    /// @brief Base for the IOGroups that provide read-only board
+    ///        signals computed from a summary of the runtime's own
+    ///        telemetry, e.g. the WaiterIOGroup and the
+    ///        ControllerIOGroup.  The summary is copied once per
+    ///        read_batch() and each signal is a function of the
+    ///        copy.  Signals with monotone behavior are formatted as
+    ///        integers and all signals are aggregated with the max.
+    template <class summary_type>
+    class SummaryIOGroup : public IOGroup
+    {
+        public:
+            struct m_signal_info_s {
+                std::string description;
+                int behavior;
+                std::function<double(const summary_type &)> value;
+            };
+            /// @param [in] class_name Name of the derived class used
+            ///        in error messages.
+            ///
+            /// @param [in] group_name Name of the IOGroup returned by
+            ///        name().
+            ///
+            /// @param [in] signal_info Description, behavior and
+            ///        value of each signal keyed by signal name.
+            ///
+            /// @param [in] read_summary Returns a copy of the
+            ///        current summary.
+            SummaryIOGroup(const std::string &class_name,
+                           const std::string &group_name,
+                           std::map<std::string, m_signal_info_s> signal_info,
+                           std::function<summary_type(void)> read_summary);
+            virtual ~SummaryIOGroup() = default;
+            std::set<std::string> signal_names(void) const override;
+            std::set<std::string> control_names(void) const override;
+            bool is_valid_signal(const std::string &signal_name) const override;
+            bool is_valid_control(const std::string &control_name) const override;
+            int signal_domain_type(const std::string &signal_name) const override;
+            int control_domain_type(const std::string &control_name) const override;
+            int push_signal(const std::string &signal_name, int domain_type, int domain_idx)  override;
+            int push_control(const std::string &control_name, int domain_type, int domain_idx) override;
+            void read_batch(void) override;
+            void write_batch(void) override;
+            double sample(int batch_idx) override;
+            void adjust(int batch_idx, double setting) override;
+            double read_signal(const std::string &signal_name, int domain_type, int domain_idx) override;
+            void write_control(const std::string &control_name, int domain_type, int domain_idx, double setting) override;
+            void save_control(void) override;
+            void restore_control(void) override;
+            std::function<double(const std::vector<double> &)> agg_function(const std::string &signal_name) const override;
+            std::function<std::string(double)> format_function(const std::string &signal_name) const override;
+            std::string signal_description(const std::string &signal_name) const override;
+            std::string control_description(const std::string &control_name) const override;
+            int signal_behavior(const std::string &signal_name) const override;
+            void save_control(const std::string &save_path) override;
+            void restore_control(const std::string &save_path) override;
+            std::string name(void) const override;
+        private:
+            void check_signal(const std::string &signal_name, int domain_type,
+                              int domain_idx, const std::string &func_name) const;
+            const m_signal_info_s &signal_info(const std::string &signal_name,
+                                               const std::string &func_name) const;
+            std::string no_control_message(const std::string &func_name) const;
+
+            const std::string m_class_name;
+            const std::string m_group_name;
+            const std::map<std::string, m_signal_info_s> m_signal_info;
+            const std::function<summary_type(void)> m_read_summary;
+            bool m_is_batch_read;
+            summary_type m_summary;
+            std::vector<std::string> m_active_signal;
+    };
+
+    template <class summary_type>
+    SummaryIOGroup<summary_type>::SummaryIOGroup(const std::string &class_name,
+                                                 const std::string &group_name,
+                                                 std::map<std::string, m_signal_info_s> signal_info,
+                                                 std::function<summary_type(void)> read_summary)
+        : m_class_name(class_name)
+        , m_group_name(group_name)
+        , m_signal_info(std::move(signal_info))
+        , m_read_summary(read_summary)
+        , m_is_batch_read(false)
+        , m_summary{}
+    {
+
+    }
+
+    template <class summary_type>
+    std::set<std::string> SummaryIOGroup<summary_type>::signal_names(void) const
+    {
+        std::set<std::string> result;
+        for (const auto &it : m_signal_info) {
+            result.insert(it.first);
+        }
+        return result;
+    }
+
+    template <class summary_type>
+    std::set<std::string> SummaryIOGroup<summary_type>::control_names(void) const
+    {
+        return {};
+    }
+
+    template <class summary_type>
+    bool SummaryIOGroup<summary_type>::is_valid_signal(const std::string &signal_name) const
+    {
+        return m_signal_info.find(signal_name) != m_signal_info.end();
+    }
+
+    template <class summary_type>
+    bool SummaryIOGroup<summary_type>::is_valid_control(const std::string &control_name) const
+    {
+        return false;
+    }
+
+    template <class summary_type>
+    int SummaryIOGroup<summary_type>::signal_domain_type(const std::string &signal_name) const
+    {
+        int result = GEOPM_DOMAIN_INVALID;
+        if (is_valid_signal(signal_name)) {
+            result = GEOPM_DOMAIN_BOARD;
+        }
+        return result;
+    }
+
+    template <class summary_type>
+    int SummaryIOGroup<summary_type>::control_domain_type(const std::string &control_name) const
+    {
+        return GEOPM_DOMAIN_INVALID;
+    }
+
+    template <class summary_type>
+    void SummaryIOGroup<summary_type>::check_signal(const std::string &signal_name, int domain_type,
+                                                    int domain_idx, const std::string &func_name) const
+    {
+        if (!is_valid_signal(signal_name)) {
+            throw Exception(m_class_name + "::" + func_name + "(): signal_name " + signal_name +
+                            " not valid for " + m_class_name,
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (domain_type != GEOPM_DOMAIN_BOARD || domain_idx != 0) {
+            throw Exception(m_class_name + "::" + func_name + "(): signals are only defined for board domain index 0",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+    }
+
+    template <class summary_type>
+    const typename SummaryIOGroup<summary_type>::m_signal_info_s &
+    SummaryIOGroup<summary_type>::signal_info(const std::string &signal_name,
+                                              const std::string &func_name) const
+    {
+        auto it = m_signal_info.find(signal_name);
+        if (it == m_signal_info.end()) {
+            throw Exception(m_class_name + "::" + func_name + "(): " + signal_name +
+                            " not valid for " + m_class_name,
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        return it->second;
+    }
+
+    template <class summary_type>
+    std::string SummaryIOGroup<summary_type>::no_control_message(const std::string &func_name) const
+    {
+        return m_class_name + "::" + func_name + "(): there are no controls supported by the " + m_class_name;
+    }
+
+    template <class summary_type>
+    int SummaryIOGroup<summary_type>::push_signal(const std::string &signal_name, int domain_type, int domain_idx)
+    {
+        check_signal(signal_name, domain_type, domain_idx, __func__);
+        if (m_is_batch_read) {
+            throw Exception(m_class_name + "::push_signal(): cannot push signal after call to read_batch().",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        auto it = std::find(m_active_signal.begin(), m_active_signal.end(), signal_name);
+        int result = it - m_active_signal.begin();
+        if (it == m_active_signal.end()) {
+            m_active_signal.push_back(signal_name);
+        }
+        return result;
+    }
+
+    template <class summary_type>
+    int SummaryIOGroup<summary_type>::push_control(const std::string &control_name, int domain_type, int domain_idx)
+    {
+        throw Exception(no_control_message(__func__),
+                        GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+    }
+
+    template <class summary_type>
+    void SummaryIOGroup<summary_type>::read_batch(void)
+    {
+        m_summary = m_read_summary();
+        m_is_batch_read = true;
+    }
+
+    template <class summary_type>
+    void SummaryIOGroup<summary_type>::write_batch(void)
+    {
+
+    }
+
+    template <class summary_type>
+    double SummaryIOGroup<summary_type>::sample(int batch_idx)
+    {
+        if (!m_is_batch_read) {
+            throw Exception(m_class_name + "::sample(): signal has not been read",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (batch_idx < 0 || (size_t)batch_idx >= m_active_signal.size()) {
+            throw Exception(m_class_name + "::sample(): batch_idx out of range",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        return m_signal_info.at(m_active_signal[batch_idx]).value(m_summary);
+    }
+
+    template <class summary_type>
+    void SummaryIOGroup<summary_type>::adjust(int batch_idx, double setting)
+    {
+        throw Exception(no_control_message(__func__),
+                        GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+    }
+
+    template <class summary_type>
+    double SummaryIOGroup<summary_type>::read_signal(const std::string &signal_name, int domain_type, int domain_idx)
+    {
+        check_signal(signal_name, domain_type, domain_idx, __func__);
+        return m_signal_info.at(signal_name).value(m_read_summary());
+    }
+
+    template <class summary_type>
+    void SummaryIOGroup<summary_type>::write_control(const std::string &control_name, int domain_type, int domain_idx, double setting)
+    {
+        throw Exception(no_control_message(__func__),
+                        GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+    }
+
+    template <class summary_type>
+    void SummaryIOGroup<summary_type>::save_control(void)
+    {
+
+    }
+
+    template <class summary_type>
+    void SummaryIOGroup<summary_type>::restore_control(void)
+    {
+
+    }
+
+    template <class summary_type>
+    std::function<double(const std::vector<double> &)> SummaryIOGroup<summary_type>::agg_function(const std::string &signal_name) const
+    {
+        signal_info(signal_name, __func__);
+        return Agg::max;
+    }
+
+    template <class summary_type>
+    std::function<std::string(double)> SummaryIOGroup<summary_type>::format_function(const std::string &signal_name) const
+    {
+        std::function<std::string(double)> result = string_format_double;
+        if (signal_info(signal_name, __func__).behavior == IOGroup::M_SIGNAL_BEHAVIOR_MONOTONE) {
+            result = string_format_integer;
+        }
+        return result;
+    }
+
+    template <class summary_type>
+    std::string SummaryIOGroup<summary_type>::signal_description(const std::string &signal_name) const
+    {
+        return signal_info(signal_name, __func__).description;
+    }
+
+    template <class summary_type>
+    std::string SummaryIOGroup<summary_type>::control_description(const std::string &control_name) const
+    {
+        throw Exception(no_control_message(__func__),
+                        GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+    }
+
+    template <class summary_type>
+    int SummaryIOGroup<summary_type>::signal_behavior(const std::string &signal_name) const
+    {
+        return signal_info(signal_name, __func__).behavior;
+    }
+
+    template <class summary_type>
+    void SummaryIOGroup<summary_type>::save_control(const std::string &save_path)
+    {
+
+    }
+
+    template <class summary_type>
+    void SummaryIOGroup<summary_type>::restore_control(const std::string &save_path)
+    {
+
+    }
+
+    template <class summary_type>
+    std::string SummaryIOGroup<summary_type>::name(void) const
+    {
+        return m_group_name;
+    }
+}
+
+#endif
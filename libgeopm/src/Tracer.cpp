@@ -14,11 +14,13 @@
 #include <iostream>
 #include <algorithm>
 #include <time.h>
+#include <cmath>
 
 #include "geopm/PlatformIO.hpp"
 #include "geopm/PlatformTopo.hpp"
 #include "geopm/Exception.hpp"
 #include "geopm/Helper.hpp"
+#include "geopm/IOGroup.hpp"
 #include "geopm/Environment.hpp"
 #include "EnvironmentParser.hpp"
 #include "geopm/PlatformIOProf.hpp"
@@ -31,7 +33,9 @@ namespace geopm
     TracerImp::TracerImp(const std::string &start_time)
         : TracerImp(start_time, environment().trace(), hostname(),
                     environment().do_trace(), PlatformIOProf::platform_io(), platform_topo(),
-                    environment_signal_parser(PlatformIOProf::platform_io().signal_names(), environment().trace_signals()))
+                    environment_signal_parser(PlatformIOProf::platform_io().signal_names(), environment().trace_signals()),
+                    environment().trace_compression(),
+                    environment().trace_summary())
     {
 
     }
@@ -43,6 +47,21 @@ namespace geopm
                          PlatformIO &platform_io,
                          const PlatformTopo &platform_topo,
                          const std::vector<std::pair<std::string, int> > &env_column)
+        : TracerImp(start_time, file_path, hostname, do_trace, platform_io,
+                    platform_topo, env_column, "none", "")
+    {
+
+    }
+
+    TracerImp::TracerImp(const std::string &start_time,
+                         const std::string &file_path,
+                         const std::string &hostname,
+                         bool do_trace,
+                         PlatformIO &platform_io,
+                         const PlatformTopo &platform_topo,
+                         const std::vector<std::pair<std::string, int> > &env_column,
+                         const std::string &compression,
+                         const std::string &summary)
         : m_is_trace_enabled(do_trace)
         , m_platform_io(platform_io)
         , m_platform_topo(platform_topo)
@@ -52,9 +71,18 @@ namespace geopm
         , m_region_hint_idx(-1)
         , m_region_progress_idx(-1)
         , m_region_runtime_idx(-1)
+        , m_time_idx(-1)
+        , m_epoch_idx(-1)
+        , m_is_summary(false)
+        , m_summary_period(0)
+        , m_summary_interval(0.0)
+        , m_is_summary_region(false)
+        , m_window_count(0)
+        , m_window_begin(NAN)
     {
+        parse_summary(summary);
         if (m_is_trace_enabled) {
-            m_csv = geopm::make_unique<CSVImp>(file_path, hostname, start_time, M_BUFFER_SIZE);
+            m_csv = geopm::make_unique<CSVImp>(file_path, hostname, start_time, M_BUFFER_SIZE, compression);
         }
     }
 
@@ -96,6 +124,8 @@ namespace geopm
                     {"CPU_CORE_TEMPERATURE", GEOPM_DOMAIN_BOARD, 0,
                      m_platform_io.format_function("CPU_CORE_TEMPERATURE")}});
 
+            m_time_idx = 0;
+            m_epoch_idx = 1;
             m_region_hash_idx = 2;
             m_region_hint_idx = 3;
             m_region_progress_idx = 4;
@@ -119,23 +149,59 @@ namespace geopm
                     base_columns.push_back({env_sig.at(sig_idx), env_dom.at(sig_idx), dom_idx, env_form.at(sig_idx)});
                 }
             }
+            std::vector<std::string> column_names;
+            std::vector<std::function<std::string(double)> > column_formats;
             // set up columns to be sampled by TracerImp
             for (const auto &col : base_columns) {
                 m_column_idx.push_back(m_platform_io.push_signal(col.name,
                                                                  col.domain_type,
                                                                  col.domain_idx));
+                if (m_is_summary) {
+                    m_column_behavior.push_back(m_platform_io.signal_behavior(col.name));
+                }
                 std::string column_name = col.name;
                 if (col.domain_type != GEOPM_DOMAIN_BOARD) {
                     column_name += "-" + PlatformTopo::domain_type_to_name(col.domain_type);
                     column_name += "-" + std::to_string(col.domain_idx);
                 }
-                m_csv->add_column(column_name, col.format);
+                column_names.push_back(column_name);
+                column_formats.push_back(col.format);
             }
             // columns from agent; will be sampled by agent
             size_t num_col = agent_cols.size();
             for (size_t col_idx = 0; col_idx != num_col; ++col_idx) {
-                std::function<std::string(double)> format = col_formats.size() ? col_formats.at(col_idx) : string_format_double;
-                m_csv->add_column(agent_cols.at(col_idx), std::move(format));
+                column_names.push_back(agent_cols.at(col_idx));
+                column_formats.push_back(col_formats.size() ? col_formats.at(col_idx) : string_format_double);
+                if (m_is_summary) {
+                    m_column_behavior.push_back(IOGroup::M_SIGNAL_BEHAVIOR_VARIABLE);
+                }
+            }
+            for (size_t col_idx = 0; col_idx != column_names.size(); ++col_idx) {
+                m_csv->add_column(column_names[col_idx], column_formats[col_idx]);
+            }
+            if (m_is_summary) {
+                // Statistics follow the last values so that every
+                // column of a full trace keeps its position
+                for (size_t col_idx = 0; col_idx != column_names.size(); ++col_idx) {
+                    const std::string &name = column_names[col_idx];
+                    if (m_column_behavior[col_idx] == IOGroup::M_SIGNAL_BEHAVIOR_VARIABLE) {
+                        m_csv->add_column(name + "_MIN", column_formats[col_idx]);
+                        m_csv->add_column(name + "_MAX", column_formats[col_idx]);
+                        m_csv->add_column(name + "_MEAN", "double");
+                    }
+                    else if (m_column_behavior[col_idx] == IOGroup::M_SIGNAL_BEHAVIOR_MONOTONE) {
+                        m_csv->add_column(name + "_DELTA", column_formats[col_idx]);
+                    }
+                }
+                m_csv->add_column("SAMPLE_COUNT", "integer");
+                size_t num_column = column_names.size();
+                m_window_min.assign(num_column, NAN);
+                m_window_max.assign(num_column, NAN);
+                m_window_sum.assign(num_column, 0.0);
+                m_window_num.assign(num_column, 0);
+                m_window_base.assign(num_column, NAN);
+                m_window_last.assign(num_column, NAN);
+                m_summary_row.reserve(2 * num_column);
             }
             m_csv->activate();
             m_last_telemetry.resize(base_columns.size() + num_col);
@@ -164,17 +230,133 @@ namespace geopm
                 m_last_telemetry[col_idx] = val;
                 ++col_idx;
             }
-            m_csv->update(m_last_telemetry);
+            if (m_is_summary) {
+                summary_update();
+            }
+            else {
+                m_csv->update(m_last_telemetry);
+            }
         }
     }
 
     void TracerImp::flush(void)
     {
         if (m_is_trace_enabled) {
+            if (m_is_summary && m_window_count != 0) {
+                summary_write();
+            }
             m_csv->flush();
         }
     }
 
+    void TracerImp::parse_summary(const std::string &summary)
+    {
+        if (summary.empty()) {
+            return;
+        }
+        for (const auto &token : string_split(summary, ",")) {
+            if (token == "region") {
+                m_is_summary_region = true;
+                continue;
+            }
+            bool is_valid = false;
+            try {
+                size_t num_parsed = 0;
+                if (string_ends_with(token, "s")) {
+                    m_summary_interval = std::stod(token, &num_parsed);
+                    is_valid = num_parsed + 1 == token.size() && m_summary_interval > 0.0;
+                }
+                else {
+                    m_summary_period = std::stoi(token, &num_parsed);
+                    is_valid = num_parsed == token.size() && m_summary_period > 0;
+                }
+            }
+            catch (const std::logic_error &) {
+                // is_valid remains false
+            }
+            if (!is_valid) {
+                throw Exception("TracerImp: invalid trace summary \"" + summary +
+                                "\", expected a list of a positive number of updates, a positive number of seconds ending in \"s\", or \"region\"",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+        }
+        m_is_summary = true;
+    }
+
+    // NAN compares unequal to itself; a column that stays NAN has not
+    // changed.
+    static bool is_changed(double last, double value)
+    {
+        return last != value && !(std::isnan(last) && std::isnan(value));
+    }
+
+    void TracerImp::summary_update(void)
+    {
+        if (m_is_summary_region && m_window_count != 0 &&
+            (is_changed(m_window_last[m_epoch_idx], m_last_telemetry[m_epoch_idx]) ||
+             is_changed(m_window_last[m_region_hash_idx], m_last_telemetry[m_region_hash_idx]))) {
+            summary_write();
+        }
+        if (std::isnan(m_window_begin)) {
+            m_window_begin = m_last_telemetry[m_time_idx];
+        }
+        size_t num_column = m_last_telemetry.size();
+        for (size_t col_idx = 0; col_idx != num_column; ++col_idx) {
+            double value = m_last_telemetry[col_idx];
+            m_window_last[col_idx] = value;
+            if (std::isnan(value)) {
+                continue;
+            }
+            if (m_window_num[col_idx] == 0) {
+                m_window_min[col_idx] = value;
+                m_window_max[col_idx] = value;
+            }
+            else {
+                m_window_min[col_idx] = std::min(m_window_min[col_idx], value);
+                m_window_max[col_idx] = std::max(m_window_max[col_idx], value);
+            }
+            m_window_sum[col_idx] += value;
+            ++m_window_num[col_idx];
+            if (std::isnan(m_window_base[col_idx])) {
+                m_window_base[col_idx] = value;
+            }
+        }
+        ++m_window_count;
+        if ((m_summary_period != 0 && m_window_count >= m_summary_period) ||
+            (m_summary_interval != 0.0 &&
+             m_last_telemetry[m_time_idx] - m_window_begin >= m_summary_interval)) {
+            summary_write();
+        }
+    }
+
+    void TracerImp::summary_write(void)
+    {
+        size_t num_column = m_window_last.size();
+        m_summary_row = m_window_last;
+        for (size_t col_idx = 0; col_idx != num_column; ++col_idx) {
+            if (m_column_behavior[col_idx] == IOGroup::M_SIGNAL_BEHAVIOR_VARIABLE) {
+                // Columns that were NAN for the whole window have
+                // no statistics
+                int num = m_window_num[col_idx];
+                m_summary_row.push_back(num ? m_window_min[col_idx] : NAN);
+                m_summary_row.push_back(num ? m_window_max[col_idx] : NAN);
+                m_summary_row.push_back(num ? m_window_sum[col_idx] / num : NAN);
+            }
+            else if (m_column_behavior[col_idx] == IOGroup::M_SIGNAL_BEHAVIOR_MONOTONE) {
+                m_summary_row.push_back(m_window_last[col_idx] - m_window_base[col_idx]);
+            }
+        }
+        m_summary_row.push_back(m_window_count);
+        m_csv->update(m_summary_row);
+
+        // The next window starts where this one ended
+        m_window_base = m_window_last;
+        m_window_begin = m_window_last[m_time_idx];
+        std::fill(m_window_sum.begin(), m_window_sum.end(), 0.0);
+        std::fill(m_window_num.begin(), m_window_num.end(), 0);
+        m_window_count = 0;
+    }
+
     std::vector<std::string> TracerImp::env_signals(void)
     {
         std::vector<std::string> result;
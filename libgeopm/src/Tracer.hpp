@@ -59,6 +59,27 @@ namespace geopm
                       PlatformIO &platform_io,
                       const PlatformTopo &platform_topo,
                       const std::vector<std::pair<std::string, int> > &env_column);
+            /// @param [in] compression Either "none" or "gzip"; see
+            ///        CSVImp.
+            /// @param [in] summary Empty to write a row for every
+            ///        update(), or a comma separated list that enables
+            ///        summary rows.  The list may hold a number of
+            ///        updates per row, a number of seconds with an
+            ///        "s" suffix, and "region" to also write a row
+            ///        when the region hash or epoch count changes.
+            ///        Each summary row holds the last value of every
+            ///        column, followed by _MIN, _MAX and _MEAN columns
+            ///        for variable signals, _DELTA columns for
+            ///        monotone signals, and SAMPLE_COUNT.
+            TracerImp(const std::string &start_time,
+                      const std::string &file_path,
+                      const std::string &hostname,
+                      bool do_trace,
+                      PlatformIO &platform_io,
+                      const PlatformTopo &platform_topo,
+                      const std::vector<std::pair<std::string, int> > &env_column,
+                      const std::string &compression,
+                      const std::string &summary);
             /// @brief TracerImp destructor, virtual.
             virtual ~TracerImp() = default;
             void columns(const std::vector<std::string> &agent_cols,
@@ -76,6 +97,9 @@ namespace geopm
             std::vector<std::string> env_signals(void);
             std::vector<int> env_domains(void);
             std::vector<std::function<std::string(double)> > env_formats(void);
+            void parse_summary(const std::string &summary);
+            void summary_update(void);
+            void summary_write(void);
 
             std::string m_file_path;
             std::string m_header;
@@ -93,6 +117,23 @@ namespace geopm
             int m_region_hint_idx;
             int m_region_progress_idx;
             int m_region_runtime_idx;
+            int m_time_idx;
+            int m_epoch_idx;
+            // Summary mode
+            bool m_is_summary;
+            int m_summary_period;
+            double m_summary_interval;
+            bool m_is_summary_region;
+            std::vector<int> m_column_behavior;
+            std::vector<double> m_window_min;
+            std::vector<double> m_window_max;
+            std::vector<double> m_window_sum;
+            std::vector<int> m_window_num;
+            std::vector<double> m_window_base; // last value of previous window
+            std::vector<double> m_window_last;
+            std::vector<double> m_summary_row;
+            int m_window_count;
+            double m_window_begin;
     };
 }
 
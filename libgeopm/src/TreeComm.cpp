@@ -84,12 +84,22 @@ namespace geopm
         if (m_num_level_ctl != root_level) {
             ++m_max_level;
         }
+        bool is_p2p = environment().tree_comm() == "p2p";
+        int max_stale = is_p2p ? environment().tree_comm_max_stale() : 0;
         for (; level < m_max_level; ++level) {
             parent_coords[root_level - 1 - level] = 0;
-            result.emplace_back(
-                std::make_shared<TreeCommLevelImp>(comm_cart->split(
-                                                   comm_cart->cart_rank(parent_coords), rank_cart),
-                                                   m_num_send_up, m_num_send_down));
+            std::shared_ptr<Comm> comm_level = comm_cart->split(
+                comm_cart->cart_rank(parent_coords), rank_cart);
+            if (is_p2p) {
+                result.emplace_back(
+                    std::make_shared<P2PTreeCommLevel>(comm_level, m_num_send_up,
+                                                       m_num_send_down, max_stale));
+            }
+            else {
+                result.emplace_back(
+                    std::make_shared<TreeCommLevelImp>(comm_level, m_num_send_up,
+                                                       m_num_send_down));
+            }
         }
         for (; level < root_level; ++level) {
             comm_cart->split(Comm::M_SPLIT_COLOR_UNDEFINED, 0);
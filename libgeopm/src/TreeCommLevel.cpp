@@ -203,4 +203,224 @@ namespace geopm
             m_sample_window = m_comm->window_create(0, NULL);
         }
     }
+
+    P2PTreeCommLevel::P2PTreeCommLevel(std::shared_ptr<Comm> comm, int num_send_up,
+                                       int num_send_down, int max_stale)
+        : m_comm(comm)
+        , m_size(comm->num_rank())
+        , m_rank(comm->rank())
+        , m_num_send_up(num_send_up)
+        , m_num_send_down(num_send_down)
+        , m_max_stale(max_stale)
+        , m_overhead_send(0)
+    {
+        if (m_max_stale < 0) {
+            throw Exception("P2PTreeCommLevel::P2PTreeCommLevel(): max_stale must not be negative",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        int num_message = m_rank ? 1 : m_size;
+        m_sample.resize(num_message, {std::vector<double>(m_num_send_up, NAN),
+                                      {}, 0, false, false, 0});
+        m_policy.resize(num_message, {std::vector<double>(m_num_send_down, NAN),
+                                      {}, 0, false, false, 0});
+        if (m_rank) {
+            m_policy[0].buffer.resize(m_num_send_down);
+            post_receive(m_policy[0], 0, M_TAG_POLICY);
+        }
+        else {
+            for (int child_rank = 1; child_rank < m_size; ++child_rank) {
+                m_sample[child_rank].buffer.resize(m_num_send_up);
+                post_receive(m_sample[child_rank], child_rank, M_TAG_SAMPLE);
+            }
+        }
+    }
+
+    P2PTreeCommLevel::~P2PTreeCommLevel()
+    {
+        // No rank sends after the first barrier, so each peer has at
+        // most one send in flight to this rank for each message.
+        // Re-post any receive that has completed so that the send can
+        // be matched, then wait for this rank's own sends to complete
+        // before their value buffers are released.  After the second
+        // barrier no message is in flight and only the posted
+        // receives remain to be cancelled.
+        m_comm->barrier();
+        if (m_rank) {
+            receive_message(m_policy[0], 0, M_TAG_POLICY);
+            complete_send(m_sample[0]);
+        }
+        else {
+            for (int child_rank = 1; child_rank < m_size; ++child_rank) {
+                receive_message(m_sample[child_rank], child_rank, M_TAG_SAMPLE);
+            }
+            for (int child_rank = 1; child_rank < m_size; ++child_rank) {
+                complete_send(m_policy[child_rank]);
+            }
+        }
+        m_comm->barrier();
+        for (auto message_vec : {&m_sample, &m_policy}) {
+            for (auto &message : *message_vec) {
+                if (message.is_pending) {
+                    m_comm->request_cancel(message.request);
+                    message.is_pending = false;
+                }
+            }
+        }
+    }
+
+    int P2PTreeCommLevel::level_rank(void) const
+    {
+        return m_rank;
+    }
+
+    void P2PTreeCommLevel::send_up(const std::vector<double> &sample)
+    {
+        if (sample.size() != m_num_send_up) {
+            throw Exception("P2PTreeCommLevel::send_up(): sample vector is not sized correctly.",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (m_rank) {
+            send_message(m_sample[0], sample, 0, M_TAG_SAMPLE);
+        }
+        else {
+            m_sample[0].value = sample;
+            m_sample[0].is_valid = true;
+        }
+    }
+
+    void P2PTreeCommLevel::send_down(const std::vector<std::vector<double> > &policy)
+    {
+#ifdef GEOPM_DEBUG
+        if (m_rank != 0) {
+            throw Exception("P2PTreeCommLevel::send_down() called from rank not at root of level",
+                            GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
+        }
+#endif
+        size_t num_down = m_num_send_down;
+        if (m_size != (int)policy.size() ||
+            std::any_of(policy.begin(), policy.end(),
+                        [num_down](const std::vector<double> &it)
+                        {return it.size() != num_down;})) {
+            throw Exception("P2PTreeCommLevel::send_down(): policy vector is not sized correctly.",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        m_policy[0].value = policy[0];
+        m_policy[0].is_valid = true;
+        for (int child_rank = 1; child_rank != m_size; ++child_rank) {
+            send_message(m_policy[child_rank], policy[child_rank], child_rank, M_TAG_POLICY);
+        }
+    }
+
+    bool P2PTreeCommLevel::receive_up(std::vector<std::vector<double> > &sample)
+    {
+#ifdef GEOPM_DEBUG
+        if (m_rank != 0) {
+            throw Exception("P2PTreeCommLevel::receive_up(): Only zero rank of the level can call receive_up()",
+                            GEOPM_ERROR_LOGIC, __FILE__, __LINE__);
+        }
+#endif
+        size_t num_up = m_num_send_up;
+        if (m_size != (int)sample.size() ||
+            std::any_of(sample.begin(), sample.end(),
+                        [num_up](const std::vector<double> &it)
+                        {return it.size() != num_up;})) {
+            throw Exception("P2PTreeCommLevel::receive_up(): sample vector is not sized correctly.",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        for (int child_rank = 1; child_rank < m_size; ++child_rank) {
+            receive_message(m_sample[child_rank], child_rank, M_TAG_SAMPLE);
+        }
+        bool is_complete = std::all_of(m_sample.begin(), m_sample.end(),
+                                       [](const m_message_s &message)
+                                       {return message.is_valid;});
+        if (is_complete) {
+            for (int child_rank = 0; child_rank != m_size; ++child_rank) {
+                std::copy(m_sample[child_rank].value.begin(),
+                          m_sample[child_rank].value.end(),
+                          sample[child_rank].begin());
+            }
+        }
+        is_complete = is_complete &&
+                      std::none_of(sample.begin(), sample.end(),
+                                   [](const std::vector<double> &vec)
+                                   {
+                                       return std::any_of(vec.begin(), vec.end(),
+                                                          [](double val){return std::isnan(val);});
+                                   });
+        return is_complete;
+    }
+
+    bool P2PTreeCommLevel::receive_down(std::vector<double> &policy)
+    {
+        if (m_rank) {
+            receive_message(m_policy[0], 0, M_TAG_POLICY);
+        }
+        bool is_complete = m_policy[0].is_valid;
+        if (is_complete) {
+            policy = m_policy[0].value;
+        }
+        is_complete = is_complete &&
+                      std::none_of(policy.begin(), policy.end(),
+                                   [](double val){return std::isnan(val);});
+        return is_complete;
+    }
+
+    size_t P2PTreeCommLevel::overhead_send(void) const
+    {
+        return m_overhead_send;
+    }
+
+    void P2PTreeCommLevel::send_message(m_message_s &message, const std::vector<double> &value,
+                                        int rank, int tag)
+    {
+        size_t msg_size = sizeof(double) * value.size();
+        // Compare bit patterns so that an unchanged NAN is not resent
+        bool is_changed = !message.is_valid ||
+                          memcmp(message.value.data(), value.data(), msg_size) != 0;
+        if (!is_changed && message.num_skip < m_max_stale) {
+            ++message.num_skip;
+            return;
+        }
+        if (message.is_pending) {
+            if (!m_comm->request_test(message.request)) {
+                // The value buffer is still in use, retry on the next call
+                return;
+            }
+            message.is_pending = false;
+        }
+        message.value = value;
+        message.request = m_comm->isend(message.value.data(), msg_size, rank, tag);
+        message.is_pending = true;
+        message.is_valid = true;
+        message.num_skip = 0;
+        m_overhead_send += msg_size;
+    }
+
+    void P2PTreeCommLevel::complete_send(m_message_s &message)
+    {
+        while (message.is_pending) {
+            message.is_pending = !m_comm->request_test(message.request);
+        }
+    }
+
+    void P2PTreeCommLevel::post_receive(m_message_s &message, int rank, int tag)
+    {
+        message.request = m_comm->irecv(message.buffer.data(),
+                                        sizeof(double) * message.buffer.size(),
+                                        rank, tag);
+        message.is_pending = true;
+    }
+
+    void P2PTreeCommLevel::receive_message(m_message_s &message, int rank, int tag)
+    {
+        // Messages between a pair of ranks arrive in order, so drain
+        // everything that has completed and keep the latest.
+        while (message.is_pending && m_comm->request_test(message.request)) {
+            message.is_pending = false;
+            std::copy(message.buffer.begin(), message.buffer.end(),
+                      message.value.begin());
+            message.is_valid = true;
+            post_receive(message, rank, tag);
+        }
+    }
 }
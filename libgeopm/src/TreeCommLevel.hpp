@@ -60,6 +60,68 @@ namespace geopm
             size_t m_num_send_up;
             size_t m_num_send_down;
     };
+
+    /// @brief TreeCommLevel implementation that uses non-blocking
+    ///        point-to-point messages rather than RMA windows.
+    ///
+    /// A message is only sent when its contents differ from the
+    /// last message sent to the same rank, or when it has been
+    /// skipped max_stale times in a row.  The receiver keeps the
+    /// last message from each rank, so receive_up() reports
+    /// complete once every child has sent at least one sample.  A
+    /// message is deferred to the next call if the previous send
+    /// to the same rank has not completed.
+    class P2PTreeCommLevel : public TreeCommLevel
+    {
+        public:
+            P2PTreeCommLevel(std::shared_ptr<Comm> comm, int num_send_up,
+                             int num_send_down, int max_stale);
+            P2PTreeCommLevel(const P2PTreeCommLevel &other) = delete;
+            P2PTreeCommLevel &operator=(const P2PTreeCommLevel &other) = delete;
+            virtual ~P2PTreeCommLevel();
+            int level_rank(void) const override;
+            void send_up(const std::vector<double> &sample) override;
+            void send_down(const std::vector<std::vector<double> > &policy) override;
+            bool receive_up(std::vector<std::vector<double> > &sample) override;
+            bool receive_down(std::vector<double> &policy) override;
+            size_t overhead_send(void) const override;
+        private:
+            enum m_tag_e {
+                M_TAG_SAMPLE = 1,
+                M_TAG_POLICY = 2,
+            };
+            struct m_message_s {
+                /// Last value sent, or last value received.
+                std::vector<double> value;
+                /// Target of the posted receive.
+                std::vector<double> buffer;
+                size_t request;
+                bool is_pending;
+                bool is_valid;
+                int num_skip;
+            };
+            void send_message(m_message_s &message, const std::vector<double> &value,
+                              int rank, int tag);
+            /// @brief Wait until a pending send has completed.
+            void complete_send(m_message_s &message);
+            void post_receive(m_message_s &message, int rank, int tag);
+            void receive_message(m_message_s &message, int rank, int tag);
+            std::shared_ptr<Comm> m_comm;
+            int m_size;
+            int m_rank;
+            size_t m_num_send_up;
+            size_t m_num_send_down;
+            int m_max_stale;
+            size_t m_overhead_send;
+            /// On the root, one sample per rank, with index zero
+            /// holding the root's own sample.  Otherwise one element
+            /// holding the last sample sent.
+            std::vector<m_message_s> m_sample;
+            /// On the root, one policy per rank, with index zero
+            /// holding the root's own policy.  Otherwise one element
+            /// holding the last policy received.
+            std::vector<m_message_s> m_policy;
+    };
 }
 
 #endif
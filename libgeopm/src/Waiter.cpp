@@ -6,17 +6,33 @@
 
 #include "geopm/Waiter.hpp"
 
+#include <errno.h>
+#include <stdint.h>
+#include <sys/timerfd.h>
 #include <time.h>
+#include <unistd.h>
 
+#include "geopm/Environment.hpp"
 #include "geopm/Exception.hpp"
 #include "geopm_time.h"
+#include "WaiterImp.hpp"
+#include "WaiterLateness.hpp"
 
 
 namespace geopm
 {
+    /// Time before the deadline when the hybrid strategy stops
+    /// sleeping and starts to spin.
+    static constexpr double M_HYBRID_SPIN_TIME = 100e-6;
+
+    static void time_monotonic(geopm_time_s *time)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &(time->t));
+    }
+
     std::unique_ptr<Waiter> Waiter::make_unique(double period)
     {
-        return Waiter::make_unique(period, "sleep");
+        return Waiter::make_unique(period, environment().waiter_strategy());
     }
 
     std::unique_ptr<Waiter> Waiter::make_unique(double period,
@@ -25,6 +41,12 @@ namespace geopm
         if (strategy == "sleep") {
             return std::make_unique<SleepWaiter>(period);
         }
+        else if (strategy == "timerfd") {
+            return std::make_unique<TimerfdWaiter>(period);
+        }
+        else if (strategy == "hybrid") {
+            return std::make_unique<HybridWaiter>(period, M_HYBRID_SPIN_TIME);
+        }
         else {
             throw Exception("Waiter::make_unique(): Unknown strategy: " + strategy,
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
@@ -67,6 +89,9 @@ namespace geopm
             throw Exception("Waiter::wait(): Failed with error: ",
                             err, __FILE__, __LINE__);
         }
+        geopm_time_s time_wake;
+        geopm_time_real(&time_wake);
+        WaiterLateness::waiter_lateness().update(geopm_time_diff(&m_time_target, &time_wake));
         geopm_time_add(&m_time_target, m_period, &m_time_target);
     }
 
@@ -74,4 +99,126 @@ namespace geopm
     {
         return m_period;
     }
+
+    TimerfdWaiter::TimerfdWaiter(double period)
+        : m_period(period)
+        , m_time_target({{0, 0}})
+        , m_is_first_time(true)
+        , m_timer_fd(timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC))
+    {
+        if (m_timer_fd == -1) {
+            throw Exception("TimerfdWaiter(): timerfd_create() failed",
+                            errno ? errno : GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+    }
+
+    TimerfdWaiter::~TimerfdWaiter()
+    {
+        close(m_timer_fd);
+    }
+
+    void TimerfdWaiter::reset(void)
+    {
+        time_monotonic(&m_time_target);
+        geopm_time_add(&m_time_target, m_period, &m_time_target);
+    }
+
+    void TimerfdWaiter::reset(double period)
+    {
+        m_period = period;
+        reset();
+    }
+
+    void TimerfdWaiter::wait(void)
+    {
+        if (m_is_first_time) {
+            reset();
+            m_is_first_time = false;
+        }
+        geopm_time_s time_wake;
+        time_monotonic(&time_wake);
+        if (geopm_time_comp(&time_wake, &m_time_target)) {
+            struct itimerspec deadline = {};
+            deadline.it_value = m_time_target.t;
+            if (timerfd_settime(m_timer_fd, TFD_TIMER_ABSTIME, &deadline, nullptr) == -1) {
+                throw Exception("TimerfdWaiter::wait(): timerfd_settime() failed",
+                                errno ? errno : GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+            }
+            uint64_t num_expire = 0;
+            ssize_t num_read = 0;
+            do {
+                num_read = read(m_timer_fd, &num_expire, sizeof(num_expire));
+            } while (num_read == -1 && errno == EINTR);
+            if (num_read != sizeof(num_expire)) {
+                throw Exception("TimerfdWaiter::wait(): read() of timerfd failed",
+                                errno ? errno : GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+            }
+            time_monotonic(&time_wake);
+        }
+        WaiterLateness::waiter_lateness().update(geopm_time_diff(&m_time_target, &time_wake));
+        geopm_time_add(&m_time_target, m_period, &m_time_target);
+    }
+
+    double TimerfdWaiter::period(void) const
+    {
+        return m_period;
+    }
+
+    HybridWaiter::HybridWaiter(double period, double spin_time)
+        : m_period(period)
+        , m_spin_time(spin_time)
+        , m_time_target({{0, 0}})
+        , m_is_first_time(true)
+    {
+        if (m_spin_time < 0.0) {
+            throw Exception("HybridWaiter(): spin_time must not be negative",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+    }
+
+    void HybridWaiter::reset(void)
+    {
+        time_monotonic(&m_time_target);
+        geopm_time_add(&m_time_target, m_period, &m_time_target);
+    }
+
+    void HybridWaiter::reset(double period)
+    {
+        m_period = period;
+        reset();
+    }
+
+    void HybridWaiter::wait(void)
+    {
+        if (m_is_first_time) {
+            reset();
+            m_is_first_time = false;
+        }
+        geopm_time_s time_wake;
+        geopm_time_s time_spin;
+        geopm_time_add(&m_time_target, -m_spin_time, &time_spin);
+        time_monotonic(&time_wake);
+        if (geopm_time_comp(&time_wake, &time_spin)) {
+            int err = 0;
+            do {
+                err = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME,
+                                      &(time_spin.t), nullptr);
+            } while (err == EINTR);
+            if (err != 0) {
+                throw Exception("HybridWaiter::wait(): clock_nanosleep() failed",
+                                err, __FILE__, __LINE__);
+            }
+            time_monotonic(&time_wake);
+        }
+        while (geopm_time_comp(&time_wake, &m_time_target)) {
+            time_monotonic(&time_wake);
+        }
+        WaiterLateness::waiter_lateness().update(geopm_time_diff(&m_time_target, &time_wake));
+        geopm_time_add(&m_time_target, m_period, &m_time_target);
+    }
+
+    double HybridWaiter::period(void) const
+    {
+        return m_period;
+    }
 }
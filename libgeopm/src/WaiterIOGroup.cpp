@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+
+#include "WaiterIOGroup.hpp"
+
+#include "geopm/Helper.hpp"
+
+namespace geopm
+{
+    WaiterIOGroup::WaiterIOGroup()
+        : WaiterIOGroup(WaiterLateness::waiter_lateness())
+    {
+
+    }
+
+    WaiterIOGroup::WaiterIOGroup(const WaiterLateness &lateness)
+        : SummaryIOGroup("WaiterIOGroup", plugin_name(), make_signal_info(),
+                         [&lateness]() { return lateness.summary(); })
+    {
+
+    }
+
+    std::map<std::string, WaiterIOGroup::m_signal_info_s> WaiterIOGroup::make_signal_info(void)
+    {
+        std::map<std::string, m_signal_info_s> result {
+            {"WAITER::WAIT_COUNT",
+             {"Number of times the control loop has waited for the end of its period",
+              IOGroup::M_SIGNAL_BEHAVIOR_MONOTONE,
+              [](const WaiterLateness::m_summary_s &summary) {
+                  return (double)summary.count;
+              }}},
+            {"WAITER::LATENESS",
+             {"Time in seconds between the deadline and the return of the most recent wait",
+              IOGroup::M_SIGNAL_BEHAVIOR_VARIABLE,
+              [](const WaiterLateness::m_summary_s &summary) {
+                  return summary.last;
+              }}},
+            {"WAITER::LATENESS_MEAN",
+             {"Mean time in seconds between the deadline and the return of each wait",
+              IOGroup::M_SIGNAL_BEHAVIOR_VARIABLE,
+              [](const WaiterLateness::m_summary_s &summary) {
+                  return summary.mean;
+              }}},
+            {"WAITER::LATENESS_MAX",
+             {"Largest time in seconds between the deadline and the return of a wait",
+              IOGroup::M_SIGNAL_BEHAVIOR_VARIABLE,
+              [](const WaiterLateness::m_summary_s &summary) {
+                  return summary.max;
+              }}},
+        };
+        for (int bin = 0; bin != LatencyHistogram::M_NUM_BIN; ++bin) {
+            result["WAITER::LATENESS_COUNT_" + LatencyHistogram::bin_name()[bin]] = {
+                "Number of waits that returned " + LatencyHistogram::bin_range()[bin] + " after the deadline",
+                IOGroup::M_SIGNAL_BEHAVIOR_MONOTONE,
+                [bin](const WaiterLateness::m_summary_s &summary) {
+                    return (double)summary.histogram[bin];
+                }};
+        }
+        return result;
+    }
+
+    std::string WaiterIOGroup::plugin_name(void)
+    {
+        return "WAITER";
+    }
+
+    std::unique_ptr<IOGroup> WaiterIOGroup::make_plugin(void)
+    {
+        return geopm::make_unique<WaiterIOGroup>();
+    }
+}
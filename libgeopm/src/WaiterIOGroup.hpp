@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef WAITERIOGROUP_HPP_INCLUDE
+#define WAITERIOGROUP_HPP_INCLUDE
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "SummaryIOGroup.hpp"
+#include "WaiterLateness.hpp"
+
+namespace geopm
+{
+    /// @brief IOGroup that provides the lateness of the control loop
+    ///        wake ups recorded by the Waiter objects of the process.
+    class WaiterIOGroup : public SummaryIOGroup<WaiterLateness::m_summary_s>
+    {
+        public:
+            WaiterIOGroup();
+            WaiterIOGroup(const WaiterLateness &lateness);
+            virtual ~WaiterIOGroup() = default;
+            static std::string plugin_name(void);
+            static std::unique_ptr<IOGroup> make_plugin(void);
+        private:
+            static std::map<std::string, m_signal_info_s> make_signal_info(void);
+    };
+}
+
+#endif
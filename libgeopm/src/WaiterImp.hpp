@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef WAITERIMP_HPP_INCLUDE
+#define WAITERIMP_HPP_INCLUDE
+
+#include "geopm_time.h"
+#include "geopm/Waiter.hpp"
+
+namespace geopm
+{
+    /// @brief Class to support a periodic wait loop that blocks on
+    ///        a timerfd armed with an absolute CLOCK_MONOTONIC
+    ///        deadline, so that it is not affected by steps of the
+    ///        system clock.
+    class TimerfdWaiter : public Waiter
+    {
+        public:
+            TimerfdWaiter(double period);
+            TimerfdWaiter(const TimerfdWaiter &other) = delete;
+            TimerfdWaiter &operator=(const TimerfdWaiter &other) = delete;
+            virtual ~TimerfdWaiter();
+            void reset(void) override;
+            void reset(double period) override;
+            void wait(void) override;
+            double period(void) const override;
+        private:
+            double m_period;
+            geopm_time_s m_time_target;
+            bool m_is_first_time;
+            int m_timer_fd;
+    };
+
+    /// @brief Class to support a periodic wait loop that sleeps on
+    ///        CLOCK_MONOTONIC until shortly before the deadline and
+    ///        then spins until the deadline is reached.  This trades
+    ///        CPU time for less oversleep.
+    class HybridWaiter : public Waiter
+    {
+        public:
+            /// @param [in] period Duration in seconds to wait
+            /// @param [in] spin_time Duration in seconds before the
+            ///        deadline where sleeping stops and spinning
+            ///        begins
+            HybridWaiter(double period, double spin_time);
+            virtual ~HybridWaiter() = default;
+            void reset(void) override;
+            void reset(double period) override;
+            void wait(void) override;
+            double period(void) const override;
+        private:
+            double m_period;
+            double m_spin_time;
+            geopm_time_s m_time_target;
+            bool m_is_first_time;
+    };
+}
+
+#endif
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "WaiterLateness.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace geopm
+{
+    WaiterLateness &WaiterLateness::waiter_lateness(void)
+    {
+        static WaiterLateness instance;
+        return instance;
+    }
+
+    WaiterLateness::WaiterLateness()
+    {
+        reset();
+    }
+
+    void WaiterLateness::update(double lateness)
+    {
+        lateness = std::max(lateness, 0.0);
+        int bin = LatencyHistogram::bin(lateness);
+        m_last.store(lateness, std::memory_order_relaxed);
+        double max = m_max.load(std::memory_order_relaxed);
+        while (max < lateness &&
+               !m_max.compare_exchange_weak(max, lateness, std::memory_order_relaxed)) {
+
+        }
+        double total = m_total.load(std::memory_order_relaxed);
+        while (!m_total.compare_exchange_weak(total, total + lateness, std::memory_order_relaxed)) {
+
+        }
+        m_histogram[bin].fetch_add(1, std::memory_order_relaxed);
+        m_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    WaiterLateness::m_summary_s WaiterLateness::summary(void) const
+    {
+        m_summary_s result;
+        result.count = m_count.load(std::memory_order_relaxed);
+        result.last = m_last.load(std::memory_order_relaxed);
+        result.max = m_max.load(std::memory_order_relaxed);
+        result.mean = result.count == 0 ?
+                      NAN : m_total.load(std::memory_order_relaxed) / result.count;
+        for (int bin = 0; bin < LatencyHistogram::M_NUM_BIN; ++bin) {
+            result.histogram[bin] = m_histogram[bin].load(std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    void WaiterLateness::reset(void)
+    {
+        m_count.store(0, std::memory_order_relaxed);
+        m_last.store(NAN, std::memory_order_relaxed);
+        m_max.store(0.0, std::memory_order_relaxed);
+        m_total.store(0.0, std::memory_order_relaxed);
+        for (auto &count : m_histogram) {
+            count.store(0, std::memory_order_relaxed);
+        }
+    }
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef WAITERLATENESS_HPP_INCLUDE
+#define WAITERLATENESS_HPP_INCLUDE
+
+#include <cstdint>
+
+#include <array>
+#include <atomic>
+#include <string>
+
+#include "LatencyHistogram.hpp"
+
+namespace geopm
+{
+    /// @brief Record of how late each call to Waiter::wait() returned
+    ///        relative to its deadline.  One instance is shared by
+    ///        all Waiters in the process, so update() uses relaxed
+    ///        atomics rather than a lock to keep wait() free of
+    ///        contention.  A summary() taken while another thread
+    ///        updates may mix values from adjacent wake ups.
+    class WaiterLateness
+    {
+        public:
+            struct m_summary_s {
+                uint64_t count;
+                /// Lateness of the most recent wait in seconds
+                double last;
+                double mean;
+                double max;
+                /// Number of waits with lateness below each bin
+                /// limit and at or above the previous one
+                std::array<uint64_t, LatencyHistogram::M_NUM_BIN> histogram;
+            };
+            static WaiterLateness &waiter_lateness(void);
+            WaiterLateness();
+            virtual ~WaiterLateness() = default;
+            /// @brief Record one wake up.
+            /// @param [in] lateness Seconds elapsed past the
+            ///        deadline; negative values are recorded as zero.
+            void update(double lateness);
+            m_summary_s summary(void) const;
+            /// @brief Forget all recorded wake ups.
+            void reset(void);
+        private:
+            std::atomic<uint64_t> m_count;
+            std::atomic<double> m_last;
+            std::atomic<double> m_max;
+            std::atomic<double> m_total;
+            std::array<std::atomic<uint64_t>, LatencyHistogram::M_NUM_BIN> m_histogram;
+    };
+}
+
+#endif
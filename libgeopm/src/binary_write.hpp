@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef BINARY_WRITE_HPP_INCLUDE
+#define BINARY_WRITE_HPP_INCLUDE
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "geopm/Exception.hpp"
+
+namespace geopm
+{
+    /// @brief Append the bytes of a value to a buffer in host byte
+    ///        order.  Shared by the binary report and binary
+    ///        profile trace formats.
+    template <typename type>
+    inline void binary_write(std::string &buffer, type value)
+    {
+        buffer.append((const char *)&value, sizeof(value));
+    }
+
+    /// @brief Append a string to a buffer as its uint32_t length
+    ///        followed by its characters.
+    inline void binary_write(std::string &buffer, const std::string &value)
+    {
+        if (value.size() > UINT32_MAX) {
+            throw Exception("binary_write(): string too long: " + value.substr(0, 32) + "...",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        binary_write(buffer, (uint32_t)value.size());
+        buffer.append(value);
+    }
+
+    /// @brief Append a list of key value pairs to a buffer as its
+    ///        uint32_t length followed by each key and value string.
+    inline void binary_write(std::string &buffer,
+                             const std::vector<std::pair<std::string, std::string> > &data)
+    {
+        binary_write(buffer, (uint32_t)data.size());
+        for (const auto &kv : data) {
+            binary_write(buffer, kv.first);
+            binary_write(buffer, kv.second);
+        }
+    }
+}
+
+#endif
@@ -9,6 +9,7 @@
 #include <sstream>
 #include <unistd.h>
 #include <errno.h>
+#include <zlib.h>
 #include "gtest/gtest.h"
 #include "geopm_error.h"
 #include "geopm_test.hpp"
@@ -173,12 +174,81 @@ TEST_F(CSVTest, buffer)
     unlink(output_path.c_str());
 }
 
+// Decompress each complete gzip member of the input in order
+static std::string gunzip_members(const std::string &input, int &num_member)
+{
+    std::string result;
+    num_member = 0;
+    size_t offset = 0;
+    while (offset < input.size()) {
+        z_stream stream = {};
+        EXPECT_EQ(Z_OK, inflateInit2(&stream, MAX_WBITS + 16));
+        stream.next_in = (Bytef *)input.data() + offset;
+        stream.avail_in = input.size() - offset;
+        int err = Z_OK;
+        char buffer[4096];
+        while (err == Z_OK) {
+            stream.next_out = (Bytef *)buffer;
+            stream.avail_out = sizeof(buffer);
+            err = inflate(&stream, Z_NO_FLUSH);
+            result.append(buffer, sizeof(buffer) - stream.avail_out);
+        }
+        inflateEnd(&stream);
+        EXPECT_EQ(Z_STREAM_END, err);
+        if (err != Z_STREAM_END) {
+            break;
+        }
+        offset += stream.total_in;
+        ++num_member;
+    }
+    return result;
+}
+
+TEST_F(CSVTest, compressed)
+{
+    std::string plain_path = "CSVTest-compressed-plain";
+    std::string output_path = "CSVTest-compressed-output";
+    std::vector<double> sample = {0.5, 1024};
+    {
+        std::unique_ptr<geopm::CSV> plain = geopm::make_unique<geopm::CSVImp>(plain_path, m_host_name, m_start_time, m_buffer_size, "none");
+        std::unique_ptr<geopm::CSV> csv = geopm::make_unique<geopm::CSVImp>(output_path, m_host_name, m_start_time, m_buffer_size, "gzip");
+        for (auto &it : std::vector<geopm::CSV *>{plain.get(), csv.get()}) {
+            it->add_column("COLUMN_FLOAT", "float");
+            it->add_column("COLUMN_INTEGER", "integer");
+            it->activate();
+            for (size_t count = 0; count != m_buffer_size; ++count) {
+                it->update(sample);
+            }
+        }
+        // Everything up to the last flush can be read while the file is open
+        csv->flush();
+        plain->flush();
+        int num_member = 0;
+        std::string partial = gunzip_members(geopm::read_file(output_path + "-" + m_host_name + ".gz"), num_member);
+        EXPECT_LT(1, num_member);
+        EXPECT_EQ(geopm::read_file(plain_path + "-" + m_host_name), partial);
+        csv->update(sample);
+        plain->update(sample);
+    }
+    plain_path += "-" + m_host_name;
+    output_path += "-" + m_host_name + ".gz";
+    int num_member = 0;
+    std::string output_string = gunzip_members(geopm::read_file(output_path), num_member);
+    EXPECT_EQ(geopm::read_file(plain_path), output_string);
+    EXPECT_LT(geopm::read_file(output_path).size(), output_string.size());
+    unlink(plain_path.c_str());
+    unlink(output_path.c_str());
+}
+
 TEST_F(CSVTest, negative)
 {
     std::string output_path = "CSVTest-negative-output";
     GEOPM_EXPECT_THROW_MESSAGE(geopm::make_unique<geopm::CSVImp>("/path/does/not/exist",
                                                                  "", m_start_time, m_buffer_size),
                                ENOENT, "Unable to open");
+    GEOPM_EXPECT_THROW_MESSAGE(geopm::make_unique<geopm::CSVImp>(output_path, "", m_start_time,
+                                                                 m_buffer_size, "lz4"),
+                               GEOPM_ERROR_INVALID, "compression must be");
 
     std::unique_ptr<geopm::CSV> csv =
         geopm::make_unique<geopm::CSVImp>(output_path, "", m_start_time, m_buffer_size);
@@ -19,6 +19,12 @@ typedef int MPI_Datatype;
 typedef long MPI_Aint;
 typedef int MPI_Info;
 typedef int MPI_Win;
+typedef int MPI_Request;
+typedef struct {
+    int MPI_SOURCE;
+    int MPI_TAG;
+    int MPI_ERROR;
+} MPI_Status;
 
 #define MPI_MAX                 (MPI_Op)(0x58000001)
 #define MPI_LAND                (MPI_Op)(0x58000005)
@@ -33,6 +39,8 @@ typedef int MPI_Win;
 #define MPI_DOUBLE              ((MPI_Datatype)0x4c00080b)
 #define MPI_INFO_NULL           ((MPI_Info)0x1c000000)
 #define MPI_WIN_NULL            ((MPI_Win)0x20000000)
+#define MPI_REQUEST_NULL        ((MPI_Request)0x2c000000)
+#define MPI_STATUS_IGNORE       ((MPI_Status *)1)
 #define MPI_MAX_ERROR_STRING    512
 typedef int                     MPI_Fint;
 #define MPI_ERR_SIZE            51
@@ -375,6 +383,94 @@ extern "C"
 #define MPI_Finalized(p0) mock_finalized(p0)
 #define PMPI_Finalized(p0) mock_finalized(p0)
 
+    // Request state shared by the non-blocking point to point mocks
+    static const MPI_Request g_active_request = 0x2c000001;
+    static int g_is_request_complete = 0;
+    static int g_num_cancel = 0;
+    static int g_num_wait = 0;
+    static int g_num_request_free = 0;
+
+    static void reset_request()
+    {
+        g_is_request_complete = 0;
+        g_num_cancel = 0;
+        g_num_wait = 0;
+        g_num_request_free = 0;
+    }
+
+    static int mock_isend(const void *param0, int param1, MPI_Datatype param2, int param3, int param4, MPI_Comm param5, MPI_Request *param6)
+    {
+        size_t tmp0 = (size_t) param0;
+        memcpy(g_params[0], &tmp0, g_sizes[0]);
+        memcpy(g_params[1], &param1, g_sizes[1]);
+        memcpy(g_params[2], &param2, g_sizes[2]);
+        memcpy(g_params[3], &param3, g_sizes[3]);
+        memcpy(g_params[4], &param4, g_sizes[4]);
+        memcpy(g_params[5], &param5, g_sizes[5]);
+        *param6 = g_active_request;
+        return 0;
+    }
+
+#define MPI_Isend(p0, p1, p2, p3, p4, p5, p6) mock_isend(p0, p1, p2, p3, p4, p5, p6)
+#define PMPI_Isend(p0, p1, p2, p3, p4, p5, p6) mock_isend(p0, p1, p2, p3, p4, p5, p6)
+
+    static int mock_irecv(void *param0, int param1, MPI_Datatype param2, int param3, int param4, MPI_Comm param5, MPI_Request *param6)
+    {
+        size_t tmp0 = (size_t) param0;
+        memcpy(g_params[0], &tmp0, g_sizes[0]);
+        memcpy(g_params[1], &param1, g_sizes[1]);
+        memcpy(g_params[2], &param2, g_sizes[2]);
+        memcpy(g_params[3], &param3, g_sizes[3]);
+        memcpy(g_params[4], &param4, g_sizes[4]);
+        memcpy(g_params[5], &param5, g_sizes[5]);
+        *param6 = g_active_request;
+        return 0;
+    }
+
+#define MPI_Irecv(p0, p1, p2, p3, p4, p5, p6) mock_irecv(p0, p1, p2, p3, p4, p5, p6)
+#define PMPI_Irecv(p0, p1, p2, p3, p4, p5, p6) mock_irecv(p0, p1, p2, p3, p4, p5, p6)
+
+    static int mock_test(MPI_Request *param0, int *param1, MPI_Status *param2)
+    {
+        *param1 = g_is_request_complete;
+        if (g_is_request_complete) {
+            *param0 = MPI_REQUEST_NULL;
+        }
+        return 0;
+    }
+
+#define MPI_Test(p0, p1, p2) mock_test(p0, p1, p2)
+#define PMPI_Test(p0, p1, p2) mock_test(p0, p1, p2)
+
+    static int mock_cancel(MPI_Request *param0)
+    {
+        ++g_num_cancel;
+        return 0;
+    }
+
+#define MPI_Cancel(p0) mock_cancel(p0)
+#define PMPI_Cancel(p0) mock_cancel(p0)
+
+    static int mock_wait(MPI_Request *param0, MPI_Status *param1)
+    {
+        ++g_num_wait;
+        *param0 = MPI_REQUEST_NULL;
+        return 0;
+    }
+
+#define MPI_Wait(p0, p1) mock_wait(p0, p1)
+#define PMPI_Wait(p0, p1) mock_wait(p0, p1)
+
+    static int mock_request_free(MPI_Request *param0)
+    {
+        ++g_num_request_free;
+        *param0 = MPI_REQUEST_NULL;
+        return 0;
+    }
+
+#define MPI_Request_free(p0) mock_request_free(p0)
+#define PMPI_Request_free(p0) mock_request_free(p0)
+
 }
 
 #include "gtest/gtest.h"
@@ -414,11 +510,13 @@ class CommMPIImpTest: public :: testing :: Test
 void CommMPIImpTest::SetUp()
 {
     reset();
+    reset_request();
 }
 
 void CommMPIImpTest::TearDown()
 {
     reset();
+    reset_request();
 }
 
 void CommMPIImpTest::check_params()
@@ -953,4 +1051,111 @@ TEST_F(CommMPIImpTest, mpi_win_ops)
 
     check_params();
 }
+
+TEST_F(CommMPIImpTest, mpi_isend_irecv)
+{
+    MPICommTestHelper tmp_comm;
+    char buffer[8] = {};
+    int size = sizeof(buffer);
+    MPI_Datatype dt = MPI_BYTE; // used beneath API
+    int rank = 3;
+    int tag = 7;
+
+    for (bool is_send : {true, false}) {
+        g_sizes.push_back(sizeof(size_t));
+        g_params.push_back(malloc(g_sizes[0]));
+        g_sizes.push_back(sizeof(int));
+        g_params.push_back(malloc(g_sizes[1]));
+        g_sizes.push_back(sizeof(MPI_Datatype));
+        g_params.push_back(malloc(g_sizes[2]));
+        g_sizes.push_back(sizeof(int));
+        g_params.push_back(malloc(g_sizes[3]));
+        g_sizes.push_back(sizeof(int));
+        g_params.push_back(malloc(g_sizes[4]));
+        g_sizes.push_back(sizeof(MPI_Comm));
+        g_params.push_back(malloc(g_sizes[5]));
+
+        size_t tmp = (size_t) buffer;
+        m_params.push_back(&tmp);
+        m_params.push_back(&size);
+        m_params.push_back(&dt);
+        m_params.push_back(&rank);
+        m_params.push_back(&tag);
+        m_params.push_back(tmp_comm.get_comm_ref());
+
+        size_t request = is_send ?
+                         tmp_comm.isend(buffer, size, rank, tag) :
+                         tmp_comm.irecv(buffer, size, rank, tag);
+
+        check_params();
+        reset();
+        m_params.clear();
+
+        // pending request is kept until it completes
+        EXPECT_FALSE(tmp_comm.request_test(request));
+        g_is_request_complete = 1;
+        EXPECT_TRUE(tmp_comm.request_test(request));
+        g_is_request_complete = 0;
+        // handle is released once the request completes
+        EXPECT_THROW(tmp_comm.request_test(request), Exception);
+        EXPECT_THROW(tmp_comm.request_cancel(request), Exception);
+        EXPECT_EQ(0, g_num_cancel);
+        EXPECT_EQ(0, g_num_request_free);
+    }
+    // comm free in destructor
+    g_sizes.push_back(sizeof(MPI_Comm *));
+    g_params.push_back(malloc(g_sizes[0]));
+}
+
+TEST_F(CommMPIImpTest, mpi_request_cancel)
+{
+    MPICommTestHelper tmp_comm;
+    char buffer[8] = {};
+
+    // pending receive is cancelled and completed
+    g_sizes = {sizeof(size_t), sizeof(int), sizeof(MPI_Datatype),
+               sizeof(int), sizeof(int), sizeof(MPI_Comm)};
+    for (size_t idx = 0; idx < g_sizes.size(); ++idx) {
+        g_params.push_back(malloc(g_sizes[idx]));
+    }
+    size_t request = tmp_comm.irecv(buffer, sizeof(buffer), 1, 0);
+    tmp_comm.request_cancel(request);
+    EXPECT_EQ(1, g_num_cancel);
+    EXPECT_EQ(1, g_num_wait);
+    EXPECT_EQ(0, g_num_request_free);
+    EXPECT_THROW(tmp_comm.request_test(request), Exception);
+
+    // pending send is freed without being cancelled
+    reset_request();
+    request = tmp_comm.isend(buffer, sizeof(buffer), 1, 0);
+    tmp_comm.request_cancel(request);
+    EXPECT_EQ(0, g_num_cancel);
+    EXPECT_EQ(0, g_num_wait);
+    EXPECT_EQ(1, g_num_request_free);
+    EXPECT_THROW(tmp_comm.request_cancel(request), Exception);
+}
+
+TEST_F(CommMPIImpTest, mpi_request_tear_down)
+{
+    MPICommTestHelper tmp_comm;
+    char buffer[8] = {};
+
+    g_sizes = {sizeof(size_t), sizeof(int), sizeof(MPI_Datatype),
+               sizeof(int), sizeof(int), sizeof(MPI_Comm)};
+    for (size_t idx = 0; idx < g_sizes.size(); ++idx) {
+        g_params.push_back(malloc(g_sizes[idx]));
+    }
+    tmp_comm.isend(buffer, sizeof(buffer), 1, 0);
+    tmp_comm.isend(buffer, sizeof(buffer), 2, 0);
+    tmp_comm.irecv(buffer, sizeof(buffer), 1, 0);
+    size_t request = tmp_comm.irecv(buffer, sizeof(buffer), 2, 0);
+    g_is_request_complete = 1;
+    EXPECT_TRUE(tmp_comm.request_test(request));
+
+    // only the pending receive is cancelled, and all pending
+    // requests are freed
+    tmp_comm.tear_down();
+    EXPECT_EQ(1, g_num_cancel);
+    EXPECT_EQ(3, g_num_request_free);
+}
 }
@@ -0,0 +1,348 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "ShmComm.hpp"
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cmath>
+#include <functional>
+
+#include "geopm/Exception.hpp"
+#include "geopm/SharedMemory.hpp"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using geopm::Comm;
+using geopm::ShmComm;
+using testing::ElementsAre;
+using testing::Contains;
+
+class CommShmImpTest : public ::testing::Test
+{
+    protected:
+        void SetUp();
+        void TearDown();
+        /// Run func in num_rank processes, each with its own rank
+        /// in a world communicator.  Rank zero runs in the test
+        /// process, the others in forked children that report
+        /// failed expectations through their exit status.
+        void run(int num_rank, std::function<void(ShmComm &comm)> func);
+        std::string m_key;
+        const int m_timeout = 5;
+};
+
+void CommShmImpTest::SetUp()
+{
+    m_key = "test-" + std::to_string(getpid()) + "-" +
+            ::testing::UnitTest::GetInstance()->current_test_info()->name();
+}
+
+void CommShmImpTest::TearDown()
+{
+    geopm::SharedMemory::cleanup_shmem();
+}
+
+void CommShmImpTest::run(int num_rank, std::function<void(ShmComm &comm)> func)
+{
+    std::vector<pid_t> child;
+    for (int rank = 1; rank < num_rank; ++rank) {
+        pid_t pid = fork();
+        if (pid == 0) {
+            int err = 0;
+            try {
+                ShmComm comm(m_key, rank, num_rank, m_timeout);
+                func(comm);
+            }
+            catch (const std::exception &ex) {
+                std::cerr << "rank " << rank << ": " << ex.what() << std::endl;
+                err = 1;
+            }
+            _exit(err || ::testing::Test::HasFailure());
+        }
+        child.push_back(pid);
+    }
+    {
+        ShmComm comm(m_key, 0, num_rank, m_timeout);
+        func(comm);
+    }
+    for (auto pid : child) {
+        int status = -1;
+        ASSERT_EQ(pid, waitpid(pid, &status, 0));
+        EXPECT_TRUE(WIFEXITED(status));
+        EXPECT_EQ(0, WEXITSTATUS(status)) << "child pid " << pid;
+    }
+}
+
+TEST_F(CommShmImpTest, registered)
+{
+    EXPECT_THAT(Comm::comm_names(), Contains("ShmComm"));
+    run(1, [](ShmComm &comm) {
+        EXPECT_TRUE(comm.comm_supported("ShmComm"));
+        EXPECT_FALSE(comm.comm_supported("MPIComm"));
+        EXPECT_EQ(0, comm.rank());
+        EXPECT_EQ(1, comm.num_rank());
+    });
+}
+
+TEST_F(CommShmImpTest, invalid)
+{
+    EXPECT_THROW(ShmComm("bad/key", 0, 1, m_timeout), geopm::Exception);
+    EXPECT_THROW(ShmComm(m_key, 2, 2, m_timeout), geopm::Exception);
+    EXPECT_THROW(ShmComm(m_key, -1, 2, m_timeout), geopm::Exception);
+    // Rank one times out waiting for rank zero
+    EXPECT_THROW(ShmComm(m_key, 1, 2, 0), geopm::Exception);
+}
+
+TEST_F(CommShmImpTest, barrier_broadcast_test)
+{
+    run(4, [](ShmComm &comm) {
+        for (int iter = 0; iter < 100; ++iter) {
+            comm.barrier();
+        }
+        int value = comm.rank() == 2 ? 42 : -1;
+        comm.broadcast(&value, sizeof(value), 2);
+        EXPECT_EQ(42, value);
+        EXPECT_TRUE(comm.test(true));
+        EXPECT_FALSE(comm.test(comm.rank() != 3));
+        EXPECT_THROW(comm.broadcast(&value, sizeof(value), 4), geopm::Exception);
+    });
+}
+
+TEST_F(CommShmImpTest, reduce_max)
+{
+    run(3, [](ShmComm &comm) {
+        std::vector<double> send {(double)comm.rank(), -1.0 * comm.rank()};
+        std::vector<double> recv {NAN, NAN};
+        comm.reduce_max(send.data(), recv.data(), send.size(), 1);
+        if (comm.rank() == 1) {
+            EXPECT_THAT(recv, ElementsAre(2.0, 0.0));
+        }
+        else {
+            EXPECT_TRUE(std::isnan(recv[0]));
+        }
+    });
+}
+
+TEST_F(CommShmImpTest, gather)
+{
+    run(3, [](ShmComm &comm) {
+        int send = 10 * comm.rank();
+        std::vector<int> recv(comm.num_rank(), -1);
+        comm.gather(&send, sizeof(send), recv.data(), sizeof(send), 0);
+        if (comm.rank() == 0) {
+            EXPECT_THAT(recv, ElementsAre(0, 10, 20));
+        }
+        // Rank r sends r + 1 values, stored in reverse rank order
+        std::vector<int> sendv(comm.rank() + 1, comm.rank());
+        std::vector<size_t> sizes {sizeof(int), 2 * sizeof(int), 3 * sizeof(int)};
+        std::vector<off_t> offsets {5 * sizeof(int), 3 * sizeof(int), 0};
+        std::vector<int> recvv(6, -1);
+        comm.gatherv(sendv.data(), sendv.size() * sizeof(int), recvv.data(),
+                     sizes, offsets, 2);
+        if (comm.rank() == 2) {
+            EXPECT_THAT(recvv, ElementsAre(2, 2, 2, 1, 1, 0));
+        }
+    });
+}
+
+TEST_F(CommShmImpTest, collective_error)
+{
+    run(3, [](ShmComm &comm) {
+        // Only rank two sends more than the root receives: every
+        // rank throws instead of waiting on rank two
+        int send = comm.rank();
+        int send_big[2] = {send, send};
+        std::vector<int> recv(comm.num_rank(), -1);
+        size_t send_size = comm.rank() == 2 ? sizeof(send_big) : sizeof(send);
+        EXPECT_THROW(comm.gather(send_big, send_size, recv.data(), sizeof(send), 1),
+                     geopm::Exception);
+        // Only the root validates the receive layout
+        std::vector<size_t> sizes {sizeof(int)};
+        std::vector<off_t> offsets {0};
+        EXPECT_THROW(comm.gatherv(&send, sizeof(send), recv.data(), sizes, offsets, 2),
+                     geopm::Exception);
+        // The communicator is usable after the failures
+        comm.gather(&send, sizeof(send), recv.data(), sizeof(send), 0);
+        if (comm.rank() == 0) {
+            EXPECT_THAT(recv, ElementsAre(0, 1, 2));
+        }
+    });
+}
+
+TEST_F(CommShmImpTest, split)
+{
+    run(5, [](ShmComm &comm) {
+        auto dup = comm.split();
+        EXPECT_EQ(comm.rank(), dup->rank());
+        EXPECT_EQ(5, dup->num_rank());
+        // Even and odd ranks in reverse order
+        auto half = comm.split(comm.rank() % 2, -comm.rank());
+        int expect_size = comm.rank() % 2 ? 2 : 3;
+        EXPECT_EQ(expect_size, half->num_rank());
+        EXPECT_EQ((expect_size - 1) - comm.rank() / 2, half->rank());
+        int value = half->rank() == 0 ? comm.rank() : -1;
+        half->broadcast(&value, sizeof(value), 0);
+        EXPECT_EQ(comm.rank() % 2 ? 3 : 4, value);
+        auto none = comm.split(comm.rank() == 0 ? Comm::M_SPLIT_COLOR_UNDEFINED : 0, 0);
+        EXPECT_EQ(comm.rank() == 0 ? -1 : comm.rank() - 1, none->rank());
+        none->barrier();
+        auto shared = comm.split("", Comm::M_COMM_SPLIT_TYPE_SHARED);
+        EXPECT_EQ(0, shared->rank());
+        EXPECT_EQ(1, shared->num_rank());
+        auto ppn1 = comm.split("", Comm::M_COMM_SPLIT_TYPE_PPN1);
+        EXPECT_EQ(5, ppn1->num_rank());
+        comm.barrier();
+    });
+}
+
+TEST_F(CommShmImpTest, cartesian)
+{
+    run(7, [](ShmComm &comm) {
+        std::vector<int> dimension(2, 0);
+        comm.dimension_create(6, dimension);
+        EXPECT_THAT(dimension, ElementsAre(3, 2));
+        auto cart = comm.split_cart(dimension);
+        if (comm.rank() < 6) {
+            EXPECT_EQ(comm.rank(), cart->rank());
+            EXPECT_EQ(6, cart->num_rank());
+            EXPECT_THAT(cart->coordinate(3), ElementsAre(1, 1));
+            EXPECT_EQ(5, cart->cart_rank({2, 1}));
+            EXPECT_THROW(cart->cart_rank({3, 0}), geopm::Exception);
+            cart->barrier();
+        }
+        else {
+            EXPECT_EQ(-1, cart->rank());
+        }
+        EXPECT_THROW(comm.split_cart({4, 2}), geopm::Exception);
+    });
+}
+
+TEST_F(CommShmImpTest, dimension_create)
+{
+    run(1, [](ShmComm &comm) {
+        std::vector<int> dimension(3, 0);
+        comm.dimension_create(24, dimension);
+        EXPECT_THAT(dimension, ElementsAre(4, 3, 2));
+        dimension = {0, 5};
+        comm.dimension_create(20, dimension);
+        EXPECT_THAT(dimension, ElementsAre(4, 5));
+        dimension = {3, 0};
+        EXPECT_THROW(comm.dimension_create(20, dimension), geopm::Exception);
+        dimension = {3, 3};
+        EXPECT_THROW(comm.dimension_create(10, dimension), geopm::Exception);
+    });
+}
+
+TEST_F(CommShmImpTest, window)
+{
+    run(3, [](ShmComm &comm) {
+        const size_t num_value = 4;
+        int *base = nullptr;
+        size_t size = 0;
+        // Only rank zero exposes memory
+        if (comm.rank() == 0) {
+            size = num_value * sizeof(int);
+            comm.alloc_mem(size, (void **)&base);
+            std::fill(base, base + num_value, -1);
+            EXPECT_THROW(comm.free_mem(base + 1), geopm::Exception);
+        }
+        size_t window_id = comm.window_create(size, base);
+        if (comm.rank() != 0) {
+            int value = comm.rank();
+            comm.window_lock(window_id, true, 0, 0);
+            comm.window_put(&value, sizeof(value), 0, comm.rank() * sizeof(int), window_id);
+            comm.window_unlock(window_id, 0);
+            EXPECT_THROW(comm.window_put(&value, sizeof(value), 0, num_value * sizeof(int), window_id),
+                         geopm::Exception);
+            EXPECT_THROW(comm.window_lock(window_id, true, 1, 0), geopm::Exception);
+        }
+        comm.barrier();
+        if (comm.rank() == 0) {
+            comm.window_lock(window_id, false, 0, 0);
+            EXPECT_THAT(std::vector<int>(base, base + num_value), ElementsAre(-1, 1, 2, -1));
+            comm.window_unlock(window_id, 0);
+            EXPECT_THROW(comm.window_unlock(window_id, 0), geopm::Exception);
+        }
+        comm.barrier();
+        comm.window_destroy(window_id);
+        EXPECT_THROW(comm.window_destroy(window_id), geopm::Exception);
+        if (comm.rank() == 0) {
+            comm.free_mem(base);
+        }
+    });
+}
+
+TEST_F(CommShmImpTest, point_to_point)
+{
+    run(2, [](ShmComm &comm) {
+        const int tag = 7;
+        const int num_message = 10;
+        double skip = NAN;
+        if (comm.rank() == 1) {
+            size_t cancel_id = comm.irecv(&skip, sizeof(skip), 0, tag);
+            comm.request_cancel(cancel_id);
+        }
+        comm.barrier();
+        if (comm.rank() == 0) {
+            std::vector<size_t> request;
+            for (int msg = 0; msg < num_message; ++msg) {
+                double value = msg;
+                request.push_back(comm.isend(&value, sizeof(value), 1, tag));
+                // The message is copied once the send completes
+                while (!comm.request_test(request.back())) {
+                }
+            }
+            EXPECT_THROW(comm.request_test(request.back()), geopm::Exception);
+            EXPECT_THROW(comm.isend(request.data(), 1, 2, tag), geopm::Exception);
+        }
+        else {
+            std::vector<double> value(num_message, NAN);
+            std::vector<size_t> request;
+            for (int msg = 0; msg < num_message; ++msg) {
+                request.push_back(comm.irecv(value.data() + msg, sizeof(double), 0, tag));
+            }
+            // Testing the last receive progresses the earlier ones,
+            // which are matched in the order they were posted
+            while (!comm.request_test(request.back())) {
+            }
+            for (int msg = 0; msg < num_message; ++msg) {
+                EXPECT_EQ(msg, value[msg]);
+            }
+            EXPECT_TRUE(std::isnan(skip));
+        }
+        comm.barrier();
+    });
+}
+
+TEST_F(CommShmImpTest, point_to_point_attach)
+{
+    run(2, [](ShmComm &comm) {
+        const int tag = 3;
+        if (comm.rank() == 0) {
+            // The send waits for the receiver to create the channel
+            double value = 1.5;
+            size_t request = comm.isend(&value, sizeof(value), 1, tag);
+            comm.barrier();
+            while (!comm.request_test(request)) {
+            }
+            comm.barrier();
+            // The receiver never creates this channel
+            size_t timeout_request = comm.isend(&value, sizeof(value), 1, tag + 1);
+            EXPECT_THROW(while (!comm.request_test(timeout_request)) {}, geopm::Exception);
+        }
+        else {
+            comm.barrier();
+            double value = NAN;
+            size_t request = comm.irecv(&value, sizeof(value), 0, tag);
+            while (!comm.request_test(request)) {
+            }
+            EXPECT_EQ(1.5, value);
+            comm.barrier();
+        }
+    });
+}
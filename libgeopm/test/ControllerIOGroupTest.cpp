@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <unistd.h>
+
+#include <cmath>
+
+#include "ControllerIOGroup.hpp"
+#include "ControllerPhase.hpp"
+#include "geopm/Exception.hpp"
+#include "geopm/IOGroup.hpp"
+#include "geopm_topo.h"
+#include "geopm_test.hpp"
+
+using geopm::ControllerIOGroup;
+using geopm::ControllerPhase;
+using geopm::IOGroup;
+using testing::Contains;
+
+class ControllerIOGroupTest : public ::testing::Test
+{
+    protected:
+        void SetUp(void);
+        ControllerPhase m_phase;
+        std::shared_ptr<ControllerIOGroup> m_group;
+};
+
+void ControllerIOGroupTest::SetUp()
+{
+    m_group = std::make_shared<ControllerIOGroup>(m_phase);
+}
+
+TEST_F(ControllerIOGroupTest, valid_signals)
+{
+    std::vector<std::string> expected_names = {
+        "CONTROLLER::READ_BATCH_COUNT",
+        "CONTROLLER::READ_BATCH_TIME",
+        "CONTROLLER::READ_BATCH_TIME_LAST",
+        "CONTROLLER::READ_BATCH_TIME_MAX",
+        "CONTROLLER::READ_BATCH_COUNT_LT_10US",
+        "CONTROLLER::READ_BATCH_COUNT_LT_100US",
+        "CONTROLLER::READ_BATCH_COUNT_LT_1MS",
+        "CONTROLLER::READ_BATCH_COUNT_LT_10MS",
+        "CONTROLLER::READ_BATCH_COUNT_GE_10MS",
+        "CONTROLLER::APPLICATION_SAMPLER_TIME",
+        "CONTROLLER::TREE_COMM_UP_TIME",
+        "CONTROLLER::WAIT_TIME_MAX",
+    };
+    EXPECT_EQ(9 * (size_t)ControllerPhase::M_NUM_PHASE, m_group->signal_names().size());
+    for (const auto &name : expected_names) {
+        EXPECT_THAT(m_group->signal_names(), Contains(name));
+        EXPECT_TRUE(m_group->is_valid_signal(name));
+        EXPECT_EQ(GEOPM_DOMAIN_BOARD, m_group->signal_domain_type(name));
+    }
+    EXPECT_EQ("Total time in seconds spent in the read batch phase of the control loop",
+              m_group->signal_description("CONTROLLER::READ_BATCH_TIME"));
+    EXPECT_EQ(IOGroup::M_SIGNAL_BEHAVIOR_MONOTONE,
+              m_group->signal_behavior("CONTROLLER::WAIT_TIME"));
+    EXPECT_EQ(IOGroup::M_SIGNAL_BEHAVIOR_VARIABLE,
+              m_group->signal_behavior("CONTROLLER::WAIT_TIME_LAST"));
+    EXPECT_EQ("1", m_group->format_function("CONTROLLER::WAIT_COUNT")(1.0));
+    EXPECT_FALSE(m_group->is_valid_signal("CONTROLLER::BAD"));
+    EXPECT_EQ(GEOPM_DOMAIN_INVALID, m_group->signal_domain_type("CONTROLLER::BAD"));
+    EXPECT_TRUE(m_group->control_names().empty());
+    EXPECT_EQ("CONTROLLER", m_group->name());
+}
+
+TEST_F(ControllerIOGroupTest, push_signal)
+{
+    GEOPM_EXPECT_THROW_MESSAGE(m_group->push_signal("CONTROLLER::BAD", GEOPM_DOMAIN_BOARD, 0),
+                               GEOPM_ERROR_INVALID, "not valid for ControllerIOGroup");
+    GEOPM_EXPECT_THROW_MESSAGE(m_group->push_signal("CONTROLLER::WAIT_TIME", GEOPM_DOMAIN_CPU, 0),
+                               GEOPM_ERROR_INVALID, "only defined for board");
+    int time_idx = m_group->push_signal("CONTROLLER::WAIT_TIME", GEOPM_DOMAIN_BOARD, 0);
+    EXPECT_EQ(time_idx, m_group->push_signal("CONTROLLER::WAIT_TIME", GEOPM_DOMAIN_BOARD, 0));
+    GEOPM_EXPECT_THROW_MESSAGE(m_group->sample(time_idx),
+                               GEOPM_ERROR_INVALID, "signal has not been read");
+    m_group->read_batch();
+    GEOPM_EXPECT_THROW_MESSAGE(m_group->push_signal("CONTROLLER::WAIT_COUNT", GEOPM_DOMAIN_BOARD, 0),
+                               GEOPM_ERROR_INVALID, "cannot push signal after call to read_batch");
+    GEOPM_EXPECT_THROW_MESSAGE(m_group->sample(time_idx + 1),
+                               GEOPM_ERROR_INVALID, "batch_idx out of range");
+}
+
+TEST_F(ControllerIOGroupTest, sample)
+{
+    int count_idx = m_group->push_signal("CONTROLLER::READ_BATCH_COUNT", GEOPM_DOMAIN_BOARD, 0);
+    int time_idx = m_group->push_signal("CONTROLLER::READ_BATCH_TIME", GEOPM_DOMAIN_BOARD, 0);
+    int last_idx = m_group->push_signal("CONTROLLER::READ_BATCH_TIME_LAST", GEOPM_DOMAIN_BOARD, 0);
+    int max_idx = m_group->push_signal("CONTROLLER::READ_BATCH_TIME_MAX", GEOPM_DOMAIN_BOARD, 0);
+    int fast_idx = m_group->push_signal("CONTROLLER::READ_BATCH_COUNT_LT_10US", GEOPM_DOMAIN_BOARD, 0);
+    int slow_idx = m_group->push_signal("CONTROLLER::READ_BATCH_COUNT_GE_10MS", GEOPM_DOMAIN_BOARD, 0);
+    int wait_idx = m_group->push_signal("CONTROLLER::WAIT_COUNT", GEOPM_DOMAIN_BOARD, 0);
+    m_group->read_batch();
+    EXPECT_EQ(0.0, m_group->sample(count_idx));
+    EXPECT_EQ(0.0, m_group->sample(time_idx));
+    EXPECT_TRUE(std::isnan(m_group->sample(last_idx)));
+
+    m_phase.update(ControllerPhase::M_PHASE_READ_BATCH, 1e-6);
+    m_phase.update(ControllerPhase::M_PHASE_READ_BATCH, 20e-3);
+    m_phase.update(ControllerPhase::M_PHASE_READ_BATCH, 3e-6);
+    // Values change only when the batch is read
+    EXPECT_EQ(0.0, m_group->sample(count_idx));
+    m_group->read_batch();
+    EXPECT_EQ(3.0, m_group->sample(count_idx));
+    EXPECT_DOUBLE_EQ(1e-6 + 20e-3 + 3e-6, m_group->sample(time_idx));
+    EXPECT_EQ(3e-6, m_group->sample(last_idx));
+    EXPECT_EQ(20e-3, m_group->sample(max_idx));
+    EXPECT_EQ(2.0, m_group->sample(fast_idx));
+    EXPECT_EQ(1.0, m_group->sample(slow_idx));
+    EXPECT_EQ(0.0, m_group->sample(wait_idx));
+
+    m_phase.update(ControllerPhase::M_PHASE_WAIT, 5e-3);
+    EXPECT_EQ(1.0, m_group->read_signal("CONTROLLER::WAIT_COUNT", GEOPM_DOMAIN_BOARD, 0));
+    EXPECT_EQ(1.0, m_group->read_signal("CONTROLLER::WAIT_COUNT_LT_10MS", GEOPM_DOMAIN_BOARD, 0));
+}
+
+TEST_F(ControllerIOGroupTest, controls)
+{
+    EXPECT_FALSE(m_group->is_valid_control("CONTROLLER::WAIT_TIME"));
+    EXPECT_EQ(GEOPM_DOMAIN_INVALID, m_group->control_domain_type("CONTROLLER::WAIT_TIME"));
+    EXPECT_THROW(m_group->push_control("CONTROLLER::WAIT_TIME", GEOPM_DOMAIN_BOARD, 0),
+                 geopm::Exception);
+    EXPECT_THROW(m_group->adjust(0, 1.0), geopm::Exception);
+    EXPECT_THROW(m_group->write_control("CONTROLLER::WAIT_TIME", GEOPM_DOMAIN_BOARD, 0, 1.0),
+                 geopm::Exception);
+}
+
+TEST(ControllerPhaseTest, scoped_timer)
+{
+    ControllerPhase phase;
+    for (int step = 0; step < 2; ++step) {
+        {
+            ControllerPhase::ScopedTimer timer(phase, ControllerPhase::M_PHASE_WAIT);
+            usleep(2000);
+        }
+        // Time in a phase entered twice during a step is summed
+        for (int level = 0; level < 2; ++level) {
+            ControllerPhase::ScopedTimer timer(phase, ControllerPhase::M_PHASE_TREE_COMM_UP);
+            usleep(1000);
+        }
+        phase.end_step();
+    }
+    auto wait = phase.summary(ControllerPhase::M_PHASE_WAIT);
+    EXPECT_EQ(2ULL, wait.count);
+    EXPECT_LE(4e-3, wait.total);
+    EXPECT_GT(1.0, wait.total);
+    EXPECT_LE(2e-3, wait.max);
+    EXPECT_EQ(2ULL, wait.histogram[3]);
+    auto tree = phase.summary(ControllerPhase::M_PHASE_TREE_COMM_UP);
+    EXPECT_EQ(2ULL, tree.count);
+    EXPECT_LE(2e-3, tree.last);
+    // Phases not entered are not counted
+    auto read = phase.summary(ControllerPhase::M_PHASE_READ_BATCH);
+    EXPECT_EQ(0ULL, read.count);
+    EXPECT_TRUE(std::isnan(read.last));
+    phase.end_step();
+    EXPECT_EQ(2ULL, phase.summary(ControllerPhase::M_PHASE_WAIT).count);
+
+    phase.update(ControllerPhase::M_PHASE_READ_BATCH, -1.0);
+    EXPECT_EQ(0.0, phase.summary(ControllerPhase::M_PHASE_READ_BATCH).last);
+    GEOPM_EXPECT_THROW_MESSAGE(phase.update(ControllerPhase::M_NUM_PHASE, 1.0),
+                               GEOPM_ERROR_INVALID, "phase_idx out of range");
+    phase.reset();
+    EXPECT_EQ(0ULL, phase.summary(ControllerPhase::M_PHASE_WAIT).count);
+    EXPECT_EQ(0.0, phase.summary(ControllerPhase::M_PHASE_WAIT).total);
+}
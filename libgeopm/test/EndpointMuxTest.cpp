@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+#include <unistd.h>
+
+#include <cmath>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "geopm_test.hpp"
+
+#include "geopm_endpoint.h"
+#include "geopm_time.h"
+#include "MockSharedMemory.hpp"
+#include "geopm/Helper.hpp"
+#include "geopm/Exception.hpp"
+#include "geopm/Endpoint.hpp"
+#include "EndpointImp.hpp"
+#include "EndpointMuxImp.hpp"
+#include "EndpointUser.hpp"
+
+using geopm::Endpoint;
+using geopm::EndpointImp;
+using geopm::EndpointMuxImp;
+using geopm::EndpointUserImp;
+using geopm::geopm_endpoint_sample_shmem_s;
+using testing::ElementsAre;
+using testing::IsNan;
+
+class EndpointMuxTest : public ::testing::Test
+{
+    protected:
+        void SetUp();
+        struct geopm_endpoint_sample_shmem_s *sample_data(int endpoint_idx);
+        const std::string m_shm_path = "/EndpointMuxTest_data";
+        const int m_max_endpoint = 3;
+        std::shared_ptr<MockSharedMemory> m_doorbell_shmem;
+        std::vector<std::shared_ptr<MockSharedMemory> > m_sample_shmem;
+        std::unique_ptr<EndpointMuxImp> m_mux;
+};
+
+class EndpointMuxTestIntegration : public ::testing::Test
+{
+    protected:
+        void TearDown();
+        const std::string m_shm_path = "/EndpointMuxTestIntegration_data_" + std::to_string(geteuid());
+        const std::string m_hostlist_path = "EndpointMuxTestIntegration_hostlist";
+};
+
+void EndpointMuxTest::SetUp()
+{
+    m_doorbell_shmem = std::make_shared<MockSharedMemory>(EndpointImp::doorbell_shmem_size(m_max_endpoint));
+    m_mux = geopm::make_unique<EndpointMuxImp>(
+        m_shm_path, m_max_endpoint, m_doorbell_shmem,
+        [this](const std::string &path) {
+            auto policy_shmem = std::make_shared<MockSharedMemory>(sizeof(struct geopm::geopm_endpoint_policy_shmem_s));
+            auto sample_shmem = std::make_shared<MockSharedMemory>(sizeof(struct geopm_endpoint_sample_shmem_s));
+            m_sample_shmem.push_back(sample_shmem);
+            return geopm::make_unique<EndpointImp>(path, policy_shmem, sample_shmem, 0, 0);
+        });
+}
+
+struct geopm_endpoint_sample_shmem_s *EndpointMuxTest::sample_data(int shmem_idx)
+{
+    return (struct geopm_endpoint_sample_shmem_s *)m_sample_shmem.at(shmem_idx)->pointer();
+}
+
+void EndpointMuxTestIntegration::TearDown()
+{
+    unlink(("/dev/shm/" + m_shm_path + "-doorbell").c_str());
+    for (int endpoint_idx = 0; endpoint_idx != 2; ++endpoint_idx) {
+        std::string endpoint_path = m_shm_path + "_" + std::to_string(endpoint_idx);
+        unlink(("/dev/shm/" + endpoint_path + "-policy").c_str());
+        unlink(("/dev/shm/" + endpoint_path + "-sample").c_str());
+    }
+    unlink(m_hostlist_path.c_str());
+}
+
+TEST_F(EndpointMuxTest, add_remove)
+{
+    EXPECT_EQ(m_max_endpoint, m_mux->max_endpoint());
+    EXPECT_EQ(0, m_mux->add_endpoint("/ep0"));
+    EXPECT_EQ(1, m_mux->add_endpoint("/ep1"));
+    EXPECT_EQ(2, m_mux->add_endpoint("/ep2"));
+    GEOPM_EXPECT_THROW_MESSAGE(m_mux->add_endpoint("/ep3"),
+                               GEOPM_ERROR_INVALID, "endpoints are in use");
+    EXPECT_EQ(m_shm_path + "-doorbell", std::string(sample_data(1)->doorbell_key));
+    EXPECT_EQ(1u, sample_data(1)->doorbell_index);
+
+    m_mux->remove_endpoint(1);
+    GEOPM_EXPECT_THROW_MESSAGE(m_mux->endpoint(1),
+                               GEOPM_ERROR_INVALID, "invalid endpoint index");
+    GEOPM_EXPECT_THROW_MESSAGE(m_mux->remove_endpoint(1),
+                               GEOPM_ERROR_INVALID, "invalid endpoint index");
+    GEOPM_EXPECT_THROW_MESSAGE(m_mux->endpoint(m_max_endpoint),
+                               GEOPM_ERROR_INVALID, "invalid endpoint index");
+    // Freed slot is reused
+    EXPECT_EQ(1, m_mux->add_endpoint("/ep3"));
+    EXPECT_EQ(1u, sample_data(3)->doorbell_index);
+    EXPECT_EQ("", m_mux->endpoint(1).get_agent());
+}
+
+TEST_F(EndpointMuxTest, wait)
+{
+    m_mux->add_endpoint("/ep0");
+    m_mux->add_endpoint("/ep1");
+    m_mux->add_endpoint("/ep2");
+    EXPECT_TRUE(m_mux->wait(0).empty());
+
+    EndpointImp::ring_doorbell(*m_doorbell_shmem, 2);
+    EndpointImp::ring_doorbell(*m_doorbell_shmem, 0);
+    EXPECT_THAT(m_mux->wait(0), ElementsAre(0, 2));
+    EXPECT_TRUE(m_mux->wait(0).empty());
+
+    // Notifications for removed endpoints are dropped
+    EndpointImp::ring_doorbell(*m_doorbell_shmem, 1);
+    m_mux->remove_endpoint(1);
+    EXPECT_TRUE(m_mux->wait(0).empty());
+
+    GEOPM_EXPECT_THROW_MESSAGE(EndpointImp::ring_doorbell(*m_doorbell_shmem, m_max_endpoint),
+                               GEOPM_ERROR_INVALID, "out of range");
+}
+
+TEST_F(EndpointMuxTest, read_sample)
+{
+    m_mux->add_endpoint("/ep0");
+    m_mux->add_endpoint("/ep1");
+    auto data = sample_data(1);
+    strncpy(data->agent, "monitor", GEOPM_ENDPOINT_AGENT_NAME_MAX);
+    data->count = 3;
+    data->values[0] = 4.0;
+    data->values[1] = 5.0;
+    data->values[2] = 6.0;
+    geopm_time(&data->timestamp);
+
+    std::vector<double> sample;
+    std::vector<double> sample_age;
+    m_mux->read_sample(2, sample, sample_age);
+    EXPECT_THAT(sample, ElementsAre(IsNan(), IsNan(), 4.0, 5.0, IsNan(), IsNan()));
+    ASSERT_EQ(3u, sample_age.size());
+    EXPECT_TRUE(std::isnan(sample_age[0]));
+    EXPECT_LE(0.0, sample_age[1]);
+    EXPECT_TRUE(std::isnan(sample_age[2]));
+
+    m_mux->read_sample(4, sample, sample_age);
+    EXPECT_THAT(sample, ElementsAre(IsNan(), IsNan(), IsNan(), IsNan(),
+                                    4.0, 5.0, 6.0, IsNan(),
+                                    IsNan(), IsNan(), IsNan(), IsNan()));
+}
+
+TEST_F(EndpointMuxTest, invalid_construction)
+{
+    GEOPM_EXPECT_THROW_MESSAGE(EndpointMuxImp(m_shm_path, 0, m_doorbell_shmem, nullptr),
+                               GEOPM_ERROR_INVALID, "max_endpoint must be positive");
+    GEOPM_EXPECT_THROW_MESSAGE(EndpointMuxImp(m_shm_path, 1000, m_doorbell_shmem, nullptr),
+                               GEOPM_ERROR_INVALID, "too small");
+}
+
+TEST_F(EndpointMuxTestIntegration, attach_sample_detach)
+{
+    std::vector<double> values = {1.5, 2.5};
+    std::set<std::string> hosts = {"node0"};
+    auto mux = geopm::EndpointMux::make_unique(m_shm_path, 2);
+    EXPECT_EQ(0, mux->add_endpoint(m_shm_path + "_0"));
+    EXPECT_EQ(1, mux->add_endpoint(m_shm_path + "_1"));
+    EXPECT_TRUE(mux->wait(0).empty());
+    {
+        EndpointUserImp endpoint_user(m_shm_path + "_1", nullptr, nullptr, "power_balancer",
+                                      values.size(), "myprofile", m_hostlist_path, hosts);
+        EXPECT_THAT(mux->wait(1.0), ElementsAre(1));
+        EXPECT_EQ("myprofile", mux->endpoint(1).get_profile_name());
+
+        endpoint_user.write_sample(values);
+        EXPECT_THAT(mux->wait(1.0), ElementsAre(1));
+        std::vector<double> sample;
+        std::vector<double> sample_age;
+        mux->read_sample(values.size(), sample, sample_age);
+        EXPECT_THAT(sample, ElementsAre(IsNan(), IsNan(), 1.5, 2.5));
+        EXPECT_TRUE(std::isnan(sample_age[0]));
+        EXPECT_LE(0.0, sample_age[1]);
+        EXPECT_TRUE(mux->wait(0).empty());
+    }
+    EXPECT_THAT(mux->wait(1.0), ElementsAre(1));
+    EXPECT_EQ("", mux->endpoint(1).get_agent());
+}
+
+TEST_F(EndpointMuxTestIntegration, c_interface)
+{
+    std::vector<double> values = {3.0};
+    std::set<std::string> hosts = {"node0"};
+    struct geopm_endpoint_mux_c *mux = nullptr;
+    ASSERT_EQ(0, geopm_endpoint_mux_create(m_shm_path.c_str(), 2, &mux));
+    int endpoint_idx = -1;
+    EXPECT_EQ(0, geopm_endpoint_mux_add(mux, (m_shm_path + "_0").c_str(), &endpoint_idx));
+    EXPECT_EQ(0, endpoint_idx);
+    struct geopm_endpoint_c *endpoint = nullptr;
+    EXPECT_EQ(0, geopm_endpoint_mux_endpoint(mux, endpoint_idx, &endpoint));
+    EXPECT_NE(0, geopm_endpoint_mux_endpoint(mux, 1, &endpoint));
+
+    EndpointUserImp endpoint_user(m_shm_path + "_0", nullptr, nullptr, "power_balancer",
+                                  values.size(), "myprofile", m_hostlist_path, hosts);
+    endpoint_user.write_sample(values);
+    int ready_idx[2] = {-1, -1};
+    int num_ready = 0;
+    EXPECT_EQ(GEOPM_ERROR_INVALID, geopm_endpoint_mux_wait(mux, 1.0, 1, ready_idx, &num_ready));
+    EXPECT_EQ(0, geopm_endpoint_mux_wait(mux, 1.0, 2, ready_idx, &num_ready));
+    EXPECT_EQ(1, num_ready);
+    EXPECT_EQ(0, ready_idx[0]);
+    double sample[2] = {};
+    double sample_age[2] = {};
+    EXPECT_EQ(GEOPM_ERROR_INVALID, geopm_endpoint_mux_read_sample(mux, 2, 2, sample, 2, sample_age));
+    EXPECT_EQ(GEOPM_ERROR_INVALID, geopm_endpoint_mux_read_sample(mux, 1, 2, sample, 1, sample_age));
+    EXPECT_EQ(0.0, sample[0]);
+    EXPECT_EQ(0, geopm_endpoint_mux_read_sample(mux, 1, 2, sample, 2, sample_age));
+    EXPECT_EQ(3.0, sample[0]);
+    EXPECT_TRUE(std::isnan(sample[1]));
+    char agent[GEOPM_ENDPOINT_AGENT_NAME_MAX];
+    EXPECT_EQ(0, geopm_endpoint_agent(endpoint, sizeof(agent), agent));
+    EXPECT_EQ("power_balancer", std::string(agent));
+    EXPECT_EQ(0, geopm_endpoint_mux_remove(mux, endpoint_idx));
+    EXPECT_NE(0, geopm_endpoint_mux_remove(mux, endpoint_idx));
+    EXPECT_EQ(0, geopm_endpoint_mux_destroy(mux));
+}
+
+TEST_F(EndpointMuxTestIntegration, wait_wakeup)
+{
+    GEOPM_TEST_EXTENDED("Requires multiple threads");
+    std::vector<double> values = {1.0};
+    std::set<std::string> hosts = {"node0"};
+    auto mux = geopm::EndpointMux::make_unique(m_shm_path, 2);
+    mux->add_endpoint(m_shm_path + "_0");
+    mux->add_endpoint(m_shm_path + "_1");
+    EndpointUserImp endpoint_user(m_shm_path + "_0", nullptr, nullptr, "power_balancer",
+                                  values.size(), "myprofile", m_hostlist_path, hosts);
+    EXPECT_THAT(mux->wait(1.0), ElementsAre(0));
+    auto run_thread = std::async(std::launch::async,
+                                 &geopm::EndpointMux::wait,
+                                 mux.get(),
+                                 2.0);
+    ASSERT_TRUE(run_thread.valid());
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    endpoint_user.write_sample(values);
+    auto result = run_thread.wait_for(std::chrono::milliseconds(50));
+    EXPECT_NE(result, std::future_status::timeout);
+    EXPECT_THAT(run_thread.get(), ElementsAre(0));
+}
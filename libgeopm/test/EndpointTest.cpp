@@ -220,6 +220,143 @@ TEST_F(EndpointTestIntegration, read_sample_before_data_exists)
     unlink(hostlist_path.c_str());
 }
 
+TEST_F(EndpointTestIntegration, read_sample_history)
+{
+    std::vector<double> values = {0, 1.5};
+    std::set<std::string> hosts = {"node5"};
+    std::string hostlist_path = "EndpointTestIntegration_hostlist";
+    std::shared_ptr<Endpoint> endpoint = std::make_shared<EndpointImp>(m_shm_path, nullptr, nullptr, 0, values.size(), 4);
+    endpoint->open();
+    EndpointUserImp endpoint_user(m_shm_path, nullptr, nullptr, "power_balancer",
+                                  values.size(), "myprofile", hostlist_path, hosts);
+    std::vector<std::vector<double> > samples;
+    std::vector<double> sample_age;
+    EXPECT_EQ(0u, endpoint->read_sample_history(samples, sample_age));
+    EXPECT_EQ(0u, samples.size());
+
+    for (int sample_idx = 0; sample_idx < 3; ++sample_idx) {
+        values[0] = sample_idx;
+        endpoint_user.write_sample(values);
+    }
+    EXPECT_EQ(0u, endpoint->read_sample_history(samples, sample_age));
+    ASSERT_EQ(3u, samples.size());
+    ASSERT_EQ(3u, sample_age.size());
+    for (int sample_idx = 0; sample_idx < 3; ++sample_idx) {
+        EXPECT_THAT(samples[sample_idx], ElementsAre(sample_idx, 1.5));
+        EXPECT_LE(0.0, sample_age[sample_idx]);
+    }
+
+    // Overrun the four entry ring: three oldest are lost
+    for (int sample_idx = 3; sample_idx < 10; ++sample_idx) {
+        values[0] = sample_idx;
+        endpoint_user.write_sample(values);
+    }
+    EXPECT_EQ(3u, endpoint->read_sample_history(samples, sample_age));
+    ASSERT_EQ(4u, samples.size());
+    for (int sample_idx = 0; sample_idx < 4; ++sample_idx) {
+        EXPECT_THAT(samples[sample_idx], ElementsAre(6 + sample_idx, 1.5));
+    }
+    EXPECT_EQ(0u, endpoint->read_sample_history(samples, sample_age));
+    EXPECT_EQ(0u, samples.size());
+
+    // read_sample() moves the history cursor
+    endpoint_user.write_sample(values);
+    std::vector<double> result(values.size());
+    endpoint->read_sample(result);
+    EXPECT_EQ(0u, endpoint->read_sample_history(samples, sample_age));
+    EXPECT_EQ(0u, samples.size());
+
+    // From C interface
+    endpoint_user.write_sample(values);
+    endpoint_user.write_sample(values);
+    endpoint_user.write_sample(values);
+    std::vector<double> result_c(2 * values.size());
+    std::vector<double> age_c(2);
+    size_t num_record = 0;
+    size_t num_lost = 0;
+    EXPECT_EQ(0, geopm_endpoint_read_sample_history(reinterpret_cast<geopm_endpoint_c*>(endpoint.get()),
+                                                    values.size(), 2, result_c.data(),
+                                                    age_c.data(), &num_record, &num_lost));
+    EXPECT_EQ(2u, num_record);
+    EXPECT_EQ(1u, num_lost);
+    EXPECT_THAT(result_c, ElementsAre(9, 1.5, 9, 1.5));
+
+    endpoint->close();
+    unlink(hostlist_path.c_str());
+}
+
+TEST_F(EndpointTestIntegration, read_sample_history_disabled)
+{
+    std::shared_ptr<Endpoint> endpoint = std::make_shared<EndpointImp>(m_shm_path, nullptr, nullptr, 0, 0);
+    endpoint->open();
+    std::vector<std::vector<double> > samples;
+    std::vector<double> sample_age;
+    GEOPM_EXPECT_THROW_MESSAGE(endpoint->read_sample_history(samples, sample_age),
+                               GEOPM_ERROR_INVALID, "without a sample history");
+    endpoint->close();
+}
+
+TEST_F(EndpointTestIntegration, read_sample_history_size_max)
+{
+    GEOPM_EXPECT_THROW_MESSAGE(std::make_shared<EndpointImp>(m_shm_path, nullptr, nullptr, 0, 0,
+                                                             (size_t)geopm::GEOPM_ENDPOINT_HISTORY_SIZE_MAX + 1),
+                               GEOPM_ERROR_INVALID, "history_size must not exceed");
+    GEOPM_EXPECT_THROW_MESSAGE(std::make_shared<EndpointImp>(m_shm_path, (size_t)UINT32_MAX + 1),
+                               GEOPM_ERROR_INVALID, "history_size must not exceed");
+    struct geopm_endpoint_c *endpoint = nullptr;
+    EXPECT_EQ(GEOPM_ERROR_INVALID,
+              geopm_endpoint_create_history(m_shm_path.c_str(),
+                                            (size_t)geopm::GEOPM_ENDPOINT_HISTORY_SIZE_MAX + 1,
+                                            &endpoint));
+}
+
+TEST_F(EndpointTestIntegration, wait_for_sample)
+{
+    std::vector<double> values = {1, 2};
+    std::set<std::string> hosts = {"node5"};
+    std::string hostlist_path = "EndpointTestIntegration_hostlist";
+    std::shared_ptr<Endpoint> endpoint = std::make_shared<EndpointImp>(m_shm_path, nullptr, nullptr, 0, values.size());
+    endpoint->open();
+    EndpointUserImp endpoint_user(m_shm_path, nullptr, nullptr, "power_balancer",
+                                  values.size(), "myprofile", hostlist_path, hosts);
+    GEOPM_EXPECT_THROW_MESSAGE(endpoint->wait_for_sample(0), GEOPM_ERROR_RUNTIME, "timed out");
+    endpoint_user.write_sample(values);
+    endpoint->wait_for_sample(0);
+    std::vector<double> result(values.size());
+    endpoint->read_sample(result);
+    GEOPM_EXPECT_THROW_MESSAGE(endpoint->wait_for_sample(0), GEOPM_ERROR_RUNTIME, "timed out");
+    endpoint->close();
+    unlink(hostlist_path.c_str());
+}
+
+TEST_F(EndpointTestIntegration, wait_for_sample_wakeup)
+{
+    GEOPM_TEST_EXTENDED("Requires multiple threads");
+    std::vector<double> values = {1, 2};
+    std::set<std::string> hosts = {"node5"};
+    std::string hostlist_path = "EndpointTestIntegration_hostlist";
+    std::shared_ptr<Endpoint> endpoint = std::make_shared<EndpointImp>(m_shm_path, nullptr, nullptr, 0, values.size());
+    endpoint->open();
+    EndpointUserImp endpoint_user(m_shm_path, nullptr, nullptr, "power_balancer",
+                                  values.size(), "myprofile", hostlist_path, hosts);
+    auto run_thread = std::async(std::launch::async,
+                                 &Endpoint::wait_for_sample,
+                                 endpoint,
+                                 2.0);
+    ASSERT_TRUE(run_thread.valid());
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    geopm_time_s before;
+    geopm_time(&before);
+    endpoint_user.write_sample(values);
+    // Notification wakes the waiter well before the poll interval
+    auto result = run_thread.wait_for(std::chrono::milliseconds(50));
+    EXPECT_NE(result, std::future_status::timeout);
+    run_thread.get();
+    EXPECT_LT(geopm_time_since(&before), 0.05);
+    endpoint->close();
+    unlink(hostlist_path.c_str());
+}
+
 TEST_F(EndpointTest, get_agent)
 {
     set_up_expectations();
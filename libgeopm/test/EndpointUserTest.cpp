@@ -124,6 +124,48 @@ TEST_F(EndpointUserTest, write_shm_sample)
     EXPECT_EQ(values, test);
 }
 
+TEST_F(EndpointUserTest, write_shm_sample_history)
+{
+    size_t history_size = 2;
+    m_sample_shmem_user = geopm::make_unique<MockSharedMemory>(geopm::EndpointImp::sample_shmem_size(history_size));
+    EXPECT_CALL(*m_sample_shmem_user, get_scoped_lock()).Times(AtLeast(0));
+    struct geopm_endpoint_sample_shmem_s *data = (struct geopm_endpoint_sample_shmem_s *) m_sample_shmem_user->pointer();
+    data->history_size = history_size;
+    auto history = (struct geopm::geopm_endpoint_sample_record_s *)(data + 1);
+    std::vector<double> values = {777, 12.3456, 2.3e9};
+    EndpointUserImp jio("/FAKE_PATH", std::move(m_policy_shmem_user), std::move(m_sample_shmem_user),
+                          "myagent", values.size(), "myprofile", m_hostlist_file, {});
+    uint32_t update_count = data->update_count;
+    jio.write_sample(values);
+    values[0] = 888;
+    jio.write_sample(values);
+    values[0] = 999;
+    jio.write_sample(values);
+
+    EXPECT_EQ(3u, data->sample_count);
+    EXPECT_EQ(update_count + 3, data->update_count);
+    EXPECT_EQ(999, history[0].values[0]);
+    EXPECT_EQ(888, history[1].values[0]);
+    EXPECT_EQ(12.3456, history[1].values[1]);
+}
+
+TEST_F(EndpointUserTest, wait_for_policy)
+{
+    struct geopm_endpoint_policy_shmem_s *data = (struct geopm_endpoint_policy_shmem_s *) m_policy_shmem_user->pointer();
+    data->count = 1;
+    data->values[0] = 1.0;
+    EndpointUserImp gp("/FAKE_PATH", std::move(m_policy_shmem_user),
+                         std::move(m_sample_shmem_user), "myagent", 0,
+                         "myprofile", m_hostlist_file, {});
+    GEOPM_EXPECT_THROW_MESSAGE(gp.wait_for_policy(0), GEOPM_ERROR_RUNTIME, "timed out");
+    // simulate resource manager write
+    data->update_count++;
+    gp.wait_for_policy(0);
+    std::vector<double> result(1);
+    gp.read_policy(result);
+    GEOPM_EXPECT_THROW_MESSAGE(gp.wait_for_policy(0.01), GEOPM_ERROR_RUNTIME, "timed out");
+}
+
 TEST_F(EndpointUserTest, agent_name_too_long)
 {
     std::string too_long(GEOPM_ENDPOINT_AGENT_NAME_MAX, 'X');
@@ -191,3 +233,24 @@ TEST_F(EndpointUserTestIntegration, parse_shm)
     expected = {tmp, tmp + num_policy};
     EXPECT_EQ(expected, result);
 }
+
+TEST_F(EndpointUserTest, destructor_doorbell_error)
+{
+    const std::string doorbell_key = m_shm_path + "-doorbell";
+    auto doorbell = SharedMemory::make_unique_owner(doorbell_key, geopm::EndpointImp::doorbell_shmem_size(1));
+    auto doorbell_data = (struct geopm::geopm_endpoint_doorbell_shmem_s *)doorbell->pointer();
+    doorbell_data->num_endpoint = 1;
+    struct geopm_endpoint_sample_shmem_s *data = (struct geopm_endpoint_sample_shmem_s *) m_sample_shmem_user->pointer();
+    strncpy(data->doorbell_key, doorbell_key.c_str(), geopm::GEOPM_ENDPOINT_DOORBELL_KEY_MAX - 1);
+    data->doorbell_index = 0;
+    auto gp = geopm::make_unique<EndpointUserImp>("/FAKE_PATH", std::move(m_policy_shmem_user),
+                                                  std::move(m_sample_shmem_user), "myagent", 0,
+                                                  "myprofile", m_hostlist_file, std::set<std::string>{});
+    uint32_t update_count = doorbell_data->update_count;
+    // The owner shrank the doorbell: ringing it fails, but the
+    // destructor must only warn.
+    doorbell_data->num_endpoint = 0;
+    EXPECT_NO_THROW(gp.reset());
+    EXPECT_EQ(update_count, doorbell_data->update_count);
+    doorbell->unlink();
+}
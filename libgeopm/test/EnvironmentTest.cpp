@@ -655,6 +655,106 @@ TEST_F(EnvironmentTest, init_control_unset)
     EXPECT_EQ("", m_env->init_control());
 }
 
+TEST_F(EnvironmentTest, tree_comm)
+{
+    m_env = geopm::make_unique<EnvironmentImp>("", "");
+    EXPECT_EQ("rma", m_env->tree_comm());
+    EXPECT_EQ(10, m_env->tree_comm_max_stale());
+
+    setenv("GEOPM_TREE_COMM", "p2p", 1);
+    setenv("GEOPM_TREE_COMM_MAX_STALE", "4", 1);
+    m_env = geopm::make_unique<EnvironmentImp>("", "");
+    EXPECT_EQ("p2p", m_env->tree_comm());
+    EXPECT_EQ(4, m_env->tree_comm_max_stale());
+
+    setenv("GEOPM_TREE_COMM", "window", 1);
+    setenv("GEOPM_TREE_COMM_MAX_STALE", "-1", 1);
+    m_env = geopm::make_unique<EnvironmentImp>("", "");
+    GEOPM_EXPECT_THROW_MESSAGE(m_env->tree_comm(), GEOPM_ERROR_INVALID,
+                               "GEOPM_TREE_COMM environment variable must be");
+    GEOPM_EXPECT_THROW_MESSAGE(m_env->tree_comm_max_stale(), GEOPM_ERROR_INVALID,
+                               "must not be negative");
+}
+
+TEST_F(EnvironmentTest, waiter_strategy)
+{
+    m_env = geopm::make_unique<EnvironmentImp>("", "");
+    EXPECT_EQ("sleep", m_env->waiter_strategy());
+
+    setenv("GEOPM_WAITER_STRATEGY", "timerfd", 1);
+    m_env = geopm::make_unique<EnvironmentImp>("", "");
+    EXPECT_EQ("timerfd", m_env->waiter_strategy());
+
+    setenv("GEOPM_WAITER_STRATEGY", "busy", 1);
+    m_env = geopm::make_unique<EnvironmentImp>("", "");
+    GEOPM_EXPECT_THROW_MESSAGE(m_env->waiter_strategy(), GEOPM_ERROR_INVALID,
+                               "GEOPM_WAITER_STRATEGY environment variable must be");
+}
+
+TEST_F(EnvironmentTest, report_format)
+{
+    m_env = geopm::make_unique<EnvironmentImp>("", "");
+    EXPECT_EQ("yaml", m_env->report_format());
+
+    setenv("GEOPM_REPORT_FORMAT", "both", 1);
+    m_env = geopm::make_unique<EnvironmentImp>("", "");
+    EXPECT_EQ("both", m_env->report_format());
+
+    setenv("GEOPM_REPORT_FORMAT", "json", 1);
+    m_env = geopm::make_unique<EnvironmentImp>("", "");
+    GEOPM_EXPECT_THROW_MESSAGE(m_env->report_format(), GEOPM_ERROR_INVALID,
+                               "GEOPM_REPORT_FORMAT environment variable must be");
+}
+
+TEST_F(EnvironmentTest, trace_profile_format)
+{
+    m_env = geopm::make_unique<EnvironmentImp>("", "");
+    EXPECT_EQ("csv", m_env->trace_profile_format());
+
+    setenv("GEOPM_TRACE_PROFILE_FORMAT", "binary", 1);
+    m_env = geopm::make_unique<EnvironmentImp>("", "");
+    EXPECT_EQ("binary", m_env->trace_profile_format());
+
+    setenv("GEOPM_TRACE_PROFILE_FORMAT", "yaml", 1);
+    m_env = geopm::make_unique<EnvironmentImp>("", "");
+    GEOPM_EXPECT_THROW_MESSAGE(m_env->trace_profile_format(), GEOPM_ERROR_INVALID,
+                               "GEOPM_TRACE_PROFILE_FORMAT environment variable must be");
+}
+
+TEST_F(EnvironmentTest, trace_compression)
+{
+    m_env = geopm::make_unique<EnvironmentImp>("", "");
+    EXPECT_EQ("none", m_env->trace_compression());
+    EXPECT_EQ("none", m_env->trace_profile_compression());
+
+    setenv("GEOPM_TRACE_COMPRESSION", "gzip", 1);
+    m_env = geopm::make_unique<EnvironmentImp>("", "");
+    EXPECT_EQ("gzip", m_env->trace_compression());
+    EXPECT_EQ("none", m_env->trace_profile_compression());
+
+    setenv("GEOPM_TRACE_PROFILE_COMPRESSION", "gzip", 1);
+    m_env = geopm::make_unique<EnvironmentImp>("", "");
+    EXPECT_EQ("gzip", m_env->trace_profile_compression());
+
+    setenv("GEOPM_TRACE_COMPRESSION", "zstd", 1);
+    setenv("GEOPM_TRACE_PROFILE_COMPRESSION", "lz4", 1);
+    m_env = geopm::make_unique<EnvironmentImp>("", "");
+    GEOPM_EXPECT_THROW_MESSAGE(m_env->trace_compression(), GEOPM_ERROR_INVALID,
+                               "GEOPM_TRACE_COMPRESSION environment variable must be");
+    GEOPM_EXPECT_THROW_MESSAGE(m_env->trace_profile_compression(), GEOPM_ERROR_INVALID,
+                               "GEOPM_TRACE_PROFILE_COMPRESSION environment variable must be");
+}
+
+TEST_F(EnvironmentTest, trace_summary)
+{
+    m_env = geopm::make_unique<EnvironmentImp>("", "");
+    EXPECT_EQ("", m_env->trace_summary());
+
+    setenv("GEOPM_TRACE_SUMMARY", "0.1s,region", 1);
+    m_env = geopm::make_unique<EnvironmentImp>("", "");
+    EXPECT_EQ("0.1s,region", m_env->trace_summary());
+}
+
 TEST_F(EnvironmentTest, signal_parser)
 {
     std::vector<std::pair<std::string, int> >& expected_signals = m_trace_signals;
@@ -7,6 +7,7 @@
 #include <fstream>
 #include <string>
 #include <cerrno>
+#include <climits>
 
 #include "geopm/PlatformTopo.hpp"
 #include "InitControl.hpp"
@@ -118,6 +119,29 @@ TEST_F(InitControlTest, parse_valid_file_2)
     m_init_control->write_controls();
 }
 
+TEST_F(InitControlTest, write_long_name_in_order)
+{
+    // A control name too long for a geopm_request_s is written
+    // individually, after the requests before it in the file
+    std::string long_name = "FAKE_CONTROL_" + std::string(NAME_MAX, 'X');
+    std::string contents = "FAKE_CONTROL0 board 0 123\n" +
+                           long_name + " board 0 4\n" +
+                           "FAKE_CONTROL1 package 1 -7.77\n";
+    WriteFile(contents);
+
+    InSequence s;
+    EXPECT_CALL(m_platform_io,
+                write_control("FAKE_CONTROL0", PlatformTopo::domain_name_to_type("board"), 0, 123));
+    EXPECT_CALL(m_platform_io,
+                write_control(long_name, PlatformTopo::domain_name_to_type("board"), 0, 4));
+    EXPECT_CALL(m_platform_io,
+                write_control("FAKE_CONTROL1", PlatformTopo::domain_name_to_type("package"), 1, -7.77));
+
+    m_init_control = std::make_shared<InitControlImp>(m_platform_io);
+    m_init_control->parse_input(m_file_name);
+    m_init_control->write_controls();
+}
+
 TEST_F(InitControlTest, parse_empty_file)
 {
     // Helper::read_file() will throw an exception if the file has no contents
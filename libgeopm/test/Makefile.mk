@@ -46,6 +46,8 @@ test_geopm_test_SOURCES = test/AccumulatorTest.cpp \
                           test/ApplicationStatusTest.cpp \
                           test/CommMPIImpTest.cpp \
                           test/CommNullImpTest.cpp \
+                          test/CommShmImpTest.cpp \
+                          test/ControllerIOGroupTest.cpp \
                           test/ControllerTest.cpp \
                           test/CSVTest.cpp \
                           test/DebugIOGroupTest.cpp \
@@ -54,6 +56,7 @@ test_geopm_test_SOURCES = test/AccumulatorTest.cpp \
                           test/EditDistEpochRecordFilterTest.cpp \
                           test/EditDistPeriodicityDetectorTest.cpp \
                           test/EndpointTest.cpp \
+                          test/EndpointMuxTest.cpp \
                           test/EndpointPolicyTracerTest.cpp \
                           test/EndpointUserTest.cpp \
                           test/EnvironmentTest.cpp \
@@ -119,6 +122,7 @@ test_geopm_test_SOURCES = test/AccumulatorTest.cpp \
                           test/ProcessRegionAggregatorTest.cpp \
                           test/RecordFilterTest.cpp \
                           test/RegionHintRecommenderTest.cpp \
+                          test/RegionIndexTest.cpp \
                           test/ReporterTest.cpp \
                           test/SampleAggregatorTest.cpp \
                           test/SchedTest.cpp \
@@ -138,6 +142,7 @@ test_geopm_test_SOURCES = test/AccumulatorTest.cpp \
                           test/TreeCommTest.cpp \
                           test/TRLFrequencyLimitDetectorTest.cpp \
                           test/ValidateRecordTest.cpp \
+                          test/WaiterIOGroupTest.cpp \
                           test/WaiterTest.cpp \
                           test/geopm_test.cpp \
                           test/geopm_test_helper.cpp \
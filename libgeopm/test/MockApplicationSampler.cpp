@@ -24,21 +24,19 @@ void MockApplicationSampler::update_time(double time)
     }
 }
 
-std::vector<geopm::record_s> MockApplicationSampler::get_records(void) const
+const std::vector<geopm::record_s> &MockApplicationSampler::get_records(void) const
 {
-    std::vector<geopm::record_s> result;
     if (isnan(m_time_1)) {
-        result = m_records;
+        return m_records;
     }
-    else {
-        for (const auto &it : m_records) {
-            if (it.time.t.tv_sec >= m_time_0 &&
-                it.time.t.tv_sec < m_time_1) {
-                result.push_back(it);
-            }
+    m_result.clear();
+    for (const auto &it : m_records) {
+        if (it.time.t.tv_sec >= m_time_0 &&
+            it.time.t.tv_sec < m_time_1) {
+            m_result.push_back(it);
         }
     }
-    return result;
+    return m_result;
 }
 
 void MockApplicationSampler::inject_records(const std::vector<geopm::record_s> &records)
@@ -28,7 +28,7 @@ class MockApplicationSampler : public geopm::ApplicationSampler
         MOCK_METHOD(bool, do_shutdown, (), (const, override));
         MOCK_METHOD(double, total_time, (), (const, override));
         MOCK_METHOD(double, overhead_time, (), (const, override));
-        std::vector<geopm::record_s> get_records(void) const override;
+        const std::vector<geopm::record_s> &get_records(void) const override;
         /// Inject records to be used by next call to get_records()
         /// @todo: figure out input type for this
         void inject_records(const std::vector<geopm::record_s> &records);
@@ -37,6 +37,7 @@ class MockApplicationSampler : public geopm::ApplicationSampler
 
     private:
         std::vector<geopm::record_s> m_records;
+        mutable std::vector<geopm::record_s> m_result;
         double m_time_0;
         double m_time_1;
 };
@@ -63,6 +63,14 @@ class MockComm : public geopm::Comm
                     (const void *send_buf, size_t send_size, int rank,
                      off_t disp, size_t window_id),
                     (const, override));
+        MOCK_METHOD(size_t, isend,
+                    (const void *send_buf, size_t send_size, int rank, int tag),
+                    (override));
+        MOCK_METHOD(size_t, irecv,
+                    (void *recv_buf, size_t recv_size, int rank, int tag),
+                    (override));
+        MOCK_METHOD(bool, request_test, (size_t request_id), (override));
+        MOCK_METHOD(void, request_cancel, (size_t request_id), (override));
         MOCK_METHOD(void, tear_down, (), (override));
 };
 
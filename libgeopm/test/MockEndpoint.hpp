@@ -18,9 +18,14 @@ class MockEndpoint : public geopm::Endpoint
         MOCK_METHOD(void, write_policy, (const std::vector<double> &policy),
                     (override));
         MOCK_METHOD(double, read_sample, (std::vector<double> & sample), (override));
+        MOCK_METHOD(size_t, read_sample_history,
+                    ((std::vector<std::vector<double> > & sample),
+                     std::vector<double> &sample_age),
+                    (override));
         MOCK_METHOD(std::string, get_agent, (), (override));
         MOCK_METHOD(void, wait_for_agent_attach, (double timeout), (override));
         MOCK_METHOD(void, wait_for_agent_detach, (double timeout), (override));
+        MOCK_METHOD(void, wait_for_sample, (double timeout), (override));
         MOCK_METHOD(void, stop_wait_loop, (), (override));
         MOCK_METHOD(void, reset_wait_loop, (), (override));
         MOCK_METHOD(std::string, get_profile_name, (), (override));
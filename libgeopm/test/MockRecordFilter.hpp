@@ -13,8 +13,10 @@
 class MockRecordFilter : public geopm::RecordFilter
 {
     public:
-        MOCK_METHOD(std::vector<geopm::record_s>, filter,
-                    (const geopm::record_s &record), (override));
+        using geopm::RecordFilter::filter;
+        MOCK_METHOD(void, filter,
+                    (const geopm::record_s &record,
+                     std::vector<geopm::record_s> &result), (override));
 };
 
 #endif
@@ -177,3 +177,20 @@ TEST_F(ProcessRegionAggregatorTest, multiple_processes)
     }
 
 }
+
+TEST_F(ProcessRegionAggregatorTest, exit_without_entry)
+{
+    std::vector<record_s> records {
+        {{{1, 0}}, 12, EVENT_REGION_ENTRY, 0xDADA},
+        {{{2, 0}}, 13, EVENT_REGION_EXIT, 0xDADA},
+    };
+    m_app_sampler.inject_records(records);
+    GEOPM_EXPECT_THROW_MESSAGE(m_account->update(), GEOPM_ERROR_INVALID,
+                               "region exit without entry");
+    records = {
+        {{{1, 0}}, 12, EVENT_REGION_EXIT, 0xBEEFBEEF},
+    };
+    m_app_sampler.inject_records(records);
+    GEOPM_EXPECT_THROW_MESSAGE(m_account->update(), GEOPM_ERROR_INVALID,
+                               "region exit without entry");
+}
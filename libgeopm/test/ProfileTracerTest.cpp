@@ -4,6 +4,9 @@
  */
 
 
+#include <unistd.h>
+
+#include <cstring>
 #include <memory>
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -14,6 +17,7 @@
 #include "geopm_time.h"
 #include "geopm_hint.h"
 #include "MockApplicationSampler.hpp"
+#include "geopm_test.hpp"
 
 using testing::Return;
 using geopm::ProfileTracer;
@@ -113,3 +117,91 @@ TEST_F(ProfileTracerTest, format)
     int err = unlink(m_output_path.c_str());
     EXPECT_EQ(0, err);
 }
+
+TEST_F(ProfileTracerTest, binary_format)
+{
+    EXPECT_CALL(m_application_sampler, get_short_region(88))
+        .WillOnce(Return(geopm::short_region_s{
+            0xdeadbeef, 2, 3.14
+        }));
+
+    {
+        // Buffer for two records per block
+        std::unique_ptr<ProfileTracer> tracer = geopm::make_unique<ProfileTracerImp>(
+            m_start_time, geopm_time_s {{0, 0}}, 2 * sizeof(record_s), true,
+            m_path, m_host_name, "test_profile", "test_agent", "binary", "none",
+            m_application_sampler);
+        tracer->update(m_data);
+    }
+
+    std::string output = geopm::read_file(m_output_path);
+    ASSERT_LT(32ULL, output.size());
+    EXPECT_EQ("GEOPMPTR", output.substr(0, 8));
+    EXPECT_NE(std::string::npos, output.find("test_profile"));
+    EXPECT_NE(std::string::npos, output.find("test_agent"));
+    EXPECT_EQ("GEOPMPTE", output.substr(output.size() - 8));
+    uint64_t index_offset = 0;
+    memcpy(&index_offset, output.data() + output.size() - 16, sizeof(index_offset));
+    ASSERT_GT(output.size(), index_offset);
+    EXPECT_EQ("GEOPMPTI", output.substr(index_offset, 8));
+    uint64_t num_block = 0;
+    memcpy(&num_block, output.data() + index_offset + 8, sizeof(num_block));
+    ASSERT_EQ(5ULL, num_block);
+
+    std::vector<record_s> records;
+    std::vector<geopm::short_region_s> short_regions;
+    for (uint64_t block_idx = 0; block_idx != num_block; ++block_idx) {
+        const char *index = output.data() + index_offset + 16 + 24 * block_idx;
+        uint64_t offset = 0;
+        double index_begin = 0.0;
+        memcpy(&offset, index, sizeof(offset));
+        memcpy(&index_begin, index + 8, sizeof(index_begin));
+        const char *block = output.data() + offset;
+        uint32_t num_record = 0;
+        uint32_t num_short = 0;
+        double begin = 0.0;
+        memcpy(&num_record, block, sizeof(num_record));
+        memcpy(&num_short, block + 4, sizeof(num_short));
+        memcpy(&begin, block + 24, sizeof(begin));
+        EXPECT_EQ(2U, num_record);
+        EXPECT_EQ(index_begin, begin);
+        EXPECT_EQ(m_data[2 * block_idx].time.t.tv_sec, begin);
+        block += 40;
+        for (uint32_t rec_idx = 0; rec_idx != num_record; ++rec_idx) {
+            record_s rec;
+            memcpy(&rec, block, sizeof(rec));
+            records.push_back(rec);
+            block += sizeof(rec);
+        }
+        for (uint32_t short_idx = 0; short_idx != num_short; ++short_idx) {
+            geopm::short_region_s short_region;
+            memcpy(&short_region.hash, block, 8);
+            memcpy(&short_region.num_complete, block + 8, 4);
+            memcpy(&short_region.total_time, block + 16, 8);
+            short_regions.push_back(short_region);
+            block += 24;
+        }
+    }
+    ASSERT_EQ(m_data.size(), records.size());
+    for (size_t idx = 0; idx != m_data.size(); ++idx) {
+        EXPECT_EQ(m_data[idx].time.t.tv_sec, records[idx].time.t.tv_sec);
+        EXPECT_EQ(m_data[idx].process, records[idx].process);
+        EXPECT_EQ(m_data[idx].event, records[idx].event);
+        EXPECT_EQ(m_data[idx].signal, records[idx].signal);
+    }
+    ASSERT_EQ(1ULL, short_regions.size());
+    EXPECT_EQ(0xdeadbeefULL, short_regions[0].hash);
+    EXPECT_EQ(2, short_regions[0].num_complete);
+    EXPECT_EQ(3.14, short_regions[0].total_time);
+    int err = unlink(m_output_path.c_str());
+    EXPECT_EQ(0, err);
+}
+
+TEST_F(ProfileTracerTest, binary_format_compression)
+{
+    GEOPM_EXPECT_THROW_MESSAGE(ProfileTracerImp(m_start_time, geopm_time_s {{0, 0}}, 2 * sizeof(record_s), true,
+                                                m_path, m_host_name, "test_profile", "test_agent",
+                                                "binary", "gzip", m_application_sampler),
+                               GEOPM_ERROR_INVALID, "not supported for the binary profile trace format");
+    EXPECT_NE(0, access(m_output_path.c_str(), F_OK));
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "config.h"
+
+#include "gtest/gtest.h"
+
+#include "RegionIndex.hpp"
+#include "geopm/Exception.hpp"
+#include "geopm_test.hpp"
+
+using geopm::RegionIndex;
+
+TEST(RegionIndexTest, insert)
+{
+    RegionIndex region_index;
+    EXPECT_EQ(0, region_index.num_region());
+    EXPECT_EQ(-1, region_index.index(0xABCD));
+    EXPECT_EQ(0, region_index.insert(0xABCD));
+    EXPECT_EQ(1, region_index.insert(0x1234));
+    EXPECT_EQ(0, region_index.insert(0xABCD));
+    EXPECT_EQ(2, region_index.num_region());
+    EXPECT_EQ(0, region_index.index(0xABCD));
+    EXPECT_EQ(1, region_index.index(0x1234));
+    EXPECT_EQ(-1, region_index.index(0x5678));
+    EXPECT_EQ(0xABCDULL, region_index.hash(0));
+    EXPECT_EQ(0x1234ULL, region_index.hash(1));
+    GEOPM_EXPECT_THROW_MESSAGE(region_index.hash(2), GEOPM_ERROR_INVALID,
+                               "region_idx out of range");
+    GEOPM_EXPECT_THROW_MESSAGE(region_index.hash(-1), GEOPM_ERROR_INVALID,
+                               "region_idx out of range");
+}
+
+TEST(RegionIndexTest, many_regions)
+{
+    RegionIndex region_index;
+    const int num_region = 10000;
+    for (int region_idx = 0; region_idx < num_region; ++region_idx) {
+        EXPECT_EQ(region_idx, region_index.insert(0x1000000ULL + 7 * region_idx));
+    }
+    EXPECT_EQ(num_region, region_index.num_region());
+    for (int region_idx = num_region - 1; region_idx >= 0; --region_idx) {
+        EXPECT_EQ(region_idx, region_index.index(0x1000000ULL + 7 * region_idx));
+        EXPECT_EQ(0x1000000ULL + 7 * region_idx, region_index.hash(region_idx));
+    }
+}
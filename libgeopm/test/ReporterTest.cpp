@@ -78,6 +78,7 @@ class ReporterTest : public testing::Test
             M_POWER_GPU_IDX,
             M_FREQUENCY_GPU_IDX,
             M_FREQUENCY_CPU_UNCORE_IDX,
+            M_WRITE_SKIPPED_IDX,
         };
         ReporterTest();
         void TearDown(void);
@@ -352,7 +353,8 @@ TEST_F(ReporterTest, generate)
                                                  "",
                                                  true,
                                                  m_profile_name,
-                                                 false);
+                                                 false,
+                                                 "yaml");
     m_reporter->init();
 
     std::vector<std::pair<std::string, std::string> > agent_header {
@@ -520,7 +522,16 @@ TEST_F(ReporterTest, generate_conditional)
     EXPECT_CALL(*m_sample_agg, push_signal("CPU_UNCORE_FREQUENCY_STATUS", GEOPM_DOMAIN_BOARD, 0))
         .WillOnce(Return(M_FREQUENCY_CPU_UNCORE_IDX));
 
-    std::set<std::string> signal_names = {"GPU_ENERGY","GPU_POWER","GPU_CORE_FREQUENCY_STATUS","CPU_UNCORE_FREQUENCY_STATUS"};
+    // The count of skipped MSR writes is pushed so that it comes
+    // from the MSRIO that writes the pushed controls
+    EXPECT_CALL(m_platform_io, push_signal("MSR::BATCH_WRITE_SKIPPED", GEOPM_DOMAIN_BOARD, 0))
+        .WillOnce(Return(M_WRITE_SKIPPED_IDX));
+    EXPECT_CALL(m_platform_io, sample(M_WRITE_SKIPPED_IDX))
+        .WillOnce(Return(7));
+    EXPECT_CALL(m_platform_io, read_signal("MSR::BATCH_WRITE_SKIPPED", _, _)).Times(0);
+
+    std::set<std::string> signal_names = {"GPU_ENERGY","GPU_POWER","GPU_CORE_FREQUENCY_STATUS","CPU_UNCORE_FREQUENCY_STATUS",
+                                          "MSR::BATCH_WRITE_SKIPPED"};
     EXPECT_CALL(m_platform_io, signal_names()).WillOnce(Return(signal_names));
 
     //setup default values for 'generate' tests
@@ -540,7 +551,8 @@ TEST_F(ReporterTest, generate_conditional)
                                                  "",
                                                  true,
                                                  m_profile_name,
-                                                 false);
+                                                 false,
+                                                 "yaml");
     m_reporter->init();
     m_reporter->total_time(56.0);
 
@@ -721,7 +733,8 @@ TEST_F(ReporterTest, generate_conditional)
              << "      GEOPM startup (s): 0.321\n"
              << "      GEOPM overhead (s): 0.123\n"
              << "      geopmctl memory HWM (B): @ANY_STRING@\n"
-             << "      geopmctl network BW (B/s): 678\n\n";
+             << "      geopmctl network BW (B/s): 678\n"
+             << "      MSR writes skipped: 7\n\n";
 
     std::istringstream exp_istream(expected.str());
     m_reporter->update();
@@ -733,6 +746,155 @@ TEST_F(ReporterTest, generate_conditional)
     check_report(exp_istream, report);
 }
 
+// Minimal reader for the format written by BinaryReport
+class BinaryReportReader
+{
+    public:
+        BinaryReportReader(const std::string &path)
+            : m_offset(0)
+        {
+            std::ifstream file(path, std::ios::binary);
+            m_buffer.assign(std::istreambuf_iterator<char>(file),
+                            std::istreambuf_iterator<char>());
+        }
+        template <typename type>
+        type read(void)
+        {
+            type result;
+            EXPECT_LE(m_offset + sizeof(type), m_buffer.size());
+            memcpy(&result, m_buffer.data() + m_offset, sizeof(type));
+            m_offset += sizeof(type);
+            return result;
+        }
+        std::string read_string(void)
+        {
+            uint32_t size = read<uint32_t>();
+            std::string result = m_buffer.substr(m_offset, size);
+            m_offset += size;
+            return result;
+        }
+        std::vector<std::pair<std::string, std::string> > read_pairs(void)
+        {
+            std::vector<std::pair<std::string, std::string> > result(read<uint32_t>());
+            for (auto &kv : result) {
+                kv.first = read_string();
+                kv.second = read_string();
+            }
+            return result;
+        }
+        std::string m_buffer;
+        size_t m_offset;
+};
+
+TEST_F(ReporterTest, generate_binary)
+{
+    EXPECT_CALL(m_platform_io, signal_names()).WillOnce(Return(std::set<std::string>{}));
+    generate_setup();
+    const std::vector<std::pair<std::string, int> > env_signals = {
+        {"CPU_ENERGY", geopm_domain_e::GEOPM_DOMAIN_PACKAGE}
+    };
+    m_reporter = geopm::make_unique<ReporterImp>(m_start_time,
+                                                 m_platform_io,
+                                                 m_platform_topo,
+                                                 0,
+                                                 m_sample_agg,
+                                                 m_region_agg,
+                                                 m_report_name,
+                                                 env_signals,
+                                                 "",
+                                                 true,
+                                                 m_profile_name,
+                                                 false,
+                                                 "binary");
+    m_reporter->init();
+    m_reporter->update();
+    m_reporter->total_time(56.0);
+    m_reporter->overhead(0.123, 0.321);
+    m_reporter->generate("my_agent", {{"one", "1"}}, {{"three", "3"}}, m_region_agent_detail,
+                         m_application_io,
+                         m_comm, m_tree_comm);
+
+    BinaryReportReader reader(m_report_name);
+    EXPECT_EQ("GEOPMRPT", reader.m_buffer.substr(0, 8));
+    reader.m_offset = 8;
+    EXPECT_EQ(1U, reader.read<uint32_t>());
+    ASSERT_EQ(1U, reader.read<uint32_t>());
+    uint64_t host_offset = reader.read<uint64_t>();
+    auto header = reader.read_pairs();
+    ASSERT_EQ(6U, header.size());
+    EXPECT_EQ(std::make_pair(std::string("Agent"), std::string("my_agent")), header[3]);
+    EXPECT_EQ(std::make_pair(std::string("one"), std::string("1")), header[5]);
+    EXPECT_EQ(host_offset, reader.m_offset);
+
+    EXPECT_EQ(geopm::hostname(), reader.read_string());
+    auto agent_host = reader.read_pairs();
+    ASSERT_EQ(1U, agent_host.size());
+    EXPECT_EQ("three", agent_host[0].first);
+    uint32_t num_region = reader.read<uint32_t>();
+    uint32_t num_column = reader.read<uint32_t>();
+    // all2all, MPI_Init_thread, unmarked, epoch, application
+    ASSERT_EQ(5U, num_region);
+    std::vector<std::string> column(num_column);
+    for (auto &name : column) {
+        name = reader.read_string();
+    }
+    ASSERT_LE(4U, column.size());
+    EXPECT_EQ("runtime (s)", column[0]);
+    EXPECT_EQ("count", column[1]);
+    EXPECT_EQ("sync-runtime (s)", column[2]);
+    EXPECT_EQ("CPU_ENERGY@package-1", column.back());
+    std::vector<uint32_t> type(num_region);
+    for (auto &tt : type) {
+        tt = reader.read<uint32_t>();
+    }
+    EXPECT_EQ(std::vector<uint32_t>({0, 0, 1, 2, 3}), type);
+    EXPECT_EQ(geopm_crc32_str("all2all"), reader.read<uint64_t>());
+    EXPECT_EQ(geopm_crc32_str("MPI_Init_thread"), reader.read<uint64_t>());
+    EXPECT_EQ(GEOPM_REGION_HASH_UNMARKED, reader.read<uint64_t>());
+    EXPECT_EQ(GEOPM_REGION_HASH_EPOCH, reader.read<uint64_t>());
+    EXPECT_EQ(GEOPM_REGION_HASH_APP, reader.read<uint64_t>());
+    EXPECT_EQ("all2all", reader.read_string());
+    EXPECT_EQ("MPI_Init_thread", reader.read_string());
+    for (int region_idx = 2; region_idx != 5; ++region_idx) {
+        EXPECT_EQ("", reader.read_string());
+    }
+    std::vector<double> runtime(num_region);
+    for (auto &value : runtime) {
+        value = reader.read<double>();
+    }
+    EXPECT_EQ(std::vector<double>({33.33, 22.11, 56.0 - 33.33 - 22.11, 70.0, 56.0}), runtime);
+    std::vector<double> count(num_region);
+    for (auto &value : count) {
+        value = reader.read<double>();
+    }
+    EXPECT_EQ(std::vector<double>({20.0, 1.0, 0.0, 66.0, 0.0}), count);
+    reader.m_offset += (num_column - 2) * num_region * sizeof(double);
+    ASSERT_EQ(4U, reader.read<uint32_t>());
+    EXPECT_EQ(0U, reader.read<uint32_t>());
+    EXPECT_EQ("agent stat", reader.read_string());
+    EXPECT_EQ("1", reader.read_string());
+    reader.m_offset += sizeof(uint32_t);
+    EXPECT_EQ("agent other stat", reader.read_string());
+    EXPECT_EQ("2", reader.read_string());
+    reader.m_offset += sizeof(uint32_t);
+    reader.read_string();
+    reader.read_string();
+    EXPECT_EQ(2U, reader.read<uint32_t>());
+    reader.read_string();
+    reader.read_string();
+    uint32_t num_overhead = reader.read<uint32_t>();
+    ASSERT_EQ(5U, num_overhead);
+    EXPECT_EQ("MPI startup (s)", reader.read_string());
+    EXPECT_EQ(22.11, reader.read<double>());
+    EXPECT_EQ("GEOPM startup (s)", reader.read_string());
+    EXPECT_EQ(0.321, reader.read<double>());
+    for (uint32_t idx = 2; idx != num_overhead; ++idx) {
+        reader.read_string();
+        reader.read<double>();
+    }
+    EXPECT_EQ(reader.m_buffer.size(), reader.m_offset);
+}
+
 void check_report(std::istream &expected, std::istream &result)
 {
     char exp_line[1024];
@@ -5,12 +5,14 @@
 
 #include <fstream>
 #include <sstream>
+#include <map>
 #include <memory>
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 
 #include "geopm/Helper.hpp"
+#include "geopm/IOGroup.hpp"
 #include "Tracer.hpp"
 #include "geopm/PlatformIO.hpp"
 #include "geopm/PlatformTopo.hpp"
@@ -25,6 +27,7 @@ using geopm::TracerImp;
 using geopm::PlatformIO;
 using geopm::PlatformTopo;
 using testing::_;
+using testing::Invoke;
 using testing::Return;
 using testing::HasSubstr;
 
@@ -204,6 +207,186 @@ TEST_F(TracerTest, region_entry_exit)
     check_trace(expected, result);
 }
 
+// Returns a map from column name to value for each row of the trace
+static std::vector<std::map<std::string, std::string> > read_trace_rows(const std::string &path)
+{
+    std::vector<std::map<std::string, std::string> > result;
+    std::vector<std::string> names;
+    for (const auto &line : geopm::string_split(geopm::read_file(path), "\n")) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::vector<std::string> fields = geopm::string_split(line, "|");
+        if (names.empty()) {
+            names = fields;
+            continue;
+        }
+        EXPECT_EQ(names.size(), fields.size());
+        std::map<std::string, std::string> row;
+        for (size_t idx = 0; idx != names.size() && idx != fields.size(); ++idx) {
+            row[names[idx]] = fields[idx];
+        }
+        result.push_back(row);
+    }
+    return result;
+}
+
+TEST_F(TracerTest, summary)
+{
+    const std::vector<std::pair<std::string, int> > env_signals = {
+        {"EXTRA", geopm_domain_e::GEOPM_DOMAIN_BOARD},
+        {"EXTRA_SPECIAL", geopm_domain_e::GEOPM_DOMAIN_CPU}
+    };
+    // Three updates per row, and a row when the epoch count changes
+    m_tracer = geopm::make_unique<TracerImp>(m_start_time, m_path, m_hostname, true,
+                                             m_platform_io, m_platform_topo, env_signals,
+                                             "none", "3,region");
+    EXPECT_CALL(m_platform_io, signal_behavior(_))
+        .WillRepeatedly(Return(geopm::IOGroup::M_SIGNAL_BEHAVIOR_VARIABLE));
+    for (const auto &name : {"TIME", "EPOCH_COUNT", "CPU_ENERGY"}) {
+        EXPECT_CALL(m_platform_io, signal_behavior(name))
+            .WillRepeatedly(Return(geopm::IOGroup::M_SIGNAL_BEHAVIOR_MONOTONE));
+    }
+    for (const auto &name : {"REGION_HASH", "REGION_HINT"}) {
+        EXPECT_CALL(m_platform_io, signal_behavior(name))
+            .WillRepeatedly(Return(geopm::IOGroup::M_SIGNAL_BEHAVIOR_LABEL));
+    }
+    std::vector<double> time {1, 2, 3, 4, 5};
+    std::vector<double> epoch {0, 0, 0, 0, 1};
+    std::vector<double> power {10, 20, 60, 5, 7};
+    std::vector<double> energy {100, 110, 130, 135, 140};
+    int update_idx = 0;
+    EXPECT_CALL(m_platform_io, sample(_))
+        .WillRepeatedly(Invoke([&](int sample_idx) {
+            switch (sample_idx) {
+                case 0: return time[update_idx];
+                case 1: return epoch[update_idx];
+                case 2: return (double)0x123;
+                case 5: return energy[update_idx];
+                case 7: return power[update_idx];
+                default: return 1.0;
+            }
+        }));
+
+    m_tracer->columns({"col1"}, {});
+    for (update_idx = 0; update_idx != (int)time.size(); ++update_idx) {
+        m_tracer->update({(double)update_idx + 1});
+    }
+    m_tracer->flush();
+
+    auto rows = read_trace_rows(m_file_path);
+    ASSERT_EQ(3ULL, rows.size());
+    EXPECT_EQ(0ULL, rows[0].count("REGION_HASH_MIN"));
+    EXPECT_EQ(0ULL, rows[0].count("CPU_ENERGY_MEAN"));
+
+    EXPECT_EQ("3", rows[0]["TIME"]);
+    EXPECT_EQ("2", rows[0]["TIME_DELTA"]);
+    EXPECT_EQ("0", rows[0]["EPOCH_COUNT_DELTA"]);
+    EXPECT_EQ("0x00000123", rows[0]["REGION_HASH"]);
+    EXPECT_EQ("60", rows[0]["CPU_POWER"]);
+    EXPECT_EQ("10", rows[0]["CPU_POWER_MIN"]);
+    EXPECT_EQ("60", rows[0]["CPU_POWER_MAX"]);
+    EXPECT_EQ("30", rows[0]["CPU_POWER_MEAN"]);
+    EXPECT_EQ("30", rows[0]["CPU_ENERGY_DELTA"]);
+    EXPECT_EQ("2", rows[0]["col1_MEAN"]);
+    EXPECT_EQ("3", rows[0]["SAMPLE_COUNT"]);
+
+    // Ended early by the epoch count change
+    EXPECT_EQ("4", rows[1]["TIME"]);
+    EXPECT_EQ("1", rows[1]["TIME_DELTA"]);
+    EXPECT_EQ("5", rows[1]["CPU_POWER_MEAN"]);
+    EXPECT_EQ("5", rows[1]["CPU_ENERGY_DELTA"]);
+    EXPECT_EQ("1", rows[1]["SAMPLE_COUNT"]);
+
+    // Partial window written by flush()
+    EXPECT_EQ("5", rows[2]["TIME"]);
+    EXPECT_EQ("1", rows[2]["EPOCH_COUNT"]);
+    EXPECT_EQ("1", rows[2]["EPOCH_COUNT_DELTA"]);
+    EXPECT_EQ("7", rows[2]["CPU_POWER_MAX"]);
+    EXPECT_EQ("5", rows[2]["CPU_ENERGY_DELTA"]);
+    EXPECT_EQ("1", rows[2]["SAMPLE_COUNT"]);
+}
+
+TEST_F(TracerTest, summary_nan_window)
+{
+    const std::vector<std::pair<std::string, int> > env_signals = {
+        {"EXTRA", geopm_domain_e::GEOPM_DOMAIN_BOARD},
+        {"EXTRA_SPECIAL", geopm_domain_e::GEOPM_DOMAIN_CPU}
+    };
+    m_tracer = geopm::make_unique<TracerImp>(m_start_time, m_path, m_hostname, true,
+                                             m_platform_io, m_platform_topo, env_signals,
+                                             "none", "2");
+    EXPECT_CALL(m_platform_io, signal_behavior(_))
+        .WillRepeatedly(Return(geopm::IOGroup::M_SIGNAL_BEHAVIOR_VARIABLE));
+    EXPECT_CALL(m_platform_io, signal_behavior("TIME"))
+        .WillRepeatedly(Return(geopm::IOGroup::M_SIGNAL_BEHAVIOR_MONOTONE));
+    // CPU_POWER is only valid in the first window
+    std::vector<double> time {1, 2, 3, 4};
+    std::vector<double> power {10, 20, NAN, NAN};
+    int update_idx = 0;
+    EXPECT_CALL(m_platform_io, sample(_))
+        .WillRepeatedly(Invoke([&](int sample_idx) {
+            switch (sample_idx) {
+                case 0: return time[update_idx];
+                case 7: return power[update_idx];
+                default: return 1.0;
+            }
+        }));
+    m_tracer->columns({}, {});
+    for (update_idx = 0; update_idx != (int)time.size(); ++update_idx) {
+        m_tracer->update({});
+    }
+    m_tracer->flush();
+
+    auto rows = read_trace_rows(m_file_path);
+    ASSERT_EQ(2ULL, rows.size());
+    EXPECT_EQ("10", rows[0]["CPU_POWER_MIN"]);
+    EXPECT_EQ("20", rows[0]["CPU_POWER_MAX"]);
+    EXPECT_EQ("15", rows[0]["CPU_POWER_MEAN"]);
+    // No statistics carried over from the previous window
+    EXPECT_EQ("4", rows[1]["TIME"]);
+    EXPECT_EQ("2", rows[1]["TIME_DELTA"]);
+    EXPECT_EQ("nan", rows[1]["CPU_POWER_MIN"]);
+    EXPECT_EQ("nan", rows[1]["CPU_POWER_MAX"]);
+    EXPECT_EQ("nan", rows[1]["CPU_POWER_MEAN"]);
+}
+
+TEST_F(TracerTest, summary_interval)
+{
+    const std::vector<std::pair<std::string, int> > env_signals = {
+        {"EXTRA", geopm_domain_e::GEOPM_DOMAIN_BOARD},
+        {"EXTRA_SPECIAL", geopm_domain_e::GEOPM_DOMAIN_CPU}
+    };
+    m_tracer = geopm::make_unique<TracerImp>(m_start_time, m_path, m_hostname, true,
+                                             m_platform_io, m_platform_topo, env_signals,
+                                             "none", "2.5s");
+    EXPECT_CALL(m_platform_io, signal_behavior(_))
+        .WillRepeatedly(Return(geopm::IOGroup::M_SIGNAL_BEHAVIOR_VARIABLE));
+    double time = 0.0;
+    EXPECT_CALL(m_platform_io, sample(_))
+        .WillRepeatedly(Invoke([&](int sample_idx) {
+            return sample_idx == 0 ? time : 1.0;
+        }));
+    m_tracer->columns({}, {});
+    for (time = 1.0; time < 5.5; time += 1.0) {
+        m_tracer->update({});
+    }
+    m_tracer->flush();
+    auto rows = read_trace_rows(m_file_path);
+    ASSERT_EQ(2ULL, rows.size());
+    EXPECT_EQ("4", rows[0]["TIME"]);
+    EXPECT_EQ("4", rows[0]["SAMPLE_COUNT"]);
+    EXPECT_EQ("5", rows[1]["TIME"]);
+    EXPECT_EQ("1", rows[1]["SAMPLE_COUNT"]);
+
+    for (const auto &summary : {"0", "-3", "3x", "s", "0s", "region,fast"}) {
+        GEOPM_EXPECT_THROW_MESSAGE(TracerImp(m_start_time, m_path, m_hostname, true,
+                                             m_platform_io, m_platform_topo, env_signals,
+                                             "none", summary),
+                                   GEOPM_ERROR_INVALID, "invalid trace summary");
+    }
+}
+
 /// @todo This is shared with ReporterTest; can be put in common file
 void check_trace(std::istream &expected, std::istream &result)
 {
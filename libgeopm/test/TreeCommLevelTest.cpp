@@ -15,9 +15,12 @@
 
 using geopm::TreeCommLevel;
 using geopm::TreeCommLevelImp;
+using geopm::P2PTreeCommLevel;
 using testing::Return;
 using testing::Invoke;
 using testing::SetArgPointee;
+using testing::Mock;
+using testing::InSequence;
 using testing::_;
 
 class TreeCommLevelTest : public ::testing::Test
@@ -324,3 +327,249 @@ TEST_F(TreeCommLevelTest, receive_down_incomplete)
         EXPECT_TRUE(std::isnan(pp));
     }
 }
+
+TEST_F(TreeCommLevelTest, p2p_send_up_change)
+{
+    int max_stale = 2;
+    size_t msg_size = sizeof(double) * m_num_up;
+    auto comm = std::make_shared<MockComm>();
+    EXPECT_CALL(*comm, num_rank()).WillOnce(Return(m_num_rank));
+    EXPECT_CALL(*comm, rank()).WillOnce(Return(1));
+    EXPECT_CALL(*comm, irecv(_, sizeof(double) * m_num_down, 0, _))
+        .WillOnce(Return(100));
+    auto level = std::make_shared<P2PTreeCommLevel>(comm, m_num_up, m_num_down, max_stale);
+    Mock::VerifyAndClearExpectations(comm.get());
+
+    // first sample is always sent
+    std::vector<double> sample {5.5, 6.6, 7.7};
+    EXPECT_CALL(*comm, isend(_, msg_size, 0, _)).WillOnce(Return(1));
+    level->send_up(sample);
+    EXPECT_EQ(msg_size, level->overhead_send());
+    Mock::VerifyAndClearExpectations(comm.get());
+
+    // unchanged sample is skipped until it reaches the staleness bound
+    EXPECT_CALL(*comm, isend(_, _, _, _)).Times(0);
+    EXPECT_CALL(*comm, request_test(_)).Times(0);
+    for (int skip = 0; skip < max_stale; ++skip) {
+        level->send_up(sample);
+    }
+    Mock::VerifyAndClearExpectations(comm.get());
+    EXPECT_CALL(*comm, request_test(1)).WillOnce(Return(true));
+    EXPECT_CALL(*comm, isend(_, msg_size, 0, _)).WillOnce(Return(2));
+    level->send_up(sample);
+    EXPECT_EQ(2 * msg_size, level->overhead_send());
+    Mock::VerifyAndClearExpectations(comm.get());
+
+    // changed sample is deferred while the previous send is in flight
+    sample[1] = 8.8;
+    EXPECT_CALL(*comm, request_test(2))
+        .WillOnce(Return(false))
+        .WillOnce(Return(true));
+    EXPECT_CALL(*comm, isend(_, msg_size, 0, _))
+        .WillOnce(Invoke([sample] (const void *send_buf, size_t send_size, int rank, int tag)
+                         {
+                             std::vector<double> sent((double *)send_buf,
+                                                      (double *)send_buf + sample.size());
+                             EXPECT_EQ(sample, sent);
+                             return 3;
+                         }));
+    level->send_up(sample);
+    EXPECT_EQ(2 * msg_size, level->overhead_send());
+    level->send_up(sample);
+    EXPECT_EQ(3 * msg_size, level->overhead_send());
+    Mock::VerifyAndClearExpectations(comm.get());
+
+    // errors
+    sample = {8.8, 9.9};
+    GEOPM_EXPECT_THROW_MESSAGE(level->send_up(sample),
+                               GEOPM_ERROR_INVALID, "sample vector is not sized correctly");
+
+    // The pending send completes before its buffer is released and
+    // the posted receive is cancelled
+    {
+        InSequence sequence;
+        EXPECT_CALL(*comm, barrier());
+        EXPECT_CALL(*comm, request_test(100)).WillOnce(Return(false));
+        EXPECT_CALL(*comm, request_test(3))
+            .WillOnce(Return(false))
+            .WillOnce(Return(true));
+        EXPECT_CALL(*comm, barrier());
+        EXPECT_CALL(*comm, request_cancel(100));
+    }
+    EXPECT_CALL(*comm, request_cancel(3)).Times(0);
+    level.reset();
+}
+
+TEST_F(TreeCommLevelTest, p2p_receive_up)
+{
+    size_t msg_size = sizeof(double) * m_num_up;
+    auto comm = std::make_shared<MockComm>();
+    std::vector<double *> recv_buf(m_num_rank, nullptr);
+    EXPECT_CALL(*comm, num_rank()).WillOnce(Return(m_num_rank));
+    EXPECT_CALL(*comm, rank()).WillOnce(Return(0));
+    // Request handle for each receive is 10 * rank + generation
+    std::vector<size_t> generation(m_num_rank, 0);
+    EXPECT_CALL(*comm, irecv(_, msg_size, _, _))
+        .Times(m_num_rank - 1)
+        .WillRepeatedly(Invoke([&recv_buf, &generation] (void *buf, size_t size, int rank, int tag)
+                               {
+                                   recv_buf[rank] = (double *)buf;
+                                   return 10 * rank + generation[rank];
+                               }));
+    auto level = std::make_shared<P2PTreeCommLevel>(comm, m_num_up, m_num_down, 0);
+    Mock::VerifyAndClearExpectations(comm.get());
+
+    std::vector<std::vector<double> > sample {{44.4, 33.3, 22.2},
+                                              {41.1, 31.1, 21.1},
+                                              {46.6, 36.6, 26.6},
+                                              {45.5, 35.5, 25.5}};
+    std::vector<std::vector<double> > sample_out(m_num_rank, std::vector<double>(m_num_up, NAN));
+    level->send_up(sample[0]);
+
+    // ranks 1 and 2 have sent, rank 3 has not
+    EXPECT_CALL(*comm, request_test(_))
+        .WillRepeatedly(Invoke([&generation] (size_t request_id)
+                               {
+                                   return request_id == 10 || request_id == 20;
+                               }));
+    EXPECT_CALL(*comm, irecv(_, msg_size, _, _))
+        .Times(2)
+        .WillRepeatedly(Invoke([&recv_buf, &generation] (void *buf, size_t size, int rank, int tag)
+                               {
+                                   ++generation[rank];
+                                   recv_buf[rank] = (double *)buf;
+                                   return 10 * rank + generation[rank];
+                               }));
+    for (int rank = 1; rank < 3; ++rank) {
+        std::copy(sample[rank].begin(), sample[rank].end(), recv_buf[rank]);
+    }
+    EXPECT_FALSE(level->receive_up(sample_out));
+    for (const auto &ss : sample_out) {
+        for (auto tt : ss) {
+            EXPECT_TRUE(std::isnan(tt));
+        }
+    }
+    Mock::VerifyAndClearExpectations(comm.get());
+
+    // rank 3 sends, ranks 1 and 2 are cached from the previous call
+    EXPECT_CALL(*comm, request_test(_))
+        .WillRepeatedly(Invoke([] (size_t request_id)
+                               {
+                                   return request_id == 30;
+                               }));
+    EXPECT_CALL(*comm, irecv(_, msg_size, 3, _))
+        .WillOnce(Return(31));
+    std::copy(sample[3].begin(), sample[3].end(), recv_buf[3]);
+    EXPECT_TRUE(level->receive_up(sample_out));
+    EXPECT_EQ(sample, sample_out);
+    Mock::VerifyAndClearExpectations(comm.get());
+
+    // nothing new arrives, the cached samples are still complete
+    EXPECT_CALL(*comm, request_test(_)).WillRepeatedly(Return(false));
+    sample_out.assign(m_num_rank, std::vector<double>(m_num_up, NAN));
+    EXPECT_TRUE(level->receive_up(sample_out));
+    EXPECT_EQ(sample, sample_out);
+
+    // errors
+    sample_out = {{1.0, 2.0, 3.0}};
+    GEOPM_EXPECT_THROW_MESSAGE(level->receive_up(sample_out),
+                               GEOPM_ERROR_INVALID, "sample vector is not sized correctly");
+    Mock::VerifyAndClearExpectations(comm.get());
+
+    // A receive that completes during shutdown is posted again so
+    // that a send still in flight can be matched
+    EXPECT_CALL(*comm, barrier()).Times(2);
+    EXPECT_CALL(*comm, request_test(_))
+        .WillRepeatedly(Invoke([] (size_t request_id)
+                               {
+                                   return request_id == 21;
+                               }));
+    EXPECT_CALL(*comm, irecv(_, msg_size, 2, _))
+        .WillOnce(Return(22));
+    EXPECT_CALL(*comm, request_cancel(11));
+    EXPECT_CALL(*comm, request_cancel(22));
+    EXPECT_CALL(*comm, request_cancel(31));
+    level.reset();
+}
+
+TEST_F(TreeCommLevelTest, p2p_send_receive_down)
+{
+    size_t msg_size = sizeof(double) * m_num_down;
+    auto comm_0 = std::make_shared<MockComm>();
+    auto comm_1 = std::make_shared<MockComm>();
+    EXPECT_CALL(*comm_0, num_rank()).WillOnce(Return(m_num_rank));
+    EXPECT_CALL(*comm_0, rank()).WillOnce(Return(0));
+    EXPECT_CALL(*comm_0, irecv(_, _, _, _))
+        .Times(m_num_rank - 1)
+        .WillRepeatedly(Return(0));
+    EXPECT_CALL(*comm_1, num_rank()).WillOnce(Return(m_num_rank));
+    EXPECT_CALL(*comm_1, rank()).WillOnce(Return(1));
+    double *policy_buf = nullptr;
+    EXPECT_CALL(*comm_1, irecv(_, msg_size, 0, _))
+        .WillOnce(Invoke([&policy_buf] (void *buf, size_t size, int rank, int tag)
+                         {
+                             policy_buf = (double *)buf;
+                             return 200;
+                         }));
+    auto level_0 = std::make_shared<P2PTreeCommLevel>(comm_0, m_num_up, m_num_down, 1);
+    auto level_1 = std::make_shared<P2PTreeCommLevel>(comm_1, m_num_up, m_num_down, 1);
+    Mock::VerifyAndClearExpectations(comm_0.get());
+    Mock::VerifyAndClearExpectations(comm_1.get());
+
+    // nothing received yet
+    std::vector<double> policy_out;
+    EXPECT_CALL(*comm_1, request_test(200)).WillOnce(Return(false));
+    EXPECT_FALSE(level_1->receive_down(policy_out));
+    EXPECT_FALSE(level_0->receive_down(policy_out));
+
+    // first policy goes to every child
+    std::vector<std::vector<double> > policy {{2.2, 3.3}, {2.9, 3.9}, {2.1, 3.1}, {2.0, 3.0}};
+    EXPECT_CALL(*comm_0, isend(_, msg_size, _, _))
+        .Times(m_num_rank - 1)
+        .WillRepeatedly(Invoke([] (const void *send_buf, size_t send_size, int rank, int tag)
+                               {
+                                   return 10 * rank;
+                               }));
+    level_0->send_down(policy);
+    EXPECT_EQ(msg_size * (m_num_rank - 1), level_0->overhead_send());
+    Mock::VerifyAndClearExpectations(comm_0.get());
+
+    // only the changed policy is sent, the others are within the staleness bound
+    policy[2][0] = 2.5;
+    EXPECT_CALL(*comm_0, request_test(20)).WillOnce(Return(true));
+    EXPECT_CALL(*comm_0, isend(_, msg_size, 2, _)).WillOnce(Return(21));
+    level_0->send_down(policy);
+    EXPECT_EQ(msg_size * m_num_rank, level_0->overhead_send());
+    Mock::VerifyAndClearExpectations(comm_0.get());
+
+    EXPECT_TRUE(level_0->receive_down(policy_out));
+    EXPECT_EQ(policy[0], policy_out);
+
+    // deliver to rank 1
+    std::copy(policy[1].begin(), policy[1].end(), policy_buf);
+    EXPECT_CALL(*comm_1, request_test(200)).WillOnce(Return(true));
+    EXPECT_CALL(*comm_1, irecv(_, msg_size, 0, _)).WillOnce(Return(201));
+    EXPECT_CALL(*comm_1, request_test(201)).WillOnce(Return(false));
+    EXPECT_TRUE(level_1->receive_down(policy_out));
+    EXPECT_EQ(policy[1], policy_out);
+    Mock::VerifyAndClearExpectations(comm_1.get());
+
+    // errors
+    policy = {{7.7, 6.6}, {5.5, 4.4}};
+    GEOPM_EXPECT_THROW_MESSAGE(level_0->send_down(policy),
+                               GEOPM_ERROR_INVALID, "policy vector is not sized correctly");
+
+    // Only the posted receives are cancelled: the sends of the
+    // policy complete first
+    EXPECT_CALL(*comm_0, barrier()).Times(2);
+    EXPECT_CALL(*comm_0, request_test(0)).WillRepeatedly(Return(false));
+    for (size_t request_id : {10, 21, 30}) {
+        EXPECT_CALL(*comm_0, request_test(request_id)).WillOnce(Return(true));
+    }
+    EXPECT_CALL(*comm_0, request_cancel(0)).Times(m_num_rank - 1);
+    EXPECT_CALL(*comm_1, barrier()).Times(2);
+    EXPECT_CALL(*comm_1, request_test(201)).WillOnce(Return(false));
+    EXPECT_CALL(*comm_1, request_cancel(201));
+    level_0.reset();
+    level_1.reset();
+}
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <cmath>
+
+#include "WaiterIOGroup.hpp"
+#include "WaiterLateness.hpp"
+#include "geopm/Exception.hpp"
+#include "geopm/IOGroup.hpp"
+#include "geopm_topo.h"
+#include "geopm_test.hpp"
+
+using geopm::IOGroup;
+using geopm::WaiterIOGroup;
+using geopm::WaiterLateness;
+using testing::Contains;
+
+class WaiterIOGroupTest : public ::testing::Test
+{
+    protected:
+        void SetUp(void);
+        WaiterLateness m_lateness;
+        std::shared_ptr<WaiterIOGroup> m_group;
+};
+
+void WaiterIOGroupTest::SetUp()
+{
+    m_group = std::make_shared<WaiterIOGroup>(m_lateness);
+}
+
+TEST_F(WaiterIOGroupTest, valid_signals)
+{
+    std::vector<std::string> expected_names = {
+        "WAITER::WAIT_COUNT",
+        "WAITER::LATENESS",
+        "WAITER::LATENESS_MEAN",
+        "WAITER::LATENESS_MAX",
+        "WAITER::LATENESS_COUNT_LT_10US",
+        "WAITER::LATENESS_COUNT_LT_100US",
+        "WAITER::LATENESS_COUNT_LT_1MS",
+        "WAITER::LATENESS_COUNT_LT_10MS",
+        "WAITER::LATENESS_COUNT_GE_10MS",
+    };
+    EXPECT_EQ(expected_names.size(), m_group->signal_names().size());
+    for (const auto &name : expected_names) {
+        EXPECT_THAT(m_group->signal_names(), Contains(name));
+        EXPECT_TRUE(m_group->is_valid_signal(name));
+        EXPECT_EQ(GEOPM_DOMAIN_BOARD, m_group->signal_domain_type(name));
+        EXPECT_NE("", m_group->signal_description(name));
+    }
+    EXPECT_EQ(IOGroup::M_SIGNAL_BEHAVIOR_MONOTONE,
+              m_group->signal_behavior("WAITER::WAIT_COUNT"));
+    EXPECT_EQ(IOGroup::M_SIGNAL_BEHAVIOR_VARIABLE,
+              m_group->signal_behavior("WAITER::LATENESS"));
+    EXPECT_EQ("1", m_group->format_function("WAITER::WAIT_COUNT")(1.0));
+    EXPECT_FALSE(m_group->is_valid_signal("WAITER::BAD"));
+    EXPECT_EQ(GEOPM_DOMAIN_INVALID, m_group->signal_domain_type("WAITER::BAD"));
+    EXPECT_TRUE(m_group->control_names().empty());
+    EXPECT_EQ("WAITER", m_group->name());
+}
+
+TEST_F(WaiterIOGroupTest, push_signal)
+{
+    GEOPM_EXPECT_THROW_MESSAGE(m_group->push_signal("WAITER::BAD", GEOPM_DOMAIN_BOARD, 0),
+                               GEOPM_ERROR_INVALID, "not valid for WaiterIOGroup");
+    GEOPM_EXPECT_THROW_MESSAGE(m_group->push_signal("WAITER::WAIT_COUNT", GEOPM_DOMAIN_CPU, 0),
+                               GEOPM_ERROR_INVALID, "only defined for board");
+    GEOPM_EXPECT_THROW_MESSAGE(m_group->push_signal("WAITER::WAIT_COUNT", GEOPM_DOMAIN_BOARD, 1),
+                               GEOPM_ERROR_INVALID, "only defined for board");
+    int count_idx = m_group->push_signal("WAITER::WAIT_COUNT", GEOPM_DOMAIN_BOARD, 0);
+    EXPECT_EQ(count_idx, m_group->push_signal("WAITER::WAIT_COUNT", GEOPM_DOMAIN_BOARD, 0));
+    GEOPM_EXPECT_THROW_MESSAGE(m_group->sample(count_idx),
+                               GEOPM_ERROR_INVALID, "signal has not been read");
+    m_group->read_batch();
+    GEOPM_EXPECT_THROW_MESSAGE(m_group->push_signal("WAITER::LATENESS", GEOPM_DOMAIN_BOARD, 0),
+                               GEOPM_ERROR_INVALID, "cannot push signal after call to read_batch");
+    GEOPM_EXPECT_THROW_MESSAGE(m_group->sample(count_idx + 1),
+                               GEOPM_ERROR_INVALID, "batch_idx out of range");
+}
+
+TEST_F(WaiterIOGroupTest, sample)
+{
+    int count_idx = m_group->push_signal("WAITER::WAIT_COUNT", GEOPM_DOMAIN_BOARD, 0);
+    int last_idx = m_group->push_signal("WAITER::LATENESS", GEOPM_DOMAIN_BOARD, 0);
+    int mean_idx = m_group->push_signal("WAITER::LATENESS_MEAN", GEOPM_DOMAIN_BOARD, 0);
+    int max_idx = m_group->push_signal("WAITER::LATENESS_MAX", GEOPM_DOMAIN_BOARD, 0);
+    int fast_idx = m_group->push_signal("WAITER::LATENESS_COUNT_LT_10US", GEOPM_DOMAIN_BOARD, 0);
+    int slow_idx = m_group->push_signal("WAITER::LATENESS_COUNT_GE_10MS", GEOPM_DOMAIN_BOARD, 0);
+    m_group->read_batch();
+    EXPECT_EQ(0.0, m_group->sample(count_idx));
+    EXPECT_TRUE(std::isnan(m_group->sample(last_idx)));
+
+    m_lateness.update(1e-6);
+    m_lateness.update(3e-6);
+    m_lateness.update(20e-3);
+    // Values change only when the batch is read
+    EXPECT_EQ(0.0, m_group->sample(count_idx));
+    m_group->read_batch();
+    EXPECT_EQ(3.0, m_group->sample(count_idx));
+    EXPECT_EQ(20e-3, m_group->sample(last_idx));
+    EXPECT_DOUBLE_EQ((1e-6 + 3e-6 + 20e-3) / 3, m_group->sample(mean_idx));
+    EXPECT_EQ(20e-3, m_group->sample(max_idx));
+    EXPECT_EQ(2.0, m_group->sample(fast_idx));
+    EXPECT_EQ(1.0, m_group->sample(slow_idx));
+
+    m_lateness.update(1e-6);
+    EXPECT_EQ(4.0, m_group->read_signal("WAITER::WAIT_COUNT", GEOPM_DOMAIN_BOARD, 0));
+    EXPECT_EQ(3.0, m_group->read_signal("WAITER::LATENESS_COUNT_LT_10US", GEOPM_DOMAIN_BOARD, 0));
+}
+
+TEST_F(WaiterIOGroupTest, controls)
+{
+    EXPECT_FALSE(m_group->is_valid_control("WAITER::WAIT_COUNT"));
+    EXPECT_EQ(GEOPM_DOMAIN_INVALID, m_group->control_domain_type("WAITER::WAIT_COUNT"));
+    EXPECT_THROW(m_group->push_control("WAITER::WAIT_COUNT", GEOPM_DOMAIN_BOARD, 0),
+                 geopm::Exception);
+    EXPECT_THROW(m_group->adjust(0, 1.0), geopm::Exception);
+    EXPECT_THROW(m_group->write_control("WAITER::WAIT_COUNT", GEOPM_DOMAIN_BOARD, 0, 1.0),
+                 geopm::Exception);
+    EXPECT_THROW(m_group->control_description("WAITER::WAIT_COUNT"), geopm::Exception);
+}
@@ -3,22 +3,58 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <cmath>
 #include <memory>
+#include <thread>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "geopm_test.hpp"
 
 #include "geopm/Waiter.hpp"
+#include "LatencyHistogram.hpp"
+#include "WaiterLateness.hpp"
 
+using geopm::LatencyHistogram;
 using geopm::Waiter;
+using geopm::WaiterLateness;
 
 class WaiterTest : public ::testing::Test
 {
     protected:
+        void check_wait(const std::string &strategy);
         double m_period = 0.1;
         double m_epsilon = 0.01;
 };
 
+void WaiterTest::check_wait(const std::string &strategy)
+{
+    geopm_time_s time_0;
+    geopm_time_s time_1;
+    std::shared_ptr<Waiter> waiter = Waiter::make_unique(m_period, strategy);
+    WaiterLateness &lateness = WaiterLateness::waiter_lateness();
+    lateness.reset();
+    timespec delay = {0,100000000};
+    nanosleep(&delay, nullptr);
+    int num_wait = 10;
+    for (int count = 0; count < num_wait; ++count) {
+        geopm_time(&time_0);
+        waiter->wait();
+        geopm_time(&time_1);
+        EXPECT_NEAR(m_period, geopm_time_diff(&time_0, &time_1), m_epsilon);
+    }
+    WaiterLateness::m_summary_s summary = lateness.summary();
+    EXPECT_EQ((uint64_t)num_wait, summary.count);
+    EXPECT_LE(0.0, summary.mean);
+    EXPECT_LE(summary.mean, summary.max);
+    EXPECT_LT(summary.max, m_epsilon);
+    uint64_t histogram_total = 0;
+    for (auto count : summary.histogram) {
+        histogram_total += count;
+    }
+    EXPECT_EQ((uint64_t)num_wait, histogram_total);
+}
+
 
 TEST_F(WaiterTest, invalid_strategy_name)
 {
@@ -32,6 +68,10 @@ TEST_F(WaiterTest, make_unique)
     ASSERT_EQ(1.0, waiter->period());
     waiter = Waiter::make_unique(2.0, "sleep");
     ASSERT_EQ(2.0, waiter->period());
+    waiter = Waiter::make_unique(3.0, "timerfd");
+    ASSERT_EQ(3.0, waiter->period());
+    waiter = Waiter::make_unique(4.0, "hybrid");
+    ASSERT_EQ(4.0, waiter->period());
 }
 
 TEST_F(WaiterTest, reset)
@@ -62,3 +102,75 @@ TEST_F(WaiterTest, wait)
         EXPECT_NEAR(m_period, geopm_time_diff(&time_0, &time_1), m_epsilon);
     }
 }
+
+TEST_F(WaiterTest, wait_timerfd)
+{
+    check_wait("timerfd");
+}
+
+TEST_F(WaiterTest, wait_hybrid)
+{
+    check_wait("hybrid");
+}
+
+TEST_F(WaiterTest, reset_timerfd)
+{
+    std::shared_ptr<Waiter> waiter = Waiter::make_unique(m_period, "timerfd");
+    geopm_time_s time_0;
+    geopm_time_s time_1;
+    timespec delay = {0,100000000};
+    nanosleep(&delay, nullptr);
+    // A missed deadline returns without blocking
+    waiter->wait();
+    geopm_time(&time_0);
+    waiter->reset(2 * m_period);
+    EXPECT_EQ(2 * m_period, waiter->period());
+    waiter->wait();
+    geopm_time(&time_1);
+    EXPECT_NEAR(2 * m_period, geopm_time_diff(&time_0, &time_1), m_epsilon);
+}
+
+TEST(WaiterLatenessTest, histogram)
+{
+    WaiterLateness lateness;
+    WaiterLateness::m_summary_s summary = lateness.summary();
+    EXPECT_EQ(0ULL, summary.count);
+    EXPECT_TRUE(std::isnan(summary.mean));
+    lateness.update(-1e-6);
+    lateness.update(5e-6);
+    lateness.update(10e-6);
+    lateness.update(2e-3);
+    lateness.update(1.0);
+    summary = lateness.summary();
+    EXPECT_EQ(5ULL, summary.count);
+    EXPECT_EQ(1.0, summary.last);
+    EXPECT_EQ(1.0, summary.max);
+    EXPECT_DOUBLE_EQ((5e-6 + 10e-6 + 2e-3 + 1.0) / 5, summary.mean);
+    std::array<uint64_t, LatencyHistogram::M_NUM_BIN> expect {2, 1, 0, 1, 1};
+    EXPECT_EQ(expect, summary.histogram);
+    lateness.reset();
+    EXPECT_EQ(0ULL, lateness.summary().count);
+}
+
+TEST(WaiterLatenessTest, concurrent_update)
+{
+    WaiterLateness lateness;
+    int num_thread = 4;
+    int num_update = 1000;
+    std::vector<std::thread> threads;
+    for (int thread_idx = 0; thread_idx < num_thread; ++thread_idx) {
+        threads.emplace_back([&lateness, num_update]() {
+            for (int count = 0; count < num_update; ++count) {
+                lateness.update(1e-3);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    WaiterLateness::m_summary_s summary = lateness.summary();
+    EXPECT_EQ((uint64_t)(num_thread * num_update), summary.count);
+    EXPECT_DOUBLE_EQ(1e-3, summary.max);
+    EXPECT_NEAR(1e-3, summary.mean, 1e-12);
+    EXPECT_EQ((uint64_t)(num_thread * num_update), summary.histogram[LatencyHistogram::bin(1e-3)]);
+}
@@ -0,0 +1,28 @@
+#  Copyright (c) 2015 - 2024 Intel Corporation
+#  SPDX-License-Identifier: BSD-3-Clause
+#
+
+# Benchmarks are built with "make checkprogs" but are not run by
+# "make check": timing results are only meaningful on an idle system.
+check_PROGRAMS += benchmark/hot_path_benchmark \
+                  benchmark/msr_startup_benchmark \
+                  benchmark/pio_startup_benchmark \
+                  benchmark/topo_push_benchmark \
+                  # end
+
+benchmark_hot_path_benchmark_SOURCES = benchmark/benchmark_case.hpp \
+                                      benchmark/hot_path_benchmark.cpp \
+                                      # end
+benchmark_hot_path_benchmark_LDADD = libgeopmd.la
+benchmark_msr_startup_benchmark_SOURCES = benchmark/benchmark_case.hpp \
+                                         benchmark/msr_startup_benchmark.cpp \
+                                         # end
+benchmark_msr_startup_benchmark_LDADD = libgeopmd.la
+benchmark_pio_startup_benchmark_SOURCES = benchmark/benchmark_case.hpp \
+                                         benchmark/pio_startup_benchmark.cpp \
+                                         # end
+benchmark_pio_startup_benchmark_LDADD = libgeopmd.la
+benchmark_topo_push_benchmark_SOURCES = benchmark/benchmark_case.hpp \
+                                       benchmark/topo_push_benchmark.cpp \
+                                       # end
+benchmark_topo_push_benchmark_LDADD = libgeopmd.la
@@ -0,0 +1,450 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/// Measures the cost per operation of the code that runs on every
+/// sample of the control loop: PlatformIO batch operations with
+/// stand-in IOGroups, MSRIO batch assembly and file IO, IOUring
+/// submission, sysfs value parsing, combined and derivative signals,
+/// the aggregation functions, CircularBuffer and the SharedMemory
+/// lock, e.g. "hot_path_benchmark 1000 8".  MSR and sysfs files are
+/// emulated with regular files in a temporary directory, so the
+/// results include the kernel cost of file IO but not the cost of
+/// the drivers.  Results are printed in the CSV format of
+/// benchmark_case.hpp.
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "geopm/Agg.hpp"
+#include "geopm/CircularBuffer.hpp"
+#include "geopm/Helper.hpp"
+#include "geopm/IOGroup.hpp"
+#include "geopm/PlatformTopo.hpp"
+#include "geopm/SharedMemory.hpp"
+#include "geopm/SharedMemoryScopedLock.hpp"
+#include "geopm_time.h"
+#include "geopm_topo.h"
+#include "CombinedControl.hpp"
+#include "CombinedSignal.hpp"
+#include "CpufreqSysfsDriver.hpp"
+#include "DerivativeSignal.hpp"
+#include "IOUring.hpp"
+#include "MSRIOImp.hpp"
+#include "MSRPath.hpp"
+#include "PlatformIOImp.hpp"
+#include "Signal.hpp"
+#include "SysfsIOGroup.hpp"
+#include "benchmark_case.hpp"
+
+using geopm::Agg;
+using geopm::CircularBuffer;
+using geopm::IOGroup;
+using geopm::IOUring;
+using geopm::MSRIOImp;
+using geopm::MSRPath;
+using geopm::PlatformIOImp;
+using geopm::PlatformTopo;
+using geopm::SharedMemory;
+
+// Provides NUM_SIGNAL signals and controls in the CPU domain; samples
+// are a running count so that aggregation is not trivially constant.
+class BenchmarkIOGroup : public IOGroup
+{
+    public:
+        BenchmarkIOGroup(int num_signal)
+        {
+            for (int sig = 0; sig < num_signal; ++sig) {
+                m_signal_names.insert("BENCHMARK::SIGNAL_" + std::to_string(sig));
+                m_control_names.insert("BENCHMARK::CONTROL_" + std::to_string(sig));
+            }
+        }
+        std::set<std::string> signal_names(void) const override { return m_signal_names; }
+        std::set<std::string> control_names(void) const override { return m_control_names; }
+        bool is_valid_signal(const std::string &signal_name) const override
+        {
+            return m_signal_names.count(signal_name) != 0;
+        }
+        bool is_valid_control(const std::string &control_name) const override
+        {
+            return m_control_names.count(control_name) != 0;
+        }
+        int signal_domain_type(const std::string &signal_name) const override
+        {
+            return is_valid_signal(signal_name) ? GEOPM_DOMAIN_CPU : GEOPM_DOMAIN_INVALID;
+        }
+        int control_domain_type(const std::string &control_name) const override
+        {
+            return is_valid_control(control_name) ? GEOPM_DOMAIN_CPU : GEOPM_DOMAIN_INVALID;
+        }
+        int push_signal(const std::string &signal_name, int domain_type, int domain_idx) override
+        {
+            m_sample.push_back(0.0);
+            return m_sample.size() - 1;
+        }
+        int push_control(const std::string &control_name, int domain_type, int domain_idx) override
+        {
+            m_setting.push_back(0.0);
+            return m_setting.size() - 1;
+        }
+        void read_batch(void) override
+        {
+            for (auto &sample : m_sample) {
+                sample += 1.0;
+            }
+        }
+        void write_batch(void) override
+        {
+            for (const auto &setting : m_setting) {
+                m_check_sum += setting;
+            }
+        }
+        double sample(int sample_idx) override { return m_sample[sample_idx]; }
+        void adjust(int control_idx, double setting) override { m_setting[control_idx] = setting; }
+        double read_signal(const std::string &signal_name, int domain_type, int domain_idx) override { return 0.0; }
+        void write_control(const std::string &control_name, int domain_type, int domain_idx, double setting) override {}
+        void save_control(void) override {}
+        void restore_control(void) override {}
+        std::function<double(const std::vector<double> &)> agg_function(const std::string &signal_name) const override
+        {
+            return Agg::average;
+        }
+        std::string signal_description(const std::string &signal_name) const override { return ""; }
+        std::string control_description(const std::string &control_name) const override { return ""; }
+        int signal_behavior(const std::string &signal_name) const override { return M_SIGNAL_BEHAVIOR_VARIABLE; }
+        void save_control(const std::string &save_path) override {}
+        void restore_control(const std::string &save_path) override {}
+        std::string name(void) const override { return "BENCHMARK"; }
+    private:
+        std::set<std::string> m_signal_names;
+        std::set<std::string> m_control_names;
+        std::vector<double> m_sample;
+        std::vector<double> m_setting;
+        double m_check_sum = 0.0;
+};
+
+// Signal that increases by one on every sample.
+class BenchmarkSignal : public geopm::Signal
+{
+    public:
+        void setup_batch(void) override {}
+        double sample(void) override { return m_value += 1.0; }
+        double read(void) const override { return m_value; }
+    private:
+        double m_value = 0.0;
+};
+
+// Uses one regular file per CPU in place of the msr driver.
+class BenchmarkMSRPath : public MSRPath
+{
+    public:
+        BenchmarkMSRPath(const std::string &dir)
+            : m_dir(dir)
+        {
+
+        }
+        std::string msr_path(int cpu_idx) const override
+        {
+            return m_dir + "/msr" + std::to_string(cpu_idx);
+        }
+        std::string msr_batch_path(void) const override
+        {
+            return "";
+        }
+    private:
+        std::string m_dir;
+};
+
+// Files and directories created, removed in reverse order at exit
+static std::vector<std::string> g_tmp_path;
+
+static void write_file(const std::string &path, const std::string &contents)
+{
+    std::ofstream stream(path);
+    stream << contents;
+    g_tmp_path.push_back(path);
+}
+
+static void make_dir(const std::string &path)
+{
+    if (mkdir(path.c_str(), S_IRWXU) == 0) {
+        g_tmp_path.push_back(path);
+    }
+}
+
+static void run_platform_io_cases(int num_iteration, int num_signal, const PlatformTopo &topo)
+{
+    int num_cpu = topo.num_domain(GEOPM_DOMAIN_CPU);
+    auto iogroup = std::make_shared<BenchmarkIOGroup>(num_signal);
+    PlatformIOImp pio({iogroup}, topo);
+    std::vector<int> signal_idx;
+    std::vector<int> control_idx;
+    for (const auto &signal_name : iogroup->signal_names()) {
+        for (int cpu_idx = 0; cpu_idx != num_cpu; ++cpu_idx) {
+            signal_idx.push_back(pio.push_signal(signal_name, GEOPM_DOMAIN_CPU, cpu_idx));
+        }
+        // Aggregated over all CPUs by PlatformIO
+        signal_idx.push_back(pio.push_signal(signal_name, GEOPM_DOMAIN_BOARD, 0));
+    }
+    for (const auto &control_name : iogroup->control_names()) {
+        for (int cpu_idx = 0; cpu_idx != num_cpu; ++cpu_idx) {
+            control_idx.push_back(pio.push_control(control_name, GEOPM_DOMAIN_CPU, cpu_idx));
+        }
+    }
+    double setting = 0.0;
+    run_case("pio_read_batch", num_iteration, signal_idx.size(), [&]() {
+        pio.read_batch();
+    });
+    run_case("pio_sample", num_iteration, signal_idx.size(), [&]() {
+        double check_sum = 0.0;
+        for (int idx : signal_idx) {
+            check_sum += pio.sample(idx);
+        }
+        setting = check_sum;
+    });
+    run_case("pio_adjust", num_iteration, control_idx.size(), [&]() {
+        setting += 1.0;
+        for (int idx : control_idx) {
+            pio.adjust(idx, setting);
+        }
+    });
+    run_case("pio_write_batch", num_iteration, control_idx.size(), [&]() {
+        pio.write_batch();
+    });
+}
+
+static void run_msrio_cases(int num_iteration, int num_cpu, const std::string &dir)
+{
+    const int num_msr = 16;
+    for (int cpu_idx = 0; cpu_idx != num_cpu; ++cpu_idx) {
+        write_file(dir + "/msr" + std::to_string(cpu_idx), std::string(num_msr * 8, '\0'));
+    }
+    auto path = std::make_shared<BenchmarkMSRPath>(dir);
+    int num_op = num_cpu * num_msr;
+    run_case("msrio_batch_assemble", num_iteration, 2 * num_op, [&]() {
+        MSRIOImp msrio(num_cpu, path, IOUring::make_unique(num_op), IOUring::make_unique(num_op));
+        for (int cpu_idx = 0; cpu_idx != num_cpu; ++cpu_idx) {
+            for (int msr_idx = 0; msr_idx != num_msr; ++msr_idx) {
+                msrio.add_read(cpu_idx, msr_idx * 8);
+                msrio.add_write(cpu_idx, msr_idx * 8);
+            }
+        }
+    });
+
+    MSRIOImp msrio(num_cpu, path, IOUring::make_unique(num_op), IOUring::make_unique(num_op));
+    std::vector<int> read_idx;
+    std::vector<int> write_idx;
+    for (int cpu_idx = 0; cpu_idx != num_cpu; ++cpu_idx) {
+        for (int msr_idx = 0; msr_idx != num_msr; ++msr_idx) {
+            read_idx.push_back(msrio.add_read(cpu_idx, msr_idx * 8));
+            write_idx.push_back(msrio.add_write(cpu_idx, msr_idx * 8));
+        }
+    }
+    uint64_t value = 0;
+    run_case("msrio_read_batch", num_iteration, num_op, [&]() {
+        msrio.read_batch();
+        for (int idx : read_idx) {
+            value += msrio.sample(idx);
+        }
+    });
+    run_case("msrio_write_batch", num_iteration, num_op, [&]() {
+        // Change the value every time so that no write is skipped.
+        ++value;
+        for (int idx : write_idx) {
+            msrio.adjust(idx, value, 0xFFFF);
+        }
+        msrio.write_batch();
+    });
+}
+
+static void run_iouring_cases(int num_iteration, int num_read, const std::string &dir)
+{
+    std::string path = dir + "/iouring";
+    write_file(path, std::string(4096, 'x'));
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1) {
+        std::cerr << "Warning: unable to open " << path << ", skipping IOUring cases" << std::endl;
+        return;
+    }
+    std::vector<char> buffer(num_read * 8);
+    std::vector<std::shared_ptr<int> > result(num_read);
+    for (auto &ret : result) {
+        ret = std::make_shared<int>(0);
+    }
+    auto batch = IOUring::make_unique(num_read);
+    run_case("iouring_submit_read", num_iteration, num_read, [&]() {
+        for (int read_idx = 0; read_idx != num_read; ++read_idx) {
+            batch->prep_read(result[read_idx], fd, buffer.data() + read_idx * 8, 8,
+                             (read_idx * 8) % 4096);
+        }
+        batch->submit();
+    });
+    close(fd);
+}
+
+static void run_sysfs_cases(int num_iteration, const PlatformTopo &topo, const std::string &dir)
+{
+    // One cpufreq policy per CPU
+    int num_cpu = topo.num_domain(GEOPM_DOMAIN_CPU);
+    std::string cpufreq_dir = dir + "/cpufreq";
+    make_dir(cpufreq_dir);
+    for (int cpu_idx = 0; cpu_idx != num_cpu; ++cpu_idx) {
+        std::string policy_dir = cpufreq_dir + "/policy" + std::to_string(cpu_idx);
+        make_dir(policy_dir);
+        write_file(policy_dir + "/affected_cpus", std::to_string(cpu_idx) + "\n");
+        write_file(policy_dir + "/scaling_cur_freq", "2400000\n");
+    }
+    auto driver = std::make_shared<geopm::CpufreqSysfsDriver>(topo, cpufreq_dir);
+    auto parse = driver->signal_parse("CPUFREQ::SCALING_CUR_FREQ");
+    std::string content = "2400000\n";
+    const int num_parse = 1000;
+    double value = 0.0;
+    run_case("sysfs_parse", num_iteration, num_parse, [&]() {
+        for (int parse_idx = 0; parse_idx != num_parse; ++parse_idx) {
+            value += parse(content);
+        }
+    });
+    geopm::SysfsIOGroup iogroup(driver, topo, nullptr,
+                                IOUring::make_unique(num_cpu),
+                                IOUring::make_unique(num_cpu));
+    std::vector<int> signal_idx;
+    for (int cpu_idx = 0; cpu_idx != num_cpu; ++cpu_idx) {
+        signal_idx.push_back(iogroup.push_signal("CPUFREQ::SCALING_CUR_FREQ",
+                                                 GEOPM_DOMAIN_CPU, cpu_idx));
+    }
+    run_case("sysfs_read_batch", num_iteration, num_cpu, [&]() {
+        iogroup.read_batch();
+        for (int idx : signal_idx) {
+            value += iogroup.sample(idx);
+        }
+    });
+}
+
+static void run_signal_cases(int num_iteration, int num_operand)
+{
+    const int num_sample = 1000;
+    std::vector<double> operand(num_operand);
+    for (int idx = 0; idx != num_operand; ++idx) {
+        operand[idx] = idx;
+    }
+    double value = 0.0;
+    geopm::CombinedSignal combined(Agg::sum);
+    run_case("combined_signal_sample", num_iteration, num_sample, [&]() {
+        for (int sample_idx = 0; sample_idx != num_sample; ++sample_idx) {
+            value += combined.sample(operand);
+        }
+    });
+    geopm::DerivativeSignal derivative(std::make_shared<BenchmarkSignal>(),
+                                       std::make_shared<BenchmarkSignal>(),
+                                       8, 0.005);
+    derivative.setup_batch();
+    run_case("derivative_signal_sample", num_iteration, num_sample, [&]() {
+        for (int sample_idx = 0; sample_idx != num_sample; ++sample_idx) {
+            value += derivative.sample();
+        }
+    });
+    std::vector<std::pair<std::string, std::function<double(const std::vector<double> &)> > > agg_func = {
+        {"sum", Agg::sum},
+        {"average", Agg::average},
+        {"median", Agg::median},
+        {"min", Agg::min},
+        {"max", Agg::max},
+        {"stddev", Agg::stddev},
+        {"expect_same", Agg::expect_same},
+    };
+    for (const auto &name_func : agg_func) {
+        const auto &func = name_func.second;
+        run_case("agg_" + name_func.first, num_iteration, num_sample, [&]() {
+            for (int sample_idx = 0; sample_idx != num_sample; ++sample_idx) {
+                value += func(operand);
+            }
+        });
+    }
+    CircularBuffer<double> buffer(64);
+    run_case("circular_buffer_insert", num_iteration, num_sample, [&]() {
+        for (int sample_idx = 0; sample_idx != num_sample; ++sample_idx) {
+            buffer.insert(sample_idx);
+        }
+    });
+    run_case("circular_buffer_value", num_iteration, num_sample, [&]() {
+        int size = buffer.size();
+        for (int sample_idx = 0; sample_idx != num_sample; ++sample_idx) {
+            value += buffer.value(sample_idx % size);
+        }
+    });
+    if (value < 0.0) {
+        std::cerr << "Warning: negative check sum" << std::endl;
+    }
+}
+
+static void run_shmem_cases(int num_iteration)
+{
+    const int num_lock = 1000;
+    std::string key = "/geopm-hot-path-benchmark-" + std::to_string(getpid());
+    auto shmem = SharedMemory::make_unique_owner(key, 4096);
+    run_case("shmem_lock_unlock", num_iteration, num_lock, [&]() {
+        for (int lock_idx = 0; lock_idx != num_lock; ++lock_idx) {
+            auto lock = shmem->get_scoped_lock();
+        }
+    });
+    shmem->unlink();
+}
+
+int main(int argc, char **argv)
+{
+    int num_iteration = 1000;
+    int num_signal = 8;
+    if (argc > 1) {
+        num_iteration = std::atoi(argv[1]);
+    }
+    if (argc > 2) {
+        num_signal = std::atoi(argv[2]);
+    }
+    if (num_iteration <= 0 || num_signal <= 0 || argc > 3) {
+        std::cerr << "Usage: " << argv[0] << " [NUM_ITERATION] [NUM_SIGNAL]" << std::endl;
+        return EXIT_FAILURE;
+    }
+    const PlatformTopo &topo = geopm::platform_topo();
+    int num_cpu = topo.num_domain(GEOPM_DOMAIN_CPU);
+    char tmp_dir[] = "/tmp/geopm-hot-path-benchmark-XXXXXX";
+    if (mkdtemp(tmp_dir) == nullptr) {
+        std::cerr << "Error: unable to create temporary directory" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cerr << "Info: num_cpu=" << num_cpu
+              << " num_signal=" << num_signal << std::endl;
+    print_case_header();
+    int err = 0;
+    try {
+        run_platform_io_cases(num_iteration, num_signal, topo);
+        run_msrio_cases(num_iteration, num_cpu, tmp_dir);
+        run_iouring_cases(num_iteration, num_cpu * num_signal, tmp_dir);
+        run_sysfs_cases(num_iteration, topo, tmp_dir);
+        run_signal_cases(num_iteration, num_cpu);
+        run_shmem_cases(num_iteration);
+    }
+    catch (const std::exception &ex) {
+        std::cerr << "Error: " << ex.what() << std::endl;
+        err = EXIT_FAILURE;
+    }
+    g_tmp_path.insert(g_tmp_path.begin(), tmp_dir);
+    for (auto it = g_tmp_path.rbegin(); it != g_tmp_path.rend(); ++it) {
+        (void)remove(it->c_str());
+    }
+    return err;
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/// Measures the cost of loading MSR definitions when the MSRIOGroup is
+/// constructed.  The built-in definitions are compiled into tables; if
+/// the json_data directory of the source tree is given, each table is
+/// also compared against parsing the JSON file it was generated from,
+/// e.g. "msr_startup_benchmark 100 libgeopmd/json_data".  The MSRIO and
+/// Cpuid are stand-ins so that no MSR device is accessed.  Results are
+/// printed in the CSV format of benchmark_case.hpp.
+
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "geopm/Cpuid.hpp"
+#include "geopm/Helper.hpp"
+#include "geopm/PlatformTopo.hpp"
+#include "MSRData.hpp"
+#include "MSRIO.hpp"
+#include "MSRIOGroup.hpp"
+#include "benchmark_case.hpp"
+
+using geopm::Cpuid;
+using geopm::MSRIO;
+using geopm::MSRIOGroup;
+
+class BenchmarkMSRIO : public MSRIO
+{
+    public:
+        uint64_t read_msr(int cpu_idx, uint64_t offset) override { return 0; }
+        void write_msr(int cpu_idx, uint64_t offset, uint64_t raw_value, uint64_t write_mask) override {}
+        int create_batch_context(void) override { return 0; }
+        int add_read(int cpu_idx, uint64_t offset) override { return 0; }
+        int add_read(int cpu_idx, uint64_t offset, int batch_ctx) override { return 0; }
+        void read_batch(void) override {}
+        void read_batch(int batch_ctx) override {}
+        int add_write(int cpu_idx, uint64_t offset) override { return 0; }
+        int add_write(int cpu_idx, uint64_t offset, int batch_ctx) override { return 0; }
+        void adjust(int batch_idx, uint64_t value, uint64_t write_mask) override {}
+        void adjust(int batch_idx, uint64_t value, uint64_t write_mask, int batch_ctx) override {}
+        uint64_t sample(int batch_idx) const override { return 0; }
+        uint64_t sample(int batch_idx, int batch_ctx) const override { return 0; }
+        void write_batch(void) override {}
+        void write_batch(int batch_ctx) override {}
+        uint64_t system_write_mask(uint64_t offset) override { return ~0ULL; }
+        uint64_t num_write_skipped(void) const override { return 0; }
+};
+
+class BenchmarkCpuid : public Cpuid
+{
+    public:
+        int cpuid(void) const override { return MSRIOGroup::M_CPUID_SPR; }
+        bool is_hwp_supported(void) const override { return false; }
+        double freq_sticker(void) const override { return 2.0e9; }
+        rdt_info_s rdt_info(void) const override { return {false, 0, 0}; }
+        uint32_t pmc_bit_width(void) const override { return 48; }
+};
+
+int main(int argc, char **argv)
+{
+    int num_iteration = 100;
+    std::string json_dir;
+    if (argc > 1) {
+        num_iteration = std::atoi(argv[1]);
+    }
+    if (argc > 2) {
+        json_dir = argv[2];
+    }
+    if (num_iteration <= 0 || argc > 3) {
+        std::cerr << "Usage: " << argv[0] << " [NUM_ITERATION] [JSON_DATA_DIR]" << std::endl;
+        return EXIT_FAILURE;
+    }
+    const geopm::PlatformTopo &topo = geopm::platform_topo();
+    int num_cpu = topo.num_domain(GEOPM_DOMAIN_CPU);
+    auto msrio = std::make_shared<BenchmarkMSRIO>();
+    auto cpuid = std::make_shared<BenchmarkCpuid>();
+    MSRIOGroup group(topo, msrio, cpuid, num_cpu, nullptr);
+    std::vector<std::pair<std::string, const geopm::msr_table_s &> > tables = {
+        {"arch", geopm::arch_msr_table()},
+        {"hsx", geopm::hsx_msr_table()},
+        {"knl", geopm::knl_msr_table()},
+        {"skx", geopm::skx_msr_table()},
+        {"snb", geopm::snb_msr_table()},
+        {"spr", geopm::spr_msr_table()},
+    };
+
+    print_case_header();
+    run_case("construct", num_iteration, 1, [&]() {
+        MSRIOGroup tmp(topo, msrio, cpuid, num_cpu, nullptr);
+    });
+    for (const auto &table : tables) {
+        run_case("table_" + table.first, num_iteration, 1, [&group, &table]() {
+            group.add_msr_table(table.second);
+        });
+        if (!json_dir.empty()) {
+            std::string json_str = geopm::read_file(json_dir + "/msr_data_" + table.first + ".json");
+            run_case("json_" + table.first, num_iteration, 1, [&group, &json_str]() {
+                group.parse_json_msrs(json_str);
+            });
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/// Measures the cost of constructing PlatformIO and reading one signal,
+/// which dominates the run time of short lived tools like geopmread,
+/// with and without the IOGroup cache.  Results are printed in the CSV
+/// format of benchmark_case.hpp.
+
+#include <unistd.h>
+
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "geopm/PlatformTopo.hpp"
+#include "geopm_topo.h"
+#include "IOGroupCache.hpp"
+#include "PlatformIOImp.hpp"
+#include "CombinedControl.hpp"
+#include "CombinedSignal.hpp"
+#include "benchmark_case.hpp"
+
+using geopm::IOGroupCache;
+using geopm::IOGroupCacheImp;
+using geopm::PlatformIOImp;
+
+int main(int argc, char **argv)
+{
+    int num_iteration = 100;
+    if (argc > 1) {
+        num_iteration = std::atoi(argv[1]);
+    }
+    if (num_iteration <= 0) {
+        std::cerr << "Usage: " << argv[0] << " [NUM_ITERATION]" << std::endl;
+        return EXIT_FAILURE;
+    }
+    const geopm::PlatformTopo &topo = geopm::platform_topo();
+    std::string cache_path = "/tmp/geopm-pio-startup-benchmark-" + std::to_string(getpid());
+    auto cache = std::make_shared<IOGroupCacheImp>(cache_path);
+    {
+        // Write the cache before timing the cached cases
+        PlatformIOImp pio({}, topo, cache);
+    }
+
+    print_case_header();
+    run_case("construct_eager", num_iteration, 1, [&topo]() {
+        PlatformIOImp pio({}, topo, nullptr);
+    });
+    run_case("construct_cached", num_iteration, 1, [&topo, &cache]() {
+        PlatformIOImp pio({}, topo, cache);
+    });
+    run_case("read_time_eager", num_iteration, 1, [&topo]() {
+        PlatformIOImp pio({}, topo, nullptr);
+        (void)pio.read_signal("TIME", GEOPM_DOMAIN_BOARD, 0);
+    });
+    run_case("read_time_cached", num_iteration, 1, [&topo, &cache]() {
+        PlatformIOImp pio({}, topo, cache);
+        (void)pio.read_signal("TIME", GEOPM_DOMAIN_BOARD, 0);
+    });
+    run_case("signal_names_eager", num_iteration, 1, [&topo]() {
+        PlatformIOImp pio({}, topo, nullptr);
+        (void)pio.signal_names();
+    });
+    run_case("signal_names_cached", num_iteration, 1, [&topo, &cache]() {
+        PlatformIOImp pio({}, topo, cache);
+        (void)pio.signal_names();
+    });
+    cache->remove();
+    return 0;
+}
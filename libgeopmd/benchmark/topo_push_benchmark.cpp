@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/// Measures the PlatformTopo lookups that PlatformIO and the agents
+/// make while signals are pushed, and the time to push a trace
+/// configuration that requests every signal of a stand-in IOGroup for
+/// every CPU of the node, e.g. "topo_push_benchmark 10 8".  The
+/// signals are native to the CPU domain, so requests for the core,
+/// package, memory and board domains are also timed.  By default the
+/// topology of the local node is used; a cache file in the format
+/// written by "geopmread --cache" may be given to time a larger node.
+/// The file is ignored when run with CAP_SYS_ADMIN.  Results are
+/// printed in the CSV format of benchmark_case.hpp.
+
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "geopm/Agg.hpp"
+#include "geopm/IOGroup.hpp"
+#include "geopm/PlatformTopo.hpp"
+#include "geopm_topo.h"
+#include "PlatformIOImp.hpp"
+#include "PlatformTopoImp.hpp"
+#include "CombinedControl.hpp"
+#include "CombinedSignal.hpp"
+#include "benchmark_case.hpp"
+
+using geopm::IOGroup;
+using geopm::PlatformIOImp;
+using geopm::PlatformTopo;
+using geopm::PlatformTopoImp;
+
+// Provides NUM_SIGNAL signals in the CPU domain; samples are zero.
+class BenchmarkIOGroup : public IOGroup
+{
+    public:
+        BenchmarkIOGroup(int num_signal)
+        {
+            for (int sig = 0; sig < num_signal; ++sig) {
+                m_signal_names.insert("BENCHMARK::SIGNAL_" + std::to_string(sig));
+            }
+        }
+        std::set<std::string> signal_names(void) const override { return m_signal_names; }
+        std::set<std::string> control_names(void) const override { return {}; }
+        bool is_valid_signal(const std::string &signal_name) const override
+        {
+            return m_signal_names.count(signal_name) != 0;
+        }
+        bool is_valid_control(const std::string &control_name) const override { return false; }
+        int signal_domain_type(const std::string &signal_name) const override
+        {
+            return is_valid_signal(signal_name) ? GEOPM_DOMAIN_CPU : GEOPM_DOMAIN_INVALID;
+        }
+        int control_domain_type(const std::string &control_name) const override { return GEOPM_DOMAIN_INVALID; }
+        int push_signal(const std::string &signal_name, int domain_type, int domain_idx) override
+        {
+            return m_num_pushed++;
+        }
+        int push_control(const std::string &control_name, int domain_type, int domain_idx) override { return -1; }
+        void read_batch(void) override {}
+        void write_batch(void) override {}
+        double sample(int sample_idx) override { return 0.0; }
+        void adjust(int control_idx, double setting) override {}
+        double read_signal(const std::string &signal_name, int domain_type, int domain_idx) override { return 0.0; }
+        void write_control(const std::string &control_name, int domain_type, int domain_idx, double setting) override {}
+        void save_control(void) override {}
+        void restore_control(void) override {}
+        std::function<double(const std::vector<double> &)> agg_function(const std::string &signal_name) const override
+        {
+            return geopm::Agg::sum;
+        }
+        std::string signal_description(const std::string &signal_name) const override { return ""; }
+        std::string control_description(const std::string &control_name) const override { return ""; }
+        int signal_behavior(const std::string &signal_name) const override { return M_SIGNAL_BEHAVIOR_VARIABLE; }
+        void save_control(const std::string &save_path) override {}
+        void restore_control(const std::string &save_path) override {}
+        std::string name(void) const override { return "BENCHMARK"; }
+    private:
+        std::set<std::string> m_signal_names;
+        int m_num_pushed = 0;
+};
+
+int main(int argc, char **argv)
+{
+    int num_iteration = 10;
+    int num_signal = 8;
+    std::string cache_path;
+    if (argc > 1) {
+        num_iteration = std::atoi(argv[1]);
+    }
+    if (argc > 2) {
+        num_signal = std::atoi(argv[2]);
+    }
+    if (argc > 3) {
+        cache_path = argv[3];
+    }
+    if (num_iteration <= 0 || num_signal <= 0 || argc > 4) {
+        std::cerr << "Usage: " << argv[0] << " [NUM_ITERATION] [NUM_SIGNAL] [TOPO_CACHE_FILE]" << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::unique_ptr<PlatformTopoImp> cache_topo;
+    if (!cache_path.empty()) {
+        cache_topo = std::make_unique<PlatformTopoImp>(cache_path, nullptr);
+    }
+    const PlatformTopo &topo = cache_topo ? *cache_topo : geopm::platform_topo();
+    int num_cpu = topo.num_domain(GEOPM_DOMAIN_CPU);
+    std::vector<int> domain_types = {GEOPM_DOMAIN_BOARD,
+                                     GEOPM_DOMAIN_PACKAGE,
+                                     GEOPM_DOMAIN_CORE,
+                                     GEOPM_DOMAIN_CPU,
+                                     GEOPM_DOMAIN_MEMORY};
+    auto iogroup = std::make_shared<BenchmarkIOGroup>(num_signal);
+    auto signal_names = iogroup->signal_names();
+
+    std::cerr << "Info: num_cpu=" << num_cpu
+              << " num_core=" << topo.num_domain(GEOPM_DOMAIN_CORE)
+              << " num_package=" << topo.num_domain(GEOPM_DOMAIN_PACKAGE)
+              << " num_memory=" << topo.num_domain(GEOPM_DOMAIN_MEMORY) << std::endl;
+    print_case_header();
+    int num_domain_type = domain_types.size();
+    run_case("domain_idx_all_cpu", num_iteration, num_domain_type * num_cpu, [&]() {
+        int check_sum = 0;
+        for (int domain_type : domain_types) {
+            for (int cpu_idx = 0; cpu_idx != num_cpu; ++cpu_idx) {
+                check_sum += topo.domain_idx(domain_type, cpu_idx);
+            }
+        }
+        if (check_sum < 0) {
+            std::cerr << "Warning: CPU not in a memory domain" << std::endl;
+        }
+    });
+    int num_nested = 0;
+    for (int domain_type : domain_types) {
+        num_nested += topo.num_domain(domain_type);
+    }
+    run_case("domain_nested_cpu", num_iteration, num_nested, [&]() {
+        for (int domain_type : domain_types) {
+            int num_domain = topo.num_domain(domain_type);
+            for (int domain_idx = 0; domain_idx != num_domain; ++domain_idx) {
+                (void)topo.domain_nested(GEOPM_DOMAIN_CPU, domain_type, domain_idx);
+            }
+        }
+    });
+    for (int domain_type : domain_types) {
+        int num_domain = topo.num_domain(domain_type);
+        int num_push = signal_names.size() * num_domain;
+        run_case("push_" + PlatformTopo::domain_type_to_name(domain_type), num_iteration, num_push, [&]() {
+            PlatformIOImp pio({iogroup}, topo);
+            for (const auto &signal_name : signal_names) {
+                for (int domain_idx = 0; domain_idx != num_domain; ++domain_idx) {
+                    pio.push_signal(signal_name, domain_type, domain_idx);
+                }
+            }
+        });
+    }
+    return 0;
+}
@@ -140,6 +140,53 @@ namespace geopm
             ///        previously given to adjust() are written to the
             ///        platform.
             virtual void write_batch(void) = 0;
+            /// @brief Push several signals at once by calling
+            ///        push_signal() for each request in order.
+            ///
+            /// @param [in] signal_config Name, domain type and domain
+            ///        index of each signal to push.
+            ///
+            /// @return Signal index for each request, in request
+            ///         order.
+            std::vector<int> push_signals(const std::vector<geopm_request_s> &signal_config);
+            /// @brief Push several controls at once by calling
+            ///        push_control() for each request in order.
+            ///
+            /// @param [in] control_config Name, domain type and
+            ///        domain index of each control to push.
+            ///
+            /// @return Control index for each request, in request
+            ///         order.
+            std::vector<int> push_controls(const std::vector<geopm_request_s> &control_config);
+            /// @brief Sample several pushed signals into a caller
+            ///        owned array by calling sample() for each index.
+            ///        Every index is checked before any value is
+            ///        written, so an invalid index leaves the result
+            ///        unmodified.
+            ///
+            /// @param [in] num_signal Number of elements in
+            ///        signal_idx and result.
+            ///
+            /// @param [in] signal_idx Indices returned by previous
+            ///        calls to push_signal() or push_signals().
+            ///
+            /// @param [out] result Signal value in SI units for each
+            ///        index.
+            void sample_array(int num_signal, const int *signal_idx, double *result);
+            /// @brief Adjust several pushed controls from a caller
+            ///        owned array by calling adjust() for each index
+            ///        in order.  Every index and setting is checked
+            ///        before any control is adjusted, so an invalid
+            ///        request leaves the controls unmodified.
+            ///
+            /// @param [in] num_control Number of elements in
+            ///        control_idx and setting.
+            ///
+            /// @param [in] control_idx Indices returned by previous
+            ///        calls to push_control() or push_controls().
+            ///
+            /// @param [in] setting Value in SI units for each index.
+            void adjust_array(int num_control, const int *control_idx, const double *setting);
             /// @brief Read from platform and interpret into SI units
             ///        a signal given its name and domain.  Does not
             ///        modify the values stored by calling
@@ -249,6 +296,23 @@ namespace geopm
                                             int &server_pid,
                                             std::string &server_key) = 0;
             virtual void stop_batch_server(int server_pid) = 0;
+            /// @brief Write several controls without pushing them,
+            ///        with the same result as calling write_control()
+            ///        for each request in order.  Consecutive
+            ///        requests provided by the same IOGroup may be
+            ///        written together.  If an IOGroup fails partway
+            ///        through its requests the error is thrown and
+            ///        the requests written before the failure keep
+            ///        their new settings.  The default implementation
+            ///        calls write_control() for each request in order.
+            ///
+            /// @param [in] control_config Name, domain type and
+            ///        domain index of each control to write.
+            ///
+            /// @param [in] settings Value in SI units to write to
+            ///        each control, aligned with control_config.
+            virtual void write_controls(const std::vector<geopm_request_s> &control_config,
+                                        const std::vector<double> &settings);
 
             /// @param [in] value Check if the given parameter is a valid value.
             ///
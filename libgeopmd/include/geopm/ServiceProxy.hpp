@@ -146,6 +146,30 @@ namespace geopm
                                                 int domain,
                                                 int domain_idx,
                                                 double setting) = 0;
+            /// @brief Calls the PlatformReadSignals API defined in the
+            ///        io.github.geopm D-Bus namespace to read many
+            ///        signals with one D-Bus round trip.  Falls back
+            ///        to one PlatformReadSignal call per request if
+            ///        the service does not provide PlatformReadSignals.
+            /// @param signal_config [in] Name, domain and domain
+            ///                      index of each signal to read.
+            /// @return The value of each signal read, in request
+            ///         order.
+            virtual std::vector<double> platform_read_signals(
+                const std::vector<struct geopm_request_s> &signal_config) = 0;
+            /// @brief Calls the PlatformWriteControls API defined in
+            ///        the io.github.geopm D-Bus namespace to write many
+            ///        controls with one D-Bus round trip.  Falls back
+            ///        to one PlatformWriteControl call per request if
+            ///        the service does not provide
+            ///        PlatformWriteControls.
+            /// @param control_config [in] Name, domain and domain
+            ///                       index of each control to write.
+            /// @param settings [in] Value to write to each control,
+            ///                 aligned with control_config.
+            virtual void platform_write_controls(
+                const std::vector<struct geopm_request_s> &control_config,
+                const std::vector<double> &settings) = 0;
             /// @brief Calls the PlatformRestoreControl API defined in the
             ///        io.github.geopm D-Bus namespace.
             virtual void platform_restore_control() = 0;
@@ -183,6 +207,10 @@ namespace geopm
                                         int domain,
                                         int domain_idx,
                                         double setting) override;
+            std::vector<double> platform_read_signals(
+                const std::vector<struct geopm_request_s> &signal_config) override;
+            void platform_write_controls(const std::vector<struct geopm_request_s> &control_config,
+                                         const std::vector<double> &settings) override;
             void platform_restore_control() override;
             std::string topo_get_cache(void) override;
             void platform_start_profile(const std::string &profile_name) override;
@@ -193,6 +221,7 @@ namespace geopm
             std::vector<std::string> GEOPM_PRIVATE
                 read_string_array(std::shared_ptr<SDBusMessage> bus_message);
             std::shared_ptr<SDBus> m_bus;
+            bool m_is_vector_supported;
     };
 }
 
@@ -253,6 +253,90 @@ int GEOPM_PUBLIC
 int GEOPM_PUBLIC
     geopm_pio_adjust(int control_idx, double setting);
 
+struct geopm_request_s;
+
+/// @brief Push an array of signals onto the stack of batch access
+///        signals, with the same semantics as calling
+///        geopm_pio_push_signal() for each request in order.
+///
+/// @param [in] num_request The number of elements in the request and
+///        signal_idx arrays.
+///
+/// @param [in] request An array of geopm_request_s elements, each
+///        containing the name of the signal, the domain type, and the
+///        domain index.
+///
+/// @param [out] signal_idx The index to pass to geopm_pio_sample()
+///        or geopm_pio_sample_array() for each request.
+///
+/// @return If an error occurs then negative error code is returned.
+///         Zero is returned upon success.
+int GEOPM_PUBLIC
+    geopm_pio_push_signal_array(int num_request,
+                                const struct geopm_request_s *request,
+                                int *signal_idx);
+
+/// @brief Push an array of controls onto the stack of batch access
+///        controls, with the same semantics as calling
+///        geopm_pio_push_control() for each request in order.
+///
+/// @param [in] num_request The number of elements in the request and
+///        control_idx arrays.
+///
+/// @param [in] request An array of geopm_request_s elements, each
+///        containing the name of the control, the domain type, and
+///        the domain index.
+///
+/// @param [out] control_idx The index to pass to geopm_pio_adjust()
+///        or geopm_pio_adjust_array() for each request.
+///
+/// @return If an error occurs then negative error code is returned.
+///         Zero is returned upon success.
+int GEOPM_PUBLIC
+    geopm_pio_push_control_array(int num_request,
+                                 const struct geopm_request_s *request,
+                                 int *control_idx);
+
+/// @brief Samples cached values of several signals that have been
+///        pushed and writes them into a caller owned array.
+///
+/// @details The cached values are updated at the time of call to
+///          geopm_pio_read_batch().  No values are written if any
+///          index is invalid.
+///
+/// @param [in] num_signal The number of elements in the signal_idx
+///        and result arrays.
+///
+/// @param [in] signal_idx Signal indices returned when the signals
+///        were pushed.
+///
+/// @param [out] result The value of each signal.
+///
+/// @return If an error occurs then negative error code is returned.
+///         Zero is returned upon success.
+int GEOPM_PUBLIC
+    geopm_pio_sample_array(int num_signal, const int *signal_idx, double *result);
+
+/// @brief Updates cached values for several controls that have been
+///        pushed from a caller owned array.
+///
+/// @details The cached values will be written to the platform at
+///          time of call to geopm_pio_write_batch().  No control is
+///          updated if any index or setting is invalid.
+///
+/// @param [in] num_control The number of elements in the
+///        control_idx and setting arrays.
+///
+/// @param [in] control_idx Control indices returned when the controls
+///        were pushed.
+///
+/// @param [in] setting The value of each control.
+///
+/// @return If an error occurs then negative error code is returned.
+///         Zero is returned upon success.
+int GEOPM_PUBLIC
+    geopm_pio_adjust_array(int num_control, const int *control_idx, const double *setting);
+
 /// @brief Read all push signals from the platform so that the next
 ///        call to geopm_pio_sample() will reflect the updated data.
 ///
@@ -377,8 +461,6 @@ int GEOPM_PUBLIC
     geopm_pio_signal_info(const char *signal_name, int *aggregation_type,
                           int *format_type, int *behavior_type);
 
-struct geopm_request_s;
-
 /// @brief Creates a batch server with the following signals and
 ///        controls.  It would be an error to create a batch server
 ///        without any signals or controls.
@@ -7,11 +7,16 @@
 #define GEOPM_PLUGIN_HPP_INCLUDE
 
 #include <string>
+#include <vector>
 
 #include "geopm_public.h"
 
 namespace geopm
 {
+    /// @brief Paths of the plugin shared objects that plugin_load()
+    ///        would load for the prefix, in load order.
+    std::vector<std::string> GEOPM_PUBLIC
+        plugin_files(const std::string &plugin_prefix);
     void GEOPM_PUBLIC
         plugin_load(const std::string &plugin_prefix);
     void GEOPM_PUBLIC
@@ -321,6 +321,17 @@ namespace geopm
         return geopm::make_unique<ConstConfigIOGroup>();
     }
 
+    std::vector<std::string> ConstConfigIOGroup::config_file_paths(void)
+    {
+        std::vector<std::string> result;
+        std::string user_file_path = geopm::get_env(M_CONFIG_PATH_ENV);
+        if (!user_file_path.empty()) {
+            result.push_back(user_file_path);
+        }
+        result.push_back(M_DEFAULT_CONFIG_FILE_PATH);
+        return result;
+    }
+
     void ConstConfigIOGroup::save_control(const std::string &save_path)
     {
     }
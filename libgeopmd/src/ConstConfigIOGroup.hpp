@@ -77,6 +77,10 @@ namespace geopm
             std::string name(void) const override;
             static std::string plugin_name(void);
             static std::unique_ptr<IOGroup> make_plugin(void);
+            /// @brief Paths of the configuration files that the
+            ///        default constructor may read, in the order
+            ///        they are tried.
+            static std::vector<std::string> config_file_paths(void);
 
         private:
             struct m_signal_desc_s {
@@ -35,6 +35,7 @@
 #include "LevelZeroIOGroup.hpp"
 #endif
 #include "ConstConfigIOGroup.hpp"
+#include "ReplayIOGroup.hpp"
 #ifdef GEOPM_DEBUG
 #include <iostream>
 #endif
@@ -160,6 +161,12 @@ namespace geopm
                         ConstConfigIOGroup::make_plugin);
         register_plugin(DrmSysfsDriver::plugin_name(),
                         DrmSysfsDriver::make_plugin);
+        // Registered last so that the replayed signals and the
+        // simulated controls take precedence over the platform.
+        if (ReplayIOGroup::is_enabled()) {
+            register_plugin(ReplayIOGroup::plugin_name(),
+                            ReplayIOGroup::make_plugin);
+        }
     }
 
     IOGroupFactory &iogroup_factory(void)
@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "IOGroupCache.hpp"
+
+#include <errno.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/sysinfo.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+
+#include "geopm/Exception.hpp"
+#include "geopm/Helper.hpp"
+#include "geopm/IOGroup.hpp"
+#include "geopm/json11.hpp"
+#include "geopm_hash.h"
+#include "geopm_plugin.hpp"
+#include "geopm_time.h"
+#include "geopm_version.h"
+#include "ConstConfigIOGroup.hpp"
+#include "MSRIOGroup.hpp"
+
+using json11::Json;
+
+namespace geopm
+{
+    const std::string IOGroupCacheImp::M_CACHE_FILE_NAME = "/tmp/geopm-iogroup-cache-" + std::to_string(getuid());
+    const std::string IOGroupCacheImp::M_SERVICE_CACHE_FILE_NAME = "/run/geopm/geopm-iogroup-cache";
+
+    std::unique_ptr<IOGroupCache> IOGroupCache::make_unique(void)
+    {
+        return geopm::make_unique<IOGroupCacheImp>();
+    }
+
+    // Modification time and size of a file, or "-" if it does not
+    // exist.
+    static std::string file_stamp(const std::string &path)
+    {
+        std::string result = path + ":";
+        struct stat file_stat;
+        if (stat(path.c_str(), &file_stat)) {
+            result += "-";
+        }
+        else {
+            result += std::to_string(file_stat.st_mtim.tv_sec) + "." +
+                      std::to_string(file_stat.st_mtim.tv_nsec) + ":" +
+                      std::to_string(file_stat.st_size);
+        }
+        return result;
+    }
+
+    // Names of the loaded kernel modules, so that a driver loaded
+    // after boot invalidates the record.
+    static std::string module_names(void)
+    {
+        std::string result;
+        try {
+            std::istringstream modules(read_file("/proc/modules"));
+            std::string line;
+            while (std::getline(modules, line)) {
+                result += line.substr(0, line.find(' ')) + ",";
+            }
+        }
+        catch (const Exception &) {
+            // Not available in all environments
+        }
+        return result;
+    }
+
+    std::string IOGroupCache::key(const std::vector<std::string> &iogroup_names)
+    {
+        std::string result = std::string(geopm_version()) + ";" +
+                             string_join(iogroup_names, ",");
+        const char *plugin_path = std::getenv("GEOPM_PLUGIN_PATH");
+        if (plugin_path != nullptr) {
+            result += ";" + std::string(plugin_path);
+        }
+        // Configuration that changes the names provided by the MSR
+        // and CONST_CONFIG IOGroups
+        for (const auto &env_name : {"GEOPM_MSR_CONFIG_PATH",
+                                     "GEOPM_CONST_CONFIG_PATH"}) {
+            result += ";" + std::string(env_name) + "=" + get_env(env_name);
+        }
+        std::string state;
+        // Plugins in the default directory and GEOPM_PLUGIN_PATH, so
+        // that a plugin that is installed, removed or rebuilt
+        // invalidates the record
+        for (const auto &path : plugin_files(IOGroup::M_PLUGIN_PREFIX)) {
+            state += file_stamp(path) + ";";
+        }
+        for (const auto &path : MSRIOGroup::config_file_paths()) {
+            state += file_stamp(path) + ";";
+        }
+        for (const auto &path : ConstConfigIOGroup::config_file_paths()) {
+            state += file_stamp(path) + ";";
+        }
+        // The msr-safe allowlist restricts the MSRs that may be
+        // accessed, and is only readable by privileged users.
+        std::string allowlist;
+        try {
+            allowlist = read_file("/dev/cpu/msr_allowlist");
+        }
+        catch (const Exception &) {
+            // The driver is not loaded or the caller is unprivileged
+        }
+        state += allowlist + ";" + module_names();
+        result += ";" + std::to_string(geopm_crc32_str(state.c_str()));
+        return result;
+    }
+
+    bool IOGroupCache::is_disabled(void)
+    {
+        return std::getenv("GEOPM_DISABLE_IOGROUP_CACHE") != nullptr;
+    }
+
+    IOGroupCacheImp::IOGroupCacheImp()
+        : IOGroupCacheImp(default_path())
+    {
+
+    }
+
+    IOGroupCacheImp::IOGroupCacheImp(const std::string &cache_path)
+        : m_cache_path(cache_path)
+    {
+
+    }
+
+    std::string IOGroupCacheImp::default_path(void)
+    {
+        return has_cap_sys_admin() ? M_SERVICE_CACHE_FILE_NAME : M_CACHE_FILE_NAME;
+    }
+
+    bool IOGroupCacheImp::is_file_valid(void) const
+    {
+        struct stat file_stat;
+        if (stat(m_cache_path.c_str(), &file_stat)) {
+            return false;
+        }
+        // Only trust a file owned by the caller that no one else may
+        // have modified
+        mode_t expected_perms = S_IRUSR | S_IWUSR; // 0o600
+        if (file_stat.st_uid != getuid() ||
+            (file_stat.st_mode & ~S_IFMT) != expected_perms) {
+            return false;
+        }
+        struct sysinfo si;
+        if (sysinfo(&si)) {
+            return false;
+        }
+        struct geopm_time_s current_time;
+        geopm_time_real(&current_time);
+        unsigned int last_boot_time = current_time.t.tv_sec - si.uptime;
+        return static_cast<unsigned int>(file_stat.st_mtime) >= last_boot_time;
+    }
+
+    bool IOGroupCacheImp::read(const std::string &key,
+                               std::vector<iogroup_names_s> &iogroups) const
+    {
+        iogroups.clear();
+        if (!is_file_valid()) {
+            return false;
+        }
+        std::string contents;
+        try {
+            contents = read_file(m_cache_path);
+        }
+        catch (const Exception &) {
+            return false;
+        }
+        std::string err;
+        Json root = Json::parse(contents, err);
+        if (!err.empty() || !root.is_object() ||
+            !root["key"].is_string() || root["key"].string_value() != key ||
+            !root["iogroups"].is_array()) {
+            return false;
+        }
+        for (const auto &group : root["iogroups"].array_items()) {
+            if (!group["name"].is_string() ||
+                !group["signals"].is_object() ||
+                !group["controls"].is_object()) {
+                iogroups.clear();
+                return false;
+            }
+            iogroup_names_s names;
+            names.iogroup_name = group["name"].string_value();
+            for (const auto &signal : group["signals"].object_items()) {
+                names.signal_domains[signal.first] = signal.second.int_value();
+            }
+            for (const auto &control : group["controls"].object_items()) {
+                names.control_domains[control.first] = control.second.int_value();
+            }
+            iogroups.push_back(std::move(names));
+        }
+        return true;
+    }
+
+    void IOGroupCacheImp::write(const std::string &key,
+                                const std::vector<iogroup_names_s> &iogroups)
+    {
+        Json::array group_array;
+        for (const auto &group : iogroups) {
+            Json::object signal_object(group.signal_domains.begin(), group.signal_domains.end());
+            Json::object control_object(group.control_domains.begin(), group.control_domains.end());
+            group_array.push_back(Json::object {
+                {"name", group.iogroup_name},
+                {"signals", signal_object},
+                {"controls", control_object},
+            });
+        }
+        Json root = Json::object {
+            {"key", key},
+            {"iogroups", group_array},
+        };
+        // Write to a temporary file and rename so that a concurrent
+        // reader never observes a partial record
+        std::string tmp_string = m_cache_path + "XXXXXX";
+        std::vector<char> tmp_path(tmp_string.c_str(), tmp_string.c_str() + tmp_string.size() + 1);
+        int tmp_fd = mkstemp(tmp_path.data());
+        if (tmp_fd == -1) {
+            throw Exception("IOGroupCacheImp::write(): Could not create temp file: " + tmp_string,
+                            errno ? errno : GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        close(tmp_fd);
+        try {
+            write_file(tmp_path.data(), root.dump());
+        }
+        catch (...) {
+            (void)unlink(tmp_path.data());
+            throw;
+        }
+        if (rename(tmp_path.data(), m_cache_path.c_str())) {
+            int err = errno ? errno : GEOPM_ERROR_RUNTIME;
+            (void)unlink(tmp_path.data());
+            throw Exception("IOGroupCacheImp::write(): Could not rename temp file: " +
+                            std::string(tmp_path.data()),
+                            err, __FILE__, __LINE__);
+        }
+    }
+
+    void IOGroupCacheImp::remove(void)
+    {
+        (void)unlink(m_cache_path.c_str());
+    }
+}
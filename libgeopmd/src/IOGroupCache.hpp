@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef IOGROUPCACHE_HPP_INCLUDE
+#define IOGROUPCACHE_HPP_INCLUDE
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace geopm
+{
+    /// @brief Persistent record of the signals and controls provided
+    ///        by each IOGroup plugin and their native domains.
+    ///
+    /// PlatformIO uses this record to defer construction of an
+    /// IOGroup until one of its signals or controls is used.  The
+    /// record is tagged with a key that describes the set of plugins
+    /// that produced it and is discarded if it was written before
+    /// the last boot, so it is regenerated when plugins or hardware
+    /// change.
+    class IOGroupCache
+    {
+        public:
+            struct iogroup_names_s {
+                std::string iogroup_name;
+                /// Native domain of each signal keyed by name
+                std::map<std::string, int> signal_domains;
+                /// Native domain of each control keyed by name
+                std::map<std::string, int> control_domains;
+            };
+            IOGroupCache() = default;
+            virtual ~IOGroupCache() = default;
+            /// @brief Read the record if it is valid for the key.
+            ///
+            /// @param [in] key Description of the current plugin set
+            ///        as returned by key().
+            ///
+            /// @param [out] iogroups Names provided by each IOGroup
+            ///        that loaded successfully, in load order.
+            ///
+            /// @return True if a valid record was read, false if the
+            ///         record is missing, stale or was written with a
+            ///         different key.
+            virtual bool read(const std::string &key,
+                              std::vector<iogroup_names_s> &iogroups) const = 0;
+            /// @brief Replace the record.
+            ///
+            /// @param [in] key Description of the current plugin set.
+            ///
+            /// @param [in] iogroups Names provided by each IOGroup
+            ///        that loaded successfully, in load order.
+            virtual void write(const std::string &key,
+                               const std::vector<iogroup_names_s> &iogroups) = 0;
+            /// @brief Remove the record so that it is regenerated by
+            ///        the next PlatformIO.
+            virtual void remove(void) = 0;
+            /// @brief Key describing the version of GEOPM and the set
+            ///        of IOGroup plugins available, including the
+            ///        path and modification time of each plugin
+            ///        shared object.
+            ///
+            /// @param [in] iogroup_names Plugin names in load order.
+            ///
+            /// @return Key to pass to read() and write().
+            static std::string key(const std::vector<std::string> &iogroup_names);
+            /// @brief Check if the record is disabled by the
+            ///        GEOPM_DISABLE_IOGROUP_CACHE environment variable.
+            static bool is_disabled(void);
+            static std::unique_ptr<IOGroupCache> make_unique(void);
+    };
+
+    class IOGroupCacheImp : public IOGroupCache
+    {
+        public:
+            IOGroupCacheImp();
+            IOGroupCacheImp(const std::string &cache_path);
+            virtual ~IOGroupCacheImp() = default;
+            bool read(const std::string &key,
+                      std::vector<iogroup_names_s> &iogroups) const override;
+            void write(const std::string &key,
+                       const std::vector<iogroup_names_s> &iogroups) override;
+            void remove(void) override;
+        private:
+            static std::string default_path(void);
+            bool is_file_valid(void) const;
+            static const std::string M_CACHE_FILE_NAME;
+            static const std::string M_SERVICE_CACHE_FILE_NAME;
+            const std::string m_cache_path;
+    };
+}
+
+#endif
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "LazyIOGroup.hpp"
+
+#include "geopm/Exception.hpp"
+#include "geopm_topo.h"
+
+namespace geopm
+{
+    LazyIOGroup::LazyIOGroup(const std::string &iogroup_name,
+                             const std::map<std::string, int> &signal_domains,
+                             const std::map<std::string, int> &control_domains,
+                             std::function<std::unique_ptr<IOGroup>(void)> factory,
+                             std::function<void(void)> on_error)
+        : m_iogroup_name(iogroup_name)
+        , m_signal_domains(signal_domains)
+        , m_control_domains(control_domains)
+        , m_factory(std::move(factory))
+        , m_on_error(std::move(on_error))
+        , m_is_failed(false)
+    {
+
+    }
+
+    IOGroup &LazyIOGroup::iogroup(void) const
+    {
+        if (m_iogroup == nullptr) {
+            if (m_is_failed) {
+                throw Exception("LazyIOGroup::iogroup(): the " + m_iogroup_name +
+                                " IOGroup failed to load",
+                                GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+            }
+            try {
+                m_iogroup = m_factory();
+            }
+            catch (...) {
+                // The recorded names no longer describe the system;
+                // stop advertising them so PlatformIO falls back to
+                // other IOGroups.
+                m_is_failed = true;
+                m_signal_domains.clear();
+                m_control_domains.clear();
+                if (m_on_error) {
+                    m_on_error();
+                }
+                throw;
+            }
+        }
+        return *m_iogroup;
+    }
+
+    IOGroup *LazyIOGroup::try_iogroup(void) const
+    {
+        IOGroup *result = nullptr;
+        try {
+            result = &iogroup();
+        }
+        catch (const Exception &) {
+            // An IOGroup that fails to construct is skipped, as it
+            // would have been if it were registered without the
+            // cache.
+        }
+        return result;
+    }
+
+    bool LazyIOGroup::is_loaded(void) const
+    {
+        return m_iogroup != nullptr;
+    }
+
+    std::set<std::string> LazyIOGroup::signal_names(void) const
+    {
+        std::set<std::string> result;
+        for (const auto &it : m_signal_domains) {
+            result.insert(result.end(), it.first);
+        }
+        return result;
+    }
+
+    std::set<std::string> LazyIOGroup::control_names(void) const
+    {
+        std::set<std::string> result;
+        for (const auto &it : m_control_domains) {
+            result.insert(result.end(), it.first);
+        }
+        return result;
+    }
+
+    bool LazyIOGroup::is_valid_signal(const std::string &signal_name) const
+    {
+        return m_signal_domains.find(signal_name) != m_signal_domains.end();
+    }
+
+    bool LazyIOGroup::is_valid_control(const std::string &control_name) const
+    {
+        return m_control_domains.find(control_name) != m_control_domains.end();
+    }
+
+    int LazyIOGroup::signal_domain_type(const std::string &signal_name) const
+    {
+        auto it = m_signal_domains.find(signal_name);
+        return it == m_signal_domains.end() ? GEOPM_DOMAIN_INVALID : it->second;
+    }
+
+    int LazyIOGroup::control_domain_type(const std::string &control_name) const
+    {
+        auto it = m_control_domains.find(control_name);
+        return it == m_control_domains.end() ? GEOPM_DOMAIN_INVALID : it->second;
+    }
+
+    int LazyIOGroup::push_signal(const std::string &signal_name,
+                                 int domain_type,
+                                 int domain_idx)
+    {
+        return iogroup().push_signal(signal_name, domain_type, domain_idx);
+    }
+
+    int LazyIOGroup::push_control(const std::string &control_name,
+                                  int domain_type,
+                                  int domain_idx)
+    {
+        return iogroup().push_control(control_name, domain_type, domain_idx);
+    }
+
+    void LazyIOGroup::read_batch(void)
+    {
+        if (m_iogroup != nullptr) {
+            m_iogroup->read_batch();
+        }
+    }
+
+    void LazyIOGroup::write_batch(void)
+    {
+        if (m_iogroup != nullptr) {
+            m_iogroup->write_batch();
+        }
+    }
+
+    double LazyIOGroup::sample(int sample_idx)
+    {
+        return iogroup().sample(sample_idx);
+    }
+
+    void LazyIOGroup::adjust(int control_idx,
+                             double setting)
+    {
+        iogroup().adjust(control_idx, setting);
+    }
+
+    double LazyIOGroup::read_signal(const std::string &signal_name,
+                                    int domain_type,
+                                    int domain_idx)
+    {
+        return iogroup().read_signal(signal_name, domain_type, domain_idx);
+    }
+
+    void LazyIOGroup::write_control(const std::string &control_name,
+                                    int domain_type,
+                                    int domain_idx,
+                                    double setting)
+    {
+        iogroup().write_control(control_name, domain_type, domain_idx, setting);
+    }
+
+    std::vector<double> LazyIOGroup::read_signals(const std::vector<geopm_request_s> &signal_config)
+    {
+        return MultiRequestIOGroup::read_signals(iogroup(), signal_config);
+    }
+
+    void LazyIOGroup::write_controls(const std::vector<geopm_request_s> &control_config,
+                                     const std::vector<double> &settings)
+    {
+        MultiRequestIOGroup::write_controls(iogroup(), control_config, settings);
+    }
+
+    void LazyIOGroup::save_control(void)
+    {
+        IOGroup *group = try_iogroup();
+        if (group != nullptr) {
+            group->save_control();
+        }
+    }
+
+    void LazyIOGroup::restore_control(void)
+    {
+        // Controls can only have been saved if the IOGroup was loaded
+        if (m_iogroup != nullptr) {
+            m_iogroup->restore_control();
+        }
+    }
+
+    std::function<double(const std::vector<double> &)> LazyIOGroup::agg_function(const std::string &signal_name) const
+    {
+        return iogroup().agg_function(signal_name);
+    }
+
+    std::function<std::string(double)> LazyIOGroup::format_function(const std::string &signal_name) const
+    {
+        return iogroup().format_function(signal_name);
+    }
+
+    std::string LazyIOGroup::signal_description(const std::string &signal_name) const
+    {
+        return iogroup().signal_description(signal_name);
+    }
+
+    std::string LazyIOGroup::control_description(const std::string &control_name) const
+    {
+        return iogroup().control_description(control_name);
+    }
+
+    int LazyIOGroup::signal_behavior(const std::string &signal_name) const
+    {
+        return iogroup().signal_behavior(signal_name);
+    }
+
+    void LazyIOGroup::save_control(const std::string &save_path)
+    {
+        IOGroup *group = try_iogroup();
+        if (group != nullptr) {
+            group->save_control(save_path);
+        }
+    }
+
+    void LazyIOGroup::restore_control(const std::string &save_path)
+    {
+        IOGroup *group = try_iogroup();
+        if (group != nullptr) {
+            group->restore_control(save_path);
+        }
+    }
+
+    std::string LazyIOGroup::name(void) const
+    {
+        return m_iogroup_name;
+    }
+}
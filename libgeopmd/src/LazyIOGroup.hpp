@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef LAZYIOGROUP_HPP_INCLUDE
+#define LAZYIOGROUP_HPP_INCLUDE
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+
+#include "geopm/IOGroup.hpp"
+#include "MultiRequestIOGroup.hpp"
+
+namespace geopm
+{
+    /// @brief IOGroup that defers construction of an IOGroup plugin
+    ///        until it is first used.
+    ///
+    /// The names and native domains of the signals and controls
+    /// provided by the plugin are known in advance (see
+    /// IOGroupCache), so name and domain queries are answered without
+    /// constructing the plugin.  Any other method
+    /// constructs the plugin and forwards the call.  read_batch() and
+    /// write_batch() are no-ops until the plugin has been constructed
+    /// because nothing can have been pushed before then.  The
+    /// save_control() and restore_control() methods do nothing if
+    /// the plugin fails to construct, just as PlatformIO skips a
+    /// plugin that fails to construct when the record is not used.
+    class LazyIOGroup : public IOGroup, public MultiRequestIOGroup
+    {
+        public:
+            /// @param [in] iogroup_name Name of the IOGroup plugin.
+            /// @param [in] signal_domains Native domain of each signal
+            ///        provided by the plugin.
+            /// @param [in] control_domains Native domain of each
+            ///        control provided by the plugin.
+            /// @param [in] factory Constructs the plugin.
+            /// @param [in] on_error Called if the plugin fails to
+            ///        construct, before the error is rethrown.  After
+            ///        a failure this object provides no signals or
+            ///        controls.
+            LazyIOGroup(const std::string &iogroup_name,
+                        const std::map<std::string, int> &signal_domains,
+                        const std::map<std::string, int> &control_domains,
+                        std::function<std::unique_ptr<IOGroup>(void)> factory,
+                        std::function<void(void)> on_error);
+            virtual ~LazyIOGroup() = default;
+            /// @brief Returns true once the plugin has been constructed.
+            bool is_loaded(void) const;
+            std::set<std::string> signal_names(void) const override;
+            std::set<std::string> control_names(void) const override;
+            bool is_valid_signal(const std::string &signal_name) const override;
+            bool is_valid_control(const std::string &control_name) const override;
+            int signal_domain_type(const std::string &signal_name) const override;
+            int control_domain_type(const std::string &control_name) const override;
+            int push_signal(const std::string &signal_name,
+                            int domain_type,
+                            int domain_idx) override;
+            int push_control(const std::string &control_name,
+                             int domain_type,
+                             int domain_idx) override;
+            void read_batch(void) override;
+            void write_batch(void) override;
+            double sample(int sample_idx) override;
+            void adjust(int control_idx,
+                        double setting) override;
+            double read_signal(const std::string &signal_name,
+                               int domain_type,
+                               int domain_idx) override;
+            void write_control(const std::string &control_name,
+                               int domain_type,
+                               int domain_idx,
+                               double setting) override;
+            std::vector<double> read_signals(const std::vector<geopm_request_s> &signal_config) override;
+            void write_controls(const std::vector<geopm_request_s> &control_config,
+                                const std::vector<double> &settings) override;
+            void save_control(void) override;
+            void restore_control(void) override;
+            std::function<double(const std::vector<double> &)> agg_function(const std::string &signal_name) const override;
+            std::function<std::string(double)> format_function(const std::string &signal_name) const override;
+            std::string signal_description(const std::string &signal_name) const override;
+            std::string control_description(const std::string &control_name) const override;
+            int signal_behavior(const std::string &signal_name) const override;
+            void save_control(const std::string &save_path) override;
+            void restore_control(const std::string &save_path) override;
+            std::string name(void) const override;
+        private:
+            IOGroup &iogroup(void) const;
+            /// @brief Construct the plugin if needed.
+            ///
+            /// @return The plugin, or nullptr if it failed to
+            ///         construct.
+            IOGroup *try_iogroup(void) const;
+            const std::string m_iogroup_name;
+            mutable std::map<std::string, int> m_signal_domains;
+            mutable std::map<std::string, int> m_control_domains;
+            std::function<std::unique_ptr<IOGroup>(void)> m_factory;
+            std::function<void(void)> m_on_error;
+            mutable std::unique_ptr<IOGroup> m_iogroup;
+            mutable bool m_is_failed;
+    };
+}
+
+#endif
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef MSRDATA_HPP_INCLUDE
+#define MSRDATA_HPP_INCLUDE
+
+#include <cstdint>
+
+namespace geopm
+{
+    /// @brief Definition of one bit field within an MSR.  The members
+    ///        mirror the keys of a field in the MSR JSON format and
+    ///        names are kept as strings so that they are validated
+    ///        the same way for built-in and user supplied
+    ///        definitions.
+    struct msr_field_data_s {
+        const char *name;
+        int begin_bit;
+        int end_bit;
+        const char *function;
+        double scalar;
+        const char *units;
+        bool is_writeable;
+        const char *behavior;
+        const char *aggregation;
+        /// Optional; nullptr when not provided
+        const char *description;
+    };
+
+    /// @brief Definition of one MSR and its fields.
+    struct msr_data_s {
+        const char *name;
+        uint64_t offset;
+        const char *domain;
+        const msr_field_data_s *field;
+        int num_field;
+    };
+
+    /// @brief A set of MSR definitions sorted by MSR name, with the
+    ///        fields of each MSR sorted by field name.
+    struct msr_table_s {
+        const msr_data_s *msr;
+        int num_msr;
+    };
+
+    /// @brief MSR definitions compiled into the library.  Each is
+    ///        generated at build time from the matching
+    ///        json_data/msr_data_*.json file.
+    const msr_table_s &arch_msr_table(void);
+    const msr_table_s &knl_msr_table(void);
+    const msr_table_s &hsx_msr_table(void);
+    const msr_table_s &snb_msr_table(void);
+    const msr_table_s &skx_msr_table(void);
+    const msr_table_s &spr_msr_table(void);
+}
+
+#endif
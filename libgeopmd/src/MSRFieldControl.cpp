@@ -36,6 +36,8 @@ namespace geopm
         , m_save_idx(-1)
         , m_restore_idx(-1)
         , m_saved_msr_value(0)
+        , m_write_ctx(-1)
+        , m_write_ctx_idx(-1)
     {
         if (m_msrio == nullptr) {
             throw Exception("MSRFieldControl: cannot construct with null MSRIO",
@@ -117,6 +119,31 @@ namespace geopm
         return result;
     }
 
+    double MSRFieldControl::decode(uint64_t field) const
+    {
+        uint64_t subfield = (field & m_mask) >> m_shift;
+        double result = NAN;
+        uint64_t float_y, float_z;
+        switch (m_function) {
+            case MSR::M_FUNCTION_SCALE:
+            case MSR::M_FUNCTION_LOGIC:
+                result = subfield;
+                break;
+            case MSR::M_FUNCTION_LOG_HALF:
+                result = 1.0 / (1ULL << subfield);
+                break;
+            case MSR::M_FUNCTION_7_BIT_FLOAT:
+                float_y = subfield & 0x1F;
+                float_z = subfield >> 5;
+                result = (1ULL << float_y) * (1.0 + float_z / 4.0);
+                break;
+            default:
+                GEOPM_DEBUG_ASSERT(false, "unsupported encode function");
+                break;
+        }
+        return result / m_inverse;
+    }
+
     void MSRFieldControl::adjust(double value)
     {
         GEOPM_DEBUG_ASSERT(m_msrio != nullptr, "null MSRIO");
@@ -146,6 +173,29 @@ namespace geopm
         m_msrio->adjust(m_restore_idx, m_saved_msr_value, m_mask, m_save_restore_ctx);
     }
 
+    double MSRFieldControl::sample_save_restore(void) const
+    {
+        GEOPM_DEBUG_ASSERT(m_msrio != nullptr, "null MSRIO");
+        return decode(m_msrio->sample(m_save_idx, m_save_restore_ctx));
+    }
+
+    void MSRFieldControl::add_write_context(int ctx)
+    {
+        GEOPM_DEBUG_ASSERT(m_msrio != nullptr, "null MSRIO");
+        m_write_ctx = ctx;
+        m_write_ctx_idx = m_msrio->add_write(m_cpu, m_offset, m_write_ctx);
+    }
+
+    void MSRFieldControl::adjust_write_context(double value)
+    {
+        GEOPM_DEBUG_ASSERT(m_msrio != nullptr, "null MSRIO");
+        if (m_write_ctx_idx == -1) {
+            throw Exception("MSRFieldControl::adjust_write_context(): cannot adjust before add_write_context()",
+                            GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        m_msrio->adjust(m_write_ctx_idx, encode(value), m_mask, m_write_ctx);
+    }
+
     void MSRFieldControl::add_save_restore_context(int ctx)
     {
         GEOPM_DEBUG_ASSERT(m_msrio != nullptr, "null MSRIO");
@@ -39,8 +39,19 @@ namespace geopm
             void save(void) override;
             void restore(void) override;
             void add_save_restore_context(int);
+            /// @brief Value in SI units of the field from the most
+            ///        recent read of the save/restore batch context.
+            double sample_save_restore(void) const;
+            /// @brief Add a write of the field to a batch context
+            ///        used to write several controls at once.
+            void add_write_context(int ctx);
+            /// @brief Adjust the field in the context given to
+            ///        add_write_context() so that the next write of
+            ///        that context applies the value.
+            void adjust_write_context(double value);
         private:
             uint64_t encode(double value) const;
+            double decode(uint64_t field) const;
 
             std::shared_ptr<MSRIO> m_msrio;
             int m_save_restore_ctx;
@@ -56,6 +67,8 @@ namespace geopm
             int m_save_idx;
             int m_restore_idx;
             uint64_t m_saved_msr_value;
+            int m_write_ctx;
+            int m_write_ctx_idx;
     };
 }
 
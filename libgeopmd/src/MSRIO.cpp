@@ -48,6 +48,7 @@ namespace geopm
         , m_path(std::move(path))
         , m_batch_reader(std::move(batch_reader))
         , m_batch_writer(std::move(batch_writer))
+        , m_num_write_skipped(0)
     {
         create_batch_context();
         open_all();
@@ -106,6 +107,7 @@ namespace geopm
                     << " write_mask=0x" << write_mask;
             throw Exception(err_str.str(), GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
+        invalidate_written(cpu_idx, offset, -1);
         uint64_t write_value = read_msr(cpu_idx, offset);
         write_value &= ~write_mask;
         write_value |= raw_value;
@@ -183,6 +185,8 @@ namespace geopm
             ctx.m_write_batch_op.push_back(wr);
             ctx.m_write_val.push_back(0);
             ctx.m_write_mask.push_back(0);  // will be widened to match writes by adjust()
+            ctx.m_written_val.push_back(0);
+            ctx.m_written_mask.push_back(0);  // nothing is known until first write
             ctx.m_write_batch_idx_map[cpu_idx][offset] = result;
         }
         else {
@@ -301,30 +305,26 @@ namespace geopm
         if (ctx.m_write_batch.numops == 0) {
             return;
         }
-        GEOPM_DEBUG_ASSERT(ctx.m_write_batch.numops == ctx.m_write_batch_op.size() &&
-                           ctx.m_write_batch.ops == ctx.m_write_batch_op.data(),
+        GEOPM_DEBUG_ASSERT(ctx.m_write_batch.numops == ctx.m_dirty_op.size() &&
+                           ctx.m_write_batch.ops == ctx.m_dirty_op.data(),
                            "MSRIOImp::msr_ioctl_write(): Batch operations not updated prior to calling");
-        if (ctx.m_write_val.size() != ctx.m_write_batch.numops ||
-            ctx.m_write_mask.size() != ctx.m_write_batch.numops ||
-            ctx.m_write_batch_op.size() != ctx.m_write_batch.numops) {
+        if (ctx.m_dirty_idx.size() != ctx.m_write_batch.numops) {
             throw Exception("MSRIOImp::msr_ioctl_write(): Invalid operations stored in object, incorrectly sized",
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
         msr_ioctl(ctx.m_write_batch);
         // Modify with write mask
         int op_idx = 0;
-        for (auto &op_it : ctx.m_write_batch_op) {
+        for (auto &op_it : ctx.m_dirty_op) {
+            int write_idx = ctx.m_dirty_idx[op_idx];
             op_it.isrdmsr = 0;
-            op_it.msrdata &= ~ctx.m_write_mask[op_idx];
-            op_it.msrdata |= ctx.m_write_val[op_idx];
-            GEOPM_DEBUG_ASSERT((~op_it.wmask & ctx.m_write_mask[op_idx]) == 0ULL,
+            op_it.msrdata &= ~ctx.m_write_mask[write_idx];
+            op_it.msrdata |= ctx.m_write_val[write_idx];
+            GEOPM_DEBUG_ASSERT((~op_it.wmask & ctx.m_write_mask[write_idx]) == 0ULL,
                                "MSRIOImp::msr_ioctl_write(): Write mask violation at write time");
             ++op_idx;
         }
         msr_ioctl(ctx.m_write_batch);
-        for (auto &op_it : ctx.m_write_batch_op) {
-            op_it.isrdmsr = 1;
-        }
     }
 
     void MSRIOImp::msr_read_files(int batch_ctx)
@@ -386,19 +386,22 @@ namespace geopm
     void MSRIOImp::msr_rmw_files(int batch_ctx)
     {
         auto &write_batch = m_batch_context.at(batch_ctx).m_write_batch;
-        auto &write_batch_op = m_batch_context.at(batch_ctx).m_write_batch_op;
+        auto &dirty_op = m_batch_context.at(batch_ctx).m_dirty_op;
+        auto &dirty_idx = m_batch_context.at(batch_ctx).m_dirty_idx;
         auto &write_mask = m_batch_context.at(batch_ctx).m_write_mask;
         auto &write_val = m_batch_context.at(batch_ctx).m_write_val;
         if (write_batch.numops == 0) {
             return;
         }
-        GEOPM_DEBUG_ASSERT(write_batch.numops == write_batch_op.size() &&
-                           write_batch.ops == write_batch_op.data(),
+        GEOPM_DEBUG_ASSERT(write_batch.numops == dirty_op.size() &&
+                           write_batch.ops == dirty_op.data(),
                            "Batch operations not updated prior to calling "
                            "MSRIOImp::msr_rmw_files()");
 
         if (!m_batch_writer) {
-            m_batch_writer = IOUring::make_unique(write_batch.numops);
+            // Size the queue for the case where every operation is dirty
+            m_batch_writer = IOUring::make_unique(
+                m_batch_context.at(batch_ctx).m_write_batch_op.size());
         }
 
         // Read existing MSR values
@@ -406,11 +409,12 @@ namespace geopm
 
         // Modify with write mask
         int op_idx = 0;
-        for (auto &op_it : write_batch_op) {
+        for (auto &op_it : dirty_op) {
+            int write_idx = dirty_idx[op_idx];
             op_it.isrdmsr = 0;
-            op_it.msrdata &= ~write_mask[op_idx];
-            op_it.msrdata |= write_val[op_idx];
-            GEOPM_DEBUG_ASSERT((~op_it.wmask & write_mask[op_idx]) == 0ULL,
+            op_it.msrdata &= ~write_mask[write_idx];
+            op_it.msrdata |= write_val[write_idx];
+            GEOPM_DEBUG_ASSERT((~op_it.wmask & write_mask[write_idx]) == 0ULL,
                                "MSRIOImp::msr_rmw_files(): Write mask "
                                "violation at write time");
             ++op_idx;
@@ -418,9 +422,6 @@ namespace geopm
 
         // Write back the modified MSRs
         msr_batch_io(*m_batch_writer, write_batch);
-        for (auto &op_it : write_batch_op) {
-            op_it.isrdmsr = 1;
-        }
     }
 
     void MSRIOImp::read_batch(void)
@@ -453,8 +454,12 @@ namespace geopm
     void MSRIOImp::write_batch(int batch_ctx)
     {
         m_batch_context_s &ctx = m_batch_context.at(batch_ctx);
-        ctx.m_write_batch.numops = ctx.m_write_batch_op.size();
-        ctx.m_write_batch.ops = ctx.m_write_batch_op.data();
+        // Only write the MSRs with adjusted bits that differ from
+        // the last write.  Fields that share an MSR were already
+        // merged into one operation by add_write().
+        update_dirty(ctx);
+        ctx.m_write_batch.numops = ctx.m_dirty_op.size();
+        ctx.m_write_batch.ops = ctx.m_dirty_op.data();
 
         // Use the batch-oriented MSR-safe ioctl twice (batch-read, modify,
         // batch-write) if possible. Otherwise, operate over individual
@@ -465,11 +470,59 @@ namespace geopm
         else {
             msr_rmw_files(batch_ctx);
         }
+        for (int write_idx : ctx.m_dirty_idx) {
+            uint64_t mask = ctx.m_write_mask[write_idx];
+            ctx.m_written_val[write_idx] &= ~mask;
+            ctx.m_written_val[write_idx] |= ctx.m_write_val[write_idx];
+            ctx.m_written_mask[write_idx] |= mask;
+            const auto &op = ctx.m_write_batch_op[write_idx];
+            invalidate_written(op.cpu, op.msr, batch_ctx);
+        }
         std::fill(ctx.m_write_val.begin(), ctx.m_write_val.end(), 0ULL);
         std::fill(ctx.m_write_mask.begin(), ctx.m_write_mask.end(), 0ULL);
         ctx.m_is_batch_read = true;
     }
 
+    void MSRIOImp::update_dirty(struct m_batch_context_s &ctx)
+    {
+        ctx.m_dirty_op.clear();
+        ctx.m_dirty_idx.clear();
+        int num_op = ctx.m_write_batch_op.size();
+        for (int write_idx = 0; write_idx != num_op; ++write_idx) {
+            uint64_t mask = ctx.m_write_mask[write_idx];
+            bool is_known = (ctx.m_written_mask[write_idx] & mask) == mask;
+            if (mask == 0ULL ||
+                (is_known && (ctx.m_written_val[write_idx] & mask) == ctx.m_write_val[write_idx])) {
+                ++m_num_write_skipped;
+            }
+            else {
+                ctx.m_dirty_op.push_back(ctx.m_write_batch_op[write_idx]);
+                ctx.m_dirty_idx.push_back(write_idx);
+            }
+        }
+    }
+
+    void MSRIOImp::invalidate_written(int cpu_idx, uint64_t offset, int skip_ctx)
+    {
+        int num_ctx = m_batch_context.size();
+        for (int ctx_idx = 0; ctx_idx != num_ctx; ++ctx_idx) {
+            if (ctx_idx == skip_ctx) {
+                continue;
+            }
+            auto &ctx = m_batch_context[ctx_idx];
+            const auto &idx_map = ctx.m_write_batch_idx_map.at(cpu_idx);
+            auto idx_it = idx_map.find(offset);
+            if (idx_it != idx_map.end()) {
+                ctx.m_written_mask[idx_it->second] = 0ULL;
+            }
+        }
+    }
+
+    uint64_t MSRIOImp::num_write_skipped(void) const
+    {
+        return m_num_write_skipped;
+    }
+
     int MSRIOImp::msr_desc(int cpu_idx)
     {
         if (cpu_idx < 0 || cpu_idx > m_num_cpu) {
@@ -139,6 +139,11 @@ namespace geopm
             /// @return The msr-safe write mask or all 1's if not using
             ///         msr-safe.
             virtual uint64_t system_write_mask(uint64_t offset) = 0;
+            /// @brief Number of MSR writes that write_batch() has
+            ///        skipped because the value was not adjusted or
+            ///        was adjusted to the value last written.
+            /// @return Count of skipped writes over all batch contexts.
+            virtual uint64_t num_write_skipped(void) const = 0;
     };
 }
 
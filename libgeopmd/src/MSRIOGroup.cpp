@@ -8,6 +8,7 @@
 
 #include <stdlib.h>
 #include <cmath>
+#include <cstring>
 #include <sstream>
 #include <algorithm>
 #include <utility>
@@ -27,12 +28,14 @@
 #include "MSRFieldSignal.hpp"
 #include "DifferenceSignal.hpp"
 #include "TimeSignal.hpp"
+#include "MSRWriteSkippedSignal.hpp"
 #include "DerivativeSignal.hpp"
 #include "RatioSignal.hpp"
 #include "MultiplicationSignal.hpp"
 #include "Control.hpp"
 #include "MSRFieldControl.hpp"
 #include "DomainControl.hpp"
+#include "geopm/PlatformIO.hpp"
 #include "geopm/PlatformTopo.hpp"
 #include "geopm/Helper.hpp"
 #include "geopm_debug.hpp"
@@ -48,13 +51,6 @@ using json11::Json;
 
 namespace geopm
 {
-    const std::string arch_msr_json(void);
-    const std::string knl_msr_json(void);
-    const std::string hsx_msr_json(void);
-    const std::string snb_msr_json(void);
-    const std::string skx_msr_json(void);
-    const std::string spr_msr_json(void);
-
     const std::string MSRIOGroup::M_DEFAULT_DESCRIPTION =
         "Refer to the Intel(R) 64 and IA-32 Architectures Software Developer's "
         "Manual for information about this MSR";
@@ -65,58 +61,63 @@ namespace geopm
     // Return true if turbo ratio limits are writable in all domains that
     // report writability.  Return false otherwise. In debug builds, print a
     // warning if there is mixed writability across domains.
-    static bool is_trl_writable_in_all_domains(const Json &msr_json,
+    static bool is_trl_writable_in_all_domains(const msr_table_s &table,
                                                const PlatformTopo &topo,
                                                std::shared_ptr<MSRIO> &msrio)
     {
         bool is_writable = false;
-        const auto &msr_obj = msr_json.object_items();
-        auto platform_info_obj_it = msr_obj.find("PLATFORM_INFO");
-
-        if (platform_info_obj_it != msr_obj.end()) {
-            auto platform_info_obj = platform_info_obj_it->second.object_items();
-            auto platform_info_offset = std::stoull(
-                platform_info_obj["offset"].string_value(), 0, 16);
-            auto domain_type = PlatformTopo::domain_name_to_type(
-                platform_info_obj["domain"].string_value());
-            auto items = platform_info_obj["fields"].object_items();
-            auto trl_mode_it = items.find("PROGRAMMABLE_RATIO_LIMITS_TURBO_MODE");
-
-            if (trl_mode_it != items.end()) {
-                auto begin_bit = (int)(trl_mode_it->second["begin_bit"].number_value());
-                auto end_bit = (int)(trl_mode_it->second["end_bit"].number_value());
-                int function = MSR::string_to_function(
-                    trl_mode_it->second["function"].string_value());
-                double scalar = trl_mode_it->second["scalar"].number_value();
-
-                int num_domain = topo.num_domain(domain_type);
-                int num_domain_with_writable_trl = 0;
-                for (int domain_idx = 0; domain_idx < num_domain; ++domain_idx) {
-                    std::set<int> cpus = topo.domain_nested(
-                        GEOPM_DOMAIN_CPU, domain_type, domain_idx);
-                    int cpu_idx = *(cpus.begin());
-                    auto platform_info_msr = std::make_shared<RawMSRSignal>(
-                        msrio, cpu_idx, platform_info_offset);
-                    auto trl_mode_signal = geopm::make_unique<MSRFieldSignal>(
-                        platform_info_msr, begin_bit, end_bit, function, scalar);
-
-                    num_domain_with_writable_trl += trl_mode_signal->read() != 0;
-                }
+        const msr_data_s *platform_info = std::find_if(
+            table.msr, table.msr + table.num_msr,
+            [](const msr_data_s &msr) {
+                return std::strcmp(msr.name, "PLATFORM_INFO") == 0;
+            });
+        const msr_field_data_s *trl_mode = nullptr;
+        if (platform_info != table.msr + table.num_msr) {
+            trl_mode = std::find_if(
+                platform_info->field, platform_info->field + platform_info->num_field,
+                [](const msr_field_data_s &field) {
+                    return std::strcmp(field.name, "PROGRAMMABLE_RATIO_LIMITS_TURBO_MODE") == 0;
+                });
+            if (trl_mode == platform_info->field + platform_info->num_field) {
+                trl_mode = nullptr;
+            }
+        }
 
-                if (num_domain_with_writable_trl == num_domain) {
-                    is_writable = true;
-                }
-                else if (num_domain_with_writable_trl != 0) {
+        if (trl_mode != nullptr) {
+            auto platform_info_offset = platform_info->offset;
+            auto domain_type = PlatformTopo::domain_name_to_type(platform_info->domain);
+            auto begin_bit = trl_mode->begin_bit;
+            auto end_bit = trl_mode->end_bit;
+            int function = MSR::string_to_function(trl_mode->function);
+            double scalar = trl_mode->scalar;
+
+            int num_domain = topo.num_domain(domain_type);
+            int num_domain_with_writable_trl = 0;
+            for (int domain_idx = 0; domain_idx < num_domain; ++domain_idx) {
+                std::set<int> cpus = topo.domain_nested(
+                    GEOPM_DOMAIN_CPU, domain_type, domain_idx);
+                int cpu_idx = *(cpus.begin());
+                auto platform_info_msr = std::make_shared<RawMSRSignal>(
+                    msrio, cpu_idx, platform_info_offset);
+                auto trl_mode_signal = geopm::make_unique<MSRFieldSignal>(
+                    platform_info_msr, begin_bit, end_bit, function, scalar);
+
+                num_domain_with_writable_trl += trl_mode_signal->read() != 0;
+            }
+
+            if (num_domain_with_writable_trl == num_domain) {
+                is_writable = true;
+            }
+            else if (num_domain_with_writable_trl != 0) {
 #ifdef GEOPM_DEBUG
-                    std::cerr
-                        << "Warning: <geopm> " << num_domain_with_writable_trl
-                        << " out of " << num_domain
-                        << " entries for PROGRAMMABLE_RATIO_LIMITS_TURBO_MODE "
-                           "indicate writable turbo ratio limits; defaulting "
-                           "to no writable turbo ratio limits"
-                        << std::endl;
+                std::cerr
+                    << "Warning: <geopm> " << num_domain_with_writable_trl
+                    << " out of " << num_domain
+                    << " entries for PROGRAMMABLE_RATIO_LIMITS_TURBO_MODE "
+                       "indicate writable turbo ratio limits; defaulting "
+                       "to no writable turbo ratio limits"
+                    << std::endl;
 #endif
-                }
             }
         }
 
@@ -124,7 +125,7 @@ namespace geopm
     }
 
     static std::set<std::string> get_msr_config_paths_from_directory(
-        const std::string &config_dir_path)
+        const std::string &config_dir_path, bool do_warn)
     {
         std::set<std::string> msr_config_paths;
         try {
@@ -137,8 +138,10 @@ namespace geopm
             }
         }
         catch (const geopm::Exception &ex) {
-            std::cerr << "Warning: <geopm> Unable to read MSR configuration from "
-                      << config_dir_path << ". Reason: " << ex.what() << std::endl;
+            if (do_warn) {
+                std::cerr << "Warning: <geopm> Unable to read MSR configuration from "
+                          << config_dir_path << ". Reason: " << ex.what() << std::endl;
+            }
         }
         return msr_config_paths;
     }
@@ -155,6 +158,7 @@ namespace geopm
         : m_platform_topo(topo)
         , m_msrio(std::move(msrio))
         , m_save_restore_ctx(m_msrio->create_batch_context())
+        , m_write_controls_ctx(m_msrio->create_batch_context())
         , m_cpuid(std::move(cpuid))
         , m_num_cpu(num_cpu)
         , m_is_active(false)
@@ -170,10 +174,10 @@ namespace geopm
         , m_mock_save_ctl(std::move(save_control))
     {
         // Load available signals and controls from files
-        parse_json_msrs(arch_msr_json());
+        add_msr_table(arch_msr_table());
         try {
             // Try to extend list of MSRs if CPUID is recognized
-            parse_json_msrs(platform_data(m_cpuid->cpuid()));
+            add_msr_table(platform_table(m_cpuid->cpuid()));
         }
         catch (const Exception &ex) {
             // Only load architectural MSRs
@@ -250,6 +254,7 @@ namespace geopm
                 for (const auto &mfcv : dc->controls()) {
                     auto mfc = std::static_pointer_cast<MSRFieldControl>(mfcv);
                     mfc->add_save_restore_context(m_save_restore_ctx);
+                    mfc->add_write_context(m_write_controls_ctx);
                 }
             }
         }
@@ -257,6 +262,17 @@ namespace geopm
         register_frequency_signals();
         register_frequency_controls();
 
+        // register count of unchanged MSR writes elided by write_batch()
+        m_signal_available["MSR::BATCH_WRITE_SKIPPED"] = {
+            std::vector<std::shared_ptr<Signal> >({std::make_shared<MSRWriteSkippedSignal>(m_msrio)}),
+            GEOPM_DOMAIN_BOARD,
+            IOGroup::M_UNITS_NONE,
+            Agg::select_first,
+            "Number of MSR writes skipped by batch writes because the "
+            "adjusted value matched the value last written",
+            IOGroup::M_SIGNAL_BEHAVIOR_MONOTONE,
+            string_format_integer};
+
         register_signal_alias("CPU_TIMESTAMP_COUNTER", "MSR::TIME_STAMP_COUNTER:TIMESTAMP_COUNT");
 
         register_signal_alias("CPU_ENERGY", "MSR::PKG_ENERGY_STATUS:ENERGY");
@@ -938,10 +954,64 @@ namespace geopm
         control->write(setting);
     }
 
+    std::vector<double> MSRIOGroup::read_signals(const std::vector<geopm_request_s> &signal_config)
+    {
+        std::vector<double> result;
+        result.reserve(signal_config.size());
+        for (const auto &request : signal_config) {
+            result.push_back(read_signal(request.name, request.domain_type, request.domain_idx));
+        }
+        return result;
+    }
+
+    void MSRIOGroup::write_controls(const std::vector<geopm_request_s> &control_config,
+                                    const std::vector<double> &settings)
+    {
+        if (control_config.size() != settings.size()) {
+            throw Exception("MSRIOGroup::write_controls(): number of settings does not match number of controls",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        // Raw MSR fields are adjusted in a context of their own and
+        // written together.  Aliases may update more than one field,
+        // so they are written one at a time after flushing the fields
+        // that were requested before them.
+        bool is_batch_pending = false;
+        for (size_t ctl_idx = 0; ctl_idx != control_config.size(); ++ctl_idx) {
+            const auto &request = control_config[ctl_idx];
+            std::string control_name = request.name;
+            auto ctl_it = m_control_available.find(control_name);
+            if (string_begins_with(control_name, M_NAME_PREFIX) &&
+                ctl_it != m_control_available.end() &&
+                request.domain_type == ctl_it->second.domain &&
+                request.domain_idx >= 0 &&
+                request.domain_idx < (int)ctl_it->second.controls.size()) {
+                check_control(control_name);
+                auto domain_ctl = std::static_pointer_cast<DomainControl>(
+                    ctl_it->second.controls[request.domain_idx]);
+                for (auto &cpu_ctl : domain_ctl->controls()) {
+                    std::static_pointer_cast<MSRFieldControl>(cpu_ctl)->adjust_write_context(settings[ctl_idx]);
+                }
+                is_batch_pending = true;
+            }
+            else {
+                if (is_batch_pending) {
+                    m_msrio->write_batch(m_write_controls_ctx);
+                    is_batch_pending = false;
+                }
+                write_control(control_name, request.domain_type,
+                              request.domain_idx, settings[ctl_idx]);
+            }
+        }
+        if (is_batch_pending) {
+            m_msrio->write_batch(m_write_controls_ctx);
+        }
+    }
+
     void MSRIOGroup::save_control(void)
     {
+        // A single read of the save/restore context covers every control
+        m_msrio->read_batch(m_save_restore_ctx);
         for (auto &ctl : m_control_available) {
-            m_msrio->read_batch(m_save_restore_ctx);
             for (auto &dom_ctl : ctl.second.controls) {
                 dom_ctl->save();
             }
@@ -1192,7 +1262,26 @@ namespace geopm
     {
         std::shared_ptr<SaveControl> save_ctl = m_mock_save_ctl;
         if (save_ctl == nullptr) {
-            save_ctl = SaveControl::make_unique(*this);
+            // Decode every control from one read of the save/restore
+            // context rather than calling read_signal() per domain.
+            m_msrio->read_batch(m_save_restore_ctx);
+            std::vector<SaveControl::m_setting_s> settings;
+            for (const auto &ctl : m_control_available) {
+                if (!string_begins_with(ctl.first, M_NAME_PREFIX)) {
+                    continue;
+                }
+                int num_domain = ctl.second.controls.size();
+                for (int domain_idx = 0; domain_idx != num_domain; ++domain_idx) {
+                    auto domain_ctl = std::static_pointer_cast<DomainControl>(
+                        ctl.second.controls[domain_idx]);
+                    // Signals report the first CPU in the domain
+                    auto cpu_ctl = std::static_pointer_cast<MSRFieldControl>(
+                        domain_ctl->controls().front());
+                    settings.push_back({ctl.first, ctl.second.domain, domain_idx,
+                                        cpu_ctl->sample_save_restore()});
+                }
+            }
+            save_ctl = SaveControl::make_unique(settings);
         }
         save_ctl->write_json(save_path);
     }
@@ -1206,33 +1295,33 @@ namespace geopm
         save_ctl->restore(*this);
     }
 
-    std::string MSRIOGroup::platform_data(int cpu_id)
+    const msr_table_s &MSRIOGroup::platform_table(int cpu_id)
     {
-        std::string platform_msrs;
+        const msr_table_s *platform_msrs = nullptr;
         if (cpu_id == MSRIOGroup::M_CPUID_KNL) {
-            platform_msrs = knl_msr_json();
+            platform_msrs = &knl_msr_table();
         }
         else if (cpu_id == MSRIOGroup::M_CPUID_HSX ||
                  cpu_id == MSRIOGroup::M_CPUID_BDX) {
-            platform_msrs = hsx_msr_json();
+            platform_msrs = &hsx_msr_table();
         }
         else if (cpu_id == MSRIOGroup::M_CPUID_SNB ||
                  cpu_id == MSRIOGroup::M_CPUID_IVT) {
-            platform_msrs = snb_msr_json();
+            platform_msrs = &snb_msr_table();
         }
         else if (cpu_id == MSRIOGroup::M_CPUID_SKX ||
                  cpu_id == MSRIOGroup::M_CPUID_ICX) {
-            platform_msrs = skx_msr_json();
+            platform_msrs = &skx_msr_table();
         }
         else if (cpu_id == MSRIOGroup::M_CPUID_SPR) {
-            platform_msrs = spr_msr_json();
+            platform_msrs = &spr_msr_table();
         }
         else {
             std::cerr << "Warning: <geopm> CPUID is not recognized, assuming Sky Lake Architecture Model Specific Register definitions.  These definitions may not be aligned with the features of this platform.  Read signals may return 0.0 in all cases, and failures may occur when attempting to write to control registers that are not supported."
                       << std::endl;
-            platform_msrs = skx_msr_json();
+            platform_msrs = &skx_msr_table();
         }
-        return platform_msrs;
+        return *platform_msrs;
     }
 
     std::set<std::string> MSRIOGroup::msr_data_files(MsrConfigWarningPreference_e warning_preference)
@@ -1246,7 +1335,8 @@ namespace geopm
             config_dir_paths.insert(config_dir_paths.end(), dirs.begin(), dirs.end());
         }
         for (const auto &dir : config_dir_paths) {
-            auto msr_configs_in_dir = get_msr_config_paths_from_directory(dir);
+            auto msr_configs_in_dir = get_msr_config_paths_from_directory(
+                dir, warning_preference != SILENCE_ALL_CONFIG_WARNINGS);
             data_files.insert(msr_configs_in_dir.begin(), msr_configs_in_dir.end());
         }
 
@@ -1258,7 +1348,8 @@ namespace geopm
             plugin_paths.insert(plugin_paths.end(), dirs.begin(), dirs.end());
         }
         for (const auto &dir : plugin_paths) {
-            auto msr_configs_in_dir = get_msr_config_paths_from_directory(dir);
+            auto msr_configs_in_dir = get_msr_config_paths_from_directory(
+                dir, warning_preference != SILENCE_ALL_CONFIG_WARNINGS);
             data_files.insert(msr_configs_in_dir.begin(), msr_configs_in_dir.end());
             if (!msr_configs_in_dir.empty() && warning_preference == EMIT_CONFIG_DEPRECATION_WARNING) {
                 std::cerr << "Warning: <geopm> Loading MSRIOGroup config files from "
@@ -1273,6 +1364,11 @@ namespace geopm
         return data_files;
     }
 
+    std::set<std::string> MSRIOGroup::config_file_paths(void)
+    {
+        return msr_data_files(SILENCE_ALL_CONFIG_WARNINGS);
+    }
+
     void MSRIOGroup::check_control(const std::string &control_name)
     {
         static const std::set<std::string> FREQ_CONTROL_SET {
@@ -1615,10 +1711,12 @@ namespace geopm
     }
 
 
-    void MSRIOGroup::parse_json_msrs(const std::string &str)
+    std::unique_ptr<MSRIOGroup::m_json_table_s> MSRIOGroup::parse_json_table(const std::string &str)
     {
+        auto result = geopm::make_unique<m_json_table_s>();
         std::string err;
-        Json root = Json::parse(str, err);
+        result->root = Json::parse(str, err);
+        const Json &root = result->root;
         if (!err.empty() || !root.is_object()) {
             throw Exception("MSRIOGroup::" + std::string(__func__) + "(): detected a malformed json string: " + err,
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
@@ -1626,10 +1724,59 @@ namespace geopm
 
         check_top_level(root);
 
-        auto msr_obj = root["msrs"].object_items();
+        // The table refers to strings owned by result->root, and
+        // object_items() is sorted by key like the generated tables.
+        const auto &msr_obj = root["msrs"].object_items();
+        result->field.resize(msr_obj.size());
+        auto field_it = result->field.begin();
+        for (const auto &msr : msr_obj) {
+            const std::string &msr_name = msr.first;
+            const Json &msr_root = msr.second;
+            check_msr_root(msr_root, msr_name);
+
+            const auto &fields_obj = msr_root["fields"].object_items();
+            for (const auto &field : fields_obj) {
+                const std::string &field_name = field.first;
+                const Json &field_root = field.second;
+                check_msr_field(field_root, msr_name, field_name);
+                const auto &field_data = field_root.object_items();
+                const char *description = nullptr;
+                if (field_data.find("description") != field_data.end()) {
+                    description = field_root["description"].string_value().c_str();
+                }
+                field_it->push_back({field_name.c_str(),
+                                     (int)(field_root["begin_bit"].number_value()),
+                                     (int)(field_root["end_bit"].number_value()),
+                                     field_root["function"].string_value().c_str(),
+                                     field_root["scalar"].number_value(),
+                                     field_root["units"].string_value().c_str(),
+                                     field_root["writeable"].bool_value(),
+                                     field_root["behavior"].string_value().c_str(),
+                                     field_root["aggregation"].string_value().c_str(),
+                                     description});
+            }
+            result->msr.push_back({msr_name.c_str(),
+                                   std::stoull(msr_root["offset"].string_value(), 0, 16),
+                                   msr_root["domain"].string_value().c_str(),
+                                   field_it->data(),
+                                   (int)field_it->size()});
+            ++field_it;
+        }
+        result->table = {result->msr.data(), (int)result->msr.size()};
+        return result;
+    }
+
+    void MSRIOGroup::parse_json_msrs(const std::string &str)
+    {
+        auto json_table = parse_json_table(str);
+        add_msr_table(json_table->table);
+    }
+
+    void MSRIOGroup::add_msr_table(const msr_table_s &table)
+    {
         bool is_trl_writable = false;
         try {
-            is_trl_writable = is_trl_writable_in_all_domains(root["msrs"], m_platform_topo, m_msrio);
+            is_trl_writable = is_trl_writable_in_all_domains(table, m_platform_topo, m_msrio);
         }
         catch (const Exception &ex) {
 #ifdef GEOPM_DEBUG
@@ -1639,41 +1786,30 @@ namespace geopm
 #endif
         }
 
-        for (const auto &msr : msr_obj) {
-            std::string msr_name = msr.first;
-            Json msr_root = msr.second;
-            check_msr_root(msr_root, msr_name);
-
-            auto msr_data = msr_root.object_items();
-            uint64_t msr_offset = std::stoull(msr_data["offset"].string_value(), 0, 16);
-            int domain_type = PlatformTopo::domain_name_to_type(msr_data["domain"].string_value());
+        for (const msr_data_s *msr = table.msr; msr != table.msr + table.num_msr; ++msr) {
+            std::string msr_name = msr->name;
+            uint64_t msr_offset = msr->offset;
+            int domain_type = PlatformTopo::domain_name_to_type(msr->domain);
 
             add_raw_msr_signal(msr_name, domain_type, msr_offset);
 
-            /// Validate fields within MSR
-            auto fields_obj = msr_data["fields"].object_items();
-            for (const auto &field : fields_obj) {
-                std::string field_name = field.first;
-                Json field_root = field.second;
-                std::string msr_field_name = msr_name + ":" + field_name;
+            for (const msr_field_data_s *field = msr->field;
+                 field != msr->field + msr->num_field; ++field) {
+                std::string msr_field_name = msr_name + ":" + field->name;
                 std::string sig_ctl_name = M_NAME_PREFIX + msr_field_name;
 
-                check_msr_field(field_root, msr_name, field_name);
-
-                // field is valid, add to list
-                auto field_data = field.second.object_items();
-                int begin_bit = (int)(field_data["begin_bit"].number_value());
-                int end_bit = (int)(field_data["end_bit"].number_value());
-                int function = MSR::string_to_function(field_data["function"].string_value());
-                double scalar = field_data["scalar"].number_value();
-                int units = IOGroup::string_to_units(field_data["units"].string_value());
-                bool is_control = field_data["writeable"].bool_value();
-                int behavior = IOGroup::string_to_behavior(field_data["behavior"].string_value());
-                std::string agg_function = field_data["aggregation"].string_value();
+                int begin_bit = field->begin_bit;
+                int end_bit = field->end_bit;
+                int function = MSR::string_to_function(field->function);
+                double scalar = field->scalar;
+                int units = IOGroup::string_to_units(field->units);
+                bool is_control = field->is_writeable;
+                int behavior = IOGroup::string_to_behavior(field->behavior);
+                std::string agg_function = field->aggregation;
                 // optional fields
                 std::string description = M_DEFAULT_DESCRIPTION;
-                if (field_data.find("description") != field_data.end()) {
-                    description = field_data["description"].string_value();
+                if (field->description != nullptr) {
+                    description = field->description;
                 }
 
                 if (m_rdt_info.rdt_support && (msr_field_name == "QM_EVTSEL:RMID" || msr_field_name == "PQR_ASSOC:RMID")) {
@@ -1730,20 +1866,18 @@ namespace geopm
                                                const PlatformTopo &topo,
                                                std::shared_ptr<MSRIO> msrio)
     {
-        std::string err;
-        Json root = Json::parse(str, err);
-        if (!err.empty() || !root.is_object()) {
-            throw Exception("MSRIOGroup::" + std::string(__func__) + "(): detected a malformed json string: " + err,
-                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
-        }
-
-        check_top_level(root);
-
-        auto msr_obj = root["msrs"].object_items();
+        auto json_table = parse_json_table(str);
+        add_msr_table_allowlist(json_table->table, allowlist_data, topo, msrio);
+    }
 
+    void MSRIOGroup::add_msr_table_allowlist(const msr_table_s &table,
+                                             std::map<uint64_t, std::pair<uint64_t, std::string> > &allowlist_data,
+                                             const PlatformTopo &topo,
+                                             std::shared_ptr<MSRIO> msrio)
+    {
         bool is_trl_writable = false;
         try {
-            is_trl_writable = is_trl_writable_in_all_domains(root["msrs"], topo, msrio);
+            is_trl_writable = is_trl_writable_in_all_domains(table, topo, msrio);
         }
         catch (const Exception &ex) {
             std::cerr << "warning: <geopm> msriogroup::" << std::string(__func__)
@@ -1752,27 +1886,15 @@ namespace geopm
             throw;
         }
 
-        for (const auto &msr : msr_obj) {
-            std::string msr_name = msr.first;
-            Json msr_root = msr.second;
-
-            check_msr_root(msr_root, msr_name);
-
-            auto msr_data = msr.second.object_items();
-            uint64_t msr_offset = std::stoull(msr_data["offset"].string_value(), 0, 16);
-            auto fields_obj = msr_data["fields"].object_items();
+        for (const msr_data_s *msr = table.msr; msr != table.msr + table.num_msr; ++msr) {
+            std::string msr_name = msr->name;
             uint64_t combined_write_mask = 0;
-            for (const auto &field : fields_obj) {
-                std::string field_name = field.first;
-                Json field_root = field.second;
-                std::string msr_field_name = msr_name + ":" + field_name;
-
-                check_msr_field(field_root, msr_name, field_name);
-
-                auto field_data = field.second.object_items();
-                int begin_bit = (int)(field_data["begin_bit"].number_value());
-                int end_bit = (int)(field_data["end_bit"].number_value());
-                bool is_control = field_data["writeable"].bool_value();
+            for (const msr_field_data_s *field = msr->field;
+                 field != msr->field + msr->num_field; ++field) {
+                std::string msr_field_name = msr_name + ":" + field->name;
+                int begin_bit = field->begin_bit;
+                int end_bit = field->end_bit;
+                bool is_control = field->is_writeable;
 
                 if (is_trl_writable &&
                     string_begins_with(msr_field_name,
@@ -1784,7 +1906,7 @@ namespace geopm
                     combined_write_mask |= (((1ULL << (end_bit - begin_bit + 1)) - 1) << begin_bit);
                 }
             }
-            allowlist_data[msr_offset] =
+            allowlist_data[msr->offset] =
                 std::pair<uint64_t, std::string>(combined_write_mask, msr_name);
         }
     }
@@ -1816,9 +1938,9 @@ namespace geopm
                                           std::shared_ptr<MSRIO> msrio)
     {
         std::map<uint64_t, std::pair<uint64_t, std::string> > allowlist_data;
-        parse_json_msrs_allowlist(arch_msr_json(), allowlist_data, topo, msrio);
+        add_msr_table_allowlist(arch_msr_table(), allowlist_data, topo, msrio);
         try {
-            parse_json_msrs_allowlist(platform_data(cpuid), allowlist_data, topo, msrio);
+            add_msr_table_allowlist(platform_table(cpuid), allowlist_data, topo, msrio);
         }
         catch (const Exception &ex) {
             // Write only architectural MSRs
@@ -19,6 +19,8 @@
 #include "geopm_time.h"
 
 #include "geopm/IOGroup.hpp"
+#include "MultiRequestIOGroup.hpp"
+#include "MSRData.hpp"
 
 extern "C"
 {
@@ -34,7 +36,7 @@ namespace geopm
     class SaveControl;
 
     /// @brief IOGroup that provides signals and controls based on MSRs.
-    class MSRIOGroup : public IOGroup
+    class MSRIOGroup : public IOGroup, public MultiRequestIOGroup
     {
         public:
             enum m_cpuid_e {
@@ -80,6 +82,9 @@ namespace geopm
                                int domain_type,
                                int domain_idx,
                                double setting) override;
+            std::vector<double> read_signals(const std::vector<geopm_request_s> &signal_config) override;
+            void write_controls(const std::vector<geopm_request_s> &control_config,
+                                const std::vector<double> &settings) override;
             void save_control(void) override;
             void restore_control(void) override;
             std::function<double(const std::vector<double> &)> agg_function(const std::string &signal_name) const override;
@@ -94,6 +99,9 @@ namespace geopm
             /// @brief Parse a JSON string and add any raw MSRs and
             ///        fields as available signals and controls.
             void parse_json_msrs(const std::string &str);
+            /// @brief Add the raw MSRs and fields in a table as
+            ///        available signals and controls.
+            void add_msr_table(const msr_table_s &table);
             /// @brief Fill string with the msr-safe allowlist file
             ///        contents reflecting all known MSRs for the
             ///        specified platform.
@@ -109,6 +117,20 @@ namespace geopm
             static std::string plugin_name(void);
             static std::unique_ptr<IOGroup> make_plugin(void);
             static std::unique_ptr<IOGroup> make_plugin_safe(void);
+            /// @brief Paths of the JSON files that define additional
+            ///        MSRs.
+            static std::set<std::string> config_file_paths(void);
+            /// @brief MSR definitions parsed from JSON along with the
+            ///        storage that the table refers to.
+            struct m_json_table_s {
+                json11::Json root;
+                std::vector<std::vector<msr_field_data_s> > field;
+                std::vector<msr_data_s> msr;
+                msr_table_s table;
+            };
+            /// @brief Parse and validate a JSON string of MSR
+            ///        definitions.
+            static std::unique_ptr<m_json_table_s> parse_json_table(const std::string &str);
         private:
             /// @brief Parse the given JSON string and update the
             ///        allowlist data map.
@@ -116,6 +138,12 @@ namespace geopm
                                                   std::map<uint64_t, std::pair<uint64_t, std::string> > &allowlist_data,
                                                   const PlatformTopo &topo,
                                                   std::shared_ptr<MSRIO> msrio);
+            /// @brief Update the allowlist data map with the MSRs in
+            ///        a table.
+            static void add_msr_table_allowlist(const msr_table_s &table,
+                                                std::map<uint64_t, std::pair<uint64_t, std::string> > &allowlist_data,
+                                                const PlatformTopo &topo,
+                                                std::shared_ptr<MSRIO> msrio);
             /// @brief Format a string with the msr-safe allowlist file contents
             ///        reflecting all known MSRs for the current platform.
             /// @param [in] allowlist_data Map from MSR offset to
@@ -124,13 +152,15 @@ namespace geopm
             ///        an msr-safe allowlist file.
             static std::string format_allowlist(const std::map<uint64_t, std::pair<uint64_t, std::string> > &allowlist_data);
 
-            /// @brief Return the JSON string for the MSR data
-            ///        associated with the given cpuid.
-            static std::string platform_data(int cpu_id);
+            /// @brief Return the built-in MSR definitions associated
+            ///        with the given cpuid.
+            static const msr_table_s &platform_table(int cpu_id);
 
             enum MsrConfigWarningPreference_e {
                 SILENCE_CONFIG_DEPRECATION_WARNING,
                 EMIT_CONFIG_DEPRECATION_WARNING,
+                /// Also silence the warning for unreadable directories
+                SILENCE_ALL_CONFIG_WARNINGS,
             };
             /// @brief Returns the filenames for user-defined MSRs if
             ///        found in the plugin path.
@@ -210,6 +240,7 @@ namespace geopm
             const PlatformTopo &m_platform_topo;
             std::shared_ptr<MSRIO> m_msrio;
             int m_save_restore_ctx;
+            int m_write_controls_ctx;
             std::shared_ptr<Cpuid> m_cpuid;
             int m_num_cpu;
             bool m_is_active;
@@ -47,6 +47,7 @@ namespace geopm
             void adjust(int batch_idx, uint64_t value, uint64_t write_mask) override;
             void adjust(int batch_idx, uint64_t value, uint64_t write_mask, int batch_ctx) override;
             uint64_t system_write_mask(uint64_t offset) override;
+            uint64_t num_write_skipped(void) const override;
         private:
             struct m_msr_batch_op_s {
                 uint16_t cpu;      /// @brief In: CPU to execute {rd/wr}msr ins.
@@ -82,6 +83,14 @@ namespace geopm
                 std::vector<std::map<uint64_t, int> > m_write_batch_idx_map;
                 std::vector<uint64_t> m_write_val;
                 std::vector<uint64_t> m_write_mask;
+                /// Bits last written by write_batch() for each write
+                /// operation and the mask of bits that are known.
+                std::vector<uint64_t> m_written_val;
+                std::vector<uint64_t> m_written_mask;
+                /// Subset of write operations that changed since the
+                /// last write_batch() and their indices.
+                std::vector<struct m_msr_batch_op_s> m_dirty_op;
+                std::vector<int> m_dirty_idx;
             };
 
             void open_all(void);
@@ -98,6 +107,12 @@ namespace geopm
             void msr_batch_io(IOUring &batcher, struct m_msr_batch_array_s &batch);
             void msr_read_files(int batch_ctx);
             void msr_rmw_files(int batch_ctx);
+            /// @brief Select the write operations with values that
+            ///        differ from the last write.
+            void update_dirty(struct m_batch_context_s &ctx);
+            /// @brief Forget the last written value for an MSR in all
+            ///        contexts other than skip_ctx.
+            void invalidate_written(int cpu_idx, uint64_t offset, int skip_ctx);
 
             const int m_num_cpu;
             std::vector<int> m_file_desc;
@@ -108,6 +123,7 @@ namespace geopm
             std::shared_ptr<MSRPath> m_path;
             std::shared_ptr<IOUring> m_batch_reader;
             std::shared_ptr<IOUring> m_batch_writer;
+            uint64_t m_num_write_skipped;
     };
 }
 
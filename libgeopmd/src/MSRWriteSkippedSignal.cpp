@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "MSRWriteSkippedSignal.hpp"
+
+#include "geopm/Exception.hpp"
+#include "MSRIO.hpp"
+
+namespace geopm
+{
+    MSRWriteSkippedSignal::MSRWriteSkippedSignal(std::shared_ptr<MSRIO> msrio)
+        : m_msrio(std::move(msrio))
+        , m_is_batch_ready(false)
+    {
+
+    }
+
+    void MSRWriteSkippedSignal::setup_batch(void)
+    {
+        if (!m_is_batch_ready) {
+            m_is_batch_ready = true;
+        }
+    }
+
+    double MSRWriteSkippedSignal::sample(void)
+    {
+        if (!m_is_batch_ready) {
+            throw Exception("setup_batch() must be called before sample().",
+                            GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        return read();
+    }
+
+    double MSRWriteSkippedSignal::read(void) const
+    {
+        return m_msrio->num_write_skipped();
+    }
+}
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef MSRWRITESKIPPEDSIGNAL_HPP_INCLUDE
+#define MSRWRITESKIPPEDSIGNAL_HPP_INCLUDE
+
+#include <memory>
+
+#include "Signal.hpp"
+
+namespace geopm
+{
+    class MSRIO;
+
+    /// A signal used by the MSRIOGroup to report the number of
+    /// batched MSR writes that were skipped because the value did
+    /// not change.
+    class MSRWriteSkippedSignal : public Signal
+    {
+        public:
+            MSRWriteSkippedSignal(std::shared_ptr<MSRIO> msrio);
+            MSRWriteSkippedSignal(const MSRWriteSkippedSignal &other) = delete;
+            MSRWriteSkippedSignal &operator=(const MSRWriteSkippedSignal &other) = delete;
+            virtual ~MSRWriteSkippedSignal() = default;
+            void setup_batch(void) override;
+            double sample(void) override;
+            double read(void) const override;
+        private:
+            std::shared_ptr<MSRIO> m_msrio;
+            bool m_is_batch_ready;
+    };
+}
+
+#endif
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "config.h"
+
+#include "MultiRequestIOGroup.hpp"
+
+#include "geopm/Exception.hpp"
+#include "geopm/IOGroup.hpp"
+#include "geopm/PlatformIO.hpp"
+
+namespace geopm
+{
+    std::vector<double> MultiRequestIOGroup::read_signals(IOGroup &io_group,
+                                                          const std::vector<geopm_request_s> &signal_config)
+    {
+        auto multi = dynamic_cast<MultiRequestIOGroup *>(&io_group);
+        if (multi != nullptr) {
+            return multi->read_signals(signal_config);
+        }
+        std::vector<double> result;
+        result.reserve(signal_config.size());
+        for (const auto &request : signal_config) {
+            result.push_back(io_group.read_signal(request.name, request.domain_type, request.domain_idx));
+        }
+        return result;
+    }
+
+    void MultiRequestIOGroup::write_controls(IOGroup &io_group,
+                                             const std::vector<geopm_request_s> &control_config,
+                                             const std::vector<double> &settings)
+    {
+        if (control_config.size() != settings.size()) {
+            throw Exception("MultiRequestIOGroup::write_controls(): number of settings does not match number of controls",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        auto multi = dynamic_cast<MultiRequestIOGroup *>(&io_group);
+        if (multi != nullptr) {
+            multi->write_controls(control_config, settings);
+            return;
+        }
+        for (size_t control_idx = 0; control_idx != control_config.size(); ++control_idx) {
+            const auto &request = control_config[control_idx];
+            io_group.write_control(request.name, request.domain_type, request.domain_idx,
+                                   settings[control_idx]);
+        }
+    }
+
+    bool MultiRequestIOGroup::is_multi_request(const IOGroup &io_group)
+    {
+        return dynamic_cast<const MultiRequestIOGroup *>(&io_group) != nullptr;
+    }
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef MULTIREQUESTIOGROUP_HPP_INCLUDE
+#define MULTIREQUESTIOGROUP_HPP_INCLUDE
+
+#include <vector>
+
+struct geopm_request_s;
+
+namespace geopm
+{
+    class IOGroup;
+
+    /// @brief Internal interface implemented by IOGroups that can
+    ///        read or write several requests at a lower cost than
+    ///        one at a time, like a round trip to a service.
+    ///
+    /// This interface is not part of the IOGroup plugin API.  Callers
+    /// reach it through the static helpers, which fall back to
+    /// read_signal() and write_control() for any other IOGroup.
+    class MultiRequestIOGroup
+    {
+        public:
+            MultiRequestIOGroup() = default;
+            virtual ~MultiRequestIOGroup() = default;
+            /// @brief Read several signals at once, with the same
+            ///        semantics as calling read_signal() for each
+            ///        request in order.
+            /// @param [in] signal_config Name, domain type and domain
+            ///        index of each signal to read.
+            /// @return The value in SI units of each signal, in
+            ///         request order.
+            virtual std::vector<double> read_signals(const std::vector<geopm_request_s> &signal_config) = 0;
+            /// @brief Write several controls at once, with the same
+            ///        semantics as calling write_control() for each
+            ///        request in order.
+            /// @param [in] control_config Name, domain type and
+            ///        domain index of each control to write.
+            /// @param [in] settings Value in SI units to write to
+            ///        each control, aligned with control_config.
+            virtual void write_controls(const std::vector<geopm_request_s> &control_config,
+                                        const std::vector<double> &settings) = 0;
+            /// @brief Read several signals from any IOGroup, in one
+            ///        request if it implements this interface.
+            static std::vector<double> read_signals(IOGroup &io_group,
+                                                    const std::vector<geopm_request_s> &signal_config);
+            /// @brief Write several controls to any IOGroup, in one
+            ///        request if it implements this interface.
+            static void write_controls(IOGroup &io_group,
+                                       const std::vector<geopm_request_s> &control_config,
+                                       const std::vector<double> &settings);
+            /// @brief Returns true if the IOGroup implements this
+            ///        interface.
+            static bool is_multi_request(const IOGroup &io_group);
+    };
+}
+
+#endif
@@ -24,6 +24,10 @@
 #include "BatchServer.hpp"
 #include "CombinedControl.hpp"
 #include "CombinedSignal.hpp"
+#include "IOGroupCache.hpp"
+#include "LazyIOGroup.hpp"
+#include "MultiRequestIOGroup.hpp"
+#include "ReplayIOGroup.hpp"
 #include "ServiceIOGroup.hpp"
 
 namespace geopm
@@ -49,7 +53,8 @@ namespace geopm
     }
 
     PlatformIOImp::PlatformIOImp()
-        : PlatformIOImp({}, platform_topo())
+        : PlatformIOImp({}, platform_topo(),
+                        IOGroupCache::is_disabled() ? nullptr : IOGroupCache::make_unique())
     {
 
     }
@@ -230,6 +235,14 @@ namespace geopm
 
     PlatformIOImp::PlatformIOImp(std::list<std::shared_ptr<IOGroup> > iogroup_list,
                                  const PlatformTopo &topo)
+        : PlatformIOImp(std::move(iogroup_list), topo, nullptr)
+    {
+
+    }
+
+    PlatformIOImp::PlatformIOImp(std::list<std::shared_ptr<IOGroup> > iogroup_list,
+                                 const PlatformTopo &topo,
+                                 std::shared_ptr<IOGroupCache> iogroup_cache)
         : m_is_signal_active(false)
         , m_is_control_active(false)
         , m_platform_topo(topo)
@@ -237,18 +250,113 @@ namespace geopm
         , m_do_restore(false)
     {
         if (m_iogroup_list.empty()) {
-            for (const auto &it : IOGroup::iogroup_names()) {
+            load_iogroups(iogroup_cache);
+        }
+    }
+
+    std::shared_ptr<IOGroup> PlatformIOImp::load_iogroup(const std::string &iogroup_name)
+    {
+        std::shared_ptr<IOGroup> result;
+        try {
+            result = IOGroup::make_unique(iogroup_name);
+        }
+        catch (const geopm::Exception &ex) {
+#ifdef GEOPM_DEBUG
+            std::cerr << "Warning: <geopm> Failed to load " << iogroup_name << " IOGroup.  "
+                      << "GEOPM may not work properly unless an alternate "
+                      << "IOGroup plugin is loaded to provide signals/controls "
+                      << "required by the Controller and Agent."
+                      << std::endl;
+            std::cerr << "The error was: " << ex.what() << std::endl;
+#endif
+        }
+        return result;
+    }
+
+    // The names provided by these groups depend on the state of the
+    // service or on the environment, so they are not cached.
+    static bool is_iogroup_cached(const std::string &iogroup_name)
+    {
+        return iogroup_name != ServiceIOGroup::plugin_name() &&
+               iogroup_name != ReplayIOGroup::plugin_name();
+    }
+
+    void PlatformIOImp::load_iogroups(std::shared_ptr<IOGroupCache> iogroup_cache)
+    {
+        std::vector<std::string> iogroup_names = IOGroup::iogroup_names();
+        std::string cache_key;
+        std::vector<IOGroupCache::iogroup_names_s> cache_record;
+        bool is_cached = false;
+        if (iogroup_cache != nullptr) {
+            cache_key = IOGroupCache::key(iogroup_names);
+            is_cached = iogroup_cache->read(cache_key, cache_record);
+        }
+        if (is_cached) {
+            std::map<std::string, const IOGroupCache::iogroup_names_s *> record_map;
+            for (const auto &record : cache_record) {
+                record_map[record.iogroup_name] = &record;
+            }
+            for (const auto &name : iogroup_names) {
+                auto record_it = record_map.find(name);
+                if (record_it != record_map.end()) {
+                    register_iogroup(std::make_shared<LazyIOGroup>(
+                        name,
+                        record_it->second->signal_domains,
+                        record_it->second->control_domains,
+                        [name]() {
+                            return IOGroup::make_unique(name);
+                        },
+                        [iogroup_cache]() {
+                            iogroup_cache->remove();
+                        }));
+                }
+                else {
+                    // Groups that were not recorded failed to load
+                    // when the record was written, or, like the
+                    // ServiceIOGroup and ReplayIOGroup, provide names
+                    // that may change at any time.  Load them now; if
+                    // a previously failing group has become available
+                    // the record is stale.
+                    auto iogroup = load_iogroup(name);
+                    if (iogroup != nullptr) {
+                        register_iogroup(iogroup);
+                        if (is_iogroup_cached(name)) {
+                            iogroup_cache->remove();
+                        }
+                    }
+                }
+            }
+        }
+        else {
+            for (const auto &name : iogroup_names) {
+                auto iogroup = load_iogroup(name);
+                if (iogroup != nullptr) {
+                    register_iogroup(iogroup);
+                    if (iogroup_cache != nullptr &&
+                        is_iogroup_cached(name)) {
+                        IOGroupCache::iogroup_names_s record;
+                        record.iogroup_name = name;
+                        for (const auto &signal_name : iogroup->signal_names()) {
+                            record.signal_domains[signal_name] =
+                                iogroup->signal_domain_type(signal_name);
+                        }
+                        for (const auto &control_name : iogroup->control_names()) {
+                            record.control_domains[control_name] =
+                                iogroup->control_domain_type(control_name);
+                        }
+                        cache_record.push_back(std::move(record));
+                    }
+                }
+            }
+            if (iogroup_cache != nullptr) {
                 try {
-                    register_iogroup(IOGroup::make_unique(it));
+                    iogroup_cache->write(cache_key, cache_record);
                 }
                 catch (const geopm::Exception &ex) {
+                    // The cache is an optimization only
 #ifdef GEOPM_DEBUG
-                    std::cerr << "Warning: <geopm> Failed to load " << it << " IOGroup.  "
-                              << "GEOPM may not work properly unless an alternate "
-                              << "IOGroup plugin is loaded to provide signals/controls "
-                              << "required by the Controller and Agent."
-                              << std::endl;
-                    std::cerr << "The error was: " << ex.what() << std::endl;
+                    std::cerr << "Warning: <geopm> Failed to write IOGroup cache: "
+                              << ex.what() << std::endl;
 #endif
                 }
             }
@@ -519,6 +627,7 @@ namespace geopm
         std::unique_ptr<CombinedControl> combiner = geopm::make_unique<CombinedControl>(factor);
         register_combined_control(result, sub_control_idx, std::move(combiner));
         m_active_control.emplace_back(nullptr, result);
+        m_adjust_setting.push_back(NAN);
         return result;
     }
 
@@ -590,6 +699,7 @@ namespace geopm
                         result = m_active_control.size();
                         m_existing_control[ctl_tup] = result;
                         m_active_control.emplace_back(ii, group_control_idx);
+                        m_adjust_setting.push_back(NAN);
                     }
                 }
                 else {
@@ -650,6 +760,30 @@ namespace geopm
         return m_active_control.size();
     }
 
+    void PlatformIOImp::check_signal_idx(int num_signal, const int *signal_idx) const
+    {
+        int num_pushed = num_signal_pushed();
+        if (std::any_of(signal_idx, signal_idx + num_signal,
+                        [num_pushed](int idx) { return idx < 0 || idx >= num_pushed; })) {
+            throw Exception("PlatformIOImp::check_signal_idx(): signal_idx out of range",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (num_signal != 0 && !m_is_signal_active) {
+            throw Exception("PlatformIOImp::check_signal_idx(): read_batch() not called prior to call to sample()",
+                            GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+    }
+
+    void PlatformIOImp::check_control_idx(int num_control, const int *control_idx) const
+    {
+        int num_pushed = num_control_pushed();
+        if (std::any_of(control_idx, control_idx + num_control,
+                        [num_pushed](int idx) { return idx < 0 || idx >= num_pushed; })) {
+            throw Exception("PlatformIOImp::check_control_idx(): control_idx out of range",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+    }
+
     double PlatformIOImp::sample(int signal_idx)
     {
         double result = NAN;
@@ -698,7 +832,12 @@ namespace geopm
         }
         auto &group_idx_pair = m_active_control[control_idx];
         if (group_idx_pair.first != nullptr) {
-            group_idx_pair.first->adjust(group_idx_pair.second, setting);
+            // An IOGroup keeps the last adjusted value, so there is
+            // nothing to write if the setting has not changed.
+            if (setting != m_adjust_setting[control_idx]) {
+                group_idx_pair.first->adjust(group_idx_pair.second, setting);
+                m_adjust_setting[control_idx] = setting;
+            }
         }
         else {
             adjust_combined(control_idx, setting);
@@ -727,11 +866,22 @@ namespace geopm
 
     void PlatformIOImp::write_batch(void)
     {
-        for (auto &it : m_iogroup_list) {
-            it->write_batch();
+        try {
+            for (auto &it : m_iogroup_list) {
+                it->write_batch();
+            }
+        }
+        catch (...) {
+            clear_adjust_setting();
+            throw;
         }
     }
 
+    void PlatformIOImp::clear_adjust_setting(void)
+    {
+        std::fill(m_adjust_setting.begin(), m_adjust_setting.end(), NAN);
+    }
+
     double PlatformIOImp::read_signal(const std::string &signal_name,
                                       int domain_type,
                                       int domain_idx)
@@ -795,8 +945,33 @@ namespace geopm
             std::set<int> base_domain_idx = m_platform_topo.domain_nested(base_domain_type,
                                                                           domain_type, domain_idx);
             std::vector<double> values;
-            for (auto idx : base_domain_idx) {
-                values.push_back(read_signal(signal_name, base_domain_type, idx));
+            // Give the IOGroup that provides the native domain a
+            // chance to read all of the nested domains in one
+            // request.  If that fails for any reason, read each
+            // domain so that lower priority IOGroups are tried.
+            auto iogroups = find_signal_iogroup(signal_name);
+            if (signal_name.size() < NAME_MAX &&
+                !iogroups.empty() &&
+                MultiRequestIOGroup::is_multi_request(*iogroups.front()) &&
+                iogroups.front()->signal_domain_type(signal_name) == base_domain_type) {
+                std::vector<geopm_request_s> signal_config;
+                for (auto idx : base_domain_idx) {
+                    geopm_request_s request = {base_domain_type, idx, {}};
+                    strncpy(request.name, signal_name.c_str(), NAME_MAX - 1);
+                    signal_config.push_back(request);
+                }
+                try {
+                    values = MultiRequestIOGroup::read_signals(*iogroups.front(), signal_config);
+                }
+                catch (const geopm::Exception &) {
+                    values.clear();
+                }
+            }
+            if (values.size() != base_domain_idx.size()) {
+                values.clear();
+                for (auto idx : base_domain_idx) {
+                    values.push_back(read_signal(signal_name, base_domain_type, idx));
+                }
             }
             result = agg_function(signal_name)(values);
         }
@@ -821,6 +996,7 @@ namespace geopm
             throw Exception("PlatformIOImp::write_control(): domain_idx is out of range",
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
+        clear_adjust_setting();
 
         auto iogroups = find_control_iogroup(control_name);
         if (iogroups.empty()) {
@@ -872,8 +1048,35 @@ namespace geopm
                 !is_control_adjust_same(control_name)) {
                 setting /= base_domain_idx.size();
             }
-            for (auto idx : base_domain_idx) {
-                write_control(control_name, base_domain_type, idx, setting);
+            // Give the IOGroup that provides the native domain a
+            // chance to write all of the nested domains in one
+            // request.  If that fails for any reason, write each
+            // domain so that lower priority IOGroups are tried.
+            bool is_write_complete = false;
+            auto iogroups = find_control_iogroup(control_name);
+            if (control_name.size() < NAME_MAX &&
+                !iogroups.empty() &&
+                MultiRequestIOGroup::is_multi_request(*iogroups.front()) &&
+                iogroups.front()->control_domain_type(control_name) == base_domain_type) {
+                std::vector<geopm_request_s> control_config;
+                for (auto idx : base_domain_idx) {
+                    geopm_request_s request = {base_domain_type, idx, {}};
+                    strncpy(request.name, control_name.c_str(), NAME_MAX - 1);
+                    control_config.push_back(request);
+                }
+                try {
+                    MultiRequestIOGroup::write_controls(*iogroups.front(), control_config,
+                                                        std::vector<double>(control_config.size(), setting));
+                    is_write_complete = true;
+                }
+                catch (const geopm::Exception &) {
+                    is_write_complete = false;
+                }
+            }
+            if (!is_write_complete) {
+                for (auto idx : base_domain_idx) {
+                    write_control(control_name, base_domain_type, idx, setting);
+                }
             }
         }
         else {
@@ -883,6 +1086,94 @@ namespace geopm
         }
     }
 
+    void PlatformIOImp::write_controls(const std::vector<geopm_request_s> &control_config,
+                                       const std::vector<double> &settings)
+    {
+        if (control_config.size() != settings.size()) {
+            throw Exception("PlatformIOImp::write_controls(): number of settings does not match number of controls",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        // Check every request and convert it to the native domain of
+        // the IOGroup that provides it before writing anything, then
+        // give each run of consecutive requests provided by the same
+        // IOGroup to that IOGroup in one call.  Controls are written
+        // in request order.
+        struct request_run_s {
+            std::shared_ptr<IOGroup> group;
+            std::vector<geopm_request_s> control_config;
+            std::vector<double> settings;
+        };
+        std::vector<request_run_s> request_run;
+        for (size_t ctl_idx = 0; ctl_idx != control_config.size(); ++ctl_idx) {
+            const auto &request = control_config[ctl_idx];
+            std::string control_name = request.name;
+            if (request.domain_type < 0 || request.domain_type >= GEOPM_NUM_DOMAIN) {
+                throw Exception("PlatformIOImp::write_controls(): domain_type is out of range",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            if (request.domain_idx < 0 ||
+                request.domain_idx >= m_platform_topo.num_domain(request.domain_type)) {
+                throw Exception("PlatformIOImp::write_controls(): domain_idx is out of range",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            auto iogroups = find_control_iogroup(control_name);
+            if (iogroups.empty()) {
+                throw Exception("PlatformIOImp::write_controls(): control name \"" + control_name + "\" not found",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            auto &group = iogroups.front();
+            int base_domain_type = group->control_domain_type(control_name);
+            std::set<int> base_domain_idx;
+            double setting = settings[ctl_idx];
+            if (base_domain_type == request.domain_type) {
+                base_domain_idx.insert(request.domain_idx);
+            }
+            else if (m_platform_topo.is_nested_domain(base_domain_type, request.domain_type)) {
+                base_domain_idx = m_platform_topo.domain_nested(base_domain_type,
+                                                                request.domain_type,
+                                                                request.domain_idx);
+                if (!base_domain_idx.empty() &&
+                    !is_control_adjust_same(control_name)) {
+                    setting /= base_domain_idx.size();
+                }
+            }
+            else {
+                throw Exception("PlatformIOImp::write_controls(): domain " + std::to_string(request.domain_type) +
+                                " is not valid for control \"" + control_name + "\"",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            if (request_run.empty() || request_run.back().group != group) {
+                request_run.push_back({group, {}, {}});
+            }
+            auto &run = request_run.back();
+            for (auto domain_idx : base_domain_idx) {
+                run.control_config.push_back({base_domain_type, domain_idx, {}});
+                strncpy(run.control_config.back().name, request.name, NAME_MAX - 1);
+                run.settings.push_back(setting);
+            }
+        }
+        clear_adjust_setting();
+        for (const auto &run : request_run) {
+            try {
+                MultiRequestIOGroup::write_controls(*run.group, run.control_config, run.settings);
+            }
+            catch (const geopm::Exception &ex) {
+                // Only an IOGroup that wrote nothing may be retried
+                // one request at a time, so that lower priority
+                // IOGroups are tried.  Any other error may have left
+                // part of the batch written.
+                if (ex.err_value() != GEOPM_ERROR_NOT_IMPLEMENTED) {
+                    throw;
+                }
+                for (size_t ctl_idx = 0; ctl_idx != run.control_config.size(); ++ctl_idx) {
+                    const auto &request = run.control_config[ctl_idx];
+                    write_control(request.name, request.domain_type,
+                                  request.domain_idx, run.settings[ctl_idx]);
+                }
+            }
+        }
+    }
+
     void PlatformIOImp::save_control(void)
     {
         m_do_restore = true;
@@ -897,6 +1188,7 @@ namespace geopm
             throw Exception("PlatformIOImp::restore_control(): Called prior to save_control()",
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
+        clear_adjust_setting();
         for (auto it = m_iogroup_list.rbegin();
              it != m_iogroup_list.rend();
              ++it) {
@@ -914,6 +1206,7 @@ namespace geopm
 
     void PlatformIOImp::restore_control(const std::string &save_dir)
     {
+        clear_adjust_setting();
         for (auto &it : m_iogroup_list) {
             std::string save_path = save_dir + '/' + it->name() + "-save-control.json";
             it->restore_control(save_path);
@@ -1031,6 +1324,88 @@ namespace geopm
     {
         return !std::isnan(value);
     }
+
+    std::vector<int> PlatformIO::push_signals(const std::vector<geopm_request_s> &signal_config)
+    {
+        std::vector<int> result;
+        result.reserve(signal_config.size());
+        for (const auto &request : signal_config) {
+            result.push_back(push_signal(request.name,
+                                         request.domain_type,
+                                         request.domain_idx));
+        }
+        return result;
+    }
+
+    std::vector<int> PlatformIO::push_controls(const std::vector<geopm_request_s> &control_config)
+    {
+        std::vector<int> result;
+        result.reserve(control_config.size());
+        for (const auto &request : control_config) {
+            result.push_back(push_control(request.name,
+                                          request.domain_type,
+                                          request.domain_idx));
+        }
+        return result;
+    }
+
+    void PlatformIO::sample_array(int num_signal, const int *signal_idx, double *result)
+    {
+        if (num_signal < 0) {
+            throw Exception("PlatformIO::sample_array(): num_signal is negative",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        auto imp = dynamic_cast<const PlatformIOImp *>(this);
+        if (imp != nullptr) {
+            // Every index is checked up front, so the result can be
+            // written in place
+            imp->check_signal_idx(num_signal, signal_idx);
+            for (int ii = 0; ii < num_signal; ++ii) {
+                result[ii] = sample(signal_idx[ii]);
+            }
+        }
+        else {
+            std::vector<double> sample_value(num_signal);
+            for (int ii = 0; ii < num_signal; ++ii) {
+                sample_value[ii] = sample(signal_idx[ii]);
+            }
+            std::copy(sample_value.begin(), sample_value.end(), result);
+        }
+    }
+
+    void PlatformIO::adjust_array(int num_control, const int *control_idx, const double *setting)
+    {
+        if (num_control < 0) {
+            throw Exception("PlatformIO::adjust_array(): num_control is negative",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (std::any_of(setting, setting + num_control,
+                        [](double value) { return std::isnan(value); })) {
+            throw Exception("PlatformIO::adjust_array(): setting is NAN",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        auto imp = dynamic_cast<const PlatformIOImp *>(this);
+        if (imp != nullptr) {
+            imp->check_control_idx(num_control, control_idx);
+        }
+        for (int ii = 0; ii < num_control; ++ii) {
+            adjust(control_idx[ii], setting[ii]);
+        }
+    }
+
+    void PlatformIO::write_controls(const std::vector<geopm_request_s> &control_config,
+                                    const std::vector<double> &settings)
+    {
+        if (control_config.size() != settings.size()) {
+            throw Exception("PlatformIO::write_controls(): number of settings does not match number of controls",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        for (size_t ctl_idx = 0; ctl_idx != control_config.size(); ++ctl_idx) {
+            const auto &request = control_config[ctl_idx];
+            write_control(request.name, request.domain_type,
+                          request.domain_idx, settings[ctl_idx]);
+        }
+    }
 }
 
 extern "C" {
@@ -1228,6 +1603,76 @@ extern "C" {
         return err;
     }
 
+    int geopm_pio_push_signal_array(int num_request,
+                                    const struct geopm_request_s *request,
+                                    int *signal_idx)
+    {
+        int err = 0;
+        try {
+            if (num_request < 0 ||
+                (num_request != 0 && (request == nullptr || signal_idx == nullptr))) {
+                throw geopm::Exception("geopm_pio_push_signal_array(): invalid request array",
+                                       GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            std::vector<geopm_request_s> request_vec(request, request + num_request);
+            std::vector<int> result = geopm::platform_io().push_signals(request_vec);
+            std::copy(result.begin(), result.end(), signal_idx);
+        }
+        catch (...) {
+            err = geopm::exception_handler(std::current_exception());
+            err = err < 0 ? err : GEOPM_ERROR_RUNTIME;
+        }
+        return err;
+    }
+
+    int geopm_pio_push_control_array(int num_request,
+                                     const struct geopm_request_s *request,
+                                     int *control_idx)
+    {
+        int err = 0;
+        try {
+            if (num_request < 0 ||
+                (num_request != 0 && (request == nullptr || control_idx == nullptr))) {
+                throw geopm::Exception("geopm_pio_push_control_array(): invalid request array",
+                                       GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            std::vector<geopm_request_s> request_vec(request, request + num_request);
+            std::vector<int> result = geopm::platform_io().push_controls(request_vec);
+            std::copy(result.begin(), result.end(), control_idx);
+        }
+        catch (...) {
+            err = geopm::exception_handler(std::current_exception());
+            err = err < 0 ? err : GEOPM_ERROR_RUNTIME;
+        }
+        return err;
+    }
+
+    int geopm_pio_sample_array(int num_signal, const int *signal_idx, double *result)
+    {
+        int err = 0;
+        try {
+            geopm::platform_io().sample_array(num_signal, signal_idx, result);
+        }
+        catch (...) {
+            err = geopm::exception_handler(std::current_exception());
+            err = err < 0 ? err : GEOPM_ERROR_RUNTIME;
+        }
+        return err;
+    }
+
+    int geopm_pio_adjust_array(int num_control, const int *control_idx, const double *setting)
+    {
+        int err = 0;
+        try {
+            geopm::platform_io().adjust_array(num_control, control_idx, setting);
+        }
+        catch (...) {
+            err = geopm::exception_handler(std::current_exception());
+            err = err < 0 ? err : GEOPM_ERROR_RUNTIME;
+        }
+        return err;
+    }
+
     int geopm_pio_read_batch(void)
     {
         int err = 0;
@@ -20,6 +20,7 @@ namespace geopm
     class CombinedControl;
     class PlatformTopo;
     class BatchServer;
+    class IOGroupCache;
 
     class PlatformIOImp : public PlatformIO
     {
@@ -27,6 +28,16 @@ namespace geopm
             PlatformIOImp();
             PlatformIOImp(std::list<std::shared_ptr<IOGroup> > iogroup_list,
                           const PlatformTopo &topo);
+            /// @brief Constructor that loads the IOGroup plugins if
+            ///        iogroup_list is empty.
+            ///
+            /// @param [in] iogroup_cache If not null, plugins recorded
+            ///        in the cache are constructed only when first
+            ///        used, and the cache is written if it does not
+            ///        describe the current set of plugins.
+            PlatformIOImp(std::list<std::shared_ptr<IOGroup> > iogroup_list,
+                          const PlatformTopo &topo,
+                          std::shared_ptr<IOGroupCache> iogroup_cache);
             PlatformIOImp(const PlatformIOImp &other) = delete;
             PlatformIOImp &operator=(const PlatformIOImp &other) = delete;
             virtual ~PlatformIOImp() = default;
@@ -52,6 +63,8 @@ namespace geopm
                                int domain_type,
                                int domain_idx,
                                double setting) override;
+            void write_controls(const std::vector<geopm_request_s> &control_config,
+                                const std::vector<double> &settings) override;
             void save_control(void) override;
             void restore_control(void) override;
             std::function<double(const std::vector<double> &)> agg_function(const std::string &signal_name) const override;
@@ -70,7 +83,21 @@ namespace geopm
 
             int num_signal_pushed(void) const;  // Used for testing only
             int num_control_pushed(void) const; // Used for testing only
+            /// @brief Check that every index may be passed to
+            ///        sample(), used by sample_array() to validate
+            ///        all indices before any value is written.
+            void check_signal_idx(int num_signal, const int *signal_idx) const;
+            /// @brief Check that every index may be passed to
+            ///        adjust(), used by adjust_array() to validate
+            ///        all indices before any control is adjusted.
+            void check_control_idx(int num_control, const int *control_idx) const;
         private:
+            /// @brief Register all IOGroup plugins, deferring
+            ///        construction of those described by the cache.
+            void load_iogroups(std::shared_ptr<IOGroupCache> iogroup_cache);
+            /// @brief Construct an IOGroup plugin, returning nullptr
+            ///        if it fails to load.
+            static std::shared_ptr<IOGroup> load_iogroup(const std::string &iogroup_name);
             /// @brief Push a signal that aggregates values sampled
             ///        from other signals.  The aggregation function
             ///        used is determined by a call to agg_function()
@@ -132,12 +159,19 @@ namespace geopm
             ///        setting will be divided by the number of subdomains
             ///        before being applied.
             bool is_control_adjust_same(const std::string &control_name) const;
+            /// @brief Forget the adjusted settings after the
+            ///        controls may have been modified outside of
+            ///        write_batch().
+            void clear_adjust_setting(void);
             bool m_is_signal_active;
             bool m_is_control_active;
             const PlatformTopo &m_platform_topo;
             std::list<std::shared_ptr<IOGroup> > m_iogroup_list;
             std::vector<std::pair<std::shared_ptr<IOGroup>, int> > m_active_signal;
             std::vector<std::pair<std::shared_ptr<IOGroup>, int> > m_active_control;
+            /// Last setting passed to adjust() for each pushed
+            /// control, NAN when the IOGroup state is not known.
+            std::vector<double> m_adjust_setting;
             std::map<std::tuple<std::string, int, int>, int> m_existing_signal;
             std::map<std::tuple<std::string, int, int>, int> m_existing_control;
             std::map<int, std::pair<std::vector<int>,
@@ -9,14 +9,17 @@
 #include <signal.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
 #include <sys/sysinfo.h>
 #include <sys/time.h>
 #include <unistd.h>
+#include <fcntl.h>
 #include <string.h>
 #include <errno.h>
 #include <limits.h>
 #include <stdio.h>
 
+#include <algorithm>
 #include <map>
 #include <fstream>
 #include <sstream>
@@ -25,6 +28,7 @@
 
 #include "geopm_sched.h"
 #include "geopm_time.h"
+#include "geopm_hash.h"
 #include "geopm/Exception.hpp"
 #include "geopm/Helper.hpp"
 #include "GPUTopo.hpp"
@@ -77,6 +81,7 @@ namespace geopm
 {
     const std::string PlatformTopoImp::M_CACHE_FILE_NAME = "/tmp/geopm-topo-cache-" + std::to_string(getuid());
     const std::string PlatformTopoImp::M_SERVICE_CACHE_FILE_NAME = "/run/geopm/geopm-topo-cache";
+    const std::string PlatformTopoImp::M_BINARY_CACHE_SUFFIX = ".bin";
 
     const PlatformTopo &platform_topo(void)
     {
@@ -85,11 +90,19 @@ namespace geopm
     }
 
     PlatformTopoImp::PlatformTopoImp()
-        : PlatformTopoImp("", try_service_proxy())
+        : PlatformTopoImp("", try_service_proxy(), binary_cache_path())
     {
 
     }
 
+    std::string PlatformTopoImp::binary_cache_path(void)
+    {
+        if (geopm::has_cap_sys_admin()) {
+            return M_SERVICE_CACHE_FILE_NAME + M_BINARY_CACHE_SUFFIX;
+        }
+        return M_CACHE_FILE_NAME + M_BINARY_CACHE_SUFFIX;
+    }
+
     std::unique_ptr<ServiceProxy> PlatformTopoImp::try_service_proxy(void)
     {
         std::unique_ptr<ServiceProxy> result;
@@ -112,15 +125,117 @@ namespace geopm
 
     PlatformTopoImp::PlatformTopoImp(const std::string &test_cache_file_name,
                                      std::shared_ptr<ServiceProxy> service_proxy)
+        : PlatformTopoImp(test_cache_file_name, service_proxy, "")
+    {
+
+    }
+
+    PlatformTopoImp::PlatformTopoImp(const std::string &test_cache_file_name,
+                                     std::shared_ptr<ServiceProxy> service_proxy,
+                                     const std::string &binary_cache_file_name)
         : M_TEST_CACHE_FILE_NAME(test_cache_file_name)
+        , m_num_package(0)
+        , m_num_core(0)
+        , m_num_cpu(0)
         , m_service_proxy(std::move(service_proxy))
+    {
+        // The binary cache is keyed on the content of the lscpu
+        // output, so it is used whether that output was read from a
+        // file or provided by the service.
+        std::string lscpu_contents = read_lscpu();
+        m_text_key_s key = text_key(lscpu_contents);
+        if (binary_cache_file_name.empty() ||
+            !read_binary_cache(binary_cache_file_name, key)) {
+            parse_text_cache(lscpu_contents);
+            if (!binary_cache_file_name.empty()) {
+                try {
+                    write_binary_cache(binary_cache_file_name, key);
+                }
+                catch (const Exception &ex) {
+                    // The binary cache only speeds up construction;
+                    // failure to write it is not an error.
+                }
+            }
+        }
+    }
+
+    void PlatformTopoImp::parse_text_cache(const std::string &lscpu_contents)
     {
         std::map<std::string, std::string> lscpu_map;
-        lscpu(lscpu_map);
-        parse_lscpu(lscpu_map, m_num_package, m_core_per_package, m_thread_per_core);
+        lscpu(lscpu_contents, lscpu_map);
+        std::vector<int> cpu_core;
+        std::vector<int> cpu_package;
+        if (parse_lscpu_cpu_map(lscpu_map, cpu_core, cpu_package)) {
+            m_num_cpu = cpu_core.size();
+            m_num_core = *std::max_element(cpu_core.begin(), cpu_core.end()) + 1;
+            m_num_package = *std::max_element(cpu_package.begin(), cpu_package.end()) + 1;
+        }
+        else {
+            // Older cache files do not record the core of each CPU:
+            // assume Linux numbering, where the first thread of every
+            // core is enumerated before the second thread of any core.
+            int core_per_package = 0;
+            int thread_per_core = 0;
+            parse_lscpu(lscpu_map, m_num_package, core_per_package, thread_per_core);
+            m_num_core = m_num_package * core_per_package;
+            m_num_cpu = m_num_core * thread_per_core;
+            for (int cpu_idx = 0; cpu_idx != m_num_cpu; ++cpu_idx) {
+                cpu_core.push_back(cpu_idx % m_num_core);
+                cpu_package.push_back(cpu_core.back() / core_per_package);
+            }
+        }
         m_numa_map = parse_lscpu_numa(lscpu_map);
         m_gpu_info[GEOPM_DOMAIN_GPU] = parse_lscpu_gpu(lscpu_map, GEOPM_DOMAIN_GPU);
         m_gpu_info[GEOPM_DOMAIN_GPU_CHIP] = parse_lscpu_gpu(lscpu_map, GEOPM_DOMAIN_GPU_CHIP);
+        init_domain_map(cpu_core, cpu_package);
+    }
+
+    void PlatformTopoImp::init_domain_map(const std::vector<int> &cpu_core,
+                                          const std::vector<int> &cpu_package)
+    {
+        m_cpu_domain_idx.assign(GEOPM_NUM_DOMAIN, {});
+        m_domain_cpus.assign(GEOPM_NUM_DOMAIN, {});
+
+        std::set<int> board_cpus;
+        for (const auto &numa_cpus : m_numa_map) {
+            board_cpus.insert(numa_cpus.begin(), numa_cpus.end());
+        }
+        m_cpu_domain_idx[GEOPM_DOMAIN_BOARD].assign(m_num_cpu, 0);
+        m_domain_cpus[GEOPM_DOMAIN_BOARD].emplace_back(board_cpus.begin(), board_cpus.end());
+
+        m_cpu_domain_idx[GEOPM_DOMAIN_PACKAGE] = cpu_package;
+        m_cpu_domain_idx[GEOPM_DOMAIN_CORE] = cpu_core;
+        m_domain_cpus[GEOPM_DOMAIN_PACKAGE].resize(m_num_package);
+        m_domain_cpus[GEOPM_DOMAIN_CORE].resize(m_num_core);
+        m_domain_cpus[GEOPM_DOMAIN_CPU].resize(m_num_cpu);
+        for (int cpu_idx = 0; cpu_idx != m_num_cpu; ++cpu_idx) {
+            m_cpu_domain_idx[GEOPM_DOMAIN_CPU].push_back(cpu_idx);
+            m_domain_cpus[GEOPM_DOMAIN_PACKAGE][cpu_package[cpu_idx]].push_back(cpu_idx);
+            m_domain_cpus[GEOPM_DOMAIN_CORE][cpu_core[cpu_idx]].push_back(cpu_idx);
+            m_domain_cpus[GEOPM_DOMAIN_CPU][cpu_idx].push_back(cpu_idx);
+        }
+
+        for (int domain_type : {GEOPM_DOMAIN_MEMORY,
+                                GEOPM_DOMAIN_GPU,
+                                GEOPM_DOMAIN_GPU_CHIP}) {
+            const auto &domain_map = (domain_type == GEOPM_DOMAIN_MEMORY) ?
+                                     m_numa_map :
+                                     m_gpu_info.at(domain_type);
+            auto &cpu_domain_idx = m_cpu_domain_idx[domain_type];
+            cpu_domain_idx.assign(m_num_cpu, -1);
+            int domain_idx = 0;
+            for (const auto &cpu_set : domain_map) {
+                m_domain_cpus[domain_type].emplace_back(cpu_set.begin(), cpu_set.end());
+                for (int cpu_idx : cpu_set) {
+                    // Use the lowest index domain that contains the CPU.
+                    if (cpu_idx >= 0 && cpu_idx < m_num_cpu &&
+                        cpu_domain_idx[cpu_idx] == -1) {
+                        cpu_domain_idx[cpu_idx] = domain_idx;
+                    }
+                }
+                ++domain_idx;
+            }
+        }
     }
 
     int PlatformTopoImp::num_domain(int domain_type) const
@@ -134,10 +249,10 @@ namespace geopm
                 result = m_num_package;
                 break;
             case GEOPM_DOMAIN_CORE:
-                result = m_num_package * m_core_per_package;
+                result = m_num_core;
                 break;
             case GEOPM_DOMAIN_CPU:
-                result = m_num_package * m_core_per_package * m_thread_per_core;
+                result = m_num_cpu;
                 break;
             case GEOPM_DOMAIN_MEMORY:
                 for (const auto &it : m_numa_map) {
@@ -177,8 +292,8 @@ namespace geopm
         return result;
     }
 
-    std::set<int> PlatformTopoImp::domain_cpus(int domain_type,
-                                               int domain_idx) const
+    const std::vector<int> &PlatformTopoImp::domain_cpus(int domain_type,
+                                                         int domain_idx) const
     {
         if (domain_type < 0 || domain_type >= GEOPM_NUM_DOMAIN) {
             throw Exception("PlatformTopoImp::domain_cpus(): domain_type out of range",
@@ -189,50 +304,28 @@ namespace geopm
             throw Exception("PlatformTopoImp::domain_cpus(): domain_idx out of range",
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
+        if (m_domain_cpus[domain_type].empty()) {
+            throw Exception("PlatformTopoImp::domain_cpus(domain_type=" +
+                            std::to_string(domain_type) +
+                            ") support not yet implemented",
+                            GEOPM_ERROR_NOT_IMPLEMENTED, __FILE__, __LINE__);
+        }
+        return m_domain_cpus[domain_type][domain_idx];
+    }
 
-        std::set<int> cpu_idx;
-        switch (domain_type) {
-            case GEOPM_DOMAIN_BOARD:
-                for (auto &numa_cpus : m_numa_map) {
-                    cpu_idx.insert(numa_cpus.begin(), numa_cpus.end());
-                }
-                break;
-            case GEOPM_DOMAIN_GPU:
-            case GEOPM_DOMAIN_GPU_CHIP:
-                cpu_idx = m_gpu_info.at(domain_type).at(domain_idx);
-                break;
-            case GEOPM_DOMAIN_PACKAGE:
-                for (int thread_idx = 0;
-                     thread_idx != m_thread_per_core;
-                     ++thread_idx) {
-                    for (int core_idx = domain_idx * m_core_per_package;
-                         core_idx != (domain_idx + 1) * m_core_per_package;
-                         ++core_idx) {
-                        cpu_idx.insert(core_idx + thread_idx * m_core_per_package * m_num_package);
-                    }
-                }
-                break;
-            case GEOPM_DOMAIN_CORE:
-                for (int thread_idx = 0;
-                     thread_idx != m_thread_per_core;
-                     ++thread_idx) {
-                    cpu_idx.insert(domain_idx + thread_idx * m_core_per_package * m_num_package);
-                }
-                break;
-            case GEOPM_DOMAIN_CPU:
-                cpu_idx.insert(domain_idx);
-                break;
-            case GEOPM_DOMAIN_MEMORY:
-                cpu_idx = m_numa_map[domain_idx];
-                break;
-            default:
-                throw Exception("PlatformTopoImp::domain_cpus(domain_type=" +
-                                std::to_string(domain_type) +
-                                ") support not yet implemented",
-                                GEOPM_ERROR_NOT_IMPLEMENTED, __FILE__, __LINE__);
-                break;
+    const std::vector<int> &PlatformTopoImp::cpu_domain_idx(int domain_type) const
+    {
+        if (domain_type < 0 || domain_type >= GEOPM_NUM_DOMAIN) {
+            throw Exception("PlatformTopoImp::cpu_domain_idx(): domain_type out of range",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (m_cpu_domain_idx[domain_type].empty()) {
+            throw Exception("PlatformTopoImp::cpu_domain_idx(domain_type=" +
+                            std::to_string(domain_type) +
+                            ") support not yet implemented",
+                            GEOPM_ERROR_NOT_IMPLEMENTED, __FILE__, __LINE__);
         }
-        return cpu_idx;
+        return m_cpu_domain_idx[domain_type];
     }
 
     int PlatformTopoImp::domain_idx(int domain_type,
@@ -250,44 +343,15 @@ namespace geopm
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
 
-        int core_idx = 0;
-        int numa_idx = 0;
         switch (domain_type) {
             case GEOPM_DOMAIN_BOARD:
-                result = 0;
-                break;
             case GEOPM_DOMAIN_PACKAGE:
-                core_idx = cpu_idx % (m_num_package * m_core_per_package);
-                result = core_idx / m_core_per_package;
-                break;
             case GEOPM_DOMAIN_CORE:
-                result = cpu_idx % (m_num_package * m_core_per_package);
-                break;
             case GEOPM_DOMAIN_CPU:
-                result = cpu_idx;
-                break;
             case GEOPM_DOMAIN_MEMORY:
             case GEOPM_DOMAIN_GPU:
             case GEOPM_DOMAIN_GPU_CHIP:
-                {
-                const auto &domain_map = (domain_type == GEOPM_DOMAIN_MEMORY) ?
-                                         m_numa_map :
-                                         m_gpu_info.at(domain_type);
-                for (const auto &set_it : domain_map) {
-                    for (const auto &cpu_it : set_it) {
-                        if (cpu_it == cpu_idx) {
-                            result = numa_idx;
-                            // Find the lowest index numa node that contains the CPU.
-                            break;
-                        }
-                    }
-                    if (result != -1) {
-                        // Find the lowest index numa node that contains the CPU.
-                        break;
-                    }
-                    ++numa_idx;
-                }
-                }
+                result = m_cpu_domain_idx[domain_type][cpu_idx];
                 break;
             case GEOPM_DOMAIN_PACKAGE_INTEGRATED_GPU:
             case GEOPM_DOMAIN_PACKAGE_INTEGRATED_MEMORY:
@@ -364,9 +428,8 @@ namespace geopm
                             GEOPM_ERROR_INVALID, __FILE__, __LINE__);
         }
         std::set<int> inner_domain_idx;
-        std::set<int> cpus = domain_cpus(outer_domain, outer_idx);
-        for (auto cc : cpus) {
-            inner_domain_idx.insert(domain_idx(inner_domain, cc));
+        for (auto cc : domain_cpus(outer_domain, outer_idx)) {
+            inner_domain_idx.insert(inner_domain_idx.end(), domain_idx(inner_domain, cc));
         }
         return inner_domain_idx;
     }
@@ -467,7 +530,12 @@ namespace geopm
             close(tmp_fd);
 
             std::ostringstream cmd;
-            cmd << "unset LD_PRELOAD; LC_ALL=C lscpu -x >> " << tmp_path << ";";
+            // Also record the core and socket of each CPU so that
+            // irregular CPU numbering is supported.
+            cmd << "unset LD_PRELOAD; LC_ALL=C lscpu -x >> " << tmp_path << " && "
+                << "LC_ALL=C lscpu -p=CPU,CORE,SOCKET | "
+                << "sed -n 's/^\\([0-9]*\\),\\([0-9]*\\),\\([0-9]*\\)$/CPU \\1 core,socket: \\2,\\3/p' >> "
+                << tmp_path << ";";
 
             FILE *pid;
             int err = geopm_topo_popen(cmd.str().c_str(), &pid);
@@ -574,6 +642,61 @@ namespace geopm
         }
     }
 
+    bool PlatformTopoImp::parse_lscpu_cpu_map(const std::map<std::string, std::string> &lscpu_map,
+                                              std::vector<int> &cpu_core,
+                                              std::vector<int> &cpu_package)
+    {
+        std::vector<int> core_id;
+        std::vector<int> socket_id;
+        for (int cpu_idx = 0; ; ++cpu_idx) {
+            auto lscpu_it = lscpu_map.find("CPU " + std::to_string(cpu_idx) + " core,socket");
+            if (lscpu_it == lscpu_map.end()) {
+                break;
+            }
+            auto fields = geopm::string_split(lscpu_it->second, ",");
+            if (fields.size() != 2) {
+                return false;
+            }
+            try {
+                core_id.push_back(std::stoi(fields[0]));
+                socket_id.push_back(std::stoi(fields[1]));
+            }
+            catch (const std::logic_error &ex) {
+                return false;
+            }
+        }
+        // Offline CPUs are not listed: fall back to the summary
+        // unless every CPU is described.
+        auto num_cpu_it = lscpu_map.find("CPU(s)");
+        if (core_id.empty() ||
+            num_cpu_it == lscpu_map.end() ||
+            atoi(num_cpu_it->second.c_str()) != (int)core_id.size()) {
+            return false;
+        }
+        // Number cores and packages densely in the order of their IDs
+        std::map<int, int> core_rank;
+        std::map<int, int> socket_rank;
+        for (size_t cpu_idx = 0; cpu_idx != core_id.size(); ++cpu_idx) {
+            core_rank[core_id[cpu_idx]] = 0;
+            socket_rank[socket_id[cpu_idx]] = 0;
+        }
+        int rank = 0;
+        for (auto &it : core_rank) {
+            it.second = rank++;
+        }
+        rank = 0;
+        for (auto &it : socket_rank) {
+            it.second = rank++;
+        }
+        cpu_core.clear();
+        cpu_package.clear();
+        for (size_t cpu_idx = 0; cpu_idx != core_id.size(); ++cpu_idx) {
+            cpu_core.push_back(core_rank.at(core_id[cpu_idx]));
+            cpu_package.push_back(socket_rank.at(socket_id[cpu_idx]));
+        }
+        return true;
+    }
+
     std::vector<std::set<int> > PlatformTopoImp::parse_lscpu_numa(const std::map<std::string, std::string> &lscpu_map)
     {
         std::vector<std::set<int> > numa_map;
@@ -606,7 +729,7 @@ namespace geopm
             }
         }
         if (numa_map.empty()) {
-            int num_cpu = m_num_package * m_core_per_package * m_thread_per_core;
+            int num_cpu = m_num_cpu;
             numa_map.push_back({});
             for (int cpu_idx = 0; cpu_idx != num_cpu; ++cpu_idx) {
                 numa_map[0].insert(cpu_idx);
@@ -673,6 +796,274 @@ namespace geopm
         }
     }
 
+    uint32_t PlatformTopoImp::sysfs_topo_hash(void)
+    {
+        static const std::vector<std::string> paths = {
+            "/sys/devices/system/cpu/online",
+            "/sys/devices/system/cpu/present",
+            "/sys/devices/system/node/online",
+        };
+        // These files are read on every construction, so avoid the
+        // overhead of geopm::read_file().  A missing file hashes the
+        // same as an empty one.
+        std::string contents;
+        char buffer[NAME_MAX];
+        for (const auto &path : paths) {
+            int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd != -1) {
+                ssize_t num_read = 0;
+                while ((num_read = read(fd, buffer, sizeof(buffer))) > 0) {
+                    contents.append(buffer, num_read);
+                }
+                close(fd);
+            }
+            contents += "\n";
+        }
+        return geopm_crc32_str(contents.c_str());
+    }
+
+    PlatformTopoImp::m_text_key_s PlatformTopoImp::text_key(const std::string &lscpu_contents)
+    {
+        return {lscpu_contents.size(),
+                (uint32_t)geopm_crc32_str(lscpu_contents.c_str())};
+    }
+
+    // Binary cache layout, all values in host byte order:
+    //
+    // @code
+    //     char     magic[8]          "GEOPMTPC"
+    //     uint32_t version           M_BINARY_CACHE_VERSION
+    //     uint32_t sysfs_hash        sysfs_topo_hash()
+    //     uint64_t text_size         text_key() of the source lscpu output
+    //     uint32_t text_hash
+    //     uint32_t num_domain_type   GEOPM_NUM_DOMAIN
+    //     int32_t  num_package, num_core, num_cpu
+    //     for each domain type:
+    //         uint32_t num_cpu_domain_idx
+    //         int32_t  cpu_domain_idx[num_cpu_domain_idx]
+    //         uint32_t num_domain
+    //         uint32_t offset[num_domain + 1]
+    //         int32_t  domain_cpus[offset[num_domain]]
+    // @endcode
+    static const char g_binary_cache_magic[8] = {'G', 'E', 'O', 'P', 'M', 'T', 'P', 'C'};
+
+    template <typename type>
+    static void binary_cache_write(std::string &buffer, type value)
+    {
+        buffer.append((const char *)&value, sizeof(value));
+    }
+
+    template <typename type>
+    static bool binary_cache_read(const char *&pos, const char *end, type &value)
+    {
+        if ((size_t)(end - pos) < sizeof(value)) {
+            return false;
+        }
+        memcpy(&value, pos, sizeof(value));
+        pos += sizeof(value);
+        return true;
+    }
+
+    static bool binary_cache_read(const char *&pos, const char *end,
+                                  uint32_t count, std::vector<int> &values)
+    {
+        if ((size_t)(end - pos) / sizeof(int32_t) < count) {
+            return false;
+        }
+        values.resize(count);
+        memcpy(values.data(), pos, count * sizeof(int32_t));
+        pos += count * sizeof(int32_t);
+        return true;
+    }
+
+    bool PlatformTopoImp::read_binary_cache(const std::string &file_name,
+                                            const m_text_key_s &key)
+    {
+        try {
+            if (!check_file(file_name)) {
+                return false;
+            }
+        }
+        catch (const Exception &ex) {
+            return false;
+        }
+        int fd = open(file_name.c_str(), O_RDONLY | O_NOFOLLOW | O_CLOEXEC);
+        if (fd == -1) {
+            return false;
+        }
+        struct stat file_stat;
+        void *map = MAP_FAILED;
+        if (fstat(fd, &file_stat) == 0 &&
+            S_ISREG(file_stat.st_mode) &&
+            file_stat.st_uid == geteuid() &&
+            file_stat.st_size > 0) {
+            map = mmap(NULL, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        }
+        close(fd);
+        if (map == MAP_FAILED) {
+            return false;
+        }
+
+        const char *pos = (const char *)map;
+        const char *end = pos + file_stat.st_size;
+        char magic[sizeof(g_binary_cache_magic)];
+        uint32_t version = 0;
+        uint32_t sysfs_hash = 0;
+        m_text_key_s file_key {0, 0};
+        uint32_t num_domain_type = 0;
+        int32_t num_package = 0;
+        int32_t num_core = 0;
+        int32_t num_cpu = 0;
+        bool is_valid = binary_cache_read(pos, end, magic) &&
+                        memcmp(magic, g_binary_cache_magic, sizeof(magic)) == 0 &&
+                        binary_cache_read(pos, end, version) &&
+                        version == M_BINARY_CACHE_VERSION &&
+                        binary_cache_read(pos, end, sysfs_hash) &&
+                        sysfs_hash == sysfs_topo_hash() &&
+                        binary_cache_read(pos, end, file_key.size) &&
+                        binary_cache_read(pos, end, file_key.hash) &&
+                        file_key.size == key.size &&
+                        file_key.hash == key.hash &&
+                        binary_cache_read(pos, end, num_domain_type) &&
+                        num_domain_type == GEOPM_NUM_DOMAIN &&
+                        binary_cache_read(pos, end, num_package) &&
+                        binary_cache_read(pos, end, num_core) &&
+                        binary_cache_read(pos, end, num_cpu) &&
+                        num_package > 0 && num_core > 0 && num_cpu > 0;
+        std::vector<std::vector<int> > cpu_domain_idx(GEOPM_NUM_DOMAIN);
+        std::vector<std::vector<std::vector<int> > > domain_cpus(GEOPM_NUM_DOMAIN);
+        for (int domain_type = 0; is_valid && domain_type != GEOPM_NUM_DOMAIN; ++domain_type) {
+            uint32_t count = 0;
+            is_valid = binary_cache_read(pos, end, count) &&
+                       (count == 0 || count == (uint32_t)num_cpu) &&
+                       binary_cache_read(pos, end, count, cpu_domain_idx[domain_type]) &&
+                       binary_cache_read(pos, end, count) &&
+                       count < UINT32_MAX;
+            std::vector<int> offset;
+            std::vector<int> cpus;
+            is_valid = is_valid &&
+                       binary_cache_read(pos, end, count + 1, offset) &&
+                       offset[0] == 0 &&
+                       std::is_sorted(offset.begin(), offset.end()) &&
+                       binary_cache_read(pos, end, offset.back(), cpus);
+            // Every index must be in range for the lookups that trust
+            // them: CPU and domain indices, and the domain counts that
+            // num_domain() reports for the CPU based domains.
+            int num_cpu_domain = -1;
+            switch (domain_type) {
+                case GEOPM_DOMAIN_BOARD:
+                    num_cpu_domain = 1;
+                    break;
+                case GEOPM_DOMAIN_PACKAGE:
+                    num_cpu_domain = num_package;
+                    break;
+                case GEOPM_DOMAIN_CORE:
+                    num_cpu_domain = num_core;
+                    break;
+                case GEOPM_DOMAIN_CPU:
+                    num_cpu_domain = num_cpu;
+                    break;
+                default:
+                    break;
+            }
+            is_valid = is_valid &&
+                       (num_cpu_domain == -1 ||
+                        (count == (uint32_t)num_cpu_domain &&
+                         !cpu_domain_idx[domain_type].empty())) &&
+                       std::all_of(cpu_domain_idx[domain_type].begin(),
+                                   cpu_domain_idx[domain_type].end(),
+                                   [&](int domain_idx) {
+                                       return domain_idx >= (num_cpu_domain == -1 ? -1 : 0) &&
+                                              domain_idx < (int)count;
+                                   }) &&
+                       std::all_of(cpus.begin(), cpus.end(),
+                                   [&](int cpu_idx) {
+                                       return cpu_idx >= 0 && cpu_idx < num_cpu;
+                                   });
+            for (uint32_t domain_idx = 0; is_valid && domain_idx != count; ++domain_idx) {
+                domain_cpus[domain_type].emplace_back(cpus.begin() + offset[domain_idx],
+                                                      cpus.begin() + offset[domain_idx + 1]);
+            }
+        }
+        is_valid = is_valid && pos == end;
+        munmap(map, file_stat.st_size);
+        if (!is_valid) {
+            return false;
+        }
+
+        m_num_package = num_package;
+        m_num_core = num_core;
+        m_num_cpu = num_cpu;
+        m_cpu_domain_idx = std::move(cpu_domain_idx);
+        m_domain_cpus = std::move(domain_cpus);
+        m_numa_map.clear();
+        for (const auto &cpus : m_domain_cpus[GEOPM_DOMAIN_MEMORY]) {
+            m_numa_map.emplace_back(cpus.begin(), cpus.end());
+        }
+        for (int domain_type : {GEOPM_DOMAIN_GPU, GEOPM_DOMAIN_GPU_CHIP}) {
+            auto &gpu_info = m_gpu_info[domain_type];
+            gpu_info.clear();
+            for (const auto &cpus : m_domain_cpus[domain_type]) {
+                gpu_info.emplace_back(cpus.begin(), cpus.end());
+            }
+        }
+        return true;
+    }
+
+    void PlatformTopoImp::write_binary_cache(const std::string &file_name,
+                                             const m_text_key_s &key) const
+    {
+        std::string buffer(g_binary_cache_magic, sizeof(g_binary_cache_magic));
+        binary_cache_write(buffer, M_BINARY_CACHE_VERSION);
+        binary_cache_write(buffer, sysfs_topo_hash());
+        binary_cache_write(buffer, key.size);
+        binary_cache_write(buffer, key.hash);
+        binary_cache_write(buffer, (uint32_t)GEOPM_NUM_DOMAIN);
+        binary_cache_write(buffer, (int32_t)m_num_package);
+        binary_cache_write(buffer, (int32_t)m_num_core);
+        binary_cache_write(buffer, (int32_t)m_num_cpu);
+        for (int domain_type = 0; domain_type != GEOPM_NUM_DOMAIN; ++domain_type) {
+            const auto &cpu_domain_idx = m_cpu_domain_idx[domain_type];
+            const auto &domain_cpus = m_domain_cpus[domain_type];
+            binary_cache_write(buffer, (uint32_t)cpu_domain_idx.size());
+            buffer.append((const char *)cpu_domain_idx.data(),
+                          cpu_domain_idx.size() * sizeof(int32_t));
+            binary_cache_write(buffer, (uint32_t)domain_cpus.size());
+            uint32_t offset = 0;
+            binary_cache_write(buffer, offset);
+            for (const auto &cpus : domain_cpus) {
+                offset += cpus.size();
+                binary_cache_write(buffer, offset);
+            }
+            for (const auto &cpus : domain_cpus) {
+                buffer.append((const char *)cpus.data(), cpus.size() * sizeof(int32_t));
+            }
+        }
+
+        std::string tmp_string = file_name + "XXXXXX";
+        char tmp_path[NAME_MAX];
+        tmp_path[NAME_MAX - 1] = '\0';
+        strncpy(tmp_path, tmp_string.c_str(), NAME_MAX - 1);
+        mode_t orig_mask = umask(S_IRGRP | S_IWGRP | S_IXGRP | S_IROTH | S_IWOTH | S_IXOTH);
+        int tmp_fd = mkstemp(tmp_path);
+        umask(orig_mask);
+        if (tmp_fd == -1) {
+            throw Exception("PlatformTopoImp::write_binary_cache(): Could not create temp file: ",
+                            errno ? errno : GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+        }
+        ssize_t num_write = write(tmp_fd, buffer.data(), buffer.size());
+        int err = (num_write == (ssize_t)buffer.size()) ? 0 : (errno ? errno : GEOPM_ERROR_RUNTIME);
+        close(tmp_fd);
+        if (!err && rename(tmp_path, file_name.c_str())) {
+            err = errno ? errno : GEOPM_ERROR_RUNTIME;
+        }
+        if (err) {
+            unlink(tmp_path);
+            throw Exception("PlatformTopoImp::write_binary_cache(): Could not write " + file_name + ": ",
+                            err, __FILE__, __LINE__);
+        }
+    }
+
     std::string PlatformTopoImp::read_lscpu(void)
     {
         std::string result;
@@ -706,9 +1097,9 @@ namespace geopm
         return geopm::read_file(M_CACHE_FILE_NAME);
     }
 
-    void PlatformTopoImp::lscpu(std::map<std::string, std::string> &lscpu_map)
+    void PlatformTopoImp::lscpu(const std::string &lscpu_contents,
+                                std::map<std::string, std::string> &lscpu_map)
     {
-        std::string lscpu_contents = read_lscpu();
         std::istringstream lscpu_stream (lscpu_contents);
 
         std::string line;
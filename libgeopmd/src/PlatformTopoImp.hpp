@@ -8,6 +8,7 @@
 #define PLATFORMTOPOIMP_HPP_INCLUDE
 
 #include "geopm/PlatformTopo.hpp"
+#include <cstdint>
 #include <vector>
 #include <map>
 #include <memory>
@@ -23,6 +24,16 @@ namespace geopm
             PlatformTopoImp();
             PlatformTopoImp(const std::string &test_cache_file_name,
                             std::shared_ptr<ServiceProxy> service_proxy);
+            /// @param [in] binary_cache_file_name Path of the binary
+            ///        cache of the computed domain tables, or empty
+            ///        to always parse the lscpu cache.  The binary
+            ///        cache is used if it is valid, and otherwise it
+            ///        is replaced after the lscpu cache is parsed.
+            ///        It is not used when the lscpu cache is provided
+            ///        by the service.
+            PlatformTopoImp(const std::string &test_cache_file_name,
+                            std::shared_ptr<ServiceProxy> service_proxy,
+                            const std::string &binary_cache_file_name);
             virtual ~PlatformTopoImp() = default;
             int num_domain(int domain_type) const override;
             int domain_idx(int domain_type,
@@ -32,31 +43,78 @@ namespace geopm
             static void create_cache();
             static void create_cache(const std::string &cache_file_name);
             static void create_cache(const std::string &cache_file_name, const GPUTopo &gtopo);
+            /// @brief Get the Linux logical CPUs associated with the
+            ///        indexed domain.
+            ///
+            /// @return Sorted CPU indices, valid for the lifetime of
+            ///         the object.
+            const std::vector<int> &domain_cpus(int domain_type,
+                                                int domain_idx) const;
+            /// @brief Get the index of the domain that contains each
+            ///        Linux logical CPU, or -1 if no domain of the
+            ///        type contains it.
+            ///
+            /// @return Vector indexed by CPU, valid for the lifetime
+            ///         of the object.
+            const std::vector<int> &cpu_domain_idx(int domain_type) const;
+            /// @brief Version of the binary cache format; a cache
+            ///        with any other version is ignored.
+            static constexpr uint32_t M_BINARY_CACHE_VERSION = 2;
+            /// @brief Hash of the sysfs files that list the online
+            ///        CPUs and NUMA nodes.  A binary cache is only
+            ///        used while this hash matches the one that it
+            ///        was written with.
+            static uint32_t sysfs_topo_hash(void);
         private:
             static const std::string M_CACHE_FILE_NAME;
             static const std::string M_SERVICE_CACHE_FILE_NAME;
-            /// @brief Get the set of Linux logical CPUs associated
-            ///        with the indexed domain.
-            std::set<int> domain_cpus(int domain_type,
-                                      int domain_idx) const;
+            static const std::string M_BINARY_CACHE_SUFFIX;
+            // Identifies the lscpu output that the tables were parsed
+            // from, whether it was read from a file or provided by the
+            // service.
+            struct m_text_key_s {
+                uint64_t size;
+                uint32_t hash;
+            };
 
-            void lscpu(std::map<std::string, std::string> &lscpu_map);
+            static void lscpu(const std::string &lscpu_contents,
+                              std::map<std::string, std::string> &lscpu_map);
             void parse_lscpu(const std::map<std::string, std::string> &lscpu_map,
                              int &num_package,
                              int &core_per_package,
                              int &thread_per_core);
+            /// @brief Parse the core and socket of each CPU recorded
+            ///        from "lscpu -p" into dense core and package
+            ///        indices.  Returns false if the cache does not
+            ///        describe every CPU.
+            static bool parse_lscpu_cpu_map(const std::map<std::string, std::string> &lscpu_map,
+                                            std::vector<int> &cpu_core,
+                                            std::vector<int> &cpu_package);
+            void init_domain_map(const std::vector<int> &cpu_core,
+                                 const std::vector<int> &cpu_package);
             std::vector<std::set<int> > parse_lscpu_numa(const std::map<std::string, std::string> &lscpu_map);
             std::vector<std::set<int> > parse_lscpu_gpu(const std::map<std::string, std::string> &lscpu_map, int domain_type);
             std::string read_lscpu(void);
             static bool check_file(const std::string &file_name);
             static std::string gpu_short_name(int domain_type);
             static std::unique_ptr<ServiceProxy> try_service_proxy(void);
+            static std::string binary_cache_path(void);
+            static m_text_key_s text_key(const std::string &lscpu_contents);
+            bool read_binary_cache(const std::string &file_name,
+                                   const m_text_key_s &key);
+            void write_binary_cache(const std::string &file_name,
+                                    const m_text_key_s &key) const;
+            void parse_text_cache(const std::string &lscpu_contents);
             const std::string M_TEST_CACHE_FILE_NAME;
             int m_num_package;
-            int m_core_per_package;
-            int m_thread_per_core;
+            int m_num_core;
+            int m_num_cpu;
             std::vector<std::set<int> > m_numa_map;
             std::map<int, std::vector<std::set<int> > > m_gpu_info;
+            // Indexed by domain type, then CPU index
+            std::vector<std::vector<int> > m_cpu_domain_idx;
+            // Indexed by domain type, then domain index
+            std::vector<std::vector<std::vector<int> > > m_domain_cpus;
             std::shared_ptr<ServiceProxy> m_service_proxy;
     };
 }
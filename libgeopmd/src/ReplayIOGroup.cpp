@@ -0,0 +1,555 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "ReplayIOGroup.hpp"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+
+#include "geopm/Agg.hpp"
+#include "geopm/Exception.hpp"
+#include "geopm/Helper.hpp"
+#include "geopm/PlatformTopo.hpp"
+#include "geopm_topo.h"
+
+#define GEOPM_REPLAY_IO_GROUP_PLUGIN_NAME "REPLAY"
+
+namespace geopm
+{
+    // Traits of the default trace columns; all other columns are
+    // treated as variable values that are averaged.
+    const std::map<std::string, ReplayIOGroup::m_signal_traits_s> ReplayIOGroup::M_SIGNAL_TRAITS = {
+        {"TIME", {IOGroup::M_SIGNAL_BEHAVIOR_MONOTONE, Agg::select_first, string_format_double}},
+        {"EPOCH_COUNT", {IOGroup::M_SIGNAL_BEHAVIOR_MONOTONE, Agg::min, string_format_integer}},
+        {"REGION_HASH", {IOGroup::M_SIGNAL_BEHAVIOR_LABEL, Agg::region_hash, string_format_hex}},
+        {"REGION_HINT", {IOGroup::M_SIGNAL_BEHAVIOR_LABEL, Agg::region_hint, string_format_hex}},
+        {"REGION_PROGRESS", {IOGroup::M_SIGNAL_BEHAVIOR_VARIABLE, Agg::min, string_format_float}},
+        {"CPU_ENERGY", {IOGroup::M_SIGNAL_BEHAVIOR_MONOTONE, Agg::sum, string_format_double}},
+        {"DRAM_ENERGY", {IOGroup::M_SIGNAL_BEHAVIOR_MONOTONE, Agg::sum, string_format_double}},
+        {"CPU_POWER", {IOGroup::M_SIGNAL_BEHAVIOR_VARIABLE, Agg::sum, string_format_double}},
+        {"DRAM_POWER", {IOGroup::M_SIGNAL_BEHAVIOR_VARIABLE, Agg::sum, string_format_double}},
+        {"CPU_FREQUENCY_STATUS", {IOGroup::M_SIGNAL_BEHAVIOR_VARIABLE, Agg::average, string_format_double}},
+        {"CPU_CYCLES_THREAD", {IOGroup::M_SIGNAL_BEHAVIOR_MONOTONE, Agg::sum, string_format_integer}},
+        {"CPU_CYCLES_REFERENCE", {IOGroup::M_SIGNAL_BEHAVIOR_MONOTONE, Agg::sum, string_format_integer}},
+        {"CPU_CORE_TEMPERATURE", {IOGroup::M_SIGNAL_BEHAVIOR_VARIABLE, Agg::average, string_format_double}},
+    };
+
+    const ReplayIOGroup::m_signal_traits_s ReplayIOGroup::M_DEFAULT_SIGNAL_TRAITS = {
+        IOGroup::M_SIGNAL_BEHAVIOR_VARIABLE, Agg::average, string_format_double
+    };
+
+    // Read the whole file; zlib reads uncompressed files unchanged.
+    static std::string read_trace_file(const std::string &trace_path)
+    {
+        gzFile trace_file = gzopen(trace_path.c_str(), "rb");
+        if (trace_file == nullptr) {
+            throw Exception("ReplayIOGroup: unable to open trace file: " + trace_path,
+                            errno ? errno : GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        std::string result;
+        char buffer[65536];
+        int num_read = 0;
+        while ((num_read = gzread(trace_file, buffer, sizeof(buffer))) > 0) {
+            result.append(buffer, num_read);
+        }
+        gzclose(trace_file);
+        if (num_read < 0) {
+            throw Exception("ReplayIOGroup: unable to read trace file: " + trace_path,
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        return result;
+    }
+
+    static double speedup_env(void)
+    {
+        std::string speedup_str = get_env("GEOPM_REPLAY_SPEEDUP");
+        if (speedup_str.empty()) {
+            return 0.0;
+        }
+        char *end = nullptr;
+        double result = std::strtod(speedup_str.c_str(), &end);
+        if (*end != '\0') {
+            throw Exception("ReplayIOGroup: invalid GEOPM_REPLAY_SPEEDUP: " + speedup_str,
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        return result;
+    }
+
+    ReplayIOGroup::ReplayIOGroup()
+        : ReplayIOGroup(platform_topo(),
+                        get_env("GEOPM_REPLAY_TRACE"),
+                        speedup_env(),
+                        get_env("GEOPM_REPLAY_CONTROLS"),
+                        get_env("GEOPM_REPLAY_CONTROL_LOG"))
+    {
+
+    }
+
+    ReplayIOGroup::ReplayIOGroup(const PlatformTopo &topo,
+                                 const std::string &trace_path,
+                                 double speedup,
+                                 const std::string &control_spec,
+                                 const std::string &control_log_path)
+        : m_platform_topo(topo)
+        , m_speedup(speedup)
+        , m_time_column(-1)
+        , m_row_idx(0)
+        , m_is_started(false)
+        , m_is_batch_read(false)
+        , m_start_time{{0, 0}}
+    {
+        if (!(m_speedup >= 0.0)) {
+            throw Exception("ReplayIOGroup: speedup must be zero or positive",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        parse_trace(read_trace_file(trace_path));
+        if (m_speedup != 0.0 && m_time_column == -1) {
+            throw Exception("ReplayIOGroup: a TIME column is required to replay with a speedup: " + trace_path,
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        parse_control_spec(control_spec);
+        if (!control_log_path.empty()) {
+            m_control_log = std::make_unique<std::ofstream>(control_log_path);
+            if (!m_control_log->good()) {
+                throw Exception("ReplayIOGroup: unable to open control log: " + control_log_path,
+                                errno ? errno : GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            *m_control_log << "TIME|CONTROL|DOMAIN|DOMAIN_INDEX|SETTING\n";
+        }
+    }
+
+    void ReplayIOGroup::parse_trace(const std::string &trace_text)
+    {
+        std::vector<std::string> header;
+        size_t line_begin = 0;
+        int line_num = 0;
+        while (line_begin < trace_text.size()) {
+            size_t line_end = trace_text.find('\n', line_begin);
+            if (line_end == std::string::npos) {
+                line_end = trace_text.size();
+            }
+            std::string line = trace_text.substr(line_begin, line_end - line_begin);
+            line_begin = line_end + 1;
+            ++line_num;
+            if (line.empty() || line[0] == '#') {
+                continue;
+            }
+            std::vector<std::string> fields = string_split(line, "|");
+            if (header.empty()) {
+                header = std::move(fields);
+                continue;
+            }
+            if (fields.size() != header.size()) {
+                throw Exception("ReplayIOGroup: line " + std::to_string(line_num) +
+                                " of trace has " + std::to_string(fields.size()) +
+                                " fields, expected " + std::to_string(header.size()),
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            std::vector<double> row(fields.size());
+            for (size_t col_idx = 0; col_idx != fields.size(); ++col_idx) {
+                const std::string &field = fields[col_idx];
+                if (field.empty()) {
+                    row[col_idx] = NAN;
+                    continue;
+                }
+                char *end = nullptr;
+                row[col_idx] = std::strtod(field.c_str(), &end);
+                if (*end != '\0') {
+                    throw Exception("ReplayIOGroup: invalid value \"" + field +
+                                    "\" on line " + std::to_string(line_num) + " of trace",
+                                    GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+                }
+            }
+            m_rows.push_back(std::move(row));
+        }
+        if (m_rows.empty()) {
+            throw Exception("ReplayIOGroup: trace has no rows",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        // Column names are SIGNAL for the board domain, otherwise
+        // SIGNAL-DOMAIN-INDEX.
+        std::map<std::string, std::map<int, std::map<int, int> > > columns;
+        for (size_t col_idx = 0; col_idx != header.size(); ++col_idx) {
+            std::string signal_name = header[col_idx];
+            int domain_type = GEOPM_DOMAIN_BOARD;
+            int domain_idx = 0;
+            size_t idx_pos = signal_name.rfind('-');
+            size_t domain_pos = idx_pos == std::string::npos || idx_pos == 0 ?
+                                std::string::npos : signal_name.rfind('-', idx_pos - 1);
+            if (domain_pos != std::string::npos) {
+                std::string idx_str = signal_name.substr(idx_pos + 1);
+                std::string domain_str = signal_name.substr(domain_pos + 1, idx_pos - domain_pos - 1);
+                if (!idx_str.empty() &&
+                    std::all_of(idx_str.begin(), idx_str.end(), ::isdigit)) {
+                    try {
+                        domain_type = PlatformTopo::domain_name_to_type(domain_str);
+                        domain_idx = std::stoi(idx_str);
+                        signal_name = signal_name.substr(0, domain_pos);
+                    }
+                    catch (const Exception &ex) {
+                        domain_type = GEOPM_DOMAIN_BOARD;
+                    }
+                }
+            }
+            columns[signal_name][domain_type][domain_idx] = col_idx;
+        }
+        // A signal recorded for more than one domain is provided for
+        // the board domain if recorded there, otherwise for the domain
+        // with the most recorded indices.
+        for (const auto &signal_it : columns) {
+            const auto &domain_map = signal_it.second;
+            auto native_it = domain_map.find(GEOPM_DOMAIN_BOARD);
+            if (native_it == domain_map.end()) {
+                native_it = std::max_element(domain_map.begin(), domain_map.end(),
+                    [](const std::pair<const int, std::map<int, int> > &lhs,
+                       const std::pair<const int, std::map<int, int> > &rhs) {
+                        return lhs.second.size() < rhs.second.size();
+                    });
+            }
+            m_signal_available[signal_it.first] = {native_it->first, native_it->second};
+        }
+        auto time_it = m_signal_available.find("TIME");
+        if (time_it != m_signal_available.end() &&
+            time_it->second.domain_type == GEOPM_DOMAIN_BOARD) {
+            m_time_column = time_it->second.column.at(0);
+        }
+    }
+
+    void ReplayIOGroup::parse_control_spec(const std::string &control_spec)
+    {
+        if (control_spec.empty()) {
+            return;
+        }
+        for (const auto &control : string_split(control_spec, ",")) {
+            std::vector<std::string> name_domain = string_split(control, "@");
+            if (name_domain.size() > 2 || name_domain[0].empty()) {
+                throw Exception("ReplayIOGroup: invalid control \"" + control +
+                                "\", expected NAME or NAME@DOMAIN",
+                                GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+            }
+            int domain_type = GEOPM_DOMAIN_BOARD;
+            if (name_domain.size() == 2) {
+                domain_type = PlatformTopo::domain_name_to_type(name_domain[1]);
+            }
+            m_control_available[name_domain[0]] = domain_type;
+        }
+    }
+
+    std::set<std::string> ReplayIOGroup::signal_names(void) const
+    {
+        std::set<std::string> result;
+        for (const auto &sv : m_signal_available) {
+            result.insert(sv.first);
+        }
+        return result;
+    }
+
+    std::set<std::string> ReplayIOGroup::control_names(void) const
+    {
+        std::set<std::string> result;
+        for (const auto &cv : m_control_available) {
+            result.insert(cv.first);
+        }
+        return result;
+    }
+
+    bool ReplayIOGroup::is_valid_signal(const std::string &signal_name) const
+    {
+        return m_signal_available.find(signal_name) != m_signal_available.end();
+    }
+
+    bool ReplayIOGroup::is_valid_control(const std::string &control_name) const
+    {
+        return m_control_available.find(control_name) != m_control_available.end();
+    }
+
+    int ReplayIOGroup::signal_domain_type(const std::string &signal_name) const
+    {
+        int result = GEOPM_DOMAIN_INVALID;
+        auto it = m_signal_available.find(signal_name);
+        if (it != m_signal_available.end()) {
+            result = it->second.domain_type;
+        }
+        return result;
+    }
+
+    int ReplayIOGroup::control_domain_type(const std::string &control_name) const
+    {
+        int result = GEOPM_DOMAIN_INVALID;
+        auto it = m_control_available.find(control_name);
+        if (it != m_control_available.end()) {
+            result = it->second;
+        }
+        return result;
+    }
+
+    int ReplayIOGroup::signal_column(const std::string &caller,
+                                     const std::string &signal_name,
+                                     int domain_type, int domain_idx) const
+    {
+        auto it = m_signal_available.find(signal_name);
+        if (it == m_signal_available.end()) {
+            throw Exception("ReplayIOGroup::" + caller + "(): signal_name " + signal_name +
+                            " not valid for ReplayIOGroup",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (domain_type != it->second.domain_type) {
+            throw Exception("ReplayIOGroup::" + caller + "(): signal_name " + signal_name +
+                            " not defined for domain " + std::to_string(domain_type),
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        auto column_it = it->second.column.find(domain_idx);
+        if (column_it == it->second.column.end()) {
+            throw Exception("ReplayIOGroup::" + caller + "(): signal_name " + signal_name +
+                            " not recorded in trace for domain index " + std::to_string(domain_idx),
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        return column_it->second;
+    }
+
+    void ReplayIOGroup::check_control(const std::string &caller,
+                                      const std::string &control_name,
+                                      int domain_type, int domain_idx) const
+    {
+        auto it = m_control_available.find(control_name);
+        if (it == m_control_available.end()) {
+            throw Exception("ReplayIOGroup::" + caller + "(): control_name " + control_name +
+                            " not valid for ReplayIOGroup",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (domain_type != it->second) {
+            throw Exception("ReplayIOGroup::" + caller + "(): control_name " + control_name +
+                            " not defined for domain " + std::to_string(domain_type),
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (domain_idx < 0 || domain_idx >= m_platform_topo.num_domain(domain_type)) {
+            throw Exception("ReplayIOGroup::" + caller + "(): domain_idx out of range",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+    }
+
+    int ReplayIOGroup::push_signal(const std::string &signal_name, int domain_type, int domain_idx)
+    {
+        int column = signal_column("push_signal", signal_name, domain_type, domain_idx);
+        if (m_is_batch_read) {
+            throw Exception("ReplayIOGroup::push_signal(): cannot push signal after call to read_batch().",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        int result = -1;
+        auto it = std::find(m_pushed_signal_column.begin(), m_pushed_signal_column.end(), column);
+        if (it != m_pushed_signal_column.end()) {
+            result = it - m_pushed_signal_column.begin();
+        }
+        else {
+            result = m_pushed_signal_column.size();
+            m_pushed_signal_column.push_back(column);
+        }
+        return result;
+    }
+
+    int ReplayIOGroup::push_control(const std::string &control_name, int domain_type, int domain_idx)
+    {
+        check_control("push_control", control_name, domain_type, domain_idx);
+        int result = 0;
+        for (const auto &control : m_pushed_control) {
+            if (control.name == control_name &&
+                control.domain_idx == domain_idx) {
+                return result;
+            }
+            ++result;
+        }
+        m_pushed_control.push_back({control_name, domain_type, domain_idx, NAN, NAN, false});
+        return result;
+    }
+
+    void ReplayIOGroup::read_batch(void)
+    {
+        if (!m_is_started) {
+            m_is_started = true;
+            geopm_time(&m_start_time);
+        }
+        else if (m_speedup == 0.0 &&
+                 m_row_idx + 1 < m_rows.size()) {
+            ++m_row_idx;
+        }
+        if (m_speedup != 0.0) {
+            double replay_time = m_rows[0][m_time_column] +
+                                 geopm_time_since(&m_start_time) * m_speedup;
+            while (m_row_idx + 1 < m_rows.size() &&
+                   m_rows[m_row_idx + 1][m_time_column] <= replay_time) {
+                ++m_row_idx;
+            }
+        }
+        m_is_batch_read = true;
+    }
+
+    void ReplayIOGroup::write_batch(void)
+    {
+        for (auto &control : m_pushed_control) {
+            if (control.is_adjusted &&
+                !(control.setting == control.last_setting)) {
+                log_control(control.name, control.domain_type,
+                            control.domain_idx, control.setting);
+                control.last_setting = control.setting;
+            }
+        }
+    }
+
+    double ReplayIOGroup::sample(int batch_idx)
+    {
+        if (batch_idx < 0 || (size_t)batch_idx >= m_pushed_signal_column.size()) {
+            throw Exception("ReplayIOGroup::sample(): batch_idx out of range",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (!m_is_batch_read) {
+            throw Exception("ReplayIOGroup::sample(): signal has not been read",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        return m_rows[m_row_idx][m_pushed_signal_column[batch_idx]];
+    }
+
+    void ReplayIOGroup::adjust(int batch_idx, double setting)
+    {
+        if (batch_idx < 0 || (size_t)batch_idx >= m_pushed_control.size()) {
+            throw Exception("ReplayIOGroup::adjust(): batch_idx out of range",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        m_pushed_control[batch_idx].setting = setting;
+        m_pushed_control[batch_idx].is_adjusted = true;
+    }
+
+    double ReplayIOGroup::read_signal(const std::string &signal_name, int domain_type, int domain_idx)
+    {
+        // Lets PlatformIO push a control that was not recorded as a
+        // signal in the trace.
+        if (!is_valid_signal(signal_name) && is_valid_control(signal_name)) {
+            throw Exception("ReplayIOGroup::read_signal(): control " + signal_name +
+                            " is not recorded in the trace",
+                            GEOPM_ERROR_NOT_IMPLEMENTED, __FILE__, __LINE__);
+        }
+        return m_rows[m_row_idx][signal_column("read_signal", signal_name, domain_type, domain_idx)];
+    }
+
+    void ReplayIOGroup::write_control(const std::string &control_name, int domain_type, int domain_idx, double setting)
+    {
+        check_control("write_control", control_name, domain_type, domain_idx);
+        log_control(control_name, domain_type, domain_idx, setting);
+    }
+
+    void ReplayIOGroup::log_control(const std::string &control_name,
+                                    int domain_type, int domain_idx,
+                                    double setting)
+    {
+        if (m_control_log == nullptr) {
+            return;
+        }
+        double time = m_time_column == -1 ? NAN : m_rows[m_row_idx][m_time_column];
+        *m_control_log << string_format_double(time) << '|'
+                       << control_name << '|'
+                       << PlatformTopo::domain_type_to_name(domain_type) << '|'
+                       << domain_idx << '|'
+                       << string_format_double(setting) << '\n';
+    }
+
+    void ReplayIOGroup::save_control(void)
+    {
+
+    }
+
+    void ReplayIOGroup::restore_control(void)
+    {
+
+    }
+
+    const ReplayIOGroup::m_signal_traits_s &ReplayIOGroup::signal_traits(const std::string &signal_name) const
+    {
+        if (!is_valid_signal(signal_name)) {
+            throw Exception("ReplayIOGroup: " + signal_name +
+                            " not valid for ReplayIOGroup",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        auto it = M_SIGNAL_TRAITS.find(signal_name);
+        if (it == M_SIGNAL_TRAITS.end()) {
+            return M_DEFAULT_SIGNAL_TRAITS;
+        }
+        return it->second;
+    }
+
+    std::function<double(const std::vector<double> &)> ReplayIOGroup::agg_function(const std::string &signal_name) const
+    {
+        return signal_traits(signal_name).agg_function;
+    }
+
+    std::function<std::string(double)> ReplayIOGroup::format_function(const std::string &signal_name) const
+    {
+        return signal_traits(signal_name).format_function;
+    }
+
+    std::string ReplayIOGroup::signal_description(const std::string &signal_name) const
+    {
+        const auto &traits = signal_traits(signal_name);
+        std::string result = "    description: Value of the " + signal_name + " column of the replayed trace.\n";
+        result += "    units: " + IOGroup::units_to_string(M_UNITS_NONE) + '\n';
+        result += "    aggregation: " + Agg::function_to_name(traits.agg_function) + '\n';
+        result += "    domain: " + PlatformTopo::domain_type_to_name(signal_domain_type(signal_name)) + '\n';
+        result += "    iogroup: ReplayIOGroup";
+        return result;
+    }
+
+    std::string ReplayIOGroup::control_description(const std::string &control_name) const
+    {
+        if (!is_valid_control(control_name)) {
+            throw Exception("ReplayIOGroup::control_description(): " + control_name +
+                            " not valid for ReplayIOGroup",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        std::string result = "    description: Accepts settings for " + control_name +
+                             " and logs them without changing the platform.\n";
+        result += "    units: " + IOGroup::units_to_string(M_UNITS_NONE) + '\n';
+        result += "    domain: " + PlatformTopo::domain_type_to_name(control_domain_type(control_name)) + '\n';
+        result += "    iogroup: ReplayIOGroup";
+        return result;
+    }
+
+    int ReplayIOGroup::signal_behavior(const std::string &signal_name) const
+    {
+        return signal_traits(signal_name).behavior;
+    }
+
+    void ReplayIOGroup::save_control(const std::string &save_path)
+    {
+
+    }
+
+    void ReplayIOGroup::restore_control(const std::string &save_path)
+    {
+
+    }
+
+    std::string ReplayIOGroup::name(void) const
+    {
+        return plugin_name();
+    }
+
+    std::string ReplayIOGroup::plugin_name(void)
+    {
+        return GEOPM_REPLAY_IO_GROUP_PLUGIN_NAME;
+    }
+
+    std::unique_ptr<IOGroup> ReplayIOGroup::make_plugin(void)
+    {
+        return std::unique_ptr<IOGroup>(new ReplayIOGroup);
+    }
+
+    bool ReplayIOGroup::is_enabled(void)
+    {
+        return !get_env("GEOPM_REPLAY_TRACE").empty();
+    }
+}
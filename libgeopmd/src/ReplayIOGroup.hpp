@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef REPLAYIOGROUP_HPP_INCLUDE
+#define REPLAYIOGROUP_HPP_INCLUDE
+
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "geopm_time.h"
+#include "geopm/IOGroup.hpp"
+
+namespace geopm
+{
+    class PlatformTopo;
+
+    /// @brief IOGroup that replays a recorded GEOPM trace as its
+    ///        signal source, and accepts and logs control writes
+    ///        without touching the hardware.
+    ///
+    /// The IOGroup is only registered when the GEOPM_REPLAY_TRACE
+    /// environment variable names a trace file.  Each column of the
+    /// trace provides a signal of the same name.  Each call to
+    /// read_batch() advances to the next row of the trace, or, when
+    /// a speedup is given, to the last row whose TIME is not later
+    /// than the wall clock time since the first read_batch()
+    /// multiplied by the speedup.
+    class ReplayIOGroup : public IOGroup
+    {
+        public:
+            ReplayIOGroup();
+            /// @param [in] topo Platform topology used to check
+            ///        the domain indices of controls.
+            ///
+            /// @param [in] trace_path Path to a CSV GEOPM trace,
+            ///        which may be gzip compressed.
+            ///
+            /// @param [in] speedup Zero to advance one row per
+            ///        read_batch(), otherwise the rate of simulated
+            ///        time relative to wall clock time.
+            ///
+            /// @param [in] control_spec Comma separated list of
+            ///        controls to accept in the form NAME@DOMAIN, or
+            ///        NAME for a board control.
+            ///
+            /// @param [in] control_log_path Path of the file that
+            ///        each control write is logged to, or empty to
+            ///        not log control writes.
+            ReplayIOGroup(const PlatformTopo &topo,
+                          const std::string &trace_path,
+                          double speedup,
+                          const std::string &control_spec,
+                          const std::string &control_log_path);
+            virtual ~ReplayIOGroup() = default;
+            std::set<std::string> signal_names(void) const override;
+            std::set<std::string> control_names(void) const override;
+            bool is_valid_signal(const std::string &signal_name) const override;
+            bool is_valid_control(const std::string &control_name) const override;
+            int signal_domain_type(const std::string &signal_name) const override;
+            int control_domain_type(const std::string &control_name) const override;
+            int push_signal(const std::string &signal_name, int domain_type, int domain_idx) override;
+            int push_control(const std::string &control_name, int domain_type, int domain_idx) override;
+            /// @brief Advance the replay and update the pushed
+            ///        signals.
+            void read_batch(void) override;
+            /// @brief Log the pushed controls whose setting changed
+            ///        since the last write.
+            void write_batch(void) override;
+            double sample(int batch_idx) override;
+            void adjust(int batch_idx, double setting) override;
+            /// @brief Read a signal from the current row of the
+            ///        trace without advancing the replay.
+            double read_signal(const std::string &signal_name, int domain_type, int domain_idx) override;
+            void write_control(const std::string &control_name, int domain_type, int domain_idx, double setting) override;
+            /// @brief Does nothing; the controls are not backed by
+            ///        hardware.
+            void save_control(void) override;
+            /// @brief Does nothing; the controls are not backed by
+            ///        hardware.
+            void restore_control(void) override;
+            std::function<double(const std::vector<double> &)> agg_function(const std::string &signal_name) const override;
+            std::function<std::string(double)> format_function(const std::string &signal_name) const override;
+            std::string signal_description(const std::string &signal_name) const override;
+            std::string control_description(const std::string &control_name) const override;
+            int signal_behavior(const std::string &signal_name) const override;
+            /// @brief Does nothing; the controls are not backed by
+            ///        hardware.
+            void save_control(const std::string &save_path) override;
+            /// @brief Does nothing; the controls are not backed by
+            ///        hardware.
+            void restore_control(const std::string &save_path) override;
+            std::string name(void) const override;
+            static std::string plugin_name(void);
+            static std::unique_ptr<IOGroup> make_plugin(void);
+            /// @brief Returns true if a trace to replay is set in
+            ///        the environment.
+            static bool is_enabled(void);
+        private:
+            struct m_signal_traits_s {
+                int behavior;
+                std::function<double(const std::vector<double> &)> agg_function;
+                std::function<std::string(double)> format_function;
+            };
+
+            struct m_signal_s {
+                int domain_type;
+                // Trace column index for each recorded domain index
+                std::map<int, int> column;
+            };
+
+            struct m_control_s {
+                std::string name;
+                int domain_type;
+                int domain_idx;
+                double setting;
+                double last_setting;
+                bool is_adjusted;
+            };
+
+            void parse_trace(const std::string &trace_text);
+            void parse_control_spec(const std::string &control_spec);
+            int signal_column(const std::string &caller,
+                              const std::string &signal_name,
+                              int domain_type, int domain_idx) const;
+            void check_control(const std::string &caller,
+                               const std::string &control_name,
+                               int domain_type, int domain_idx) const;
+            void log_control(const std::string &control_name,
+                             int domain_type, int domain_idx,
+                             double setting);
+            const m_signal_traits_s &signal_traits(const std::string &signal_name) const;
+
+            static const std::map<std::string, m_signal_traits_s> M_SIGNAL_TRAITS;
+            static const m_signal_traits_s M_DEFAULT_SIGNAL_TRAITS;
+
+            const PlatformTopo &m_platform_topo;
+            const double m_speedup;
+            std::vector<std::vector<double> > m_rows;
+            int m_time_column;
+            size_t m_row_idx;
+            bool m_is_started;
+            bool m_is_batch_read;
+            geopm_time_s m_start_time;
+            std::map<std::string, m_signal_s> m_signal_available;
+            std::map<std::string, int> m_control_available;
+            std::vector<int> m_pushed_signal_column;
+            std::vector<m_control_s> m_pushed_control;
+            std::unique_ptr<std::ofstream> m_control_log;
+    };
+}
+
+#endif
@@ -23,12 +23,17 @@ namespace geopm
             std::ostringstream error_message;
             error_message << "SDBus: Failed to call sd-bus function "
                           << func_name << "(), error:" << return_val;
+            int error_value = GEOPM_ERROR_RUNTIME;
             if (bus_error != nullptr) {
                 error_message << " name: " << bus_error->name << ": "
                               << bus_error->message;
+                // An older service that does not provide the method
+                if (sd_bus_error_has_name(bus_error, SD_BUS_ERROR_UNKNOWN_METHOD)) {
+                    error_value = GEOPM_ERROR_NOT_IMPLEMENTED;
+                }
             }
             throw Exception(error_message.str(),
-                            GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+                            error_value, __FILE__, __LINE__);
         }
     }
 
@@ -38,6 +38,11 @@ namespace geopm
             static std::unique_ptr<SDBus> make_unique(void);
             /// @brief Wrapper for the sd_bus_call(3) function.
             ///
+            /// All call_method() overloads throw a geopm::Exception
+            /// with error value GEOPM_ERROR_NOT_IMPLEMENTED if the
+            /// service does not provide the requested method, and
+            /// GEOPM_ERROR_RUNTIME for any other failure.
+            ///
             /// Used to execute a GEOPM D-Bus API using an
             /// SDBusMessage created by the make_call_message()
             /// method.  This enables the user to update the message
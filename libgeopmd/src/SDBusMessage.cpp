@@ -161,6 +161,15 @@ namespace geopm
         check_bus_error("sd_bus_message_append", ret);
     }
 
+    void SDBusMessageImp::append_request_setting(const geopm_request_s &request,
+                                                 double setting)
+    {
+        check_null_ptr(__func__, m_bus_message);
+        int ret = sd_bus_message_append(m_bus_message, "(iisd)", request.domain_type,
+                                        request.domain_idx, request.name, setting);
+        check_bus_error("sd_bus_message_append", ret);
+    }
+
     bool SDBusMessageImp::was_success(void)
     {
         return m_was_success;
@@ -117,6 +117,17 @@ namespace geopm
             /// @param [in] Vector of geopm_request_s to write into the
             ///        message as an array.
             virtual void append_request(const geopm_request_s &request) = 0;
+            /// @brief Write a geopm_request_s and a control setting
+            ///        into the message as a "(iisd)" structure
+            ///
+            /// Wrapper around the "sd_bus_message_append(3)"
+            /// function.
+            ///
+            /// @param [in] request Domain, index and name of the
+            ///        control.
+            /// @param [in] setting Value to write to the control.
+            virtual void append_request_setting(const geopm_request_s &request,
+                                                double setting) = 0;
             /// @brief Determine if end of array has been reached.
             ///
             /// When iterating through an array container, the
@@ -154,6 +165,8 @@ namespace geopm
             void append_strings(
                 const std::vector<std::string> &write_values) override;
             void append_request(const geopm_request_s &request) override;
+            void append_request_setting(const geopm_request_s &request,
+                                        double setting) override;
             bool was_success(void) override;
         private:
             sd_bus_message *m_bus_message;
@@ -6,13 +6,17 @@
 
 #include "geopm/SaveControl.hpp"
 
+#include <climits>
 #include <cmath>
+#include <cstring>
 
 #include "geopm/json11.hpp"
 #include "geopm/Helper.hpp"
 #include "geopm/Exception.hpp"
 #include "geopm/IOGroup.hpp"
+#include "geopm/PlatformIO.hpp"
 #include "geopm/PlatformTopo.hpp"
+#include "MultiRequestIOGroup.hpp"
 
 using json11::Json;
 
@@ -133,14 +137,35 @@ namespace geopm
 
     void SaveControlImp::restore(IOGroup &io_group) const
     {
+        // Hand the settings to the IOGroup in one request so that
+        // IOGroups which batch their writes can do so.  Names that do
+        // not fit in a request are written individually.
+        std::vector<geopm_request_s> control_config;
+        std::vector<double> control_setting;
+        std::vector<m_setting_s> long_name;
         for (const auto &ss : settings()) {
-            if (std::isfinite(ss.setting)) {
-                io_group.write_control(ss.name,
-                                       ss.domain_type,
-                                       ss.domain_idx,
-                                       ss.setting);
+            if (!std::isfinite(ss.setting)) {
+                continue;
+            }
+            if (ss.name.size() < NAME_MAX) {
+                geopm_request_s request = {ss.domain_type, ss.domain_idx, {}};
+                strncpy(request.name, ss.name.c_str(), NAME_MAX - 1);
+                control_config.push_back(request);
+                control_setting.push_back(ss.setting);
+            }
+            else {
+                long_name.push_back(ss);
             }
-         }
+        }
+        if (!control_config.empty()) {
+            MultiRequestIOGroup::write_controls(io_group, control_config, control_setting);
+        }
+        for (const auto &ss : long_name) {
+            io_group.write_control(ss.name,
+                                   ss.domain_type,
+                                   ss.domain_idx,
+                                   ss.setting);
+        }
     }
 
     std::set<std::string> SaveControlImp::unsaved_controls(const std::set<std::string> &all_controls) const
@@ -160,22 +185,43 @@ namespace geopm
                              const PlatformTopo &topo)
     {
         std::vector<m_setting_s> result;
+        std::vector<geopm_request_s> signal_config;
         std::string prefix = io_group.name() + "::";
         for (const auto &name : io_group.control_names()) {
             if (string_begins_with(name, prefix)) {
                 int dom_type = io_group.control_domain_type(name);
                 int num_dom = topo.num_domain(dom_type);
                 for (int dom_idx = 0; dom_idx != num_dom; ++dom_idx) {
-                    double setting = io_group.read_signal(name,
-                                                          dom_type,
-                                                          dom_idx);
                     result.push_back({name,
                                       dom_type,
                                       dom_idx,
-                                      setting});
+                                      NAN});
                 }
             }
         }
+        // Read every setting in one request so that IOGroups which
+        // batch their reads can do so.
+        std::vector<size_t> result_idx;
+        for (size_t idx = 0; idx != result.size(); ++idx) {
+            const auto &ss = result[idx];
+            if (ss.name.size() < NAME_MAX) {
+                geopm_request_s request = {ss.domain_type, ss.domain_idx, {}};
+                strncpy(request.name, ss.name.c_str(), NAME_MAX - 1);
+                signal_config.push_back(request);
+                result_idx.push_back(idx);
+            }
+            else {
+                result[idx].setting = io_group.read_signal(ss.name,
+                                                           ss.domain_type,
+                                                           ss.domain_idx);
+            }
+        }
+        if (!signal_config.empty()) {
+            std::vector<double> setting = MultiRequestIOGroup::read_signals(io_group, signal_config);
+            for (size_t idx = 0; idx != result_idx.size(); ++idx) {
+                result[result_idx[idx]].setting = setting.at(idx);
+            }
+        }
         return result;
     }
 }
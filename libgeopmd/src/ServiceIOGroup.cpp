@@ -293,6 +293,77 @@ namespace geopm
         m_service_proxy->platform_write_control(control_name_strip, domain_type, domain_idx, setting);
     }
 
+    std::vector<double> ServiceIOGroup::read_signals(const std::vector<geopm_request_s> &signal_config)
+    {
+        std::vector<geopm_request_s> service_config;
+        service_config.reserve(signal_config.size());
+        for (const auto &request : signal_config) {
+            service_config.push_back(service_signal_request(__func__, request));
+        }
+        return m_service_proxy->platform_read_signals(service_config);
+    }
+
+    void ServiceIOGroup::write_controls(const std::vector<geopm_request_s> &control_config,
+                                        const std::vector<double> &settings)
+    {
+        if (control_config.size() != settings.size()) {
+            throw Exception("ServiceIOGroup::write_controls(): number of settings does not match number of controls",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        std::vector<geopm_request_s> service_config;
+        service_config.reserve(control_config.size());
+        for (const auto &request : control_config) {
+            service_config.push_back(service_control_request(__func__, request));
+        }
+        m_service_proxy->platform_write_controls(service_config, settings);
+    }
+
+    geopm_request_s ServiceIOGroup::service_signal_request(const std::string &func_name,
+                                                           const geopm_request_s &request) const
+    {
+        std::string signal_name = request.name;
+        if (!is_valid_signal(signal_name)) {
+            throw Exception("ServiceIOGroup::" + func_name + "(): signal name \"" +
+                            signal_name + "\" not found",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (request.domain_type != signal_domain_type(signal_name)) {
+            throw Exception("ServiceIOGroup::" + func_name + "(): domain_type requested does not match the domain of the signal (" + signal_name + ").",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (request.domain_idx < 0 || request.domain_idx >= m_platform_topo.num_domain(request.domain_type)) {
+            throw Exception("ServiceIOGroup::" + func_name + "(): domain_idx out of range",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        geopm_request_s result = request;
+        result.name[NAME_MAX - 1] = '\0';
+        strncpy(result.name, strip_plugin_name(signal_name).c_str(), NAME_MAX - 1);
+        return result;
+    }
+
+    geopm_request_s ServiceIOGroup::service_control_request(const std::string &func_name,
+                                                            const geopm_request_s &request) const
+    {
+        std::string control_name = request.name;
+        if (!is_valid_control(control_name)) {
+            throw Exception("ServiceIOGroup::" + func_name + "(): control name \"" +
+                            control_name + "\" not found",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (request.domain_type != control_domain_type(control_name)) {
+            throw Exception("ServiceIOGroup::" + func_name + "(): domain_type requested does not match the domain of the control (" + control_name + ").",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (request.domain_idx < 0 || request.domain_idx >= m_platform_topo.num_domain(request.domain_type)) {
+            throw Exception("ServiceIOGroup::" + func_name + "(): domain_idx out of range",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        geopm_request_s result = request;
+        result.name[NAME_MAX - 1] = '\0';
+        strncpy(result.name, strip_plugin_name(control_name).c_str(), NAME_MAX - 1);
+        return result;
+    }
+
     void ServiceIOGroup::save_control(void)
     {
         // Implementation not required as ServiceIOGroup works with the service, which manages
@@ -9,6 +9,7 @@
 #include <map>
 
 #include "geopm/IOGroup.hpp"
+#include "MultiRequestIOGroup.hpp"
 
 struct geopm_request_s;
 
@@ -23,7 +24,7 @@ namespace geopm
     /// @brief IOGroup that uses DBus interface to access geopmd
     ///        provided signals and controls.  This IOGroup is not
     ///        loaded by a server side PlatformIO object.
-    class ServiceIOGroup : public IOGroup
+    class ServiceIOGroup : public IOGroup, public MultiRequestIOGroup
     {
         public:
             ServiceIOGroup();
@@ -57,6 +58,9 @@ namespace geopm
                                int domain_type,
                                int domain_idx,
                                double setting) override;
+            std::vector<double> read_signals(const std::vector<geopm_request_s> &signal_config) override;
+            void write_controls(const std::vector<geopm_request_s> &control_config,
+                                const std::vector<double> &settings) override;
             // NOTE: This IOGroup will not directlly implement a
             //       save/restore since it is a proxy.  Creating this
             //       IOGroup will start a session with the service,
@@ -76,6 +80,14 @@ namespace geopm
             static std::unique_ptr<IOGroup> make_plugin(void);
         private:
             void init_batch_server(void);
+            /// @brief Check a signal request and strip the plugin
+            ///        name for use with the service.
+            geopm_request_s service_signal_request(const std::string &func_name,
+                                                   const geopm_request_s &request) const;
+            /// @brief Check a control request and strip the plugin
+            ///        name for use with the service.
+            geopm_request_s service_control_request(const std::string &func_name,
+                                                    const geopm_request_s &request) const;
             static const std::string M_PLUGIN_NAME;
             static std::map<std::string, signal_info_s> service_signal_info(std::shared_ptr<ServiceProxy> service_proxy);
             static std::map<std::string, control_info_s> service_control_info(std::shared_ptr<ServiceProxy> service_proxy);
@@ -30,6 +30,7 @@ namespace geopm
 
     ServiceProxyImp::ServiceProxyImp(std::shared_ptr<SDBus> bus)
         : m_bus(std::move(bus))
+        , m_is_vector_supported(true)
     {
 
     }
@@ -157,6 +158,93 @@ namespace geopm
                                  setting);
     }
 
+    std::vector<double> ServiceProxyImp::platform_read_signals(
+        const std::vector<struct geopm_request_s> &signal_config)
+    {
+        std::vector<double> result;
+        if (signal_config.empty()) {
+            return result;
+        }
+        if (m_is_vector_supported) {
+            std::shared_ptr<SDBusMessage> bus_message = m_bus->make_call_message("PlatformReadSignals");
+            bus_message->open_container(SDBusMessage::M_MESSAGE_TYPE_ARRAY, "(iis)");
+            for (const auto &request : signal_config) {
+                bus_message->append_request(request);
+            }
+            bus_message->close_container();
+            try {
+                std::shared_ptr<SDBusMessage> bus_reply = m_bus->call_method(std::move(bus_message));
+                bus_reply->enter_container(SDBusMessage::M_MESSAGE_TYPE_ARRAY, "d");
+                double sample = bus_reply->read_double();
+                while (bus_reply->was_success()) {
+                    result.push_back(sample);
+                    sample = bus_reply->read_double();
+                }
+                bus_reply->exit_container();
+                if (result.size() != signal_config.size()) {
+                    throw Exception("ServiceProxyImp::platform_read_signals(): PlatformReadSignals returned " +
+                                    std::to_string(result.size()) + " values for " +
+                                    std::to_string(signal_config.size()) + " requests",
+                                    GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+                }
+            }
+            catch (const Exception &ex) {
+                if (ex.err_value() != GEOPM_ERROR_NOT_IMPLEMENTED) {
+                    throw;
+                }
+                // Service predates PlatformReadSignals
+                m_is_vector_supported = false;
+            }
+        }
+        if (!m_is_vector_supported) {
+            result.clear();
+            for (const auto &request : signal_config) {
+                result.push_back(platform_read_signal(request.name,
+                                                      request.domain_type,
+                                                      request.domain_idx));
+            }
+        }
+        return result;
+    }
+
+    void ServiceProxyImp::platform_write_controls(const std::vector<struct geopm_request_s> &control_config,
+                                                  const std::vector<double> &settings)
+    {
+        if (control_config.size() != settings.size()) {
+            throw Exception("ServiceProxyImp::platform_write_controls(): number of settings does not match number of controls",
+                            GEOPM_ERROR_INVALID, __FILE__, __LINE__);
+        }
+        if (control_config.empty()) {
+            return;
+        }
+        if (m_is_vector_supported) {
+            std::shared_ptr<SDBusMessage> bus_message = m_bus->make_call_message("PlatformWriteControls");
+            bus_message->open_container(SDBusMessage::M_MESSAGE_TYPE_ARRAY, "(iisd)");
+            for (size_t control_idx = 0; control_idx != control_config.size(); ++control_idx) {
+                bus_message->append_request_setting(control_config[control_idx],
+                                                    settings[control_idx]);
+            }
+            bus_message->close_container();
+            try {
+                (void)m_bus->call_method(std::move(bus_message));
+            }
+            catch (const Exception &ex) {
+                if (ex.err_value() != GEOPM_ERROR_NOT_IMPLEMENTED) {
+                    throw;
+                }
+                // Service predates PlatformWriteControls
+                m_is_vector_supported = false;
+            }
+        }
+        if (!m_is_vector_supported) {
+            for (size_t control_idx = 0; control_idx != control_config.size(); ++control_idx) {
+                const auto &request = control_config[control_idx];
+                platform_write_control(request.name, request.domain_type,
+                                       request.domain_idx, settings[control_idx]);
+            }
+        }
+    }
+
     void ServiceProxyImp::platform_restore_control()
     {
         m_bus->call_method("PlatformRestoreControl");
@@ -91,7 +91,7 @@ namespace geopm
         return result;
     }
 
-    void plugin_load(const std::string &plugin_prefix)
+    std::vector<std::string> plugin_files(const std::string &plugin_prefix)
     {
         std::string env_plugin_path_str(geopm::get_env("GEOPM_PLUGIN_PATH"));
         std::vector<std::string> plugin_paths {GEOPM_DEFAULT_PLUGIN_PATH};
@@ -112,6 +112,12 @@ namespace geopm
                 }
             }
         }
+        return plugins;
+    }
+
+    void plugin_load(const std::string &plugin_prefix)
+    {
+        std::vector<std::string> plugins = plugin_files(plugin_prefix);
         for (const auto &plugin : plugins) {
             try {
                 SecurePath sp (plugin.c_str());
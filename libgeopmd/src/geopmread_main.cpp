@@ -9,8 +9,13 @@
 #include <unistd.h>
 #include <getopt.h>
 #include <errno.h>
+#include <signal.h>
+#include <time.h>
 
+#include <cmath>
+#include <functional>
 #include <string>
+#include <vector>
 #include <stdexcept>
 #include <iostream>
 #include <iomanip>
@@ -18,6 +23,7 @@
 #include "geopm_version.h"
 #include "geopm_error.h"
 #include "geopm_hash.h"
+#include "geopm_time.h"
 #include "geopm/PlatformIO.hpp"
 #include "geopm/PlatformTopo.hpp"
 #include "geopm/Exception.hpp"
@@ -28,8 +34,26 @@
 using geopm::PlatformIO;
 using geopm::PlatformTopo;
 
+struct stream_request_s {
+    std::string signal_name;
+    int domain_type;
+    int domain_idx;
+};
+
 int parse_domain_type(const std::string &dom);
 static int main_imp(int argc, char **argv);
+static int parse_stream_requests(const std::vector<std::string> &pos_args,
+                                 std::vector<stream_request_s> &requests);
+static int stream_signals(PlatformIO &platform_io,
+                          const std::vector<stream_request_s> &requests,
+                          double period, long count, bool is_binary);
+
+static volatile sig_atomic_t g_is_stream_stopped = 0;
+
+static void stream_stop_handler(int signum)
+{
+    g_is_stream_stopped = 1;
+}
 
 int main(int argc, char **argv)
 {
@@ -49,6 +73,8 @@ static int main_imp(int argc, char **argv)
     const char *usage = "\nUsage:\n"
                         "       geopmread SIGNAL_NAME DOMAIN_TYPE DOMAIN_INDEX\n"
                         "       geopmread [--info [SIGNAL_NAME]]\n"
+                        "       geopmread --period PERIOD [--count COUNT] [--binary]\n"
+                        "                 [SIGNAL_NAME DOMAIN_TYPE DOMAIN_INDEX ...]\n"
                         "       geopmread [--help] [--version] [--cache] [--info-all] [--domain]\n"
                         "\n"
                         "  SIGNAL_NAME:  name of the signal\n"
@@ -59,6 +85,13 @@ static int main_imp(int argc, char **argv)
                         "  -i, --info                       print longer description of a signal\n"
                         "  -I, --info-all                   print longer description of all signals\n"
                         "  -c, --cache                      create geopm topo cache and clean up /dev/shm\n"
+                        "  -p, --period                     stream samples of all requested signals\n"
+                        "                                   every PERIOD seconds; requests are read\n"
+                        "                                   from standard input if none are given\n"
+                        "  -n, --count                      number of samples to stream; default is\n"
+                        "                                   to stream until SIGINT or SIGTERM\n"
+                        "  -b, --binary                     stream samples as raw doubles rather\n"
+                        "                                   than CSV\n"
                         "  -h, --help                       print brief summary of the command line\n"
                         "                                   usage information, then exit\n"
                         "  -v, --version                    print version of GEOPM to standard output,\n"
@@ -72,6 +105,9 @@ static int main_imp(int argc, char **argv)
         {"info", no_argument, NULL, 'i'},
         {"info-all", no_argument, NULL, 'I'},
         {"cache", no_argument, NULL, 'c'},
+        {"period", required_argument, NULL, 'p'},
+        {"count", required_argument, NULL, 'n'},
+        {"binary", no_argument, NULL, 'b'},
         {"help", no_argument, NULL, 'h'},
         {"version", no_argument, NULL, 'v'},
         {NULL, 0, NULL, 0}
@@ -82,7 +118,11 @@ static int main_imp(int argc, char **argv)
     bool is_domain = false;
     bool is_info = false;
     bool is_all_info = false;
-    while (!err && (opt = getopt_long(argc, argv, "diIchv", long_options, NULL)) != -1) {
+    bool is_stream = false;
+    bool is_binary = false;
+    double period = NAN;
+    long count = -1;
+    while (!err && (opt = getopt_long(argc, argv, "diIcp:n:bhv", long_options, NULL)) != -1) {
         switch (opt) {
             case 'd':
                 is_domain = true;
@@ -97,6 +137,34 @@ static int main_imp(int argc, char **argv)
                 geopm::PlatformTopo::create_cache();
                 geopm::SharedMemory::cleanup_shmem();
                 return 0;
+            case 'p':
+                is_stream = true;
+                try {
+                    period = std::stod(optarg);
+                }
+                catch (const std::exception &) {
+                    period = NAN;
+                }
+                if (!(period > 0.0)) {
+                    std::cerr << "Error: --period must be a positive number of seconds." << std::endl;
+                    err = EINVAL;
+                }
+                break;
+            case 'n':
+                try {
+                    count = std::stol(optarg);
+                }
+                catch (const std::exception &) {
+                    count = -1;
+                }
+                if (count <= 0) {
+                    std::cerr << "Error: --count must be a positive integer." << std::endl;
+                    err = EINVAL;
+                }
+                break;
+            case 'b':
+                is_binary = true;
+                break;
             case 'h':
                 printf("%s", usage);
                 return 0;
@@ -115,11 +183,20 @@ static int main_imp(int argc, char **argv)
         }
     }
 
+    if (err) {
+        return err;
+    }
+
     if (is_domain && is_info) {
         std::cerr << "Error: info about domain not implemented." << std::endl;
         return EINVAL;
     }
 
+    if (!is_stream && (count != -1 || is_binary)) {
+        std::cerr << "Error: --count and --binary require --period." << std::endl;
+        return EINVAL;
+    }
+
     std::vector<std::string> pos_args;
     while (optind < argc) {
         pos_args.emplace_back(argv[optind++]);
@@ -127,7 +204,14 @@ static int main_imp(int argc, char **argv)
 
     PlatformIO &platform_io = geopm::platform_io();
     const PlatformTopo &platform_topo = geopm::platform_topo();
-    if (is_domain) {
+    if (is_stream) {
+        std::vector<stream_request_s> requests;
+        err = parse_stream_requests(pos_args, requests);
+        if (!err) {
+            err = stream_signals(platform_io, requests, period, count, is_binary);
+        }
+    }
+    else if (is_domain) {
         // print all domains
         for (int dom = GEOPM_DOMAIN_BOARD; dom < GEOPM_NUM_DOMAIN; ++dom) {
             std::cout << std::setw(28) << std::left
@@ -198,3 +282,131 @@ static int main_imp(int argc, char **argv)
     }
     return err;
 }
+
+static int parse_stream_requests(const std::vector<std::string> &pos_args,
+                                 std::vector<stream_request_s> &requests)
+{
+    std::vector<std::string> request_words = pos_args;
+    if (request_words.empty()) {
+        // Requests are whitespace separated triplets on standard input
+        std::string word;
+        while (std::cin >> word) {
+            request_words.push_back(word);
+        }
+    }
+    if (request_words.empty() || request_words.size() % 3 != 0) {
+        std::cerr << "Error: streaming requires one or more SIGNAL_NAME DOMAIN_TYPE DOMAIN_INDEX requests.\n" << std::endl;
+        return EINVAL;
+    }
+    for (size_t word_idx = 0; word_idx < request_words.size(); word_idx += 3) {
+        stream_request_s request;
+        request.signal_name = request_words[word_idx];
+        try {
+            request.domain_type = PlatformTopo::domain_name_to_type(request_words[word_idx + 1]);
+            request.domain_idx = std::stoi(request_words[word_idx + 2]);
+        }
+        catch (const geopm::Exception &ex) {
+            std::cerr << "Error: invalid domain type: " << ex.what() << std::endl;
+            return EINVAL;
+        }
+        catch (const std::exception &) {
+            std::cerr << "Error: invalid domain index.\n" << std::endl;
+            return EINVAL;
+        }
+        requests.push_back(request);
+    }
+    return 0;
+}
+
+static int stream_signals(PlatformIO &platform_io,
+                          const std::vector<stream_request_s> &requests,
+                          double period, long count, bool is_binary)
+{
+    std::vector<int> signal_idx;
+    std::vector<std::function<std::string(double)> > format;
+    try {
+        for (const auto &request : requests) {
+            signal_idx.push_back(platform_io.push_signal(request.signal_name,
+                                                         request.domain_type,
+                                                         request.domain_idx));
+            format.push_back(platform_io.format_function(request.signal_name));
+        }
+    }
+    catch (const geopm::Exception &ex) {
+        std::cerr << "Error: cannot push signal: " << ex.what() << std::endl;
+        return EINVAL;
+    }
+
+    struct sigaction action = {};
+    action.sa_handler = stream_stop_handler;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+
+    if (!is_binary) {
+        // Header uses the same column naming as the trace
+        for (size_t req_idx = 0; req_idx < requests.size(); ++req_idx) {
+            const auto &request = requests[req_idx];
+            if (req_idx != 0) {
+                std::cout << ",";
+            }
+            std::cout << request.signal_name;
+            if (request.domain_type != GEOPM_DOMAIN_BOARD) {
+                std::cout << "-" << PlatformTopo::domain_type_to_name(request.domain_type)
+                          << "-" << request.domain_idx;
+            }
+        }
+        std::cout << std::endl;
+    }
+
+    int err = 0;
+    std::vector<double> sample(signal_idx.size());
+    geopm_time_s start_time;
+    geopm_time(&start_time);
+    for (long sample_idx = 0;
+         !g_is_stream_stopped && !err && (count == -1 || sample_idx < count);
+         ++sample_idx) {
+        if (sample_idx != 0) {
+            // Sleep until the next period boundary, measured from the
+            // start so that delays do not accumulate as drift.
+            double remaining = period * sample_idx - geopm_time_since(&start_time);
+            while (remaining > 0.0 && !g_is_stream_stopped) {
+                struct timespec delay = {(time_t)remaining,
+                                         (long)((remaining - (time_t)remaining) * 1E9)};
+                nanosleep(&delay, NULL);
+                remaining = period * sample_idx - geopm_time_since(&start_time);
+            }
+            if (g_is_stream_stopped) {
+                break;
+            }
+        }
+        try {
+            platform_io.read_batch();
+            for (size_t sig_idx = 0; sig_idx < signal_idx.size(); ++sig_idx) {
+                sample[sig_idx] = platform_io.sample(signal_idx[sig_idx]);
+            }
+        }
+        catch (const geopm::Exception &ex) {
+            std::cerr << "Error: cannot read signal: " << ex.what() << std::endl;
+            err = EINVAL;
+            break;
+        }
+        if (is_binary) {
+            fwrite(sample.data(), sizeof(double), sample.size(), stdout);
+            fflush(stdout);
+        }
+        else {
+            for (size_t sig_idx = 0; sig_idx < sample.size(); ++sig_idx) {
+                if (sig_idx != 0) {
+                    std::cout << ",";
+                }
+                std::cout << format[sig_idx](sample[sig_idx]);
+            }
+            std::cout << std::endl;
+        }
+        if (ferror(stdout) || !std::cout) {
+            err = EIO;
+        }
+    }
+    return err;
+}
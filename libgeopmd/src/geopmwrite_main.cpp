@@ -9,9 +9,11 @@
 #include <unistd.h>
 #include <getopt.h>
 #include <errno.h>
+#include <limits.h>
 #include <cmath>
 
 #include <string>
+#include <sstream>
 #include <stdexcept>
 #include <iostream>
 #include <iomanip>
@@ -22,6 +24,7 @@
 #include "geopm/PlatformIO.hpp"
 #include "geopm/PlatformTopo.hpp"
 #include "geopm/Exception.hpp"
+#include "geopm/Helper.hpp"
 
 
 using geopm::PlatformIO;
@@ -29,6 +32,7 @@ using geopm::PlatformTopo;
 
 int parse_domain_type(const std::string &dom);
 static int main_imp(int argc, char **argv);
+static int write_request_file(PlatformIO &platform_io, const std::string &path);
 
 int main(int argc, char **argv)
 {
@@ -47,6 +51,7 @@ static int main_imp(int argc, char **argv)
 {
     const char *usage = "\nUsage:\n"
                         "       geopmwrite CONTROL_NAME DOMAIN_TYPE DOMAIN_INDEX VALUE\n"
+                        "       geopmwrite --file REQUEST_FILE\n"
                         "       geopmwrite [--info [CONTROL_NAME]]\n"
                         "       geopmwrite [--help] [--version] [--cache] [--info-all] [--domain]\n"
                         "\n"
@@ -55,6 +60,9 @@ static int main_imp(int argc, char **argv)
                         "  DOMAIN_INDEX: index of the domain, starting from 0\n"
                         "  VALUE:        setting to adjust control to\n"
                         "\n"
+                        "  -f, --file=REQUEST_FILE          write every control listed in the file, one\n"
+                        "                                   \"CONTROL_NAME DOMAIN_TYPE DOMAIN_INDEX VALUE\"\n"
+                        "                                   request per line; \"#\" starts a comment\n"
                         "  -d, --domain                     print domains detected\n"
                         "  -i, --info                       print longer description of a control\n"
                         "  -I, --info-all                   print longer description of all controls\n"
@@ -69,6 +77,7 @@ static int main_imp(int argc, char **argv)
 
     static struct option long_options[] = {
         {"domain", no_argument, NULL, 'd'},
+        {"file", required_argument, NULL, 'f'},
         {"info", no_argument, NULL, 'i'},
         {"info-all", no_argument, NULL, 'I'},
         {"cache", no_argument, NULL, 'c'},
@@ -82,11 +91,15 @@ static int main_imp(int argc, char **argv)
     bool is_domain = false;
     bool is_info = false;
     bool is_all_info = false;
-    while (!err && (opt = getopt_long(argc, argv, "diIchv", long_options, NULL)) != -1) {
+    std::string request_path;
+    while (!err && (opt = getopt_long(argc, argv, "df:iIchv", long_options, NULL)) != -1) {
         switch (opt) {
             case 'd':
                 is_domain = true;
                 break;
+            case 'f':
+                request_path = optarg;
+                break;
             case 'i':
                 is_info = true;
                 break;
@@ -125,9 +138,18 @@ static int main_imp(int argc, char **argv)
         pos_args.emplace_back(argv[optind++]);
     }
 
+    if (!request_path.empty() &&
+        (is_domain || is_info || is_all_info || pos_args.size() != 0)) {
+        std::cerr << "Error: --file cannot be combined with other options or a control request.\n" << std::endl;
+        return EINVAL;
+    }
+
     PlatformIO &platform_io = geopm::platform_io();
     const PlatformTopo &platform_topo = geopm::platform_topo();
-    if (is_domain) {
+    if (!request_path.empty()) {
+        err = write_request_file(platform_io, request_path);
+    }
+    else if (is_domain) {
         // print all domains
         for (int dom = GEOPM_DOMAIN_BOARD; dom < GEOPM_NUM_DOMAIN; ++dom) {
             std::cout << std::setw(28) << std::left
@@ -208,3 +230,73 @@ static int main_imp(int argc, char **argv)
 
     return err;
 }
+
+static int write_request_file(PlatformIO &platform_io, const std::string &path)
+{
+    // Parse every request before writing any so that a bad line does
+    // not leave the controls partly written.
+    std::vector<geopm_request_s> control_config;
+    std::vector<double> settings;
+    std::istringstream file_stream(geopm::read_file(path));
+    std::string line;
+    int line_num = 0;
+    while (std::getline(file_stream, line)) {
+        ++line_num;
+        line = line.substr(0, line.find('#'));
+        std::istringstream line_stream(line);
+        std::string control_name;
+        std::string domain_name;
+        std::string domain_idx_str;
+        std::string value_str;
+        std::string extra;
+        if (!(line_stream >> control_name)) {
+            continue;
+        }
+        if (!(line_stream >> domain_name >> domain_idx_str >> value_str) ||
+            (line_stream >> extra)) {
+            std::cerr << "Error: " << path << ":" << line_num
+                      << ": expected \"CONTROL_NAME DOMAIN_TYPE DOMAIN_INDEX VALUE\".\n" << std::endl;
+            return EINVAL;
+        }
+        if (control_name.size() >= NAME_MAX) {
+            std::cerr << "Error: " << path << ":" << line_num
+                      << ": control name is too long.\n" << std::endl;
+            return EINVAL;
+        }
+        geopm_request_s request = {-1, -1, {}};
+        double value = NAN;
+        try {
+            request.domain_type = PlatformTopo::domain_name_to_type(domain_name);
+            size_t pos = 0;
+            request.domain_idx = std::stoi(domain_idx_str, &pos);
+            if (pos != domain_idx_str.size()) {
+                throw std::invalid_argument(domain_idx_str);
+            }
+            value = std::stod(value_str, &pos);
+            if (pos != value_str.size()) {
+                throw std::invalid_argument(value_str);
+            }
+        }
+        catch (const std::logic_error &ex) {
+            std::cerr << "Error: " << path << ":" << line_num
+                      << ": invalid domain index or value.\n" << std::endl;
+            return EINVAL;
+        }
+        catch (const geopm::Exception &ex) {
+            std::cerr << "Error: " << path << ":" << line_num
+                      << ": " << ex.what() << std::endl;
+            return EINVAL;
+        }
+        strncpy(request.name, control_name.c_str(), NAME_MAX - 1);
+        control_config.push_back(request);
+        settings.push_back(value);
+    }
+    try {
+        platform_io.write_controls(control_config, settings);
+    }
+    catch (const geopm::Exception &ex) {
+        std::cerr << "Error: cannot write controls: " << ex.what() << std::endl;
+        return EINVAL;
+    }
+    return 0;
+}
@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+#
+#  Copyright (c) 2015 - 2024 Intel Corporation
+#  SPDX-License-Identifier: BSD-3-Clause
+#
+
+"""Convert an MSR definition JSON file into C++ source that defines
+an msr_table_s (see src/MSRData.hpp) so that the definitions built
+into libgeopmd need not be parsed at run time.  The JSON is checked
+with the same rules that MSRIOGroup applies to user supplied files;
+names are checked at run time when the table is loaded.
+
+Usage: msr_data_table.py FUNCTION_NAME JSON_PATH > OUTPUT.cpp
+
+"""
+
+import json
+import sys
+
+_MSR_KEYS = {'offset': str, 'domain': str, 'fields': dict}
+_FIELD_KEYS = {'begin_bit': int, 'end_bit': int, 'function': str,
+               'units': str, 'scalar': float, 'writeable': bool,
+               'behavior': str, 'aggregation': str}
+_FIELD_OPTIONAL_KEYS = {'description': str}
+
+
+def _check_type(value, expect_type):
+    if expect_type is float:
+        return type(value) in (int, float)
+    if expect_type is int:
+        return (type(value) in (int, float) and value == int(value))
+    return type(value) is expect_type
+
+
+def _check_keys(obj, required, optional, location):
+    if type(obj) is not dict:
+        raise ValueError('{} must be an object'.format(location))
+    for key in obj:
+        if key not in required and key not in optional:
+            raise ValueError('unexpected key "{}" found {}'.format(key, location))
+    for key, expect_type in required.items():
+        if key not in obj:
+            raise ValueError('"{}" key is required {}'.format(key, location))
+        if not _check_type(obj[key], expect_type):
+            raise ValueError('"{}" has the wrong type {}'.format(key, location))
+    for key, expect_type in optional.items():
+        if key in obj and not _check_type(obj[key], expect_type):
+            raise ValueError('"{}" has the wrong type {}'.format(key, location))
+
+
+def _cpp_string(value):
+    """Format a C++ string literal; bytes that are not printable ASCII
+    are written as octal escapes of their UTF-8 encoding.
+
+    """
+    result = ['"']
+    for byte in value.encode('utf-8'):
+        char = chr(byte)
+        if char in '"\\':
+            result.append('\\' + char)
+        elif 0x20 <= byte < 0x7f and char != '?':
+            result.append(char)
+        else:
+            result.append('\\{:03o}'.format(byte))
+    result.append('"')
+    return ''.join(result)
+
+
+def generate(function_name, msr_json):
+    _check_keys(msr_json, {'msrs': dict}, {}, 'at top level')
+    msr_names = sorted(msr_json['msrs'])
+    lines = []
+    lines.append('/*')
+    lines.append(' * Copyright (c) 2015 - 2024 Intel Corporation')
+    lines.append(' * SPDX-License-Identifier: BSD-3-Clause')
+    lines.append(' */')
+    lines.append('')
+    lines.append('// Generated by src/msr_data_table.py, do not edit')
+    lines.append('')
+    lines.append('#include "MSRData.hpp"')
+    lines.append('')
+    lines.append('namespace geopm')
+    lines.append('{')
+    lines.append('    namespace')
+    lines.append('    {')
+    for msr_idx, msr_name in enumerate(msr_names):
+        msr = msr_json['msrs'][msr_name]
+        _check_keys(msr, _MSR_KEYS, {}, 'in msr "{}"'.format(msr_name))
+        if not msr['offset'].startswith('0x') or int(msr['offset'], 16) == 0:
+            raise ValueError('"offset" must be a hex string and non-zero in msr "{}"'.format(msr_name))
+        if len(msr['fields']) == 0:
+            continue
+        lines.append('        // {}'.format(msr_name))
+        lines.append('        constexpr msr_field_data_s M_FIELD_{}[] = {{'.format(msr_idx))
+        for field_name in sorted(msr['fields']):
+            field = msr['fields'][field_name]
+            _check_keys(field, _FIELD_KEYS, _FIELD_OPTIONAL_KEYS,
+                        'in "{}:{}"'.format(msr_name, field_name))
+            description = 'nullptr'
+            if 'description' in field:
+                description = _cpp_string(field['description'])
+            lines.append('            {{{}, {}, {}, {}, {!r}, {}, {}, {}, {},'.format(
+                         _cpp_string(field_name), int(field['begin_bit']),
+                         int(field['end_bit']), _cpp_string(field['function']),
+                         float(field['scalar']), _cpp_string(field['units']),
+                         'true' if field['writeable'] else 'false',
+                         _cpp_string(field['behavior']),
+                         _cpp_string(field['aggregation'])))
+            lines.append('             {}}},'.format(description))
+        lines.append('        };')
+    lines.append('        constexpr msr_data_s M_MSR[] = {')
+    for msr_idx, msr_name in enumerate(msr_names):
+        msr = msr_json['msrs'][msr_name]
+        field_array = 'M_FIELD_{}'.format(msr_idx) if len(msr['fields']) else 'nullptr'
+        lines.append('            {{{}, 0x{:x}ULL, {}, {}, {}}},'.format(
+                     _cpp_string(msr_name), int(msr['offset'], 16),
+                     _cpp_string(msr['domain']), field_array, len(msr['fields'])))
+    lines.append('        };')
+    lines.append('    }')
+    lines.append('')
+    lines.append('    const msr_table_s &{}(void)'.format(function_name))
+    lines.append('    {')
+    lines.append('        static constexpr msr_table_s result = {{M_MSR, {}}};'.format(len(msr_names)))
+    lines.append('        return result;')
+    lines.append('    }')
+    lines.append('}')
+    return '\n'.join(lines) + '\n'
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.stderr.write(__doc__)
+        return 1
+    function_name, json_path = sys.argv[1:]
+    try:
+        with open(json_path) as fid:
+            msr_json = json.load(fid)
+        sys.stdout.write(generate(function_name, msr_json))
+    except (OSError, ValueError) as ex:
+        sys.stderr.write('Error: {}: {}\n'.format(json_path, ex))
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
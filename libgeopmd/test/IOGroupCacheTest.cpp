@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "geopm/Helper.hpp"
+#include "geopm/IOGroup.hpp"
+#include "geopm_topo.h"
+#include "geopm_version.h"
+#include "IOGroupCache.hpp"
+#include "PlatformIOImp.hpp"
+#include "CombinedControl.hpp"
+#include "CombinedSignal.hpp"
+#include "MockPlatformTopo.hpp"
+#include "geopm_test.hpp"
+
+using geopm::IOGroup;
+using geopm::IOGroupCache;
+using geopm::IOGroupCacheImp;
+using geopm::PlatformIOImp;
+using testing::_;
+using testing::AtLeast;
+
+class IOGroupCacheTest : public ::testing::Test
+{
+    protected:
+        void SetUp(void);
+        void TearDown(void);
+        const std::string M_CACHE_PATH = "IOGroupCacheTest-cache";
+        std::shared_ptr<IOGroupCache> m_cache;
+        std::vector<IOGroupCache::iogroup_names_s> m_record;
+};
+
+void IOGroupCacheTest::SetUp(void)
+{
+    (void)unlink(M_CACHE_PATH.c_str());
+    m_cache = std::make_shared<IOGroupCacheImp>(M_CACHE_PATH);
+    m_record = {
+        {"FIRST", {{"FIRST::SIGNAL", GEOPM_DOMAIN_CPU}, {"ALIAS", GEOPM_DOMAIN_CPU}},
+                  {{"FIRST::CONTROL", GEOPM_DOMAIN_PACKAGE}}},
+        {"SECOND", {{"SECOND::SIGNAL", GEOPM_DOMAIN_BOARD}}, {}},
+    };
+}
+
+void IOGroupCacheTest::TearDown(void)
+{
+    (void)unlink(M_CACHE_PATH.c_str());
+}
+
+TEST_F(IOGroupCacheTest, write_read)
+{
+    std::vector<IOGroupCache::iogroup_names_s> result;
+    EXPECT_FALSE(m_cache->read("key", result));
+    m_cache->write("key", m_record);
+    struct stat file_stat;
+    ASSERT_EQ(0, stat(M_CACHE_PATH.c_str(), &file_stat));
+    EXPECT_EQ((mode_t)(S_IRUSR | S_IWUSR), file_stat.st_mode & ~S_IFMT);
+
+    ASSERT_TRUE(m_cache->read("key", result));
+    ASSERT_EQ(2ULL, result.size());
+    EXPECT_EQ("FIRST", result[0].iogroup_name);
+    EXPECT_EQ(m_record[0].signal_domains, result[0].signal_domains);
+    EXPECT_EQ(m_record[0].control_domains, result[0].control_domains);
+    EXPECT_EQ("SECOND", result[1].iogroup_name);
+    EXPECT_EQ(m_record[1].signal_domains, result[1].signal_domains);
+    EXPECT_TRUE(result[1].control_domains.empty());
+
+    // A record written for a different set of plugins is ignored
+    EXPECT_FALSE(m_cache->read("other key", result));
+    EXPECT_TRUE(result.empty());
+
+    m_cache->remove();
+    EXPECT_FALSE(m_cache->read("key", result));
+}
+
+TEST_F(IOGroupCacheTest, invalid_file)
+{
+    std::vector<IOGroupCache::iogroup_names_s> result;
+    m_cache->write("key", m_record);
+    // Records that others may have modified are not trusted
+    ASSERT_EQ(0, chmod(M_CACHE_PATH.c_str(), S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP));
+    EXPECT_FALSE(m_cache->read("key", result));
+
+    geopm::write_file(M_CACHE_PATH, "{\"key\": \"key\", \"iogroups\": [");
+    ASSERT_EQ(0, chmod(M_CACHE_PATH.c_str(), S_IRUSR | S_IWUSR));
+    EXPECT_FALSE(m_cache->read("key", result));
+
+    geopm::write_file(M_CACHE_PATH, "{\"key\": \"key\", \"iogroups\": [{\"name\": \"FIRST\"}]}");
+    EXPECT_FALSE(m_cache->read("key", result));
+    EXPECT_TRUE(result.empty());
+}
+
+TEST_F(IOGroupCacheTest, key)
+{
+    std::string key_ab = IOGroupCache::key({"A", "B"});
+    EXPECT_EQ(key_ab, IOGroupCache::key({"A", "B"}));
+    EXPECT_NE(key_ab, IOGroupCache::key({"B", "A"}));
+    EXPECT_NE(key_ab, IOGroupCache::key({"A"}));
+
+    // Configuration that changes the names provided by the plugins
+    // changes the key
+    const std::string config_path = "IOGroupCacheTest-const_config.json";
+    (void)unlink(config_path.c_str());
+    setenv("GEOPM_CONST_CONFIG_PATH", config_path.c_str(), 1);
+    std::string key_env = IOGroupCache::key({"A", "B"});
+    EXPECT_NE(key_ab, key_env);
+    geopm::write_file(config_path, "{}");
+    std::string key_file = IOGroupCache::key({"A", "B"});
+    EXPECT_NE(key_env, key_file);
+    EXPECT_EQ(key_file, IOGroupCache::key({"A", "B"}));
+    geopm::write_file(config_path, "{\"CONST_CONFIG::SIGNAL\": {}}");
+    EXPECT_NE(key_file, IOGroupCache::key({"A", "B"}));
+    unsetenv("GEOPM_CONST_CONFIG_PATH");
+    (void)unlink(config_path.c_str());
+    EXPECT_EQ(key_ab, IOGroupCache::key({"A", "B"}));
+}
+
+TEST_F(IOGroupCacheTest, key_plugin_file)
+{
+    const std::string plugin_dir = "IOGroupCacheTest-plugins";
+    auto so_version = geopm::shared_object_version();
+    const std::string plugin_path = plugin_dir + "/" + IOGroup::M_PLUGIN_PREFIX +
+                                    "test.so." + std::to_string(so_version[0]) + "." +
+                                    std::to_string(so_version[1]) + ".0";
+    (void)mkdir(plugin_dir.c_str(), S_IRWXU);
+    (void)unlink(plugin_path.c_str());
+    setenv("GEOPM_PLUGIN_PATH", plugin_dir.c_str(), 1);
+    std::string key_empty = IOGroupCache::key({"A"});
+    // Installing, rebuilding or removing a plugin in the search path
+    // changes the key even though the plugin path is unchanged
+    geopm::write_file(plugin_path, "");
+    std::string key_plugin = IOGroupCache::key({"A"});
+    EXPECT_NE(key_empty, key_plugin);
+    EXPECT_EQ(key_plugin, IOGroupCache::key({"A"}));
+    struct timespec times[2] = {{0, UTIME_OMIT}, {1, 0}};
+    ASSERT_EQ(0, utimensat(AT_FDCWD, plugin_path.c_str(), times, 0));
+    EXPECT_NE(key_plugin, IOGroupCache::key({"A"}));
+    (void)unlink(plugin_path.c_str());
+    EXPECT_EQ(key_empty, IOGroupCache::key({"A"}));
+    unsetenv("GEOPM_PLUGIN_PATH");
+    (void)rmdir(plugin_dir.c_str());
+}
+
+TEST_F(IOGroupCacheTest, platform_io_record)
+{
+    auto topo = make_topo(1, 1, 1);
+    EXPECT_CALL(*topo, num_domain(_)).Times(AtLeast(0));
+    std::string key = IOGroupCache::key(IOGroup::iogroup_names());
+    // Without a valid record every plugin is constructed and the
+    // record is written
+    {
+        PlatformIOImp platform_io({}, *topo, m_cache);
+        EXPECT_EQ(GEOPM_DOMAIN_CPU, platform_io.signal_domain_type("TIME"));
+    }
+    std::vector<IOGroupCache::iogroup_names_s> result;
+    ASSERT_TRUE(m_cache->read(key, result));
+    auto time_it = std::find_if(result.begin(), result.end(),
+                                [](const IOGroupCache::iogroup_names_s &names) {
+                                    return names.iogroup_name == "TIME";
+                                });
+    ASSERT_NE(result.end(), time_it);
+    EXPECT_EQ(GEOPM_DOMAIN_CPU, time_it->signal_domains.at("TIME"));
+
+    // With a valid record the recorded names are used without
+    // constructing the plugins
+    time_it->signal_domains["TIME::CACHED_ONLY"] = GEOPM_DOMAIN_BOARD;
+    m_cache->write(key, result);
+    {
+        PlatformIOImp platform_io({}, *topo, m_cache);
+        auto signal_names = platform_io.signal_names();
+        EXPECT_NE(signal_names.end(), signal_names.find("TIME::CACHED_ONLY"));
+        EXPECT_EQ(GEOPM_DOMAIN_BOARD, platform_io.signal_domain_type("TIME::CACHED_ONLY"));
+        // Use of a signal loads the plugin
+        EXPECT_LE(0.0, platform_io.read_signal("TIME", GEOPM_DOMAIN_CPU, 0));
+    }
+}
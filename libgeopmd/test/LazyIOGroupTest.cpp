@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "geopm/Exception.hpp"
+#include "geopm/Helper.hpp"
+#include "geopm_topo.h"
+#include "LazyIOGroup.hpp"
+#include "MockIOGroup.hpp"
+#include "geopm_test.hpp"
+
+using geopm::IOGroup;
+using geopm::LazyIOGroup;
+using testing::Return;
+
+class LazyIOGroupTest : public ::testing::Test
+{
+    protected:
+        void SetUp(void);
+        std::unique_ptr<IOGroup> make_iogroup(void);
+        std::map<std::string, int> m_signal_domains;
+        std::map<std::string, int> m_control_domains;
+        MockIOGroup *m_iogroup;
+        int m_num_factory_call;
+        int m_num_error_call;
+        bool m_is_factory_error;
+        std::unique_ptr<LazyIOGroup> m_lazy;
+};
+
+void LazyIOGroupTest::SetUp(void)
+{
+    m_signal_domains = {{"SIGNAL", GEOPM_DOMAIN_PACKAGE},
+                        {"LAZY::SIGNAL", GEOPM_DOMAIN_PACKAGE}};
+    m_control_domains = {{"CONTROL", GEOPM_DOMAIN_CORE}};
+    m_iogroup = nullptr;
+    m_num_factory_call = 0;
+    m_num_error_call = 0;
+    m_is_factory_error = false;
+    m_lazy = geopm::make_unique<LazyIOGroup>(
+        "LAZY", m_signal_domains, m_control_domains,
+        [this]() {
+            return make_iogroup();
+        },
+        [this]() {
+            ++m_num_error_call;
+        });
+}
+
+std::unique_ptr<IOGroup> LazyIOGroupTest::make_iogroup(void)
+{
+    ++m_num_factory_call;
+    if (m_is_factory_error) {
+        throw geopm::Exception("LazyIOGroupTest: device not found",
+                               GEOPM_ERROR_RUNTIME, __FILE__, __LINE__);
+    }
+    auto result = geopm::make_unique<testing::NiceMock<MockIOGroup> >();
+    m_iogroup = result.get();
+    return result;
+}
+
+TEST_F(LazyIOGroupTest, names_without_load)
+{
+    EXPECT_EQ(std::set<std::string>({"SIGNAL", "LAZY::SIGNAL"}), m_lazy->signal_names());
+    EXPECT_EQ(std::set<std::string>({"CONTROL"}), m_lazy->control_names());
+    EXPECT_TRUE(m_lazy->is_valid_signal("SIGNAL"));
+    EXPECT_FALSE(m_lazy->is_valid_signal("CONTROL"));
+    EXPECT_TRUE(m_lazy->is_valid_control("CONTROL"));
+    EXPECT_FALSE(m_lazy->is_valid_control("SIGNAL"));
+    EXPECT_EQ(GEOPM_DOMAIN_PACKAGE, m_lazy->signal_domain_type("LAZY::SIGNAL"));
+    EXPECT_EQ(GEOPM_DOMAIN_CORE, m_lazy->control_domain_type("CONTROL"));
+    EXPECT_EQ(GEOPM_DOMAIN_INVALID, m_lazy->signal_domain_type("CONTROL"));
+    EXPECT_EQ("LAZY", m_lazy->name());
+    // Nothing has been pushed so batch operations have nothing to do
+    m_lazy->read_batch();
+    m_lazy->write_batch();
+    m_lazy->restore_control();
+    EXPECT_FALSE(m_lazy->is_loaded());
+    EXPECT_EQ(0, m_num_factory_call);
+}
+
+TEST_F(LazyIOGroupTest, load_on_push)
+{
+    EXPECT_EQ(0, m_num_factory_call);
+    // The first method that needs the IOGroup constructs it ...
+    EXPECT_EQ("", m_lazy->signal_description("UNKNOWN"));
+    EXPECT_EQ(1, m_num_factory_call);
+    ASSERT_NE(nullptr, m_iogroup);
+    EXPECT_TRUE(m_lazy->is_loaded());
+    // ... and every later call is forwarded to the same instance
+    EXPECT_CALL(*m_iogroup, push_signal("SIGNAL", GEOPM_DOMAIN_PACKAGE, 1))
+        .WillOnce(Return(3));
+    EXPECT_CALL(*m_iogroup, push_control("CONTROL", GEOPM_DOMAIN_CORE, 2))
+        .WillOnce(Return(5));
+    EXPECT_CALL(*m_iogroup, read_batch());
+    EXPECT_CALL(*m_iogroup, sample(3))
+        .WillOnce(Return(42.0));
+    EXPECT_CALL(*m_iogroup, adjust(5, 7.0));
+    EXPECT_CALL(*m_iogroup, write_batch());
+    EXPECT_CALL(*m_iogroup, signal_behavior("SIGNAL"))
+        .WillOnce(Return(IOGroup::M_SIGNAL_BEHAVIOR_VARIABLE));
+    EXPECT_EQ(3, m_lazy->push_signal("SIGNAL", GEOPM_DOMAIN_PACKAGE, 1));
+    EXPECT_EQ(5, m_lazy->push_control("CONTROL", GEOPM_DOMAIN_CORE, 2));
+    m_lazy->read_batch();
+    EXPECT_EQ(42.0, m_lazy->sample(3));
+    m_lazy->adjust(5, 7.0);
+    m_lazy->write_batch();
+    EXPECT_EQ(IOGroup::M_SIGNAL_BEHAVIOR_VARIABLE, m_lazy->signal_behavior("SIGNAL"));
+    EXPECT_EQ(1, m_num_factory_call);
+    EXPECT_EQ(0, m_num_error_call);
+}
+
+TEST_F(LazyIOGroupTest, factory_error)
+{
+    m_is_factory_error = true;
+    GEOPM_EXPECT_THROW_MESSAGE(m_lazy->push_signal("SIGNAL", GEOPM_DOMAIN_PACKAGE, 0),
+                               GEOPM_ERROR_RUNTIME, "device not found");
+    EXPECT_EQ(1, m_num_error_call);
+    EXPECT_FALSE(m_lazy->is_loaded());
+    // The recorded names are withdrawn after a failure
+    EXPECT_TRUE(m_lazy->signal_names().empty());
+    EXPECT_TRUE(m_lazy->control_names().empty());
+    EXPECT_FALSE(m_lazy->is_valid_signal("SIGNAL"));
+    GEOPM_EXPECT_THROW_MESSAGE(m_lazy->read_signal("SIGNAL", GEOPM_DOMAIN_PACKAGE, 0),
+                               GEOPM_ERROR_RUNTIME, "LAZY IOGroup failed to load");
+    EXPECT_EQ(1, m_num_factory_call);
+    EXPECT_EQ(1, m_num_error_call);
+}
+
+TEST_F(LazyIOGroupTest, factory_error_save_restore)
+{
+    m_is_factory_error = true;
+    // Saving and restoring skip an IOGroup that fails to construct
+    m_lazy->save_control();
+    m_lazy->save_control("LazyIOGroupTest-save-control.json");
+    m_lazy->restore_control("LazyIOGroupTest-save-control.json");
+    m_lazy->restore_control();
+    EXPECT_FALSE(m_lazy->is_loaded());
+    EXPECT_EQ(1, m_num_factory_call);
+    EXPECT_EQ(1, m_num_error_call);
+    EXPECT_TRUE(m_lazy->control_names().empty());
+}
+
+TEST_F(LazyIOGroupTest, save_restore_path)
+{
+    m_lazy->save_control("LazyIOGroupTest-save-control.json");
+    ASSERT_NE(nullptr, m_iogroup);
+    EXPECT_CALL(*m_iogroup, restore_control("LazyIOGroupTest-save-control.json"));
+    m_lazy->restore_control("LazyIOGroupTest-save-control.json");
+    EXPECT_EQ(1, m_num_factory_call);
+}
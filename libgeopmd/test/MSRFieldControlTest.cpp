@@ -219,3 +219,33 @@ TEST_F(MSRFieldControlTest, save_restore)
     EXPECT_CALL(*m_msrio, adjust(m_restore_idx, saved_value, m_mask, m_save_restore_ctx));
     ctl->restore();
 }
+
+TEST_F(MSRFieldControlTest, save_restore_setting)
+{
+    set_up_default_expectations();
+
+    EXPECT_CALL(*m_msrio, add_read(m_cpu, m_offset, m_save_restore_ctx))
+        .WillOnce(Return(m_save_idx));
+    EXPECT_CALL(*m_msrio, add_write(m_cpu, m_offset, m_save_restore_ctx))
+        .WillOnce(Return(m_restore_idx));
+
+    auto ctl = geopm::make_unique<MSRFieldControl>(m_msrio, m_cpu, m_offset,
+                                                   m_begin_bit, m_end_bit,
+                                                   MSR::M_FUNCTION_SCALE, 1e8);
+    ctl->add_save_restore_context(m_save_restore_ctx);
+
+    EXPECT_CALL(*m_msrio, sample(m_save_idx, m_save_restore_ctx))
+        .WillOnce(Return(0x180012));
+    EXPECT_DOUBLE_EQ(2.4e9, ctl->sample_save_restore());
+
+    // Writes of several controls at once use a context of their own
+    int write_ctx = 2;
+    int write_idx = 3;
+    GEOPM_EXPECT_THROW_MESSAGE(ctl->adjust_write_context(2.6e9), GEOPM_ERROR_RUNTIME,
+                               "cannot adjust before add_write_context()");
+    EXPECT_CALL(*m_msrio, add_write(m_cpu, m_offset, write_ctx))
+        .WillOnce(Return(write_idx));
+    ctl->add_write_context(write_ctx);
+    EXPECT_CALL(*m_msrio, adjust(write_idx, 0x1A0000, m_mask, write_ctx));
+    ctl->adjust_write_context(2.6e9);
+}
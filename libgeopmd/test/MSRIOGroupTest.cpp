@@ -27,6 +27,7 @@
 #include "geopm_hash.h"
 #include "geopm_field.h"
 #include "geopm/Helper.hpp"
+#include "geopm/PlatformIO.hpp"
 #include "geopm/PlatformTopo.hpp"
 #include "MSRIOImp.hpp"
 #include "MSR.hpp"
@@ -218,6 +219,9 @@ TEST_F(MSRIOGroupTest, valid_signal_names)
     ASSERT_TRUE(m_msrio_group->is_valid_signal("MSR::PPERF:PCNT"));
     ASSERT_TRUE(m_msrio_group->is_valid_signal("MSR::CPU_SCALABILITY_RATIO"));
 
+    //// batch statistics
+    ASSERT_TRUE(m_msrio_group->is_valid_signal("MSR::BATCH_WRITE_SKIPPED"));
+
     auto signal_names = m_msrio_group->signal_names();
     for (const auto &name : signal_aliases) {
         // check names appear in signal_names
@@ -558,6 +562,17 @@ TEST_F(MSRIOGroupTest, read_signal_energy)
     EXPECT_NEAR(50, result, 0.0001);
 }
 
+TEST_F(MSRIOGroupTest, read_signal_write_skipped)
+{
+    EXPECT_CALL(*m_msrio, num_write_skipped())
+        .WillOnce(Return(42))
+        .WillOnce(Return(43));
+    EXPECT_EQ(42, m_msrio_group->read_signal("MSR::BATCH_WRITE_SKIPPED", GEOPM_DOMAIN_BOARD, 0));
+    int idx = m_msrio_group->push_signal("MSR::BATCH_WRITE_SKIPPED", GEOPM_DOMAIN_BOARD, 0);
+    m_msrio_group->read_batch();
+    EXPECT_EQ(43, m_msrio_group->sample(idx));
+}
+
 TEST_F(MSRIOGroupTest, read_signal_counter)
 {
     uint64_t tsc_offset = 0x10;
@@ -1427,6 +1442,57 @@ TEST_F(MSRIOGroupTest, parse_json_msrs)
     EXPECT_TRUE(is_agg_expect_same(m_msrio_group->agg_function("MSR::MSR_TWO:FIELD_RW")));
 }
 
+TEST_F(MSRIOGroupTest, msr_table_json)
+{
+    // The tables generated by msr_data_table.py at build time must
+    // match the run time parse of the JSON they were generated from.
+    std::vector<std::pair<std::string, const geopm::msr_table_s &> > built_in {
+        {"arch", geopm::arch_msr_table()},
+        {"knl", geopm::knl_msr_table()},
+        {"hsx", geopm::hsx_msr_table()},
+        {"snb", geopm::snb_msr_table()},
+        {"skx", geopm::skx_msr_table()},
+        {"spr", geopm::spr_msr_table()},
+    };
+    for (const auto &it : built_in) {
+        std::string json_path = std::string(GEOPM_SOURCE_DIR) + "/json_data/msr_data_" + it.first + ".json";
+        auto json_table = MSRIOGroup::parse_json_table(geopm::read_file(json_path));
+        const geopm::msr_table_s &expect = json_table->table;
+        const geopm::msr_table_s &actual = it.second;
+        ASSERT_EQ(expect.num_msr, actual.num_msr) << json_path;
+        for (int msr_idx = 0; msr_idx != expect.num_msr; ++msr_idx) {
+            const geopm::msr_data_s &expect_msr = expect.msr[msr_idx];
+            const geopm::msr_data_s &actual_msr = actual.msr[msr_idx];
+            std::string msr_name = expect_msr.name;
+            EXPECT_EQ(msr_name, actual_msr.name) << json_path;
+            EXPECT_EQ(expect_msr.offset, actual_msr.offset) << msr_name;
+            EXPECT_EQ(std::string(expect_msr.domain), actual_msr.domain) << msr_name;
+            ASSERT_EQ(expect_msr.num_field, actual_msr.num_field) << msr_name;
+            for (int field_idx = 0; field_idx != expect_msr.num_field; ++field_idx) {
+                const geopm::msr_field_data_s &expect_field = expect_msr.field[field_idx];
+                const geopm::msr_field_data_s &actual_field = actual_msr.field[field_idx];
+                std::string field_name = msr_name + ":" + expect_field.name;
+                EXPECT_EQ(std::string(expect_field.name), actual_field.name) << field_name;
+                EXPECT_EQ(expect_field.begin_bit, actual_field.begin_bit) << field_name;
+                EXPECT_EQ(expect_field.end_bit, actual_field.end_bit) << field_name;
+                EXPECT_EQ(std::string(expect_field.function), actual_field.function) << field_name;
+                EXPECT_EQ(expect_field.scalar, actual_field.scalar) << field_name;
+                EXPECT_EQ(std::string(expect_field.units), actual_field.units) << field_name;
+                EXPECT_EQ(expect_field.is_writeable, actual_field.is_writeable) << field_name;
+                EXPECT_EQ(std::string(expect_field.behavior), actual_field.behavior) << field_name;
+                EXPECT_EQ(std::string(expect_field.aggregation), actual_field.aggregation) << field_name;
+                if (expect_field.description == nullptr) {
+                    EXPECT_EQ(nullptr, actual_field.description) << field_name;
+                }
+                else {
+                    ASSERT_NE(nullptr, actual_field.description) << field_name;
+                    EXPECT_EQ(std::string(expect_field.description), actual_field.description) << field_name;
+                }
+            }
+        }
+    }
+}
+
 TEST_F(MSRIOGroupTest, batch_calls_no_push)
 {
     // Make sure calling read_batch and write batch with nothing
@@ -1462,6 +1528,36 @@ TEST_F(MSRIOGroupTest, save_restore_control)
     m_msrio_group->restore_control(file_name);
 }
 
+TEST_F(MSRIOGroupTest, save_restore_batch)
+{
+    int save_restore_ctx = 1;
+    int write_controls_ctx = 2;
+    EXPECT_CALL(*m_msrio, create_batch_context())
+        .WillOnce(Return(save_restore_ctx))
+        .WillOnce(Return(write_controls_ctx));
+    m_msrio_group = geopm::make_unique<MSRIOGroup>(*m_topo, m_msrio,
+                                                   m_mock_cpuid,
+                                                   m_num_cpu,
+                                                   m_mock_save_ctl);
+    // One read of the save/restore context saves every control
+    EXPECT_CALL(*m_msrio, read_batch(save_restore_ctx)).Times(1);
+    EXPECT_CALL(*m_msrio, sample(_, _)).Times(AnyNumber());
+    m_msrio_group->save_control();
+    EXPECT_CALL(*m_msrio, adjust(_, _, _, _)).Times(AnyNumber());
+    EXPECT_CALL(*m_msrio, write_batch(save_restore_ctx)).Times(1);
+    m_msrio_group->restore_control();
+
+    // Raw fields requested together are written in one batch of
+    // their own context
+    std::vector<geopm_request_s> control_config = {
+        {GEOPM_DOMAIN_CORE, 0, "MSR::PERF_CTL:FREQ"},
+        {GEOPM_DOMAIN_CORE, 1, "MSR::PERF_CTL:FREQ"}};
+    EXPECT_CALL(*m_msrio, adjust(_, _, _, save_restore_ctx)).Times(0);
+    EXPECT_CALL(*m_msrio, write_batch(write_controls_ctx)).Times(1);
+    EXPECT_CALL(*m_msrio, write_msr(_, _, _, _)).Times(0);
+    m_msrio_group->write_controls(control_config, {2e9, 3e9});
+}
+
 TEST_F(MSRIOGroupTest, turbo_ratio_limit_writability)
 {
     static const uint64_t platform_info_offset = 0xce;
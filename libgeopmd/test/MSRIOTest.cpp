@@ -917,3 +917,67 @@ TEST_F(MSRIOTest, write_batch)
     EXPECT_EQ(end_words0, written_words0);
     EXPECT_EQ(end_words1, written_words1);
 }
+
+TEST_F(MSRIOTest, write_batch_dirty)
+{
+    int num_read = 0;
+    int num_write = 0;
+    int num_submit = 0;
+    EXPECT_CALL(*m_batch_io, prep_read(_, _, _, _, _)).WillRepeatedly(
+        Invoke([&num_read](std::shared_ptr<int> ret, int, void *buf, unsigned nbytes, off_t) {
+            memset(buf, 0, nbytes);
+            *ret = nbytes;
+            ++num_read;
+        }));
+    EXPECT_CALL(*m_batch_io, prep_write(_, _, _, _, _)).WillRepeatedly(
+        Invoke([&num_write](std::shared_ptr<int> ret, int, const void *, unsigned nbytes, off_t) {
+            *ret = nbytes;
+            ++num_write;
+        }));
+    EXPECT_CALL(*m_batch_io, submit()).WillRepeatedly(
+        Invoke([&num_submit]() {
+            ++num_submit;
+        }));
+
+    // Fields of the same MSR share one write operation
+    int idx_0 = m_msrio->add_write(0, 0x0);
+    EXPECT_EQ(idx_0, m_msrio->add_write(0, 0x0));
+    int idx_1 = m_msrio->add_write(1, 0x0);
+    EXPECT_NE(idx_0, idx_1);
+    m_msrio->adjust(idx_0, 0x1, 0xF);
+    m_msrio->adjust(idx_0, 0x20, 0xF0);
+    m_msrio->adjust(idx_1, 0x1, 0xF);
+    m_msrio->write_batch();
+    EXPECT_EQ(2, num_read);
+    EXPECT_EQ(2, num_write);
+    EXPECT_EQ(2, num_submit);
+    EXPECT_EQ(0ULL, m_msrio->num_write_skipped());
+
+    // Nothing adjusted: no system calls
+    m_msrio->write_batch();
+    EXPECT_EQ(2, num_submit);
+    EXPECT_EQ(2ULL, m_msrio->num_write_skipped());
+
+    // Only the operation with a new value is written
+    m_msrio->adjust(idx_0, 0x1, 0xF);
+    m_msrio->adjust(idx_1, 0x2, 0xF);
+    m_msrio->write_batch();
+    EXPECT_EQ(3, num_read);
+    EXPECT_EQ(3, num_write);
+    EXPECT_EQ(4, num_submit);
+    EXPECT_EQ(3ULL, m_msrio->num_write_skipped());
+
+    // A field that was not written before is dirty even if the rest
+    // of the MSR matches
+    m_msrio->adjust(idx_0, 0x0, 0xF00);
+    m_msrio->write_batch();
+    EXPECT_EQ(4, num_write);
+    EXPECT_EQ(4ULL, m_msrio->num_write_skipped());
+
+    // A write outside of the batch invalidates the last written value
+    m_msrio->write_msr(1, 0x0, 0x0, 0xF);
+    m_msrio->adjust(idx_1, 0x2, 0xF);
+    m_msrio->write_batch();
+    EXPECT_EQ(5, num_write);
+    EXPECT_EQ(5ULL, m_msrio->num_write_skipped());
+}
@@ -44,8 +44,10 @@ test_geopm_test_SOURCES = test/GPUTopoNullTest.cpp \
                           test/geopm_test_helper.cpp \
                           test/GEOPMHintTest.cpp \
                           test/HelperTest.cpp \
+                          test/IOGroupCacheTest.cpp \
                           test/IOGroupTest.cpp \
                           test/IOUringTest.cpp \
+                          test/LazyIOGroupTest.cpp \
                           test/LevelZeroGPUTopoTest.cpp \
                           test/LevelZeroDevicePoolTest.cpp \
                           test/LevelZeroIOGroupTest.cpp \
@@ -85,6 +87,7 @@ test_geopm_test_SOURCES = test/GPUTopoNullTest.cpp \
                           test/PlatformTopoTest.cpp \
                           test/RawMSRSignalTest.cpp \
                           test/SharedMemoryTest.cpp \
+                          test/ReplayIOGroupTest.cpp \
                           test/SaveControlTest.cpp \
                           test/SecurePathTest.cpp \
                           test/ServiceIOGroupTest.cpp \
@@ -29,6 +29,8 @@ class MockSDBusMessage : public geopm::SDBusMessage
                     (const std::vector<std::string> &write_values), (override));
         MOCK_METHOD(void, append_request,
                     (const geopm_request_s &request), (override));
+        MOCK_METHOD(void, append_request_setting,
+                    (const geopm_request_s &request, double setting), (override));
         MOCK_METHOD(bool, was_success, (), (override));
 };
 
@@ -33,6 +33,11 @@ class MockServiceProxy : public geopm::ServiceProxy
         MOCK_METHOD(void, platform_write_control,
                     (const std::string &control_name, int domain,
                      int domain_idx, double setting), (override));
+        MOCK_METHOD(std::vector<double>, platform_read_signals,
+                    (const std::vector<struct geopm_request_s> &signal_config), (override));
+        MOCK_METHOD(void, platform_write_controls,
+                    (const std::vector<struct geopm_request_s> &control_config,
+                     const std::vector<double> &settings), (override));
         MOCK_METHOD(void, platform_restore_control, (), (override));
         MOCK_METHOD(std::string, topo_get_cache,
                     (), (override));
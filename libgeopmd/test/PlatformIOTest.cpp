@@ -18,6 +18,7 @@
 #include "PlatformIOImp.hpp"
 #include "geopm/IOGroup.hpp"
 #include "MockIOGroup.hpp"
+#include "MultiRequestIOGroup.hpp"
 #include "MockPlatformTopo.hpp"
 #include "geopm/PlatformTopo.hpp"
 #include "geopm/Exception.hpp"
@@ -37,6 +38,7 @@ using ::testing::Return;
 using ::testing::SetArgReferee;
 using ::testing::AtLeast;
 using ::testing::AtMost;
+using ::testing::InSequence;
 using ::testing::Throw;
 using ::testing::Not;
 using ::testing::IsEmpty;
@@ -99,6 +101,19 @@ class PlatformIOTestMockIOGroup : public MockIOGroup
         }
 };
 
+// IOGroup that can also read and write several requests at once
+class PlatformIOTestMultiRequestIOGroup : public PlatformIOTestMockIOGroup,
+                                          public geopm::MultiRequestIOGroup
+{
+    public:
+        MOCK_METHOD(std::vector<double>, read_signals,
+                    (const std::vector<geopm_request_s> &signal_config), (override));
+        MOCK_METHOD(void, write_controls,
+                    (const std::vector<geopm_request_s> &control_config,
+                     const std::vector<double> &settings),
+                    (override));
+};
+
 class PlatformIOTest : public ::testing::Test
 {
     protected:
@@ -473,6 +488,48 @@ TEST_F(PlatformIOTest, sample)
     GEOPM_EXPECT_THROW_MESSAGE(m_platio->sample(10), GEOPM_ERROR_INVALID, "signal_idx out of range");
 }
 
+TEST_F(PlatformIOTest, sample_array)
+{
+    EXPECT_CALL(*m_control_iogroup, signal_domain_type("FREQ")).Times(2);
+    EXPECT_CALL(*m_control_iogroup, push_signal("FREQ", _, _));
+    EXPECT_CALL(*m_control_iogroup, read_signal("FREQ", _, _));
+    EXPECT_CALL(*m_time_iogroup, signal_domain_type("TIME")).Times(2);
+    EXPECT_CALL(*m_time_iogroup, push_signal("TIME", _, _));
+    EXPECT_CALL(*m_time_iogroup, read_signal("TIME", _, _));
+    std::vector<geopm_request_s> requests = {{GEOPM_DOMAIN_CPU, 0, "FREQ"},
+                                             {GEOPM_DOMAIN_BOARD, 0, "TIME"}};
+    std::vector<int> signal_idx = m_platio->push_signals(requests);
+    EXPECT_EQ(std::vector<int>({0, 1}), signal_idx);
+
+    double result[2] = {NAN, NAN};
+    GEOPM_EXPECT_THROW_MESSAGE(m_platio->sample_array(2, signal_idx.data(), result),
+                               GEOPM_ERROR_RUNTIME, "read_batch() not called prior to call to sample()");
+    EXPECT_TRUE(std::isnan(result[0]));
+
+    for (auto iog : m_iogroup_ptr) {
+        EXPECT_CALL(*iog, read_batch());
+    }
+    m_platio->read_batch();
+
+    EXPECT_CALL(*m_control_iogroup, sample(0))
+        .WillOnce(Return(2e9));
+    EXPECT_CALL(*m_time_iogroup, sample(0))
+        .WillOnce(Return(1.0));
+    m_platio->sample_array(2, signal_idx.data(), result);
+    EXPECT_DOUBLE_EQ(2e9, result[0]);
+    EXPECT_DOUBLE_EQ(1.0, result[1]);
+
+    // The result is not modified if any index is invalid, and no
+    // signal is sampled
+    EXPECT_CALL(*m_control_iogroup, sample(_)).Times(0);
+    int bad_idx[2] = {0, 10};
+    GEOPM_EXPECT_THROW_MESSAGE(m_platio->sample_array(2, bad_idx, result),
+                               GEOPM_ERROR_INVALID, "signal_idx out of range");
+    EXPECT_DOUBLE_EQ(2e9, result[0]);
+    GEOPM_EXPECT_THROW_MESSAGE(m_platio->sample_array(-1, signal_idx.data(), result),
+                               GEOPM_ERROR_INVALID, "num_signal is negative");
+}
+
 TEST_F(PlatformIOTest, sample_not_active)
 {
     /*EXPECT_CALL(*m_control_iogroup, control_domain_type("FREQ")).Times(2);
@@ -536,10 +593,45 @@ TEST_F(PlatformIOTest, adjust)
         EXPECT_CALL(*iog, write_batch());
     }
     m_platio->write_batch();
+    // The IOGroup is not called again when the setting is unchanged
+    m_platio->adjust(freq_idx, 3e9);
+    EXPECT_CALL(*m_control_iogroup, adjust(0, 2e9));
+    m_platio->adjust(freq_idx, 2e9);
     GEOPM_EXPECT_THROW_MESSAGE(m_platio->adjust(-1, 0.0), GEOPM_ERROR_INVALID, "control_idx out of range");
     GEOPM_EXPECT_THROW_MESSAGE(m_platio->adjust(10, 0.0), GEOPM_ERROR_INVALID, "control_idx out of range");
 }
 
+TEST_F(PlatformIOTest, adjust_array)
+{
+    EXPECT_CALL(*m_control_iogroup, control_domain_type("FREQ")).Times(2 * 2);
+    EXPECT_CALL(*m_control_iogroup, read_signal("FREQ", GEOPM_DOMAIN_CPU, _)).Times(2);
+    EXPECT_CALL(*m_control_iogroup, write_control("FREQ", GEOPM_DOMAIN_CPU, _, _)).Times(2);
+    EXPECT_CALL(*m_control_iogroup, push_control("FREQ", GEOPM_DOMAIN_CPU, 0))
+        .WillOnce(Return(0));
+    EXPECT_CALL(*m_control_iogroup, push_control("FREQ", GEOPM_DOMAIN_CPU, 1))
+        .WillOnce(Return(1));
+    std::vector<geopm_request_s> requests = {{GEOPM_DOMAIN_CPU, 0, "FREQ"},
+                                             {GEOPM_DOMAIN_CPU, 1, "FREQ"}};
+    std::vector<int> control_idx = m_platio->push_controls(requests);
+    EXPECT_EQ(std::vector<int>({0, 1}), control_idx);
+
+    double setting[2] = {3e9, 2e9};
+    EXPECT_CALL(*m_control_iogroup, adjust(0, 3e9));
+    EXPECT_CALL(*m_control_iogroup, adjust(1, 2e9));
+    m_platio->adjust_array(2, control_idx.data(), setting);
+
+    // No control is adjusted if any setting or index is invalid
+    EXPECT_CALL(*m_control_iogroup, adjust(_, _)).Times(0);
+    double bad_setting[2] = {1e9, NAN};
+    GEOPM_EXPECT_THROW_MESSAGE(m_platio->adjust_array(2, control_idx.data(), bad_setting),
+                               GEOPM_ERROR_INVALID, "setting is NAN");
+    int bad_idx[2] = {0, 10};
+    GEOPM_EXPECT_THROW_MESSAGE(m_platio->adjust_array(2, bad_idx, setting),
+                               GEOPM_ERROR_INVALID, "control_idx out of range");
+    GEOPM_EXPECT_THROW_MESSAGE(m_platio->adjust_array(-1, control_idx.data(), setting),
+                               GEOPM_ERROR_INVALID, "num_control is negative");
+}
+
 TEST_F(PlatformIOTest, adjust_agg)
 {
     EXPECT_CALL(*m_topo, is_nested_domain(GEOPM_DOMAIN_CPU,
@@ -633,6 +725,41 @@ TEST_F(PlatformIOTest, read_signal_agg)
     EXPECT_DOUBLE_EQ(expected, freq);
 }
 
+TEST_F(PlatformIOTest, read_signal_agg_error)
+{
+    // Higher priority IOGroup that reads all nested domains at once
+    auto multi_iogroup = std::make_shared<PlatformIOTestMultiRequestIOGroup>();
+    ON_CALL(*multi_iogroup, name()).WillByDefault(Return("MULTI"));
+    EXPECT_CALL(*multi_iogroup, name()).Times(AtLeast(0));
+    multi_iogroup->set_valid_signals({{"FREQ", GEOPM_DOMAIN_CPU}});
+    PlatformIOImp platio({m_control_iogroup, multi_iogroup}, *m_topo);
+
+    EXPECT_CALL(*m_topo, is_nested_domain(_, _)).Times(AtLeast(1));
+    EXPECT_CALL(*m_topo, domain_nested(_, _, _)).Times(AtLeast(1));
+    EXPECT_CALL(*multi_iogroup, signal_domain_type("FREQ")).Times(AtLeast(1));
+    EXPECT_CALL(*m_control_iogroup, signal_domain_type("FREQ")).Times(AtLeast(0));
+    EXPECT_CALL(*multi_iogroup, agg_function("FREQ"))
+        .WillRepeatedly(Return(Agg::average));
+    EXPECT_CALL(*multi_iogroup, read_signals(_))
+        .WillOnce(Return(std::vector<double> {0.0, 1e9, 4e9, 5e9}));
+    EXPECT_CALL(*multi_iogroup, read_signal(_, _, _)).Times(0);
+    double freq = platio.read_signal("FREQ", GEOPM_DOMAIN_PACKAGE, 0);
+    EXPECT_DOUBLE_EQ((0 + 1 + 4 + 5) * 1e9 / 4.0, freq);
+
+    // If the batched read fails, each domain is read and lower
+    // priority IOGroups are tried
+    EXPECT_CALL(*multi_iogroup, read_signals(_))
+        .WillOnce(Throw(geopm::Exception("injected exception", GEOPM_ERROR_RUNTIME, __FILE__, __LINE__)));
+    for (auto cpu : m_cpu_set0) {
+        EXPECT_CALL(*multi_iogroup, read_signal("FREQ", GEOPM_DOMAIN_CPU, cpu))
+            .WillOnce(Throw(geopm::Exception("injected exception", GEOPM_ERROR_RUNTIME, __FILE__, __LINE__)));
+        EXPECT_CALL(*m_control_iogroup, read_signal("FREQ", GEOPM_DOMAIN_CPU, cpu))
+            .WillOnce(Return(1e9 * cpu));
+    }
+    freq = platio.read_signal("FREQ", GEOPM_DOMAIN_PACKAGE, 0);
+    EXPECT_DOUBLE_EQ((0 + 1 + 4 + 5) * 1e9 / 4.0, freq);
+}
+
 TEST_F(PlatformIOTest, read_signal_override)
 {
     // overridden IOGroup will not be used except to be inspected as a potential fallback
@@ -701,6 +828,113 @@ TEST_F(PlatformIOTest, write_control)
                                GEOPM_ERROR_INVALID, "domain 4 is not valid for control \"MODE\"");
 }
 
+TEST_F(PlatformIOTest, write_controls)
+{
+    // write_controls will not affect pushed controls
+    EXPECT_CALL(*m_override_iogroup, write_batch()).Times(0);
+
+    double value = 3e9;
+    EXPECT_CALL(*m_topo, is_nested_domain(_, _)).Times(AtLeast(1));
+    EXPECT_CALL(*m_topo, domain_nested(_, _, _)).Times(AtLeast(1));
+    EXPECT_CALL(*m_control_iogroup, control_domain_type(_)).Times(AtLeast(1));
+    EXPECT_CALL(*m_override_iogroup, control_domain_type(_)).Times(AtLeast(1));
+    EXPECT_CALL(*m_control_iogroup, agg_function("FREQ"))
+        .WillRepeatedly(Return(geopm::Agg::average));
+    // Requests are converted to native domains and written in the
+    // order given, even when an IOGroup appears more than once
+    {
+        InSequence sequence;
+        for (auto cpu : m_cpu_set0) {
+            EXPECT_CALL(*m_control_iogroup, write_control("FREQ", GEOPM_DOMAIN_CPU, cpu, value));
+        }
+        EXPECT_CALL(*m_override_iogroup, write_control("MODE", GEOPM_DOMAIN_BOARD, 0, 1.0));
+        EXPECT_CALL(*m_control_iogroup, write_control("FREQ", GEOPM_DOMAIN_CPU, 5, value + 1e8));
+    }
+    std::vector<geopm_request_s> control_config = {
+        {GEOPM_DOMAIN_PACKAGE, 0, "FREQ"},
+        {GEOPM_DOMAIN_BOARD, 0, "MODE"},
+        {GEOPM_DOMAIN_CPU, 5, "FREQ"},
+    };
+    m_platio->write_controls(control_config, {value, 1.0, value + 1e8});
+
+    // Nothing is written if any request is invalid
+    control_config.push_back({GEOPM_DOMAIN_CPU, 0, "INVALID"});
+    GEOPM_EXPECT_THROW_MESSAGE(m_platio->write_controls(control_config, {value, 1.0, value, 0.0}),
+                               GEOPM_ERROR_INVALID, "control name \"INVALID\" not found");
+    GEOPM_EXPECT_THROW_MESSAGE(m_platio->write_controls(control_config, {value}),
+                               GEOPM_ERROR_INVALID, "number of settings does not match");
+}
+
+TEST_F(PlatformIOTest, write_controls_run)
+{
+    auto multi_iogroup = std::make_shared<PlatformIOTestMultiRequestIOGroup>();
+    ON_CALL(*multi_iogroup, name()).WillByDefault(Return("MULTI"));
+    EXPECT_CALL(*multi_iogroup, name()).Times(AtLeast(0));
+    multi_iogroup->set_valid_controls({{"FREQ", GEOPM_DOMAIN_CPU}});
+    PlatformIOImp platio({m_override_iogroup, multi_iogroup}, *m_topo);
+
+    EXPECT_CALL(*multi_iogroup, control_domain_type("FREQ")).Times(AtLeast(1));
+    EXPECT_CALL(*m_override_iogroup, control_domain_type(_)).Times(AtLeast(0));
+    std::vector<geopm_request_s> control_config = {
+        {GEOPM_DOMAIN_CPU, 0, "FREQ"},
+        {GEOPM_DOMAIN_CPU, 1, "FREQ"},
+        {GEOPM_DOMAIN_BOARD, 0, "MODE"},
+        {GEOPM_DOMAIN_CPU, 2, "FREQ"},
+    };
+    // Consecutive requests to the same IOGroup are written together
+    auto is_cpu = [](std::vector<int> cpus) {
+        return ::testing::Truly([cpus](const std::vector<geopm_request_s> &config) {
+            std::vector<int> domain_idx;
+            for (const auto &request : config) {
+                domain_idx.push_back(request.domain_idx);
+            }
+            return domain_idx == cpus;
+        });
+    };
+    {
+        InSequence sequence;
+        EXPECT_CALL(*multi_iogroup, write_controls(is_cpu({0, 1}), std::vector<double>{1e9, 2e9}));
+        EXPECT_CALL(*m_override_iogroup, write_control("MODE", GEOPM_DOMAIN_BOARD, 0, 3.0));
+        EXPECT_CALL(*multi_iogroup, write_controls(is_cpu({2}), std::vector<double>{4e9}));
+    }
+    platio.write_controls(control_config, {1e9, 2e9, 3.0, 4e9});
+}
+
+TEST_F(PlatformIOTest, write_controls_error)
+{
+    double value = 3e9;
+    EXPECT_CALL(*m_topo, is_nested_domain(_, _)).Times(AtLeast(1));
+    EXPECT_CALL(*m_topo, domain_nested(_, _, _)).Times(AtLeast(1));
+    EXPECT_CALL(*m_control_iogroup, control_domain_type(_)).Times(AtLeast(1));
+    EXPECT_CALL(*m_control_iogroup, agg_function("FREQ"))
+        .WillRepeatedly(Return(geopm::Agg::average));
+    std::vector<geopm_request_s> control_config = {
+        {GEOPM_DOMAIN_PACKAGE, 0, "FREQ"},
+    };
+    // The IOGroup fails partway through the batch: the error is
+    // thrown and no request is written again
+    {
+        InSequence sequence;
+        EXPECT_CALL(*m_control_iogroup, write_control("FREQ", GEOPM_DOMAIN_CPU, 0, value));
+        EXPECT_CALL(*m_control_iogroup, write_control("FREQ", GEOPM_DOMAIN_CPU, 1, value))
+            .WillOnce(Throw(geopm::Exception("injected exception", GEOPM_ERROR_RUNTIME, __FILE__, __LINE__)));
+    }
+    EXPECT_CALL(*m_control_iogroup, write_control("FREQ", GEOPM_DOMAIN_CPU, 4, _)).Times(0);
+    EXPECT_CALL(*m_control_iogroup, write_control("FREQ", GEOPM_DOMAIN_CPU, 5, _)).Times(0);
+    GEOPM_EXPECT_THROW_MESSAGE(m_platio->write_controls(control_config, {value}),
+                               GEOPM_ERROR_RUNTIME, "injected exception");
+
+    // An IOGroup that does not implement the batched write is
+    // written one request at a time
+    EXPECT_CALL(*m_control_iogroup, write_control("FREQ", GEOPM_DOMAIN_CPU, 0, value))
+        .WillOnce(Throw(geopm::Exception("injected exception", GEOPM_ERROR_NOT_IMPLEMENTED, __FILE__, __LINE__)))
+        .WillOnce(Return());
+    for (auto cpu : {1, 4, 5}) {
+        EXPECT_CALL(*m_control_iogroup, write_control("FREQ", GEOPM_DOMAIN_CPU, cpu, value));
+    }
+    m_platio->write_controls(control_config, {value});
+}
+
 TEST_F(PlatformIOTest, write_control_agg)
 {
     // write_control will not affect pushed controls
@@ -720,6 +954,38 @@ TEST_F(PlatformIOTest, write_control_agg)
     m_platio->write_control("FREQ", GEOPM_DOMAIN_PACKAGE, 0, value);
 }
 
+TEST_F(PlatformIOTest, write_control_agg_error)
+{
+    // Higher priority IOGroup that writes all nested domains at once
+    auto multi_iogroup = std::make_shared<PlatformIOTestMultiRequestIOGroup>();
+    ON_CALL(*multi_iogroup, name()).WillByDefault(Return("MULTI"));
+    EXPECT_CALL(*multi_iogroup, name()).Times(AtLeast(0));
+    multi_iogroup->set_valid_controls({{"FREQ", GEOPM_DOMAIN_CPU}});
+    PlatformIOImp platio({m_control_iogroup, multi_iogroup}, *m_topo);
+
+    double value = 3e9;
+    EXPECT_CALL(*m_topo, is_nested_domain(_, _)).Times(AtLeast(1));
+    EXPECT_CALL(*m_topo, domain_nested(_, _, _)).Times(AtLeast(1));
+    EXPECT_CALL(*multi_iogroup, control_domain_type("FREQ")).Times(AtLeast(1));
+    EXPECT_CALL(*m_control_iogroup, control_domain_type("FREQ")).Times(AtLeast(0));
+    EXPECT_CALL(*multi_iogroup, agg_function("FREQ"))
+        .WillRepeatedly(Return(Agg::average));
+    EXPECT_CALL(*multi_iogroup, write_controls(_, std::vector<double>(m_cpu_set0.size(), value)));
+    EXPECT_CALL(*multi_iogroup, write_control(_, _, _, _)).Times(0);
+    platio.write_control("FREQ", GEOPM_DOMAIN_PACKAGE, 0, value);
+
+    // If the batched write fails, each domain is written and lower
+    // priority IOGroups are tried
+    EXPECT_CALL(*multi_iogroup, write_controls(_, _))
+        .WillOnce(Throw(geopm::Exception("injected exception", GEOPM_ERROR_RUNTIME, __FILE__, __LINE__)));
+    for (auto cpu : m_cpu_set0) {
+        EXPECT_CALL(*multi_iogroup, write_control("FREQ", GEOPM_DOMAIN_CPU, cpu, value))
+            .WillOnce(Throw(geopm::Exception("injected exception", GEOPM_ERROR_RUNTIME, __FILE__, __LINE__)));
+        EXPECT_CALL(*m_control_iogroup, write_control("FREQ", GEOPM_DOMAIN_CPU, cpu, value));
+    }
+    platio.write_control("FREQ", GEOPM_DOMAIN_PACKAGE, 0, value);
+}
+
 TEST_F(PlatformIOTest, write_control_agg_sum)
 {
     // write_control will not affect pushed controls
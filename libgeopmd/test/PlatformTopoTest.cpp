@@ -771,6 +771,54 @@ TEST_F(PlatformTopoTest, bdx_domain_nested)
                                     GEOPM_DOMAIN_NIC, 0), Exception);
 }
 
+TEST_F(PlatformTopoTest, hybrid_cpu_map)
+{
+    // Two cores with two adjacent hardware threads and two cores
+    // with one thread: the summary alone is inconsistent.
+    std::string lscpu_str =
+        "CPU(s):                6\n"
+        "On-line CPU(s) mask:   0x3f\n"
+        "Thread(s) per core:    2\n"
+        "Core(s) per socket:    4\n"
+        "Socket(s):             1\n"
+        "NUMA node(s):          1\n"
+        "NUMA node0 CPU(s):     0x3f\n";
+    write_lscpu(lscpu_str);
+    EXPECT_THROW(PlatformTopoImp topo(m_lscpu_file_name, nullptr), Exception);
+
+    lscpu_str +=
+        "CPU 0 core,socket:     0,0\n"
+        "CPU 1 core,socket:     0,0\n"
+        "CPU 2 core,socket:     4,0\n"
+        "CPU 3 core,socket:     4,0\n"
+        "CPU 4 core,socket:     8,0\n"
+        "CPU 5 core,socket:     9,0\n";
+    write_lscpu(lscpu_str);
+    PlatformTopoImp topo(m_lscpu_file_name, nullptr);
+    EXPECT_EQ(1, topo.num_domain(GEOPM_DOMAIN_PACKAGE));
+    EXPECT_EQ(4, topo.num_domain(GEOPM_DOMAIN_CORE));
+    EXPECT_EQ(6, topo.num_domain(GEOPM_DOMAIN_CPU));
+    std::vector<int> expect_core = {0, 0, 1, 1, 2, 3};
+    EXPECT_EQ(expect_core, topo.cpu_domain_idx(GEOPM_DOMAIN_CORE));
+    for (int cpu_idx = 0; cpu_idx != 6; ++cpu_idx) {
+        EXPECT_EQ(expect_core[cpu_idx], topo.domain_idx(GEOPM_DOMAIN_CORE, cpu_idx));
+        EXPECT_EQ(0, topo.domain_idx(GEOPM_DOMAIN_PACKAGE, cpu_idx));
+    }
+    EXPECT_EQ(std::vector<int>({2, 3}), topo.domain_cpus(GEOPM_DOMAIN_CORE, 1));
+    EXPECT_EQ(std::vector<int>({5}), topo.domain_cpus(GEOPM_DOMAIN_CORE, 3));
+    EXPECT_EQ(std::set<int>({0, 1}),
+              topo.domain_nested(GEOPM_DOMAIN_CPU, GEOPM_DOMAIN_CORE, 0));
+    EXPECT_EQ(std::set<int>({0, 1, 2, 3}),
+              topo.domain_nested(GEOPM_DOMAIN_CORE, GEOPM_DOMAIN_PACKAGE, 0));
+
+    // A map that does not describe every CPU is ignored
+    lscpu_str = m_hsw_lscpu_str + "CPU 0 core,socket:     0,0\n";
+    write_lscpu(lscpu_str);
+    PlatformTopoImp topo_partial(m_lscpu_file_name, nullptr);
+    EXPECT_EQ(2, topo_partial.num_domain(GEOPM_DOMAIN_CORE));
+    EXPECT_EQ(1, topo_partial.domain_idx(GEOPM_DOMAIN_CORE, 1));
+}
+
 TEST_F(PlatformTopoTest, parse_error)
 {
     std::string lscpu_missing_cpu =
@@ -834,6 +882,136 @@ TEST_F(PlatformTopoTest, parse_error)
     EXPECT_THROW(PlatformTopoImp topo(m_lscpu_file_name, nullptr), Exception);
 }
 
+TEST_F(PlatformTopoTest, binary_cache)
+{
+    std::string binary_file_name = m_lscpu_file_name + ".bin";
+    (void)unlink(binary_file_name.c_str());
+    write_lscpu(m_gpu_lscpu_str);
+    PlatformTopoImp expect_topo(m_lscpu_file_name, nullptr);
+    {
+        PlatformTopoImp topo(m_lscpu_file_name, nullptr, binary_file_name);
+    }
+    struct stat file_stat;
+    ASSERT_EQ(0, stat(binary_file_name.c_str(), &file_stat));
+    EXPECT_EQ((mode_t)(S_IRUSR | S_IWUSR), file_stat.st_mode & ~S_IFMT);
+
+    PlatformTopoImp topo(m_lscpu_file_name, nullptr, binary_file_name);
+    for (int domain_type = 0; domain_type != GEOPM_NUM_DOMAIN; ++domain_type) {
+        int num_domain = expect_topo.num_domain(domain_type);
+        EXPECT_EQ(num_domain, topo.num_domain(domain_type));
+        for (int domain_idx = 0; domain_idx != num_domain; ++domain_idx) {
+            EXPECT_EQ(expect_topo.domain_cpus(domain_type, domain_idx),
+                      topo.domain_cpus(domain_type, domain_idx));
+        }
+        if (num_domain != 0 &&
+            domain_type != GEOPM_DOMAIN_PACKAGE_INTEGRATED_MEMORY) {
+            EXPECT_EQ(expect_topo.cpu_domain_idx(domain_type),
+                      topo.cpu_domain_idx(domain_type));
+        }
+    }
+
+    // Find the memory domain index of CPU 0 in the cache by skipping
+    // the tables of the board, package, core and CPU domains.
+    std::string binary_contents = geopm::read_file(binary_file_name);
+    auto read_uint32 = [&binary_contents](size_t offset) {
+        uint32_t result = 0;
+        memcpy(&result, binary_contents.data() + offset, sizeof(result));
+        return result;
+    };
+    size_t memory_idx_offset = 44;
+    for (int domain_type = 0; domain_type != GEOPM_DOMAIN_MEMORY; ++domain_type) {
+        memory_idx_offset += sizeof(uint32_t) * (1 + read_uint32(memory_idx_offset));
+        uint32_t num_domain = read_uint32(memory_idx_offset);
+        memory_idx_offset += sizeof(uint32_t);
+        uint32_t num_cpus = read_uint32(memory_idx_offset + sizeof(uint32_t) * num_domain);
+        memory_idx_offset += sizeof(uint32_t) * (num_domain + 1 + num_cpus);
+    }
+    memory_idx_offset += sizeof(uint32_t);
+    ASSERT_EQ(0, expect_topo.domain_idx(GEOPM_DOMAIN_MEMORY, 0));
+
+    // Modify the cache to show that the cache is used rather than the
+    // lscpu file.
+    int32_t memory_idx = -1;
+    std::fstream binary_stream(binary_file_name, std::ios::in | std::ios::out | std::ios::binary);
+    binary_stream.seekp(memory_idx_offset);
+    binary_stream.write((const char *)&memory_idx, sizeof(memory_idx));
+    binary_stream.close();
+    EXPECT_EQ(-1, PlatformTopoImp(m_lscpu_file_name, nullptr, binary_file_name).domain_idx(GEOPM_DOMAIN_MEMORY, 0));
+
+    // A cache with an out of range domain index is replaced
+    memory_idx = expect_topo.num_domain(GEOPM_DOMAIN_MEMORY);
+    binary_stream.open(binary_file_name, std::ios::in | std::ios::out | std::ios::binary);
+    binary_stream.seekp(memory_idx_offset);
+    binary_stream.write((const char *)&memory_idx, sizeof(memory_idx));
+    binary_stream.close();
+    EXPECT_EQ(0, PlatformTopoImp(m_lscpu_file_name, nullptr, binary_file_name).domain_idx(GEOPM_DOMAIN_MEMORY, 0));
+
+    // A cache with a package count that does not match its package
+    // table is replaced
+    const size_t num_package_offset = 32;
+    const size_t version_offset = 8;
+    int32_t num_package = 3;
+    binary_stream.open(binary_file_name, std::ios::in | std::ios::out | std::ios::binary);
+    binary_stream.seekp(num_package_offset);
+    binary_stream.write((const char *)&num_package, sizeof(num_package));
+    binary_stream.close();
+    EXPECT_EQ(2, PlatformTopoImp(m_lscpu_file_name, nullptr, binary_file_name).num_domain(GEOPM_DOMAIN_PACKAGE));
+
+    // A cache with another format version is replaced
+    uint32_t version = PlatformTopoImp::M_BINARY_CACHE_VERSION + 1;
+    binary_stream.open(binary_file_name, std::ios::in | std::ios::out | std::ios::binary);
+    binary_stream.seekp(version_offset);
+    binary_stream.write((const char *)&version, sizeof(version));
+    binary_stream.close();
+    EXPECT_EQ(2, PlatformTopoImp(m_lscpu_file_name, nullptr, binary_file_name).num_domain(GEOPM_DOMAIN_PACKAGE));
+    std::ifstream version_stream(binary_file_name, std::ios::binary);
+    version_stream.seekg(version_offset);
+    version_stream.read((char *)&version, sizeof(version));
+    version_stream.close();
+    EXPECT_EQ(PlatformTopoImp::M_BINARY_CACHE_VERSION, version);
+
+    // A cache of a stale lscpu file is replaced
+    write_lscpu(m_hsw_lscpu_str);
+    PlatformTopoImp hsw_topo(m_lscpu_file_name, nullptr, binary_file_name);
+    EXPECT_EQ(0, hsw_topo.num_domain(GEOPM_DOMAIN_GPU));
+    EXPECT_EQ(PlatformTopoImp(m_lscpu_file_name, nullptr).num_domain(GEOPM_DOMAIN_CPU),
+              hsw_topo.num_domain(GEOPM_DOMAIN_CPU));
+
+    // A truncated cache is rejected
+    ASSERT_EQ(0, stat(binary_file_name.c_str(), &file_stat));
+    off_t binary_size = file_stat.st_size;
+    ASSERT_EQ(0, truncate(binary_file_name.c_str(), binary_size - 1));
+    EXPECT_EQ(0, PlatformTopoImp(m_lscpu_file_name, nullptr, binary_file_name).num_domain(GEOPM_DOMAIN_GPU));
+    ASSERT_EQ(0, stat(binary_file_name.c_str(), &file_stat));
+    EXPECT_EQ(binary_size, file_stat.st_size);
+    (void)unlink(binary_file_name.c_str());
+}
+
+TEST_F(PlatformTopoTest, binary_cache_service)
+{
+    // The binary cache is keyed on the content of the lscpu output
+    // provided by the service.
+    std::string binary_file_name = m_lscpu_file_name + ".bin";
+    (void)unlink(binary_file_name.c_str());
+    std::shared_ptr<MockServiceProxy> service_proxy = std::make_shared<MockServiceProxy>();
+    EXPECT_CALL(*service_proxy, topo_get_cache())
+        .Times(3)
+        .WillOnce(Return(m_gpu_lscpu_str))
+        .WillOnce(Return(m_gpu_lscpu_str))
+        .WillOnce(Return(m_hsw_lscpu_str));
+    int num_gpu = PlatformTopoImp("", service_proxy, binary_file_name).num_domain(GEOPM_DOMAIN_GPU);
+    EXPECT_NE(0, num_gpu);
+    struct stat file_stat;
+    ASSERT_EQ(0, stat(binary_file_name.c_str(), &file_stat));
+    std::string binary_contents = geopm::read_file(binary_file_name);
+    EXPECT_EQ(num_gpu, PlatformTopoImp("", service_proxy, binary_file_name).num_domain(GEOPM_DOMAIN_GPU));
+    EXPECT_EQ(binary_contents, geopm::read_file(binary_file_name));
+    // Different output from the service replaces the cache
+    EXPECT_EQ(0, PlatformTopoImp("", service_proxy, binary_file_name).num_domain(GEOPM_DOMAIN_GPU));
+    EXPECT_NE(binary_contents, geopm::read_file(binary_file_name));
+    (void)unlink(binary_file_name.c_str());
+}
+
 TEST_F(PlatformTopoTest, domain_type_to_name)
 {
     EXPECT_THROW(PlatformTopo::domain_type_to_name(GEOPM_DOMAIN_INVALID),
@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2015 - 2024 Intel Corporation
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "ReplayIOGroup.hpp"
+
+#include <unistd.h>
+#include <zlib.h>
+
+#include <cmath>
+#include <fstream>
+#include <string>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "geopm_topo.h"
+#include "geopm_test.hpp"
+
+#include "geopm/Agg.hpp"
+#include "geopm/Exception.hpp"
+#include "geopm/Helper.hpp"
+
+#include "MockPlatformTopo.hpp"
+
+using geopm::ReplayIOGroup;
+using geopm::IOGroup;
+using geopm::Exception;
+
+class ReplayIOGroupTest : public ::testing::Test
+{
+    protected:
+        void SetUp(void) override;
+        void TearDown(void) override;
+        static void write_file(const std::string &path, const std::string &contents);
+        static const std::string M_TRACE;
+
+        std::shared_ptr<MockPlatformTopo> m_topo;
+        std::string m_trace_path;
+        std::string m_log_path;
+};
+
+const std::string ReplayIOGroupTest::M_TRACE =
+    "# geopm_version: 3.1.0\n"
+    "# start_time: Mon Oct 19 08:00:00 2026\n"
+    "# profile_name: test\n"
+    "# node_name: node0\n"
+    "# agent: monitor\n"
+    "TIME|EPOCH_COUNT|REGION_HASH|CPU_POWER|CPU_POWER-package-0|CPU_POWER-package-1|CPU_FREQUENCY_STATUS-package-0|CPU_FREQUENCY_STATUS-package-1\n"
+    "0.0|0|0x00000000725e8066|150|70|80|2e9|2.1e9\n"
+    "0.005|1|0x00000000725e8066|160|75|85|2.2e9|2.3e9\n"
+    "0.010|2|0x00000000644f9787|170|80|90|2.4e9|NAN\n";
+
+void ReplayIOGroupTest::SetUp(void)
+{
+    m_topo = make_topo(2, 4, 8);
+    m_trace_path = "ReplayIOGroupTest_trace_" + std::to_string(getpid());
+    m_log_path = "ReplayIOGroupTest_log_" + std::to_string(getpid());
+    write_file(m_trace_path, M_TRACE);
+}
+
+void ReplayIOGroupTest::TearDown(void)
+{
+    (void)unlink(m_trace_path.c_str());
+    (void)unlink(m_log_path.c_str());
+}
+
+void ReplayIOGroupTest::write_file(const std::string &path, const std::string &contents)
+{
+    std::ofstream out(path);
+    out << contents;
+}
+
+TEST_F(ReplayIOGroupTest, valid_signals)
+{
+    ReplayIOGroup group(*m_topo, m_trace_path, 0.0, "CPU_POWER_LIMIT_CONTROL@package", "");
+    EXPECT_EQ(std::set<std::string>({"TIME", "EPOCH_COUNT", "REGION_HASH",
+                                     "CPU_POWER", "CPU_FREQUENCY_STATUS"}),
+              group.signal_names());
+    EXPECT_EQ(std::set<std::string>({"CPU_POWER_LIMIT_CONTROL"}), group.control_names());
+    // Board columns are preferred over the per-domain columns
+    EXPECT_EQ(GEOPM_DOMAIN_BOARD, group.signal_domain_type("CPU_POWER"));
+    EXPECT_EQ(GEOPM_DOMAIN_PACKAGE, group.signal_domain_type("CPU_FREQUENCY_STATUS"));
+    EXPECT_EQ(GEOPM_DOMAIN_INVALID, group.signal_domain_type("INVALID"));
+    EXPECT_EQ(GEOPM_DOMAIN_PACKAGE, group.control_domain_type("CPU_POWER_LIMIT_CONTROL"));
+    EXPECT_EQ(GEOPM_DOMAIN_INVALID, group.control_domain_type("CPU_POWER"));
+    EXPECT_FALSE(group.is_valid_control("CPU_POWER"));
+    EXPECT_EQ(IOGroup::M_SIGNAL_BEHAVIOR_MONOTONE, group.signal_behavior("EPOCH_COUNT"));
+    EXPECT_EQ(IOGroup::M_SIGNAL_BEHAVIOR_LABEL, group.signal_behavior("REGION_HASH"));
+    EXPECT_EQ(IOGroup::M_SIGNAL_BEHAVIOR_VARIABLE, group.signal_behavior("CPU_FREQUENCY_STATUS"));
+    EXPECT_TRUE(is_agg_sum(group.agg_function("CPU_POWER")));
+    EXPECT_TRUE(is_agg_average(group.agg_function("CPU_FREQUENCY_STATUS")));
+    EXPECT_EQ("0x725e8066", group.format_function("REGION_HASH")(0x725e8066));
+    EXPECT_EQ("REPLAY", group.name());
+}
+
+TEST_F(ReplayIOGroupTest, step)
+{
+    ReplayIOGroup group(*m_topo, m_trace_path, 0.0, "", "");
+    int time_idx = group.push_signal("TIME", GEOPM_DOMAIN_BOARD, 0);
+    int hash_idx = group.push_signal("REGION_HASH", GEOPM_DOMAIN_BOARD, 0);
+    int freq_idx = group.push_signal("CPU_FREQUENCY_STATUS", GEOPM_DOMAIN_PACKAGE, 1);
+    EXPECT_EQ(time_idx, group.push_signal("TIME", GEOPM_DOMAIN_BOARD, 0));
+    GEOPM_EXPECT_THROW_MESSAGE(group.push_signal("CPU_POWER", GEOPM_DOMAIN_PACKAGE, 0),
+                               GEOPM_ERROR_INVALID, "not defined for domain");
+    GEOPM_EXPECT_THROW_MESSAGE(group.sample(time_idx),
+                               GEOPM_ERROR_INVALID, "signal has not been read");
+    EXPECT_DOUBLE_EQ(2e9, group.read_signal("CPU_FREQUENCY_STATUS", GEOPM_DOMAIN_PACKAGE, 0));
+
+    group.read_batch();
+    EXPECT_DOUBLE_EQ(0.0, group.sample(time_idx));
+    EXPECT_DOUBLE_EQ(0x725e8066, group.sample(hash_idx));
+    EXPECT_DOUBLE_EQ(2.1e9, group.sample(freq_idx));
+    GEOPM_EXPECT_THROW_MESSAGE(group.push_signal("CPU_POWER", GEOPM_DOMAIN_BOARD, 0),
+                               GEOPM_ERROR_INVALID, "cannot push signal after call to read_batch");
+
+    group.read_batch();
+    EXPECT_DOUBLE_EQ(0.005, group.sample(time_idx));
+    EXPECT_DOUBLE_EQ(2.3e9, group.sample(freq_idx));
+    EXPECT_DOUBLE_EQ(160, group.read_signal("CPU_POWER", GEOPM_DOMAIN_BOARD, 0));
+
+    group.read_batch();
+    EXPECT_DOUBLE_EQ(0.010, group.sample(time_idx));
+    EXPECT_DOUBLE_EQ(0x644f9787, group.sample(hash_idx));
+    EXPECT_TRUE(std::isnan(group.sample(freq_idx)));
+
+    // The last row is held at the end of the trace
+    group.read_batch();
+    EXPECT_DOUBLE_EQ(0.010, group.sample(time_idx));
+}
+
+TEST_F(ReplayIOGroupTest, speedup)
+{
+    ReplayIOGroup slow(*m_topo, m_trace_path, 1e-9, "", "");
+    int slow_idx = slow.push_signal("EPOCH_COUNT", GEOPM_DOMAIN_BOARD, 0);
+    slow.read_batch();
+    slow.read_batch();
+    EXPECT_DOUBLE_EQ(0, slow.sample(slow_idx));
+
+    ReplayIOGroup fast(*m_topo, m_trace_path, 1e9, "", "");
+    int fast_idx = fast.push_signal("EPOCH_COUNT", GEOPM_DOMAIN_BOARD, 0);
+    fast.read_batch();
+    usleep(1000);
+    fast.read_batch();
+    EXPECT_DOUBLE_EQ(2, fast.sample(fast_idx));
+}
+
+TEST_F(ReplayIOGroupTest, control_log)
+{
+    {
+        ReplayIOGroup group(*m_topo, m_trace_path, 0.0,
+                            "CPU_POWER_LIMIT_CONTROL@package,CPU_FREQUENCY_MAX_CONTROL",
+                            m_log_path);
+        int time_idx = group.push_signal("TIME", GEOPM_DOMAIN_BOARD, 0);
+        int pkg0_idx = group.push_control("CPU_POWER_LIMIT_CONTROL", GEOPM_DOMAIN_PACKAGE, 0);
+        int pkg1_idx = group.push_control("CPU_POWER_LIMIT_CONTROL", GEOPM_DOMAIN_PACKAGE, 1);
+        EXPECT_NE(pkg0_idx, pkg1_idx);
+        EXPECT_EQ(pkg1_idx, group.push_control("CPU_POWER_LIMIT_CONTROL", GEOPM_DOMAIN_PACKAGE, 1));
+        GEOPM_EXPECT_THROW_MESSAGE(group.push_control("CPU_POWER_LIMIT_CONTROL", GEOPM_DOMAIN_PACKAGE, 2),
+                                   GEOPM_ERROR_INVALID, "domain_idx out of range");
+        GEOPM_EXPECT_THROW_MESSAGE(group.push_control("CPU_FREQUENCY_MAX_CONTROL", GEOPM_DOMAIN_CORE, 0),
+                                   GEOPM_ERROR_INVALID, "not defined for domain");
+        GEOPM_EXPECT_THROW_MESSAGE(group.read_signal("CPU_POWER_LIMIT_CONTROL", GEOPM_DOMAIN_PACKAGE, 0),
+                                   GEOPM_ERROR_NOT_IMPLEMENTED, "is not recorded in the trace");
+        group.read_batch();
+        (void)group.sample(time_idx);
+        // Nothing is logged until a control is adjusted
+        group.write_batch();
+        group.adjust(pkg0_idx, 100);
+        group.adjust(pkg1_idx, 110);
+        group.write_batch();
+        group.read_batch();
+        // Unchanged settings are not logged again
+        group.adjust(pkg0_idx, 100);
+        group.adjust(pkg1_idx, 120);
+        group.write_batch();
+        group.write_control("CPU_FREQUENCY_MAX_CONTROL", GEOPM_DOMAIN_BOARD, 0, 2e9);
+    }
+    std::string expected = "TIME|CONTROL|DOMAIN|DOMAIN_INDEX|SETTING\n"
+                           "0|CPU_POWER_LIMIT_CONTROL|package|0|100\n"
+                           "0|CPU_POWER_LIMIT_CONTROL|package|1|110\n"
+                           "0.005|CPU_POWER_LIMIT_CONTROL|package|1|120\n"
+                           "0.005|CPU_FREQUENCY_MAX_CONTROL|board|0|2000000000\n";
+    EXPECT_EQ(expected, geopm::read_file(m_log_path));
+}
+
+TEST_F(ReplayIOGroupTest, gzip_trace)
+{
+    std::string gz_path = m_trace_path + ".gz";
+    gzFile gz_file = gzopen(gz_path.c_str(), "wb");
+    ASSERT_NE(nullptr, gz_file);
+    ASSERT_EQ((int)M_TRACE.size(), gzwrite(gz_file, M_TRACE.data(), M_TRACE.size()));
+    gzclose(gz_file);
+    ReplayIOGroup group(*m_topo, gz_path, 0.0, "", "");
+    EXPECT_DOUBLE_EQ(150, group.read_signal("CPU_POWER", GEOPM_DOMAIN_BOARD, 0));
+    (void)unlink(gz_path.c_str());
+}
+
+TEST_F(ReplayIOGroupTest, errors)
+{
+    GEOPM_EXPECT_THROW_MESSAGE(ReplayIOGroup(*m_topo, "ReplayIOGroupTest_missing", 0.0, "", ""),
+                               ENOENT, "unable to open trace file");
+    GEOPM_EXPECT_THROW_MESSAGE(ReplayIOGroup(*m_topo, m_trace_path, -1.0, "", ""),
+                               GEOPM_ERROR_INVALID, "speedup must be zero or positive");
+    GEOPM_EXPECT_THROW_MESSAGE(ReplayIOGroup(*m_topo, m_trace_path, 0.0, "A@package@core", ""),
+                               GEOPM_ERROR_INVALID, "invalid control");
+    write_file(m_trace_path, "TIME|CPU_POWER\n0.0|150\n0.005\n");
+    GEOPM_EXPECT_THROW_MESSAGE(ReplayIOGroup(*m_topo, m_trace_path, 0.0, "", ""),
+                               GEOPM_ERROR_INVALID, "line 3 of trace has 1 fields, expected 2");
+    write_file(m_trace_path, "TIME|CPU_POWER\n0.0|watts\n");
+    GEOPM_EXPECT_THROW_MESSAGE(ReplayIOGroup(*m_topo, m_trace_path, 0.0, "", ""),
+                               GEOPM_ERROR_INVALID, "invalid value \"watts\" on line 2");
+    write_file(m_trace_path, "# comment\nTIME|CPU_POWER\n");
+    GEOPM_EXPECT_THROW_MESSAGE(ReplayIOGroup(*m_topo, m_trace_path, 0.0, "", ""),
+                               GEOPM_ERROR_INVALID, "trace has no rows");
+    write_file(m_trace_path, "CPU_POWER\n150\n");
+    GEOPM_EXPECT_THROW_MESSAGE(ReplayIOGroup(*m_topo, m_trace_path, 2.0, "", ""),
+                               GEOPM_ERROR_INVALID, "a TIME column is required");
+}
@@ -26,6 +26,7 @@ using testing::Return;
 using testing::_;
 using testing::SetArgReferee;
 using testing::DoAll;
+using testing::SaveArg;
 
 class ServiceIOGroupTest : public :: testing:: Test
 {
@@ -211,6 +212,57 @@ TEST_F(ServiceIOGroupTest, write_control_exception)
                                "ServiceIOGroup::write_control(): domain_idx out of range");
 }
 
+TEST_F(ServiceIOGroupTest, read_signals)
+{
+    std::vector<geopm_request_s> signal_config = {
+        geopm_request_s {0, 0, "SERVICE::signal1"},
+        geopm_request_s {1, 1, "signal2"}};
+    std::vector<geopm_request_s> service_config;
+    EXPECT_CALL(*m_proxy, platform_read_signals(_))
+        .WillOnce(DoAll(SaveArg<0>(&service_config),
+                        Return(std::vector<double>{42, 7})));
+    EXPECT_EQ(std::vector<double>({42, 7}),
+              m_serviceio_group->read_signals(signal_config));
+    ASSERT_EQ(2ULL, service_config.size());
+    EXPECT_EQ("signal1", std::string(service_config[0].name));
+    EXPECT_EQ(0, service_config[0].domain_type);
+    EXPECT_EQ(0, service_config[0].domain_idx);
+    EXPECT_EQ("signal2", std::string(service_config[1].name));
+    EXPECT_EQ(1, service_config[1].domain_type);
+    EXPECT_EQ(1, service_config[1].domain_idx);
+
+    GEOPM_EXPECT_THROW_MESSAGE(m_serviceio_group->read_signals({geopm_request_s {0, 0, "NUM_VACUUM_TUBES"}}),
+                               GEOPM_ERROR_INVALID,
+                               "ServiceIOGroup::read_signals(): signal name \"NUM_VACUUM_TUBES\" not found");
+    GEOPM_EXPECT_THROW_MESSAGE(m_serviceio_group->read_signals({geopm_request_s {0, 80, "signal1"}}),
+                               GEOPM_ERROR_INVALID,
+                               "ServiceIOGroup::read_signals(): domain_idx out of range");
+}
+
+TEST_F(ServiceIOGroupTest, write_controls)
+{
+    std::vector<geopm_request_s> control_config = {
+        geopm_request_s {0, 0, "control1"},
+        geopm_request_s {1, 1, "SERVICE::control2"}};
+    std::vector<double> settings = {42, 7};
+    std::vector<geopm_request_s> service_config;
+    EXPECT_CALL(*m_proxy, platform_write_controls(_, settings))
+        .WillOnce(SaveArg<0>(&service_config));
+    m_serviceio_group->write_controls(control_config, settings);
+    ASSERT_EQ(2ULL, service_config.size());
+    EXPECT_EQ("control1", std::string(service_config[0].name));
+    EXPECT_EQ("control2", std::string(service_config[1].name));
+    EXPECT_EQ(1, service_config[1].domain_type);
+    EXPECT_EQ(1, service_config[1].domain_idx);
+
+    GEOPM_EXPECT_THROW_MESSAGE(m_serviceio_group->write_controls(control_config, {42}),
+                               GEOPM_ERROR_INVALID,
+                               "number of settings does not match");
+    GEOPM_EXPECT_THROW_MESSAGE(m_serviceio_group->write_controls({geopm_request_s {80, 0, "control1"}}, {1}),
+                               GEOPM_ERROR_INVALID,
+                               "ServiceIOGroup::write_controls(): domain_type");
+}
+
 TEST_F(ServiceIOGroupTest, valid_signal_aggregation)
 {
     std::function<double(const std::vector<double> &)> func;
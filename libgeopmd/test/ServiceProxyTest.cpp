@@ -3,6 +3,7 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <cmath>
 #include <memory>
 
 #include "geopm/ServiceProxy.hpp"
@@ -257,6 +258,135 @@ TEST_F(ServiceProxyTest, platform_write_control)
     m_proxy->platform_write_control("frequency", 1, 2, 1.0e9);
 }
 
+TEST_F(ServiceProxyTest, platform_read_signals)
+{
+    std::vector<geopm_request_s> signal_config = {geopm_request_s {1, 0, "CPU_FREQUENCY"},
+                                                  geopm_request_s {2, 1, "TEMPERATURE"}};
+    EXPECT_CALL(*m_bus, make_call_message("PlatformReadSignals"))
+        .WillOnce(Return(m_bus_message));
+    EXPECT_CALL(*m_bus_message,
+                open_container(SDBusMessage::M_MESSAGE_TYPE_ARRAY, "(iis)"));
+    EXPECT_CALL(*m_bus_message, append_request(_))
+        .Times(2);
+    EXPECT_CALL(*m_bus_message, close_container());
+    std::shared_ptr<SDBusMessage> bus_message_ptr = m_bus_message;
+    EXPECT_CALL(*m_bus, call_method(bus_message_ptr))
+        .WillOnce(Return(m_bus_reply));
+    EXPECT_CALL(*m_bus_reply,
+                enter_container(SDBusMessage::M_MESSAGE_TYPE_ARRAY, "d"));
+    EXPECT_CALL(*m_bus_reply, read_double())
+        .WillOnce(Return(2.0e9))
+        .WillOnce(Return(45.0))
+        .WillOnce(Return(NAN));
+    EXPECT_CALL(*m_bus_reply, was_success())
+        .WillOnce(Return(true))
+        .WillOnce(Return(true))
+        .WillOnce(Return(false));
+    EXPECT_CALL(*m_bus_reply, exit_container());
+    // No per-signal round trips
+    EXPECT_CALL(*m_bus, call_method("PlatformReadSignal", _, _, _))
+        .Times(0);
+    std::vector<double> expect = {2.0e9, 45.0};
+    EXPECT_EQ(expect, m_proxy->platform_read_signals(signal_config));
+    EXPECT_TRUE(m_proxy->platform_read_signals({}).empty());
+}
+
+TEST_F(ServiceProxyTest, platform_read_signals_fallback)
+{
+    std::vector<geopm_request_s> signal_config = {geopm_request_s {1, 0, "CPU_FREQUENCY"},
+                                                  geopm_request_s {2, 1, "TEMPERATURE"}};
+    EXPECT_CALL(*m_bus, make_call_message("PlatformReadSignals"))
+        .WillOnce(Return(m_bus_message));
+    EXPECT_CALL(*m_bus_message, open_container(_, _));
+    EXPECT_CALL(*m_bus_message, append_request(_))
+        .Times(2);
+    EXPECT_CALL(*m_bus_message, close_container());
+    std::shared_ptr<SDBusMessage> bus_message_ptr = m_bus_message;
+    EXPECT_CALL(*m_bus, call_method(bus_message_ptr))
+        .WillOnce(testing::Throw(geopm::Exception("Unknown method",
+                                                  GEOPM_ERROR_NOT_IMPLEMENTED,
+                                                  __FILE__, __LINE__)));
+    // Service without vector support is remembered: each later call
+    // goes straight to PlatformReadSignal
+    EXPECT_CALL(*m_bus, call_method("PlatformReadSignal", "CPU_FREQUENCY", 1, 0))
+        .Times(2)
+        .WillRepeatedly(Return(m_bus_reply));
+    EXPECT_CALL(*m_bus, call_method("PlatformReadSignal", "TEMPERATURE", 2, 1))
+        .Times(2)
+        .WillRepeatedly(Return(m_bus_reply));
+    EXPECT_CALL(*m_bus_reply, read_double())
+        .WillOnce(Return(2.0e9))
+        .WillOnce(Return(45.0))
+        .WillOnce(Return(2.1e9))
+        .WillOnce(Return(46.0));
+    std::vector<double> expect = {2.0e9, 45.0};
+    EXPECT_EQ(expect, m_proxy->platform_read_signals(signal_config));
+    expect = {2.1e9, 46.0};
+    EXPECT_EQ(expect, m_proxy->platform_read_signals(signal_config));
+}
+
+TEST_F(ServiceProxyTest, platform_read_signals_error)
+{
+    std::vector<geopm_request_s> signal_config = {geopm_request_s {1, 0, "CPU_FREQUENCY"}};
+    EXPECT_CALL(*m_bus, make_call_message("PlatformReadSignals"))
+        .WillOnce(Return(m_bus_message));
+    EXPECT_CALL(*m_bus_message, open_container(_, _));
+    EXPECT_CALL(*m_bus_message, append_request(_));
+    EXPECT_CALL(*m_bus_message, close_container());
+    std::shared_ptr<SDBusMessage> bus_message_ptr = m_bus_message;
+    EXPECT_CALL(*m_bus, call_method(bus_message_ptr))
+        .WillOnce(testing::Throw(geopm::Exception("Access denied",
+                                                  GEOPM_ERROR_RUNTIME,
+                                                  __FILE__, __LINE__)));
+    EXPECT_CALL(*m_bus, call_method("PlatformReadSignal", _, _, _))
+        .Times(0);
+    GEOPM_EXPECT_THROW_MESSAGE(m_proxy->platform_read_signals(signal_config),
+                               GEOPM_ERROR_RUNTIME, "Access denied");
+}
+
+TEST_F(ServiceProxyTest, platform_write_controls)
+{
+    std::vector<geopm_request_s> control_config = {geopm_request_s {1, 0, "MAX_CPU_FREQUENCY"},
+                                                   geopm_request_s {1, 1, "MAX_CPU_FREQUENCY"}};
+    std::vector<double> settings = {1.0e9, 1.5e9};
+    EXPECT_CALL(*m_bus, make_call_message("PlatformWriteControls"))
+        .WillOnce(Return(m_bus_message));
+    EXPECT_CALL(*m_bus_message,
+                open_container(SDBusMessage::M_MESSAGE_TYPE_ARRAY, "(iisd)"));
+    EXPECT_CALL(*m_bus_message, append_request_setting(_, 1.0e9));
+    EXPECT_CALL(*m_bus_message, append_request_setting(_, 1.5e9));
+    EXPECT_CALL(*m_bus_message, close_container());
+    std::shared_ptr<SDBusMessage> bus_message_ptr = m_bus_message;
+    EXPECT_CALL(*m_bus, call_method(bus_message_ptr))
+        .WillOnce(Return(m_bus_reply));
+    EXPECT_CALL(*m_bus, call_method("PlatformWriteControl", _, _, _, _))
+        .Times(0);
+    m_proxy->platform_write_controls(control_config, settings);
+    GEOPM_EXPECT_THROW_MESSAGE(m_proxy->platform_write_controls(control_config, {1.0e9}),
+                               GEOPM_ERROR_INVALID, "number of settings");
+}
+
+TEST_F(ServiceProxyTest, platform_write_controls_fallback)
+{
+    std::vector<geopm_request_s> control_config = {geopm_request_s {1, 0, "MAX_CPU_FREQUENCY"},
+                                                   geopm_request_s {1, 1, "MAX_CPU_FREQUENCY"}};
+    std::vector<double> settings = {1.0e9, 1.5e9};
+    EXPECT_CALL(*m_bus, make_call_message("PlatformWriteControls"))
+        .WillOnce(Return(m_bus_message));
+    EXPECT_CALL(*m_bus_message, open_container(_, _));
+    EXPECT_CALL(*m_bus_message, append_request_setting(_, _))
+        .Times(2);
+    EXPECT_CALL(*m_bus_message, close_container());
+    std::shared_ptr<SDBusMessage> bus_message_ptr = m_bus_message;
+    EXPECT_CALL(*m_bus, call_method(bus_message_ptr))
+        .WillOnce(testing::Throw(geopm::Exception("Unknown method",
+                                                  GEOPM_ERROR_NOT_IMPLEMENTED,
+                                                  __FILE__, __LINE__)));
+    EXPECT_CALL(*m_bus, call_method("PlatformWriteControl", "MAX_CPU_FREQUENCY", 1, 0, 1.0e9));
+    EXPECT_CALL(*m_bus, call_method("PlatformWriteControl", "MAX_CPU_FREQUENCY", 1, 1, 1.5e9));
+    m_proxy->platform_write_controls(control_config, settings);
+}
+
 TEST_F(ServiceProxyTest, platform_restore_control)
 {
     EXPECT_CALL(*m_bus, call_method("PlatformRestoreControl"));